@@ -13,6 +13,7 @@
 #include <type_traits>
 
 #include "storm-cli-utilities/model-handling.h"
+#include "storm-cli-utilities/model-server.h"
 
 // Includes for the linked libraries and versions header.
 #include "storm/adapters/IntelTbbAdapter.h"
@@ -248,6 +249,12 @@ void processOptions() {
     // Start by setting some urgent options (log levels, resources, etc.)
     setUrgentOptions();
 
+    // In server mode, models and properties are received via a socket.
+    if (storm::settings::getModule<storm::settings::modules::IOSettings>().isServerSet()) {
+        runServer();
+        return;
+    }
+
     // Parse symbolic input (PRISM, JANI, properties, etc.)
     SymbolicInput symbolicInput = parseSymbolicInput();
 
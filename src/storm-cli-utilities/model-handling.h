@@ -461,6 +461,7 @@ std::shared_ptr<storm::models::ModelBase> buildModelSparse(SymbolicInput const&
         options.setExplorationChecks();
     }
     options.setReservedBitsForUnboundedVariables(buildSettings.getBitsForUnboundedVariables());
+    options.setNumberOfExplorationThreads(buildSettings.getNumberOfExplorationThreads());
 
     options.setAddOutOfBoundsState(buildSettings.isBuildOutOfBoundsStateSet());
     if (buildSettings.isBuildFullModelSet()) {
@@ -490,7 +491,10 @@ std::shared_ptr<storm::models::ModelBase> buildModelExplicit(storm::settings::mo
     } else if (ioSettings.isExplicitDRNSet()) {
         storm::parser::DirectEncodingParserOptions options;
         options.buildChoiceLabeling = buildSettings.isBuildChoiceLabelsSet();
+        options.numberOfThreads = storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads();
         result = storm::api::buildExplicitDRNModel<ValueType>(ioSettings.getExplicitDRNFilename(), options);
+    } else if (ioSettings.isExplicitBinarySet()) {
+        result = storm::api::buildExplicitBinaryModel<ValueType>(ioSettings.getExplicitBinaryFilename());
     } else {
         STORM_LOG_THROW(ioSettings.isExplicitIMCASet(), storm::exceptions::InvalidSettingsException, "Unexpected explicit model input type.");
         result = storm::api::buildExplicitIMCAModel<ValueType>(ioSettings.getExplicitIMCAFilename());
@@ -512,7 +516,7 @@ std::shared_ptr<storm::models::ModelBase> buildModel(SymbolicInput const& input,
         } else if (builderType == storm::builder::BuilderType::Explicit) {
             result = buildModelSparse<ValueType>(input, buildSettings);
         }
-    } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitIMCASet()) {
+    } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitBinarySet() || ioSettings.isExplicitIMCASet()) {
         STORM_LOG_THROW(mpi.engine == storm::utility::Engine::Sparse, storm::exceptions::InvalidSettingsException,
                         "Can only use sparse engine with explicit input.");
         result = buildModelExplicit<ValueType>(ioSettings, buildSettings);
@@ -620,6 +624,9 @@ void exportSparseModel(std::shared_ptr<storm::models::sparse::Model<ValueType>>
             case storm::exporter::ModelExportFormat::Json:
                 storm::api::exportSparseModelAsJson(model, ioSettings.getExportBuildFilename());
                 break;
+            case storm::exporter::ModelExportFormat::Binary:
+                storm::api::exportSparseModelAsBinary(model, ioSettings.getExportBuildFilename());
+                break;
             default:
                 STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
                                 "Exporting sparse models in " << storm::exporter::toString(ioSettings.getExportBuildFormat()) << " format is not supported.");
@@ -1095,20 +1102,41 @@ template<typename ValueType>
 void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
     auto sparseModel = model->as<storm::models::sparse::Model<ValueType>>();
     auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
-    auto verificationCallback = [&sparseModel, &ioSettings, &mpi](std::shared_ptr<storm::logic::Formula const> const& formula,
-                                                                  std::shared_ptr<storm::logic::Formula const> const& states) {
+
+    // In batch mode, several properties on an MDP are checked by the same model checker such that precomputations are shared.
+    std::shared_ptr<storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<ValueType>>> batchModelChecker;
+    if constexpr (!std::is_same<ValueType, storm::RationalFunction>::value) {
+        if (storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isBatchSet() &&
+            sparseModel->isOfType(storm::models::ModelType::Mdp) && input.properties.size() > 1) {
+            batchModelChecker = std::make_shared<storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<ValueType>>>(
+                *sparseModel->template as<storm::models::sparse::Mdp<ValueType>>());
+            batchModelChecker->enablePrecomputationCache();
+        }
+    }
+    auto verifyTask = [&sparseModel, &mpi, &batchModelChecker](storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+        std::unique_ptr<storm::modelchecker::CheckResult> result;
+        if (!batchModelChecker) {
+            result = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, task);
+        } else if (batchModelChecker->canHandle(task)) {
+            result = batchModelChecker->check(mpi.env, task);
+        }
+        return result;
+    };
+
+    auto verificationCallback = [&sparseModel, &ioSettings, &verifyTask](std::shared_ptr<storm::logic::Formula const> const& formula,
+                                                                         std::shared_ptr<storm::logic::Formula const> const& states) {
         bool filterForInitialStates = states->isInitialFormula();
         auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
         if (ioSettings.isExportSchedulerSet()) {
             task.setProduceSchedulers(true);
         }
-        std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, task);
+        std::unique_ptr<storm::modelchecker::CheckResult> result = verifyTask(task);
 
         std::unique_ptr<storm::modelchecker::CheckResult> filter;
         if (filterForInitialStates) {
             filter = std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(sparseModel->getInitialStates());
         } else {
-            filter = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, storm::api::createTask<ValueType>(states, false));
+            filter = verifyTask(storm::api::createTask<ValueType>(states, false));
         }
         if (result && filter) {
             result->filter(filter->asQualitativeCheckResult());
@@ -1186,6 +1214,12 @@ void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& mod
 
 template<storm::dd::DdType DdType, typename ValueType>
 void verifyWithHybridEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
+    if (input.properties.size() > 1) {
+        // Properties that lead to the same maybe states can share the conversion to the explicit representation. Keep the conversions of
+        // a few matrices of the size of the model.
+        auto symbolicModel = model->as<storm::models::symbolic::Model<DdType, ValueType>>();
+        symbolicModel->setExplicitRepresentationCacheCapacity(4 * symbolicModel->getNumberOfTransitions());
+    }
     verifyProperties<ValueType>(
         input, [&model, &mpi](std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
             bool filterForInitialStates = states->isInitialFormula();
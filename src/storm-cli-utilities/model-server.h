@@ -0,0 +1,359 @@
+#pragma once
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <map>
+#include <sstream>
+#include <string>
+
+#include "storm-cli-utilities/model-handling.h"
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+namespace cli {
+
+/*!
+ * A model that is kept in memory by the server (see runServer).
+ */
+struct ServerModel {
+    // The symbolic description of the model (if the model was not loaded from an explicit file).
+    SymbolicInput input;
+
+    // The constant definitions that are substituted in the properties.
+    std::map<storm::expressions::Variable, storm::expressions::Expression> constantDefinitions;
+
+    // The built model.
+    std::shared_ptr<storm::models::sparse::Model<double>> model;
+
+    // For MDPs, a model checker that is shared among the properties of a request such that qualitative precomputations are reused.
+    std::shared_ptr<storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>>> mdpModelChecker;
+};
+
+ServerModel loadServerModel(storm::json<double> const& request) {
+    auto buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+
+    ServerModel result;
+    if (request.contains("drn")) {
+        result.model = storm::api::buildExplicitDRNModel<double>(request.at("drn").get<std::string>());
+    } else {
+        if (request.contains("prism")) {
+            result.input.model = storm::api::parseProgram(request.at("prism").get<std::string>(), buildSettings.isPrismCompatibilityEnabled(),
+                                                          !buildSettings.isNoSimplifySet());
+        } else {
+            STORM_LOG_THROW(request.contains("jani"), storm::exceptions::InvalidArgumentException, "The request does not specify an input model.");
+            result.input.model = storm::api::parseJaniModel(request.at("jani").get<std::string>(), std::vector<std::string>()).first;
+        }
+        result.constantDefinitions = result.input.model->parseConstantDefinitions(request.value("constants", std::string()));
+        result.input.model = result.input.model->preprocess(result.constantDefinitions);
+        if (result.input.model->isJaniModel()) {
+            storm::api::simplifyJaniModel(result.input.model->asJaniModel(), result.input.properties,
+                                          storm::api::getSupportedJaniFeatures(storm::builder::BuilderType::Explicit));
+        }
+
+        // As the properties are not known in advance, all labels and reward models are built.
+        storm::builder::BuilderOptions options(std::vector<std::shared_ptr<storm::logic::Formula const>>(), result.input.model.get());
+        options.setBuildAllLabels(true);
+        options.setBuildAllRewardModels(true);
+        options.setBuildChoiceLabels(options.isBuildChoiceLabelsSet() || buildSettings.isBuildChoiceLabelsSet());
+        options.setBuildStateValuations(options.isBuildStateValuationsSet() || buildSettings.isBuildStateValuationsSet());
+        options.setReservedBitsForUnboundedVariables(buildSettings.getBitsForUnboundedVariables());
+        options.setNumberOfExplorationThreads(buildSettings.getNumberOfExplorationThreads());
+        result.model = storm::api::buildSparseModel<double>(result.input.model.get(), options);
+    }
+
+    ModelProcessingInformation mpi;
+    mpi.engine = storm::utility::Engine::Sparse;
+    mpi.applyBisimulation = false;
+    auto preprocessingResult = preprocessSparseModel<double>(result.model, result.input, mpi);
+    if (preprocessingResult.second) {
+        result.model = preprocessingResult.first;
+    }
+    result.model->printModelInformationToStream(std::cout);
+
+    if (result.model->isOfType(storm::models::ModelType::Mdp)) {
+        result.mdpModelChecker = std::make_shared<storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>>>(
+            *result.model->as<storm::models::sparse::Mdp<double>>());
+    }
+    return result;
+}
+
+std::unique_ptr<storm::modelchecker::CheckResult> verifyOnServerModel(ServerModel const& serverModel,
+                                                                      storm::modelchecker::CheckTask<storm::logic::Formula, double> const& task) {
+    storm::Environment env;
+    if (serverModel.mdpModelChecker && serverModel.mdpModelChecker->canHandle(task)) {
+        return serverModel.mdpModelChecker->check(env, task);
+    }
+    return storm::api::verifyWithSparseEngine<double>(env, serverModel.model, task);
+}
+
+/*!
+ * Converts the given (already filtered) result to json, applying the given filter type in the same way as printFilteredResult.
+ */
+storm::json<double> filteredResultToJson(std::unique_ptr<storm::modelchecker::CheckResult> const& result, storm::modelchecker::FilterType ft) {
+    if (result->isQuantitative()) {
+        auto const& quantitativeResult = result->asQuantitativeCheckResult<double>();
+        switch (ft) {
+            case storm::modelchecker::FilterType::VALUES:
+                return result->asExplicitQuantitativeCheckResult<double>().toJson();
+            case storm::modelchecker::FilterType::SUM:
+                return quantitativeResult.sum();
+            case storm::modelchecker::FilterType::AVG:
+                return quantitativeResult.average();
+            case storm::modelchecker::FilterType::MIN:
+                return quantitativeResult.getMin();
+            case storm::modelchecker::FilterType::MAX:
+                return quantitativeResult.getMax();
+            case storm::modelchecker::FilterType::ARGMIN:
+            case storm::modelchecker::FilterType::ARGMAX:
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Outputting states is not supported.");
+            default:
+                STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Filter type only defined for qualitative results.");
+        }
+    } else {
+        switch (ft) {
+            case storm::modelchecker::FilterType::VALUES:
+                return result->asExplicitQualitativeCheckResult().toJson<double>();
+            case storm::modelchecker::FilterType::EXISTS:
+                return result->asQualitativeCheckResult().existsTrue();
+            case storm::modelchecker::FilterType::FORALL:
+                return result->asQualitativeCheckResult().forallTrue();
+            case storm::modelchecker::FilterType::COUNT:
+                return result->asQualitativeCheckResult().count();
+            case storm::modelchecker::FilterType::ARGMIN:
+            case storm::modelchecker::FilterType::ARGMAX:
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Outputting states is not supported.");
+            default:
+                STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Filter type only defined for quantitative results.");
+        }
+    }
+}
+
+/*!
+ * Writes the given answer as a single line to the given connection.
+ */
+void sendServerAnswer(int connection, storm::json<double> const& answer) {
+    std::string line = answer.dump() + "\n";
+    char const* data = line.data();
+    uint64_t remaining = line.size();
+    while (remaining > 0) {
+        ssize_t written = send(connection, data, remaining, MSG_NOSIGNAL);
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        STORM_LOG_THROW(written > 0, storm::exceptions::FileIoException, "Unable to write to the server connection: " << std::strerror(errno) << ".");
+        data += written;
+        remaining -= written;
+    }
+}
+
+/*!
+ * Checks the properties given in the request on the model and sends one answer per property as soon as it has been checked.
+ */
+void checkOnServerModel(ServerModel const& serverModel, storm::json<double> const& request, storm::json<double> const& answerTemplate,
+                        std::function<void(storm::json<double> const&)> const& sendAnswer) {
+    std::string propertyString = request.at("properties").get<std::string>();
+    std::vector<storm::jani::Property> properties;
+    if (serverModel.input.model) {
+        properties = storm::api::parsePropertiesForSymbolicModelDescription(propertyString, serverModel.input.model.get());
+        properties = storm::api::substituteConstantsInProperties(properties, serverModel.constantDefinitions);
+    } else {
+        properties = storm::api::parseProperties(propertyString);
+    }
+    ensureNoUndefinedPropertyConstants(properties);
+
+    // The precomputations are only shared among the properties of this request such that a long-running server does not accumulate them.
+    if (serverModel.mdpModelChecker) {
+        serverModel.mdpModelChecker->disablePrecomputationCache();
+        if (properties.size() > 1) {
+            serverModel.mdpModelChecker->enablePrecomputationCache();
+        }
+    }
+
+    for (auto const& property : properties) {
+        storm::json<double> answer = answerTemplate;
+        answer["property"] = property.getName();
+        storm::utility::Stopwatch watch(true);
+        try {
+            auto const& states = property.getFilter().getStatesFormula();
+            bool filterForInitialStates = states->isInitialFormula();
+            std::unique_ptr<storm::modelchecker::CheckResult> result =
+                verifyOnServerModel(serverModel, storm::api::createTask<double>(property.getRawFormula(), filterForInitialStates));
+            STORM_LOG_THROW(result, storm::exceptions::NotSupportedException, "Property is unsupported by the sparse engine.");
+            std::unique_ptr<storm::modelchecker::CheckResult> filter;
+            if (filterForInitialStates) {
+                filter = std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(serverModel.model->getInitialStates());
+            } else {
+                filter = verifyOnServerModel(serverModel, storm::api::createTask<double>(states, false));
+            }
+            STORM_LOG_THROW(filter && filter->isQualitative(), storm::exceptions::NotSupportedException,
+                            "The states of the filter " << *states << " can not be computed by the sparse engine.");
+            result->filter(filter->asQualitativeCheckResult());
+            answer["result"] = filteredResultToJson(result, property.getFilter().getFilterType());
+        } catch (storm::exceptions::BaseException const& ex) {
+            answer["error"] = ex.what();
+        }
+        watch.stop();
+        answer["time"] = watch.getTimeInMilliseconds();
+        sendAnswer(answer);
+    }
+
+    if (serverModel.mdpModelChecker) {
+        serverModel.mdpModelChecker->disablePrecomputationCache();
+    }
+}
+
+/*!
+ * Handles a single request and returns false iff the server is to be shut down.
+ */
+bool handleServerRequest(std::map<std::string, ServerModel>& models, std::string const& line,
+                         std::function<void(storm::json<double> const&)> const& sendAnswer) {
+    storm::json<double> answer;
+    bool keepRunning = true;
+    try {
+        storm::json<double> request = storm::json<double>::parse(line);
+        if (request.contains("id")) {
+            answer["id"] = request.at("id");
+        }
+        std::string command = request.at("command").get<std::string>();
+        STORM_LOG_INFO("Server received request '" << command << "'.");
+        if (command == "load") {
+            storm::utility::Stopwatch watch(true);
+            models[request.at("model").get<std::string>()] = loadServerModel(request);
+            watch.stop();
+            answer["time"] = watch.getTimeInMilliseconds();
+        } else if (command == "check") {
+            auto modelIt = models.find(request.at("model").get<std::string>());
+            STORM_LOG_THROW(modelIt != models.end(), storm::exceptions::InvalidArgumentException,
+                            "Unknown model '" << request.at("model").get<std::string>() << "'.");
+            checkOnServerModel(modelIt->second, request, answer, sendAnswer);
+        } else if (command == "unload") {
+            STORM_LOG_THROW(models.erase(request.at("model").get<std::string>()) > 0, storm::exceptions::InvalidArgumentException,
+                            "Unknown model '" << request.at("model").get<std::string>() << "'.");
+        } else if (command == "list") {
+            answer["models"] = storm::json<double>::array();
+            for (auto const& nameModel : models) {
+                storm::json<double> entry;
+                entry["model"] = nameModel.first;
+                std::stringstream modelType;
+                modelType << nameModel.second.model->getType();
+                entry["type"] = modelType.str();
+                entry["states"] = nameModel.second.model->getNumberOfStates();
+                entry["transitions"] = nameModel.second.model->getNumberOfTransitions();
+                answer["models"].push_back(std::move(entry));
+            }
+        } else if (command == "shutdown") {
+            keepRunning = false;
+        } else {
+            STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Unknown command '" << command << "'.");
+        }
+    } catch (storm::exceptions::BaseException const& ex) {
+        answer["error"] = ex.what();
+    } catch (std::exception const& ex) {
+        // Malformed requests are reported by the json library.
+        answer["error"] = ex.what();
+    }
+    answer["done"] = true;
+    sendAnswer(answer);
+    return keepRunning;
+}
+
+/*!
+ * Listens on the socket given by the settings and answers requests until a shutdown request is received.
+ * Connections are handled one after another and requests of a connection are handled in the order in which they were received.
+ *
+ * The server keeps built models in memory such that many properties can be checked on them without rebuilding. Properties of the
+ * same request on an MDP share qualitative analyses. Clients connect to a UNIX domain socket and send requests as JSON objects, one per line.
+ * Each request is answered by one or more JSON lines, the last of which has the field "done". Supported requests are
+ *
+ *   {"command": "load", "model": <name>, "prism"|"jani"|"drn": <file>, "constants": <definitions>}
+ *   {"command": "check", "model": <name>, "properties": <properties>}
+ *   {"command": "unload", "model": <name>}
+ *   {"command": "list"}
+ *   {"command": "shutdown"}
+ *
+ * An optional field "id" of a request is copied to all of its answers. For each property of a check request, one answer with the
+ * (filtered) result is sent as soon as the property has been checked. Only the sparse engine with finite precision arithmetic is supported.
+ */
+void runServer() {
+    auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
+    std::string socketPath = ioSettings.getServerSocket();
+
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    STORM_LOG_THROW(socketPath.size() < sizeof(address.sun_path), storm::exceptions::InvalidArgumentException,
+                    "The socket path '" << socketPath << "' is too long.");
+    std::strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+
+    // Remove a stale socket of a previous run, but never delete other files.
+    struct stat socketStat;
+    if (lstat(socketPath.c_str(), &socketStat) == 0) {
+        STORM_LOG_THROW(S_ISSOCK(socketStat.st_mode), storm::exceptions::FileIoException,
+                        "Unable to listen on socket '" << socketPath << "': The path exists and is not a socket.");
+        unlink(socketPath.c_str());
+    }
+
+    int serverSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+    STORM_LOG_THROW(serverSocket >= 0, storm::exceptions::FileIoException, "Unable to create socket: " << std::strerror(errno) << ".");
+    if (bind(serverSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(serverSocket, 8) != 0) {
+        std::string error = std::strerror(errno);
+        close(serverSocket);
+        STORM_LOG_THROW(false, storm::exceptions::FileIoException, "Unable to listen on socket '" << socketPath << "': " << error << ".");
+    }
+    STORM_PRINT_AND_LOG("Server is listening on socket '" << socketPath << "'.\n");
+
+    std::map<std::string, ServerModel> models;
+    bool keepRunning = true;
+    while (keepRunning && !storm::utility::resources::isTerminate()) {
+        int connection = accept(serverSocket, nullptr, nullptr);
+        if (connection < 0) {
+            STORM_LOG_WARN_COND(errno == EINTR, "Unable to accept connection: " << std::strerror(errno) << ".");
+            continue;
+        }
+        auto sendAnswer = [connection](storm::json<double> const& answer) { sendServerAnswer(connection, answer); };
+
+        std::string buffer;
+        char chunk[4096];
+        try {
+            while (keepRunning) {
+                std::size_t lineEnd = buffer.find('\n');
+                if (lineEnd == std::string::npos) {
+                    ssize_t received = recv(connection, chunk, sizeof(chunk), 0);
+                    if (received < 0 && errno == EINTR) {
+                        continue;
+                    } else if (received <= 0) {
+                        // The client closed the connection.
+                        break;
+                    }
+                    buffer.append(chunk, received);
+                    continue;
+                }
+                std::string line = buffer.substr(0, lineEnd);
+                buffer.erase(0, lineEnd + 1);
+                if (line.find_first_not_of(" \t\r") != std::string::npos) {
+                    keepRunning = handleServerRequest(models, line, sendAnswer);
+                }
+            }
+        } catch (storm::exceptions::FileIoException const& ex) {
+            STORM_LOG_WARN("Lost connection to client: " << ex.what());
+        }
+        close(connection);
+    }
+
+    close(serverSocket);
+    if (lstat(socketPath.c_str(), &socketStat) == 0 && S_ISSOCK(socketStat.st_mode)) {
+        unlink(socketPath.c_str());
+    }
+    STORM_PRINT_AND_LOG("Server stopped.\n");
+}
+
+}  // namespace cli
+}  // namespace storm
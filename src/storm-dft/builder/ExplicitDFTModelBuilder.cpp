@@ -41,6 +41,7 @@ ExplicitDFTModelBuilder<ValueType, StateType>::ExplicitDFTModelBuilder(storm::df
       generator(dft, *stateGenerationInfo),
       matrixBuilder(!generator.isDeterministicModel()),
       stateStorage(dft.stateBitVectorSize()),
+      statePool(dft.stateBitVectorSize()),
       explorationQueue(1, 0, 0.9, false) {
     // Set relevant events
     STORM_LOG_DEBUG("Relevant events: " << this->dft.getRelevantEventsString());
@@ -188,7 +189,7 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::buildModel(size_t iteration,
         }
 
         // Initialize heuristic values for inital state
-        STORM_LOG_ASSERT(!statesNotExplored.at(initialStateIndex).second, "Heuristic for initial state is already initialized");
+        STORM_LOG_ASSERT(!statesNotExplored.at(initialStateIndex).heuristic, "Heuristic for initial state is already initialized");
         ExplorationHeuristicPointer heuristic;
         switch (usedHeuristic) {
             case storm::dft::builder::ApproximationHeuristic::DEPTH:
@@ -204,7 +205,7 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::buildModel(size_t iteration,
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
         }
         heuristic->markExpand();
-        statesNotExplored[initialStateIndex].second = heuristic;
+        statesNotExplored[initialStateIndex].heuristic = heuristic;
         explorationQueue.push(heuristic);
     } else {
         initializeNextIteration();
@@ -266,8 +267,8 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::initializeNextIteration() {
     // Push skipped states to explore queue
     // TODO: remove
     for (auto const& skippedState : skippedStates) {
-        statesNotExplored[skippedState.second.first->getId()] = skippedState.second;
-        explorationQueue.push(skippedState.second.second);
+        statesNotExplored[skippedState.second.id] = skippedState.second;
+        explorationQueue.push(skippedState.second.heuristic);
     }
 
     // Initialize matrix builder again
@@ -296,7 +297,7 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::initializeNextIteration() {
     matrixBuilder.mappingOffset = nrStates;
     STORM_LOG_TRACE("# expanded states: " << nrExpandedStates);
     StateType skippedIndex = nrExpandedStates;
-    std::map<StateType, std::pair<DFTStatePointer, ExplorationHeuristicPointer>> skippedStatesNew;
+    std::map<StateType, UnexploredState> skippedStatesNew;
     for (size_t id = 0; id < matrixBuilder.stateRemapping.size(); ++id) {
         StateType index = matrixBuilder.getRemapping(id);
         auto itFind = skippedStates.find(index);
@@ -346,7 +347,7 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::initializeNextIteration() {
                     auto itFind = skippedStates.find(itEntry->getColumn());
                     if (itFind != skippedStates.end()) {
                         // Set id for skipped states as we remap it later
-                        matrixBuilder.addTransition(matrixBuilder.mappingOffset + itFind->second.first->getId(), itEntry->getValue());
+                        matrixBuilder.addTransition(matrixBuilder.mappingOffset + itFind->second.id, itEntry->getValue());
                     } else {
                         // Set newly remapped index for expanded states
                         matrixBuilder.addTransition(indexRemapping[itEntry->getColumn()], itEntry->getValue());
@@ -376,21 +377,17 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpace(double app
         StateType currentId = currentExplorationHeuristic->getId();
         auto itFind = statesNotExplored.find(currentId);
         STORM_LOG_ASSERT(itFind != statesNotExplored.end(), "Id " << currentId << " not found");
-        DFTStatePointer currentState = itFind->second.first;
-        STORM_LOG_ASSERT(currentExplorationHeuristic == itFind->second.second, "Exploration heuristics do not match");
-        STORM_LOG_ASSERT(currentState->getId() == currentId, "Ids do not match");
+        UnexploredState currentEntry = itFind->second;
+        STORM_LOG_ASSERT(currentExplorationHeuristic == currentEntry.heuristic, "Exploration heuristics do not match");
+        STORM_LOG_ASSERT(currentEntry.id == currentId, "Ids do not match");
         // Remove it from the list of not explored states
         statesNotExplored.erase(itFind);
+
+        // Get concrete state
+        DFTStatePointer currentState = createConcreteState(currentEntry);
         STORM_LOG_ASSERT(stateStorage.stateToId.contains(currentState->status()), "State is not contained in state storage.");
         STORM_LOG_ASSERT(stateStorage.stateToId.getValue(currentState->status()) == currentId, "Ids of states do not coincide.");
 
-        // Get concrete state if necessary
-        if (currentState->isPseudoState()) {
-            // Create concrete state from pseudo state
-            currentState->construct();
-        }
-        STORM_LOG_ASSERT(!currentState->isPseudoState(), "State is pseudo state.");
-
         // Remember that the current row group was actually filled with the transitions of a different state
         matrixBuilder.setRemapping(currentId);
 
@@ -409,12 +406,14 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpace(double app
             // TODO: what to do when there is no unique target state?
             // STORM_LOG_ASSERT(this->uniqueFailedState, "Approximation only works with unique failed state");
             matrixBuilder.addTransition(0, storm::utility::zero<ValueType>());
-            // Remember skipped state
-            skippedStates[matrixBuilder.getCurrentRowGroup() - 1] = std::make_pair(currentState, currentExplorationHeuristic);
+            // Remember skipped state (its status remains in the state pool)
+            skippedStates[matrixBuilder.getCurrentRowGroup() - 1] = currentEntry;
             matrixBuilder.finishRow();
         } else {
             // Explore the current state
             ++nrExpandedStates;
+            // The status is not needed anymore as the concrete state was already created
+            statePool.release(currentEntry.handle);
             storm::generator::StateBehavior<ValueType, StateType> behavior =
                 generator.expand(std::bind(&ExplicitDFTModelBuilder::getOrAddStateIndex, this, std::placeholders::_1));
             STORM_LOG_ASSERT(!behavior.empty(), "Behavior is empty.");
@@ -431,8 +430,7 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpace(double app
                     auto iter = statesNotExplored.find(stateProbabilityPair.first);
                     if (iter != statesNotExplored.end()) {
                         // Update heuristic values
-                        DFTStatePointer state = iter->second.first;
-                        if (!iter->second.second) {
+                        if (!iter->second.heuristic) {
                             // Initialize heuristic values
                             ExplorationHeuristicPointer heuristic;
                             switch (usedHeuristic) {
@@ -452,22 +450,14 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpace(double app
                                     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
                             }
 
-                            iter->second.second = heuristic;
-                            // if (state->hasFailed(dft.getTopLevelIndex()) || state->isFailsafe(dft.getTopLevelIndex()) ||
-                            // state->getFailableElements().hasDependencies() || (!state->getFailableElements().hasDependencies() &&
-                            // !state->getFailableElements().hasBEs())) {
-                            if (state->getFailableElements().hasDependencies() ||
-                                (!state->getFailableElements().hasDependencies() && !state->getFailableElements().hasBEs())) {
+                            iter->second.heuristic = heuristic;
+                            if (iter->second.mustExpand) {
                                 // Do not skip absorbing state or if reached by dependencies
-                                iter->second.second->markExpand();
+                                heuristic->markExpand();
                             }
                             if (usedHeuristic == storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE) {
                                 // Compute bounds for heuristic now
-                                if (state->isPseudoState()) {
-                                    // Create concrete state from pseudo state
-                                    state->construct();
-                                }
-                                STORM_LOG_ASSERT(!currentState->isPseudoState(), "State is pseudo state.");
+                                DFTStatePointer state = createConcreteState(iter->second);
 
                                 // Initialize bounds
                                 // TODO: avoid hack
@@ -477,21 +467,21 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpace(double app
                             }
 
                             explorationQueue.push(heuristic);
-                        } else if (!iter->second.second->isExpand()) {
+                        } else if (!iter->second.heuristic->isExpand()) {
                             bool changedPriority = false;
-                            double oldPriority = iter->second.second->getPriority();
+                            double oldPriority = iter->second.heuristic->getPriority();
                             switch (usedHeuristic) {
                                 case storm::dft::builder::ApproximationHeuristic::DEPTH:
-                                    changedPriority = iter->second.second->updateHeuristicValues(*currentExplorationHeuristic,
+                                    changedPriority = iter->second.heuristic->updateHeuristicValues(*currentExplorationHeuristic,
                                                                                                  /* next values are irrelevant */ stateProbabilityPair.second,
                                                                                                  stateProbabilityPair.second);
                                     break;
                                 case storm::dft::builder::ApproximationHeuristic::PROBABILITY:
-                                    changedPriority = iter->second.second->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second,
+                                    changedPriority = iter->second.heuristic->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second,
                                                                                                  choice.getTotalMass());
                                     break;
                                 case storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE:
-                                    changedPriority = iter->second.second->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second,
+                                    changedPriority = iter->second.heuristic->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second,
                                                                                                  choice.getTotalMass());
                                     break;
                                 default:
@@ -499,7 +489,7 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpace(double app
                             }
                             if (changedPriority) {
                                 // Update priority queue
-                                explorationQueue.update(iter->second.second, oldPriority);
+                                explorationQueue.update(iter->second.heuristic, oldPriority);
                             }
                         }
                     }
@@ -636,7 +626,6 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> ExplicitDFTModelBuilder
             for (auto it = skippedStates.begin(); it != skippedStates.end(); ++it) {
                 auto matrixEntry = matrix.getRow(it->first, 0).begin();
                 STORM_LOG_ASSERT(matrixEntry->getColumn() == 0, "Transition has wrong target state.");
-                STORM_LOG_ASSERT(!it->second.first->isPseudoState(), "State is still pseudo state.");
                 matrixEntry->setValue(storm::utility::one<ValueType>());
                 matrixEntry->setColumn(it->first);
             }
@@ -756,14 +745,14 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::changeMatrixBound(storm::sto
     for (auto it = skippedStates.begin(); it != skippedStates.end(); ++it) {
         auto matrixEntry = matrix.getRow(it->first, 0).begin();
         STORM_LOG_ASSERT(matrixEntry->getColumn() == 0, "Transition has wrong target state.");
-        STORM_LOG_ASSERT(!it->second.first->isPseudoState(), "State is still pseudo state.");
+        DFTStatePointer state = createConcreteState(it->second);
 
         // Change bound
         // TODO: cache values inbetween iterations
         if (lowerBound) {
-            matrixEntry->setValue(getLowerBound(it->second.first));
+            matrixEntry->setValue(getLowerBound(state));
         } else {
-            matrixEntry->setValue(getUpperBound(it->second.first));
+            matrixEntry->setValue(getUpperBound(state));
         }
     }
 }
@@ -926,22 +915,6 @@ StateType ExplicitDFTModelBuilder<ValueType, StateType>::getOrAddStateIndex(DFTS
         // State already exists
         stateId = stateStorage.stateToId.getValue(state->status());
         STORM_LOG_TRACE("State " << dft.getStateString(state) << " with id " << stateId << " already exists");
-        if (!changed) {
-            // Check if state is pseudo state
-            // If state is explored already the possible pseudo state was already constructed
-            auto iter = statesNotExplored.find(stateId);
-            if (iter != statesNotExplored.end() && iter->second.first->isPseudoState()) {
-                // Create pseudo state now
-                STORM_LOG_ASSERT(iter->second.first->getId() == stateId, "Ids do not match.");
-                STORM_LOG_ASSERT(iter->second.first->status() == state->status(), "Pseudo states do not coincide.");
-                state->setId(stateId);
-                // Update mapping to map to concrete state now
-                // TODO: just change pointer?
-                statesNotExplored[stateId] = std::make_pair(state, iter->second.second);
-                // We do not push the new state on the exploration queue as the pseudo state was already pushed
-                STORM_LOG_TRACE("Created pseudo state " << dft.getStateString(state));
-            }
-        }
     } else {
         // State does not exist yet
         STORM_LOG_ASSERT(state->isPseudoState() == changed, "State type (pseudo/concrete) wrong.");
@@ -950,8 +923,11 @@ StateType ExplicitDFTModelBuilder<ValueType, StateType>::getOrAddStateIndex(DFTS
         stateId = stateStorage.stateToId.findOrAdd(state->status(), state->getId());
         STORM_LOG_ASSERT(stateId == state->getId(), "Ids do not match.");
         // Insert state as not yet explored
+        // Only the status is stored, the concrete state is created again when it is expanded.
+        // Absorbing states and states reached by dependencies are never skipped. This also holds for pseudo states as their failable elements are empty.
+        bool mustExpand = state->getFailableElements().hasDependencies() || !state->getFailableElements().hasBEs();
         ExplorationHeuristicPointer nullHeuristic;
-        statesNotExplored[stateId] = std::make_pair(state, nullHeuristic);
+        statesNotExplored[stateId] = UnexploredState{stateId, statePool.add(state->status()), mustExpand, nullHeuristic};
         // Reserve one slot for the new state in the remapping
         matrixBuilder.stateRemapping.push_back(0);
         STORM_LOG_TRACE("New " << (state->isPseudoState() ? "pseudo" : "concrete") << " state: " << dft.getStateString(state));
@@ -968,11 +944,20 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::setMarkovian(bool markovian)
     modelComponents.markovianStates.set(matrixBuilder.getCurrentRowGroup() - 1, markovian);
 }
 
+template<typename ValueType, typename StateType>
+typename ExplicitDFTModelBuilder<ValueType, StateType>::DFTStatePointer ExplicitDFTModelBuilder<ValueType, StateType>::createConcreteState(
+    UnexploredState const& state) const {
+    DFTStatePointer concreteState =
+        std::make_shared<storm::dft::storage::DFTState<ValueType>>(statePool.get(state.handle), dft, *stateGenerationInfo, state.id);
+    concreteState->construct();
+    return concreteState;
+}
+
 template<typename ValueType, typename StateType>
 void ExplicitDFTModelBuilder<ValueType, StateType>::printNotExplored() const {
     std::cout << "states not explored:\n";
     for (auto it : statesNotExplored) {
-        std::cout << it.first << " -> " << dft.getStateString(it.second.first) << '\n';
+        std::cout << it.first << " -> " << dft.getStateString(statePool.get(it.second.handle), *stateGenerationInfo, it.first) << '\n';
     }
 }
 
@@ -16,6 +16,7 @@
 #include "storm-dft/generator/DftNextStateGenerator.h"
 #include "storm-dft/storage/BucketPriorityQueue.h"
 #include "storm-dft/storage/DFT.h"
+#include "storm-dft/storage/DFTStatePool.h"
 #include "storm-dft/storage/SymmetricUnits.h"
 
 namespace storm::dft {
@@ -54,6 +55,22 @@ class ExplicitDFTModelBuilder {
         bool deterministicModel;
     };
 
+    // A state which was not yet expanded.
+    // Only the status of the state is kept in the state pool, the concrete state is created again when it is needed.
+    struct UnexploredState {
+        // Id of the state.
+        StateType id;
+
+        // Handle of the status in the state pool.
+        storm::dft::storage::DFTStatePool::Handle handle;
+
+        // A flag indicating if the state must be expanded (because it is absorbing or has failable dependencies).
+        bool mustExpand;
+
+        // The heuristic values (if already initialized).
+        ExplorationHeuristicPointer heuristic;
+    };
+
     // A class holding the information for building the transition matrix.
     class MatrixBuilder {
        public:
@@ -201,7 +218,7 @@ class ExplicitDFTModelBuilder {
     void buildLabeling();
 
     /*!
-     * Add a state to the explored states (if not already there). It also handles pseudo states.
+     * Add a state to the explored states (if not already there).
      *
      * @param state The state to add.
      *
@@ -209,6 +226,15 @@ class ExplicitDFTModelBuilder {
      */
     StateType getOrAddStateIndex(DFTStatePointer const& state);
 
+    /*!
+     * Create the concrete state for a state which was not yet expanded.
+     *
+     * @param state The unexplored state.
+     *
+     * @return Concrete state.
+     */
+    DFTStatePointer createConcreteState(UnexploredState const& state) const;
+
     /*!
      * Set markovian flag for the current state.
      *
@@ -311,17 +337,20 @@ class ExplicitDFTModelBuilder {
     // Internal information about the states that were explored.
     storm::storage::sparse::StateStorage<StateType> stateStorage;
 
+    // Compact storage of the status of all states which were not yet expanded.
+    storm::dft::storage::DFTStatePool statePool;
+
     // A priority queue of states that still need to be explored.
     storm::dft::storage::BucketPriorityQueue<ExplorationHeuristic> explorationQueue;
 
-    // A mapping of not yet explored states from the id to the tuple (state object, heuristic values).
-    std::map<StateType, std::pair<DFTStatePointer, ExplorationHeuristicPointer>> statesNotExplored;
+    // A mapping of not yet explored states from the id to the unexplored state.
+    std::map<StateType, UnexploredState> statesNotExplored;
 
     // Holds all skipped states which were not yet expanded. More concretely it is a mapping from matrix indices
     // to the corresponding skipped states.
     // Notice that we need an ordered map here to easily iterate in increasing order over state ids.
     // TODO remove again
-    std::map<StateType, std::pair<DFTStatePointer, ExplorationHeuristicPointer>> skippedStates;
+    std::map<StateType, UnexploredState> skippedStates;
 
     // List of independent subtrees and the BEs contained in them.
     std::vector<std::vector<size_t>> subtreeBEs;
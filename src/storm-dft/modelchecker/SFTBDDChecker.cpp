@@ -1,11 +1,18 @@
 #include <gmm/gmm_std.h>
 
+#include <algorithm>
+#include <functional>
 #include <memory>
+#include <numeric>
 #include <vector>
 
 #include "storm-dft/modelchecker/SFTBDDChecker.h"
 #include "storm-dft/transformations/SftToBddTransformator.h"
 #include "storm/adapters/eigen.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/utility/ThreadPool.h"
+#include "storm/utility/macros.h"
 
 namespace storm::dft {
 namespace modelchecker {
@@ -16,224 +23,272 @@ using Bdd = SFTBDDChecker::Bdd;
 namespace {
 
 /**
- * \returns
- * The probability that the bdd is true
- * given the probabilities that the variables are true.
- *
- * \param bdd
- * The bdd for which to calculate the probability
- *
- * \param indexToProbability
- * A reference to a mapping
- * that must map every variable in the bdd to a probability
+ * Evaluates the probabilities and birnbaum factors of a bdd
+ * without recursion.
  *
- * \param bddToProbability
- * A cache for common sub Bdds.
- * Must be empty or from an earlier call with a bdd that is an
- * ancestor of the current one.
+ * The nodes of the bdd are stored in a dense representation.
+ * The terminals have the indices 0 (false) and 1 (true)
+ * and all other nodes are sorted by their variable in descending order.
+ * Thus, the children of a node always have smaller indices than the node.
+ * All nodes with the same variable form a level.
+ * The nodes of a level are independent of each other
+ * and are processed in parallel
+ * using the number of threads of the core settings.
  */
-ValueType recursiveProbability(Bdd const bdd, std::map<uint32_t, ValueType> const &indexToProbability, std::map<uint64_t, ValueType> &bddToProbability) {
-    if (bdd.isOne()) {
-        return 1;
-    } else if (bdd.isZero()) {
-        return 0;
-    }
+class BddEvaluator {
+   public:
+    /**
+     * Builds the dense representation of the given bdd.
+     */
+    explicit BddEvaluator(Bdd const bdd) : maxNumberOfThreads{storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads()} {
+        // Discover all nodes with an explicit stack.
+        // Non-terminal nodes get temporary indices (starting at 2) in the order of discovery.
+        std::unordered_map<uint64_t, uint64_t> bddToIndex{};
+        std::vector<Bdd> stack{};
+        std::vector<uint32_t> discoveredVariables{};
+        std::vector<uint64_t> discoveredThenIndices{};
+        std::vector<uint64_t> discoveredElseIndices{};
+        auto const discover{[&](Bdd const &node) -> uint64_t {
+            if (node.isOne()) {
+                return 1;
+            } else if (node.isZero()) {
+                return 0;
+            }
+            auto const [it, inserted] = bddToIndex.emplace(node.GetBDD(), discoveredVariables.size() + 2);
+            if (inserted) {
+                stack.push_back(node);
+                discoveredVariables.push_back(node.TopVar());
+                discoveredThenIndices.push_back(0);
+                discoveredElseIndices.push_back(0);
+            }
+            return it->second;
+        }};
+
+        auto const discoveredRoot{discover(bdd)};
+        while (!stack.empty()) {
+            auto const node{stack.back()};
+            stack.pop_back();
+            auto const index{bddToIndex.at(node.GetBDD()) - 2};
+            auto const thenIndex{discover(node.Then())};
+            auto const elseIndex{discover(node.Else())};
+            discoveredThenIndices[index] = thenIndex;
+            discoveredElseIndices[index] = elseIndex;
+        }
 
-    auto const it{bddToProbability.find(bdd.GetBDD())};
-    if (it != bddToProbability.end()) {
-        return it->second;
+        // Sort the nodes by their variable in descending order
+        std::vector<uint64_t> order(discoveredVariables.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](uint64_t a, uint64_t b) { return discoveredVariables[a] > discoveredVariables[b]; });
+        std::vector<uint64_t> newIndices(discoveredVariables.size() + 2);
+        newIndices[0] = 0;
+        newIndices[1] = 1;
+        for (size_t i{0}; i < order.size(); ++i) {
+            newIndices[order[i] + 2] = i + 2;
+        }
+
+        nodeCount = discoveredVariables.size() + 2;
+        rootIndex = newIndices[discoveredRoot];
+        thenIndices.resize(nodeCount, 0);
+        elseIndices.resize(nodeCount, 0);
+        nodeLevels.resize(nodeCount, 0);
+        for (size_t i{0}; i < order.size(); ++i) {
+            auto const variable{discoveredVariables[order[i]]};
+            if (levelVariables.empty() || levelVariables.back() != variable) {
+                levelVariables.push_back(variable);
+                levelStarts.push_back(i + 2);
+            }
+            nodeLevels[i + 2] = levelVariables.size() - 1;
+            thenIndices[i + 2] = newIndices[discoveredThenIndices[order[i]]];
+            elseIndices[i + 2] = newIndices[discoveredElseIndices[order[i]]];
+        }
+        levelStarts.push_back(nodeCount);
+
+        // Parents of each node (in CSR format) for the top-down pass.
+        // A parent is stored as 2 * parentIndex + (1 if the node is the then child).
+        parentStarts.assign(nodeCount + 1, 0);
+        for (uint64_t node{2}; node < nodeCount; ++node) {
+            ++parentStarts[thenIndices[node] + 1];
+            ++parentStarts[elseIndices[node] + 1];
+        }
+        std::partial_sum(parentStarts.begin(), parentStarts.end(), parentStarts.begin());
+        parents.resize(parentStarts.back());
+        std::vector<uint64_t> nextParent(parentStarts.begin(), parentStarts.end() - 1);
+        for (uint64_t node{2}; node < nodeCount; ++node) {
+            parents[nextParent[thenIndices[node]]++] = 2 * node + 1;
+            parents[nextParent[elseIndices[node]]++] = 2 * node;
+        }
     }
 
-    auto const currentVar{bdd.TopVar()};
-    auto const currentProbability{indexToProbability.at(currentVar)};
+    /**
+     * Calculates the probabilities of all nodes.
+     *
+     * \param chunksize
+     * The width of the Eigen Arrays
+     *
+     * \param indexToProbabilities
+     * A reference to a mapping
+     * that must map every variable in the bdd to probabilities
+     */
+    void calculateProbabilities(size_t const chunksize, std::map<uint32_t, Eigen::ArrayXd> const &indexToProbabilities) {
+        levelProbabilities.resize(levelVariables.size());
+        for (size_t level{0}; level < levelVariables.size(); ++level) {
+            levelProbabilities[level] = &indexToProbabilities.at(levelVariables[level]);
+        }
 
-    auto const thenProbability{recursiveProbability(bdd.Then(), indexToProbability, bddToProbability)};
-    auto const elseProbability{recursiveProbability(bdd.Else(), indexToProbability, bddToProbability)};
+        probabilities.resize(chunksize, nodeCount);
+        probabilities.col(0).setZero();
+        probabilities.col(1).setOnes();
+        // Bottom-up: the children of a level are in previous levels
+        for (size_t level{0}; level < levelVariables.size(); ++level) {
+            auto const &currentProbabilities{*levelProbabilities[level]};
+            forEachNode(levelStarts[level], levelStarts[level + 1], chunksize, [&](uint64_t const node) {
+                // P(Ite(x, f1, f2)) = P(x) * P(f1) + P(!x) * P(f2)
+                probabilities.col(node) =
+                    currentProbabilities * probabilities.col(thenIndices[node]) + (1 - currentProbabilities) * probabilities.col(elseIndices[node]);
+            });
+        }
+        birnbaumFactorsValid = false;
+    }
 
-    // P(Ite(x, f1, f2)) = P(x) * P(f1) + P(!x) * P(f2)
-    auto const probability{currentProbability * thenProbability + (1 - currentProbability) * elseProbability};
-    bddToProbability[bdd.GetBDD()] = probability;
-    return probability;
-}
+    /**
+     * Calculates the birnbaum factors of all variables.
+     * The birnbaum factor of a variable is the sum over all nodes of
+     * the variable of the probability to reach the node times the
+     * difference of the probabilities of its children.
+     *
+     * \note
+     * Requires the probabilities of the current chunk.
+     */
+    void calculateBirnbaumFactors() {
+        auto const chunksize{static_cast<size_t>(probabilities.rows())};
+
+        // Top-down: the parents of a level are in later levels
+        reachProbabilities.resize(chunksize, nodeCount);
+        for (size_t level{levelVariables.size()}; level > 0; --level) {
+            forEachNode(levelStarts[level - 1], levelStarts[level], chunksize, [&](uint64_t const node) {
+                auto reachProbability{reachProbabilities.col(node)};
+                if (node == rootIndex) {
+                    reachProbability.setOnes();
+                } else {
+                    reachProbability.setZero();
+                }
+                for (uint64_t i{parentStarts[node]}; i < parentStarts[node + 1]; ++i) {
+                    auto const parent{parents[i] / 2};
+                    auto const &parentProbabilities{*levelProbabilities[nodeLevels[parent]]};
+                    if (parents[i] % 2 == 1) {
+                        reachProbability += parentProbabilities * reachProbabilities.col(parent);
+                    } else {
+                        reachProbability += (1 - parentProbabilities) * reachProbabilities.col(parent);
+                    }
+                }
+            });
+        }
 
-/**
- * \returns
- * The birnbaum importance factor of the given variable
- *
- * \param variableIndex
- * The index of the variable the birnbaum factor should be calculated
- *
- * \param bdd
- * The bdd for which to calculate the factor
- *
- * \param indexToProbability
- * A reference to a mapping
- * that must map every variable in the bdd to a probability
- *
- * \param bddToProbability
- * A cache for common sub Bdds.
- * Must be empty or from an earlier call with a bdd that is an
- * ancestor of the current one.
- *
- * \param bddToBirnbaumFactor
- * A cache for common sub Bdds.
- * Must be empty or from an earlier call with a bdd that is an
- * ancestor of the current one.
- */
-ValueType recursiveBirnbaumFactor(uint32_t const variableIndex, Bdd const bdd, std::map<uint32_t, ValueType> const &indexToProbability,
-                                  std::map<uint64_t, ValueType> &bddToProbability, std::map<uint64_t, ValueType> &bddToBirnbaumFactor) {
-    if (bdd.isTerminal()) {
-        return 0;
+        // Each level contributes to the birnbaum factor of its variable only
+        levelBirnbaumFactors.resize(levelVariables.size());
+        auto const averageLevelSize{nodeCount / std::max<size_t>(levelVariables.size(), 1) + 1};
+        forEachNode(0, levelVariables.size(), chunksize * averageLevelSize, [&](uint64_t const level) {
+            auto &birnbaumFactors{levelBirnbaumFactors[level]};
+            birnbaumFactors = Eigen::ArrayXd::Zero(chunksize);
+            for (uint64_t node{levelStarts[level]}; node < levelStarts[level + 1]; ++node) {
+                birnbaumFactors += reachProbabilities.col(node) * (probabilities.col(thenIndices[node]) - probabilities.col(elseIndices[node]));
+            }
+        });
+        birnbaumFactorsValid = true;
     }
 
-    auto const it{bddToBirnbaumFactor.find(bdd.GetBDD())};
-    if (it != bddToBirnbaumFactor.end()) {
-        return it->second;
+    /**
+     * \returns
+     * The probabilities that the bdd is true.
+     */
+    Eigen::ArrayXd getProbabilities() const {
+        return probabilities.col(rootIndex);
     }
 
-    auto const currentVar{bdd.TopVar()};
-    auto const currentProbability{indexToProbability.at(currentVar)};
-
-    ValueType birnbaumFactor{0};
-
-    if (currentVar > variableIndex) {
-        return 0;
-    } else if (currentVar == variableIndex) {
-        auto const thenProbability{recursiveProbability(bdd.Then(), indexToProbability, bddToProbability)};
-        auto const elseProbability{recursiveProbability(bdd.Else(), indexToProbability, bddToProbability)};
-        birnbaumFactor = thenProbability - elseProbability;
-    } else if (currentVar < variableIndex) {
-        auto const thenBirnbaumFactor{recursiveBirnbaumFactor(variableIndex, bdd.Then(), indexToProbability, bddToProbability, bddToBirnbaumFactor)};
-        auto const elseBirnbaumFactor{recursiveBirnbaumFactor(variableIndex, bdd.Else(), indexToProbability, bddToProbability, bddToBirnbaumFactor)};
+    /**
+     * \returns
+     * The birnbaum factors of the given variable.
+     * They are zero if the variable does not occur in the bdd.
+     */
+    Eigen::ArrayXd getBirnbaumFactors(uint32_t const variableIndex) const {
+        STORM_LOG_ASSERT(birnbaumFactorsValid, "Birnbaum factors were not calculated.");
+        auto const it{std::lower_bound(levelVariables.begin(), levelVariables.end(), variableIndex, std::greater<uint32_t>())};
+        if (it == levelVariables.end() || *it != variableIndex) {
+            return Eigen::ArrayXd::Zero(probabilities.rows());
+        }
+        return levelBirnbaumFactors[it - levelVariables.begin()];
+    }
 
-        birnbaumFactor = currentProbability * thenBirnbaumFactor + (1 - currentProbability) * elseBirnbaumFactor;
+   private:
+    /**
+     * Calls func for all indices in [begin, end).
+     * The calls are distributed over (at most maxNumberOfThreads) threads
+     * of the global thread pool if the range is large enough to benefit from it.
+     *
+     * \param workPerIndex
+     * An estimate for the work of a single call
+     */
+    template<typename FuncType>
+    void forEachNode(uint64_t const begin, uint64_t const end, size_t const workPerIndex, FuncType const &func) const {
+        if (maxNumberOfThreads <= 1 || (end - begin) * workPerIndex < parallelThreshold) {
+            for (uint64_t i{begin}; i < end; ++i) {
+                func(i);
+            }
+        } else {
+            uint64_t const blockSize{std::max<uint64_t>(1, parallelThreshold / std::max<size_t>(workPerIndex, 1))};
+            storm::utility::ThreadPool::getGlobalPool().parallelForBlocks(
+                begin, end, blockSize,
+                [&func](uint64_t const blockBegin, uint64_t const blockEnd) {
+                    for (uint64_t i{blockBegin}; i < blockEnd; ++i) {
+                        func(i);
+                    }
+                },
+                maxNumberOfThreads);
+        }
     }
 
-    bddToBirnbaumFactor[bdd.GetBDD()] = birnbaumFactor;
-    return birnbaumFactor;
-}
+    // Minimal amount of work (nodes times timepoints) for which parallelization pays off
+    static constexpr size_t parallelThreshold{4096};
 
-/**
- * \returns
- * The probabilities that the bdd is true
- * given the probabilities that the variables are true.
- *
- * \param chunksize
- * The width of the Eigen Arrays
- *
- * \param bdd
- * The bdd for which to calculate the probabilities
- *
- * \param indexToProbabilities
- * A reference to a mapping
- * that must map every variable in the bdd to probabilities
- *
- * \param bddToProbabilities
- * A cache for common sub Bdds.
- * Must be empty or from an earlier call with a bdd that is an
- * ancestor of the current one.
- *
- * \note
- * Great care was made that all pointers
- * are valid elements in bddToProbabilities.
- *
- */
-Eigen::ArrayXd const *recursiveProbabilities(size_t const chunksize, Bdd const bdd, std::map<uint32_t, Eigen::ArrayXd> const &indexToProbabilities,
-                                             std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> &bddToProbabilities) {
-    auto const bddId{bdd.GetBDD()};
-    auto const it{bddToProbabilities.find(bddId)};
-    if (it != bddToProbabilities.end() && it->second.first) {
-        return &it->second.second;
-    }
+    // The configured number of threads (--threads)
+    uint64_t maxNumberOfThreads;
 
-    auto &bddToProbabilitiesElement{bddToProbabilities[bddId]};
-    if (bdd.isOne()) {
-        bddToProbabilitiesElement.first = true;
-        bddToProbabilitiesElement.second = Eigen::ArrayXd::Constant(chunksize, 1);
-        return &bddToProbabilitiesElement.second;
-    } else if (bdd.isZero()) {
-        bddToProbabilitiesElement.first = true;
-        bddToProbabilitiesElement.second = Eigen::ArrayXd::Constant(chunksize, 0);
-        return &bddToProbabilitiesElement.second;
-    }
+    uint64_t nodeCount{0};
+    uint64_t rootIndex{0};
+    std::vector<uint64_t> thenIndices{};
+    std::vector<uint64_t> elseIndices{};
 
-    auto const &thenProbabilities{*recursiveProbabilities(chunksize, bdd.Then(), indexToProbabilities, bddToProbabilities)};
-    auto const &elseProbabilities{*recursiveProbabilities(chunksize, bdd.Else(), indexToProbabilities, bddToProbabilities)};
+    // The nodes of level i are levelStarts[i], ..., levelStarts[i+1] - 1
+    std::vector<uint64_t> levelStarts{};
+    std::vector<uint32_t> levelVariables{};
+    std::vector<uint64_t> nodeLevels{};
 
-    auto const currentVar{bdd.TopVar()};
-    auto const &currentProbabilities{indexToProbabilities.at(currentVar)};
+    // The parents of node i are parents[parentStarts[i]], ..., parents[parentStarts[i+1] - 1]
+    std::vector<uint64_t> parentStarts{};
+    std::vector<uint64_t> parents{};
 
-    // P(Ite(x, f1, f2)) = P(x) * P(f1) + P(!x) * P(f2)
-    bddToProbabilitiesElement.first = true;
-    bddToProbabilitiesElement.second = currentProbabilities * thenProbabilities + (1 - currentProbabilities) * elseProbabilities;
-    return &bddToProbabilitiesElement.second;
-}
+    // Caches for the current chunk, indexed by node (columns) or level
+    std::vector<Eigen::ArrayXd const *> levelProbabilities{};
+    Eigen::ArrayXXd probabilities{};
+    Eigen::ArrayXXd reachProbabilities{};
+    std::vector<Eigen::ArrayXd> levelBirnbaumFactors{};
+    bool birnbaumFactorsValid{false};
+};
 
 /**
  * \returns
- * The birnbaum importance factors of the given variable
- *
- * \param chunksize
- * The width of the Eigen Arrays
- *
- * \param bdd
- * The bdd for which to calculate the factors
- *
- * \param variableIndex
- * The index of the variable the birnbaum factors should be calculated
- *
- * \param indexToProbability
- * A reference to a mapping
- * that must map every variable in the bdd to a probabilities
- *
- * \param bddToProbability
- * A cache for common sub Bdds.
- * Must be empty or from an earlier call with a bdd that is an
- * ancestor of the current one.
- *
- * \param bddToBirnbaumFactor
- * A cache for common sub Bdds.
- * Must be empty or from an earlier call with a bdd that is an
- * ancestor of the current one.
+ * A mapping from every basic element index to
+ * its probability at the given timebound
+ * (as an Eigen Array of width 1).
  */
-Eigen::ArrayXd const *recursiveBirnbaumFactors(size_t const chunksize, uint32_t const variableIndex, Bdd const bdd,
-                                               std::map<uint32_t, Eigen::ArrayXd> const &indexToProbabilities,
-                                               std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> &bddToProbabilities,
-                                               std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> &bddToBirnbaumFactors) {
-    auto const bddId{bdd.GetBDD()};
-    auto const it{bddToBirnbaumFactors.find(bddId)};
-    if (it != bddToBirnbaumFactors.end() && it->second.first) {
-        return &it->second.second;
-    }
-
-    auto &bddToBirnbaumFactorsElement{bddToBirnbaumFactors[bddId]};
-    if (bdd.isTerminal() || bdd.TopVar() > variableIndex) {
-        // return vector 0;
-        bddToBirnbaumFactorsElement.second = Eigen::ArrayXd::Constant(chunksize, 0);
-        return &bddToBirnbaumFactorsElement.second;
-    }
-
-    auto const currentVar{bdd.TopVar()};
-    auto const &currentProbabilities{indexToProbabilities.at(currentVar)};
-
-    if (currentVar == variableIndex) {
-        auto const &thenProbabilities{*recursiveProbabilities(chunksize, bdd.Then(), indexToProbabilities, bddToProbabilities)};
-        auto const &elseProbabilities{*recursiveProbabilities(chunksize, bdd.Else(), indexToProbabilities, bddToProbabilities)};
-
-        bddToBirnbaumFactorsElement.first = true;
-        bddToBirnbaumFactorsElement.second = thenProbabilities - elseProbabilities;
-        return &bddToBirnbaumFactorsElement.second;
+std::map<uint32_t, Eigen::ArrayXd> getProbabilitiesAtTimebound(storm::dft::storage::DFT<ValueType> const &dft,
+                                                               storm::dft::storage::SylvanBddManager const &sylvanBddManager, ValueType const timebound) {
+    std::map<uint32_t, Eigen::ArrayXd> indexToProbability{};
+    for (auto const &be : dft.getBasicElements()) {
+        auto const currentIndex{sylvanBddManager.getIndex(be->name())};
+        indexToProbability[currentIndex] = Eigen::ArrayXd::Constant(1, be->getUnreliability(timebound));
     }
-
-    // currentVar < variableIndex
-    auto const &thenBirnbaumFactors{
-        *recursiveBirnbaumFactors(chunksize, variableIndex, bdd.Then(), indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
-    auto const &elseBirnbaumFactors{
-        *recursiveBirnbaumFactors(chunksize, variableIndex, bdd.Else(), indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
-
-    bddToBirnbaumFactorsElement.first = true;
-    bddToBirnbaumFactorsElement.second = currentProbabilities * thenBirnbaumFactors + (1 - currentProbabilities) * elseBirnbaumFactors;
-    return &bddToBirnbaumFactorsElement.second;
+    return indexToProbability;
 }
 }  // namespace
 
@@ -335,31 +390,21 @@ void SFTBDDChecker::chunkCalculationTemplate(std::vector<ValueType> const &timep
 }
 
 ValueType SFTBDDChecker::getProbabilityAtTimebound(Bdd bdd, ValueType timebound) const {
-    std::map<uint32_t, ValueType> indexToProbability{};
-    for (auto const &be : getDFT()->getBasicElements()) {
-        auto const currentIndex{getSylvanBddManager()->getIndex(be->name())};
-        indexToProbability[currentIndex] = be->getUnreliability(timebound);
-    }
+    auto const indexToProbability{getProbabilitiesAtTimebound(*getDFT(), *getSylvanBddManager(), timebound)};
 
-    std::map<uint64_t, ValueType> bddToProbability{};
-    auto const probability{recursiveProbability(bdd, indexToProbability, bddToProbability)};
-    return probability;
+    BddEvaluator evaluator{bdd};
+    evaluator.calculateProbabilities(1, indexToProbability);
+    return evaluator.getProbabilities()(0);
 }
 
 std::vector<ValueType> SFTBDDChecker::getProbabilitiesAtTimepoints(Bdd bdd, std::vector<ValueType> const &timepoints, size_t chunksize) const {
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToProbabilities{};
+    BddEvaluator evaluator{bdd};
     std::vector<ValueType> resultProbabilities{};
     resultProbabilities.reserve(timepoints.size());
 
     chunkCalculationTemplate(timepoints, chunksize, [&](auto const currentChunksize, auto const &timepointsArray, auto const &indexToProbabilities) {
-        // Invalidate bdd cache
-        for (auto &i : bddToProbabilities) {
-            i.second.first = false;
-        }
-
-        // Great care was made so that the pointer returned is always valid
-        // and points to an element in bddToProbabilities
-        auto const &probabilitiesArray{*recursiveProbabilities(currentChunksize, bdd, indexToProbabilities, bddToProbabilities)};
+        evaluator.calculateProbabilities(currentChunksize, indexToProbabilities);
+        auto const probabilitiesArray{evaluator.getProbabilities()};
 
         // Update result Probabilities
         for (size_t i{0}; i < currentChunksize; ++i) {
@@ -372,44 +417,37 @@ std::vector<ValueType> SFTBDDChecker::getProbabilitiesAtTimepoints(Bdd bdd, std:
 
 template<typename FuncType>
 ValueType SFTBDDChecker::getImportanceMeasureAtTimebound(std::string const &beName, ValueType timebound, FuncType func) {
-    std::map<uint32_t, ValueType> indexToProbability{};
-    for (auto const &be : getDFT()->getBasicElements()) {
-        auto const currentIndex{getSylvanBddManager()->getIndex(be->name())};
-        indexToProbability[currentIndex] = be->getUnreliability(timebound);
-    }
+    auto const indexToProbability{getProbabilitiesAtTimebound(*getDFT(), *getSylvanBddManager(), timebound)};
+
+    BddEvaluator evaluator{getTopLevelElementBdd()};
+    evaluator.calculateProbabilities(1, indexToProbability);
+    evaluator.calculateBirnbaumFactors();
 
-    auto const bdd{getTopLevelElementBdd()};
     auto const index{getSylvanBddManager()->getIndex(beName)};
-    std::map<uint64_t, ValueType> bddToProbability{};
-    std::map<uint64_t, ValueType> bddToBirnbaumFactor{};
-    auto const probability{recursiveProbability(bdd, indexToProbability, bddToProbability)};
-    auto const birnbaumFactor{recursiveBirnbaumFactor(index, bdd, indexToProbability, bddToProbability, bddToBirnbaumFactor)};
-    auto const &beProbability{indexToProbability[index]};
+    ValueType const probability{evaluator.getProbabilities()(0)};
+    ValueType const birnbaumFactor{evaluator.getBirnbaumFactors(index)(0)};
+    ValueType const beProbability{indexToProbability.at(index)(0)};
 
     return func(beProbability, probability, birnbaumFactor);
 }
 
 template<typename FuncType>
 std::vector<ValueType> SFTBDDChecker::getAllImportanceMeasuresAtTimebound(ValueType timebound, FuncType func) {
-    auto const bdd{getTopLevelElementBdd()};
-
     std::vector<ValueType> resultVector{};
     resultVector.reserve(getDFT()->getBasicElements().size());
 
-    std::map<uint32_t, ValueType> indexToProbability{};
-    for (auto const &be : getDFT()->getBasicElements()) {
-        auto const currentIndex{getSylvanBddManager()->getIndex(be->name())};
-        indexToProbability[currentIndex] = be->getUnreliability(timebound);
-    }
-    std::map<uint64_t, ValueType> bddToProbability{};
+    auto const indexToProbability{getProbabilitiesAtTimebound(*getDFT(), *getSylvanBddManager(), timebound)};
 
-    auto const probability{recursiveProbability(bdd, indexToProbability, bddToProbability)};
+    // All birnbaum factors are calculated in a single pass
+    BddEvaluator evaluator{getTopLevelElementBdd()};
+    evaluator.calculateProbabilities(1, indexToProbability);
+    evaluator.calculateBirnbaumFactors();
+    ValueType const probability{evaluator.getProbabilities()(0)};
 
     for (auto const &be : getDFT()->getBasicElements()) {
         auto const index{getSylvanBddManager()->getIndex(be->name())};
-        std::map<uint64_t, ValueType> bddToBirnbaumFactor{};
-        auto const birnbaumFactor{recursiveBirnbaumFactor(index, bdd, indexToProbability, bddToProbability, bddToBirnbaumFactor)};
-        auto const &beProbability{indexToProbability[index]};
+        ValueType const birnbaumFactor{evaluator.getBirnbaumFactors(index)(0)};
+        ValueType const beProbability{indexToProbability.at(index)(0)};
         resultVector.push_back(func(beProbability, probability, birnbaumFactor));
     }
     return resultVector;
@@ -418,26 +456,16 @@ std::vector<ValueType> SFTBDDChecker::getAllImportanceMeasuresAtTimebound(ValueT
 template<typename FuncType>
 std::vector<ValueType> SFTBDDChecker::getImportanceMeasuresAtTimepoints(std::string const &beName, std::vector<ValueType> const &timepoints, size_t chunksize,
                                                                         FuncType func) {
-    auto const bdd{getTopLevelElementBdd()};
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToProbabilities{};
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToBirnbaumFactors{};
+    BddEvaluator evaluator{getTopLevelElementBdd()};
+    auto const index{getSylvanBddManager()->getIndex(beName)};
     std::vector<ValueType> resultVector{};
     resultVector.reserve(timepoints.size());
 
     chunkCalculationTemplate(timepoints, chunksize, [&](auto const currentChunksize, auto const &timepointsArray, auto const &indexToProbabilities) {
-        // Invalidate bdd caches
-        for (auto &i : bddToProbabilities) {
-            i.second.first = false;
-        }
-        for (auto &i : bddToBirnbaumFactors) {
-            i.second.first = false;
-        }
-
-        // Great care was made so that the pointer returned is always valid
-        auto const index{getSylvanBddManager()->getIndex(beName)};
-        auto const &probabilitiesArray{*recursiveProbabilities(currentChunksize, bdd, indexToProbabilities, bddToProbabilities)};
-        auto const &birnbaumFactorsArray{
-            *recursiveBirnbaumFactors(currentChunksize, index, bdd, indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
+        evaluator.calculateProbabilities(currentChunksize, indexToProbabilities);
+        evaluator.calculateBirnbaumFactors();
+        auto const probabilitiesArray{evaluator.getProbabilities()};
+        auto const birnbaumFactorsArray{evaluator.getBirnbaumFactors(index)};
 
         auto const &beProbabilitiesArray{indexToProbabilities.at(index)};
         auto const ImportanceMeasureArray{func(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray)};
@@ -454,11 +482,9 @@ std::vector<ValueType> SFTBDDChecker::getImportanceMeasuresAtTimepoints(std::str
 template<typename FuncType>
 std::vector<std::vector<ValueType>> SFTBDDChecker::getAllImportanceMeasuresAtTimepoints(std::vector<ValueType> const &timepoints, size_t chunksize,
                                                                                         FuncType func) {
-    auto const bdd{getTopLevelElementBdd()};
     auto const basicElements{getDFT()->getBasicElements()};
 
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToProbabilities{};
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToBirnbaumFactors{};
+    BddEvaluator evaluator{getTopLevelElementBdd()};
     std::vector<std::vector<ValueType>> resultVector{};
     resultVector.resize(getDFT()->getBasicElements().size());
     for (auto &i : resultVector) {
@@ -466,26 +492,15 @@ std::vector<std::vector<ValueType>> SFTBDDChecker::getAllImportanceMeasuresAtTim
     }
 
     chunkCalculationTemplate(timepoints, chunksize, [&](auto const currentChunksize, auto const &timepointsArray, auto const &indexToProbabilities) {
-        // Invalidate bdd cache
-        for (auto &i : bddToProbabilities) {
-            i.second.first = false;
-        }
-
-        auto const &probabilitiesArray{*recursiveProbabilities(currentChunksize, bdd, indexToProbabilities, bddToProbabilities)};
+        // All birnbaum factors of the chunk are calculated in a single pass
+        evaluator.calculateProbabilities(currentChunksize, indexToProbabilities);
+        evaluator.calculateBirnbaumFactors();
+        auto const probabilitiesArray{evaluator.getProbabilities()};
 
         for (size_t basicElementIndex{0}; basicElementIndex < basicElements.size(); ++basicElementIndex) {
             auto const &be{basicElements[basicElementIndex]};
-            // Invalidate bdd cache
-            for (auto &i : bddToBirnbaumFactors) {
-                i.second.first = false;
-            }
-
-            // Great care was made so that the pointer returned is always
-            // valid and points to an element in bddToProbabilities
             auto const index{getSylvanBddManager()->getIndex(be->name())};
-            auto const &birnbaumFactorsArray{
-                *recursiveBirnbaumFactors(currentChunksize, index, bdd, indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
-
+            auto const birnbaumFactorsArray{evaluator.getBirnbaumFactors(index)};
             auto const &beProbabilitiesArray{indexToProbabilities.at(index)};
 
             auto const ImportanceMeasureArray{func(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray)};
@@ -88,7 +88,10 @@ void DFTState<ValueType>::construct() {
         std::shared_ptr<storm::dft::storage::elements::DFTDependency<ValueType> const> dependency = mDft.getDependency(dependencyId);
         STORM_LOG_ASSERT(dependencyId == dependency->id(), "Ids do not match.");
         assert(dependency->dependentEvents().size() == 1);
-        if (hasFailed(dependency->triggerEvent()->id()) && getElementState(dependency->dependentEvents()[0]->id()) == DFTElementState::Operational) {
+        // Dependencies which were already resolved (e.g. an unsuccessful PDEP) are not failable anymore
+        if (hasFailed(dependency->triggerEvent()->id()) && getDependencyState(dependency->id()) == DFTDependencyState::Passive &&
+            getElementState(dependency->dependentEvents()[0]->id()) == DFTElementState::Operational &&
+            !isEventDisabledViaRestriction(dependency->dependentEvents()[0]->id())) {
             failableElements.addDependency(dependency->id(), mDft.isDependencyInConflict(dependency->id()));
             STORM_LOG_TRACE("New dependency failure: " << *dependency);
         }
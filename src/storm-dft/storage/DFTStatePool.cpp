@@ -0,0 +1,47 @@
+#include "DFTStatePool.h"
+
+#include <algorithm>
+
+#include "storm/utility/macros.h"
+
+namespace storm::dft {
+namespace storage {
+
+DFTStatePool::DFTStatePool(uint64_t bitsPerState) : bitsPerState(bitsPerState), storage(), nrSlots(0) {
+    STORM_LOG_ASSERT(bitsPerState % 64 == 0, "Size of status must be a multiple of 64.");
+}
+
+DFTStatePool::Handle DFTStatePool::add(storm::storage::BitVector const& status) {
+    STORM_LOG_ASSERT(status.size() == bitsPerState, "Size of status does not match.");
+    Handle handle;
+    if (freeSlots.empty()) {
+        handle = nrSlots++;
+        if (nrSlots * bitsPerState > storage.size()) {
+            // Grow geometrically to avoid frequent reallocations
+            storage.resize(std::max(2 * storage.size(), nrSlots * bitsPerState));
+        }
+    } else {
+        handle = freeSlots.back();
+        freeSlots.pop_back();
+    }
+    storage.set(handle * bitsPerState, status);
+    return handle;
+}
+
+storm::storage::BitVector DFTStatePool::get(Handle handle) const {
+    STORM_LOG_ASSERT(handle < nrSlots, "Invalid handle " << handle << ".");
+    return storage.get(handle * bitsPerState, bitsPerState);
+}
+
+void DFTStatePool::release(Handle handle) {
+    STORM_LOG_ASSERT(handle < nrSlots, "Invalid handle " << handle << ".");
+    STORM_LOG_ASSERT(std::find(freeSlots.begin(), freeSlots.end(), handle) == freeSlots.end(), "Handle " << handle << " was already released.");
+    freeSlots.push_back(handle);
+}
+
+uint64_t DFTStatePool::size() const {
+    return nrSlots - freeSlots.size();
+}
+
+}  // namespace storage
+}  // namespace storm::dft
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm::dft {
+namespace storage {
+
+/*!
+ * Pool storing the status bit vectors of DFT states.
+ * All status vectors have the same size and are stored consecutively in one large bit vector.
+ * States are referred to by handles which remain valid until the state is released. Released slots are reused for new states.
+ * This avoids keeping a complete DFTState object (including failable elements etc.) for each state that is not yet expanded.
+ */
+class DFTStatePool {
+   public:
+    using Handle = uint64_t;
+
+    /*!
+     * Create new pool.
+     * @param bitsPerState Size of the status bit vectors. Must be a multiple of 64.
+     */
+    explicit DFTStatePool(uint64_t bitsPerState);
+
+    /*!
+     * Store the given status.
+     * @param status Status bit vector.
+     * @return Handle for the stored status.
+     */
+    Handle add(storm::storage::BitVector const& status);
+
+    /*!
+     * Get the stored status.
+     * @param handle Handle of the status.
+     * @return Copy of the status bit vector.
+     */
+    storm::storage::BitVector get(Handle handle) const;
+
+    /*!
+     * Release the status such that its slot can be reused.
+     * The handle becomes invalid.
+     * @param handle Handle of the status.
+     */
+    void release(Handle handle);
+
+    /*!
+     * Get the number of currently stored states.
+     * @return Number of states.
+     */
+    uint64_t size() const;
+
+   private:
+    // Size of each status bit vector.
+    uint64_t bitsPerState;
+
+    // Storage for all status bit vectors. The status with handle i occupies the bits [i*bitsPerState, (i+1)*bitsPerState).
+    storm::storage::BitVector storage;
+
+    // Number of slots that were used so far.
+    uint64_t nrSlots;
+
+    // Slots that were released and can be reused.
+    std::vector<Handle> freeSlots;
+};
+
+}  // namespace storage
+}  // namespace storm::dft
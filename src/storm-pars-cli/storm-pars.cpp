@@ -389,7 +389,7 @@ namespace storm {
         }
 
         template<typename ValueType>
-        void printInitialStatesResult(std::unique_ptr<storm::modelchecker::CheckResult> const &result, utility::Stopwatch *watch = nullptr, const utility::parametric::Valuation <ValueType> *valuation = nullptr) {
+        void printInitialStatesResult(std::unique_ptr<storm::modelchecker::CheckResult> const &result, utility::Stopwatch const* watch = nullptr, const utility::parametric::Valuation <ValueType> *valuation = nullptr) {
             if (result) {
                 STORM_PRINT_AND_LOG("Result (initial states)");
                 if (valuation) {
@@ -452,68 +452,60 @@ namespace storm {
         template<template<typename, typename> class ModelCheckerType, typename ModelType, typename ValueType, typename SolveValueType = double>
         void verifyPropertiesAtSamplePoints(ModelType const& model, SymbolicInput const& input, SampleInformation<ValueType> const& samples) {
 
-            // When samples are provided, we create an instantiation model checker.
-            ModelCheckerType<ModelType, SolveValueType> modelchecker(model);
-
-            for (auto const& property : input.properties) {
-                storm::cli::printModelCheckingProperty(property);
-
-                modelchecker.specifyFormula(storm::api::createTask<ValueType>(property.getRawFormula(), true));
-                modelchecker.setInstantiationsAreGraphPreserving(samples.graphPreserving);
-
-                storm::utility::parametric::Valuation<ValueType> valuation;
-
-                std::vector<typename utility::parametric::VariableType<ValueType>::type> parameters;
-                std::vector<typename std::vector<typename utility::parametric::CoefficientType<ValueType>::type>::const_iterator> iterators;
-                std::vector<typename std::vector<typename utility::parametric::CoefficientType<ValueType>::type>::const_iterator> iteratorEnds;
+            // Collect all valuations spanned by the samples.
+            std::vector<storm::utility::parametric::Valuation<ValueType>> valuations;
+            std::vector<typename utility::parametric::VariableType<ValueType>::type> parameters;
+            std::vector<typename std::vector<typename utility::parametric::CoefficientType<ValueType>::type>::const_iterator> iterators;
+            std::vector<typename std::vector<typename utility::parametric::CoefficientType<ValueType>::type>::const_iterator> iteratorEnds;
+            for (auto const& product : samples.cartesianProducts) {
+                parameters.clear();
+                iterators.clear();
+                iteratorEnds.clear();
+
+                for (auto const& entry : product) {
+                    parameters.push_back(entry.first);
+                    iterators.push_back(entry.second.cbegin());
+                    iteratorEnds.push_back(entry.second.cend());
+                }
 
-                storm::utility::Stopwatch watch(true);
-                for (auto const& product : samples.cartesianProducts) {
-                    parameters.clear();
-                    iterators.clear();
-                    iteratorEnds.clear();
-
-                    for (auto const& entry : product) {
-                        parameters.push_back(entry.first);
-                        iterators.push_back(entry.second.cbegin());
-                        iteratorEnds.push_back(entry.second.cend());
+                bool done = false;
+                while (!done) {
+                    // Read off valuation.
+                    storm::utility::parametric::Valuation<ValueType> valuation;
+                    for (uint64_t i = 0; i < parameters.size(); ++i) {
+                        valuation[parameters[i]] = *iterators[i];
                     }
+                    valuations.push_back(std::move(valuation));
 
-                    bool done = false;
-                    while (!done) {
-                        // Read off valuation.
-                        for (uint64_t i = 0; i < parameters.size(); ++i) {
-                            valuation[parameters[i]] = *iterators[i];
-                        }
-
-                        storm::utility::Stopwatch valuationWatch(true);
-                        std::unique_ptr<storm::modelchecker::CheckResult> result = modelchecker.check(Environment(), valuation);
-                        valuationWatch.stop();
-
-                        if (result) {
-                            result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model.getInitialStates()));
-                        }
-                        printInitialStatesResult<ValueType>(result, &valuationWatch, &valuation);
-
-                        for (uint64_t i = 0; i < parameters.size(); ++i) {
-                            ++iterators[i];
-                            if (iterators[i] == iteratorEnds[i]) {
-                                // Reset iterator and proceed to move next iterator.
-                                iterators[i] = product.at(parameters[i]).cbegin();
+                    for (uint64_t i = 0; i < parameters.size(); ++i) {
+                        ++iterators[i];
+                        if (iterators[i] == iteratorEnds[i]) {
+                            // Reset iterator and proceed to move next iterator.
+                            iterators[i] = product.at(parameters[i]).cbegin();
 
-                                // If the last iterator was removed, we are done.
-                                if (i == parameters.size() - 1) {
-                                    done = true;
-                                }
-                            } else {
-                                // If an iterator was moved but not reset, we have another valuation to check.
-                                break;
+                            // If the last iterator was removed, we are done.
+                            if (i == parameters.size() - 1) {
+                                done = true;
                             }
+                        } else {
+                            // If an iterator was moved but not reset, we have another valuation to check.
+                            break;
                         }
-
                     }
                 }
+            }
 
+            uint64_t numberOfThreads = storm::settings::getModule<storm::settings::modules::ParametricSettings>().getNumberOfSampleThreads();
+            for (auto const& property : input.properties) {
+                storm::cli::printModelCheckingProperty(property);
+
+                // The valuations are checked in an order that allows to reuse the result of one valuation for the next one. The results are
+                // already filtered to the initial states and are printed in the order of the valuations as soon as they are available.
+                storm::utility::Stopwatch watch(true);
+                storm::api::checkAtValuations<ModelCheckerType, ModelType, SolveValueType>(Environment(), model, storm::api::createTask<ValueType>(property.getRawFormula(), true), valuations, samples.graphPreserving, numberOfThreads, nullptr,
+                    [&valuations] (uint64_t index, std::unique_ptr<storm::modelchecker::CheckResult> const& result, storm::utility::Stopwatch const& valuationWatch) {
+                        printInitialStatesResult<ValueType>(result, &valuationWatch, &valuations[index]);
+                    });
                 watch.stop();
                 STORM_PRINT_AND_LOG("Overall time for sampling all instances: " << watch << "\n\n");
             }
@@ -872,8 +864,9 @@ namespace storm {
                     if (regionSettings.isDepthLimitSet()) {
                         optionalDepthLimit = regionSettings.getDepthLimit();
                     }
+                    uint64_t numberOfThreads = regionSettings.isNumberOfThreadsSet() ? regionSettings.getNumberOfThreads() : storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads();
                     // TODO @Jip: change allow model simplification when not using monotonicity, for benchmarking purposes simplification is moved forward.
-                    std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> result = storm::api::checkAndRefineRegionWithSparseEngine<ValueType>(model, storm::api::createTask<ValueType>(formula, true), regions.front(), engine, refinementThreshold, optionalDepthLimit, regionSettings.getHypothesis(), false, monotonicitySettings, monThresh);
+                    std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> result = storm::api::checkAndRefineRegionWithSparseEngine<ValueType>(model, storm::api::createTask<ValueType>(formula, true), regions.front(), engine, refinementThreshold, optionalDepthLimit, regionSettings.getHypothesis(), false, monotonicitySettings, monThresh, numberOfThreads);
                     return result;
                 };
             } else {
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+#include "storm-pars/modelchecker/instantiation/SparseCtmcInstantiationModelChecker.h"
+#include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
+#include "storm-pars/modelchecker/instantiation/SparseMdpInstantiationModelChecker.h"
+#include "storm-pars/utility/parametric.h"
+
+#include "storm/environment/Environment.h"
+#include "storm/modelchecker/CheckTask.h"
+#include "storm/modelchecker/results/CheckResult.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/utility/Stopwatch.h"
+#include "storm/utility/ThreadPool.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace api {
+
+        /*!
+         * Checks the given task on the given parametric model for each of the given valuations.
+         * The valuations are checked in an order in which consecutive valuations are close to each other (see storm::utility::parametric::getLocalityPreservingOrder).
+         * As the instantiation model checkers use the solution for one valuation as initial guess for the next one, this typically reduces the effort of the solvers.
+         *
+         * @param graphPreserving if set, it is assumed that all valuations induce the same graph structure such that the graph analysis is only performed once
+         * @param numberOfThreads the number of threads that check valuations concurrently. Each thread checks a contiguous part of the ordered valuations
+         *        with its own model checker. Only supported if ConstantType is double.
+         * @param valuationWatches if given, the i-th stopwatch is set to the time spent for checking the i-th valuation
+         * @param resultCallback if given, it is called with the index, the result and the time of each valuation in the order of the given valuations.
+         *        A result is reported as soon as it and the results of all preceding valuations are available. Calls to the callback are not concurrent.
+         * @return the results, where the i-th result corresponds to the i-th valuation. If only the initial states are relevant for the task, the results
+         *         are filtered to the initial states such that only little memory is kept per valuation.
+         */
+        template<template<typename, typename> class ModelCheckerType, typename ModelType, typename ConstantType>
+        std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> checkAtValuations(Environment const& env, ModelType const& model, storm::modelchecker::CheckTask<storm::logic::Formula, typename ModelType::ValueType> const& task, std::vector<storm::utility::parametric::Valuation<typename ModelType::ValueType>> const& valuations, bool graphPreserving, uint64_t numberOfThreads = 1, std::vector<storm::utility::Stopwatch>* valuationWatches = nullptr, std::function<void(uint64_t, std::unique_ptr<storm::modelchecker::CheckResult> const&, storm::utility::Stopwatch const&)> const& resultCallback = nullptr) {
+            std::vector<uint64_t> order = storm::utility::parametric::getLocalityPreservingOrder<typename ModelType::ValueType>(valuations);
+            std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results(valuations.size());
+            std::vector<storm::utility::Stopwatch> watches(valuations.size());
+            storm::modelchecker::ExplicitQualitativeCheckResult initialStatesFilter(model.getInitialStates());
+
+            // Exact instantiation evaluates the functions with CArL, which is not thread-safe.
+            STORM_LOG_WARN_COND(numberOfThreads <= 1 || std::is_same<ConstantType, double>::value, "Checking valuations concurrently is only supported for floating point arithmetic, continuing with a single thread.");
+            if (!std::is_same<ConstantType, double>::value) {
+                numberOfThreads = 1;
+            }
+            numberOfThreads = std::max<uint64_t>(1, std::min<uint64_t>({numberOfThreads, storm::utility::ThreadPool::getGlobalPool().getNumberOfThreads(), valuations.size()}));
+
+            // The model checkers are created upfront as this involves copying the parametric functions.
+            std::vector<std::unique_ptr<ModelCheckerType<ModelType, ConstantType>>> modelCheckers;
+            for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+                modelCheckers.push_back(std::make_unique<ModelCheckerType<ModelType, ConstantType>>(model));
+                modelCheckers.back()->specifyFormula(task);
+                modelCheckers.back()->setInstantiationsAreGraphPreserving(graphPreserving);
+            }
+
+            // Keeps track of the results that are available but have not been reported yet.
+            std::mutex reportMutex;
+            std::vector<bool> available(valuations.size(), false);
+            uint64_t nextToReport = 0;
+
+            storm::utility::ThreadPool::getGlobalPool().parallelFor(0, numberOfThreads, [&](uint64_t thread) {
+                auto& modelChecker = *modelCheckers[thread];
+                uint64_t const end = valuations.size() * (thread + 1) / numberOfThreads;
+                for (uint64_t position = valuations.size() * thread / numberOfThreads; position < end; ++position) {
+                    uint64_t const index = order[position];
+                    watches[index].start();
+                    results[index] = modelChecker.check(env, valuations[index]);
+                    watches[index].stop();
+                    if (results[index] && task.isOnlyInitialStatesRelevant()) {
+                        results[index]->filter(initialStatesFilter);
+                    }
+                    if (resultCallback) {
+                        std::lock_guard<std::mutex> lock(reportMutex);
+                        available[index] = true;
+                        for (; nextToReport < valuations.size() && available[nextToReport]; ++nextToReport) {
+                            resultCallback(nextToReport, results[nextToReport], watches[nextToReport]);
+                        }
+                    }
+                }
+            }, numberOfThreads);
+            if (valuationWatches) {
+                *valuationWatches = std::move(watches);
+            }
+            return results;
+        }
+
+    }
+}
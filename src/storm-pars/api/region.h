@@ -4,6 +4,7 @@
 #include <set>
 #include <vector>
 #include <memory>
+#include <algorithm>
 #include <boost/optional.hpp>
 
 #include "storm-pars/modelchecker/results/RegionCheckResult.h"
@@ -24,6 +25,7 @@
 #include "storm/api/transformation.h"
 #include "storm/io/file.h"
 #include "storm/models/sparse/Model.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/exceptions/UnexpectedException.h"
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/NotSupportedException.h"
@@ -235,12 +237,24 @@ namespace storm {
          * @param allowModelSimplification
          * @param useMonotonicity
          * @param monThresh if given, determines at which depth to start using monotonicity
+         * @param numberOfThreads the number of threads that analyze regions concurrently (each with its own region model checker). Not supported together with monotonicity.
          */
         template <typename ValueType>
-        std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> checkAndRefineRegionWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, storm::storage::ParameterRegion<ValueType> const& region, storm::modelchecker::RegionCheckEngine engine, boost::optional<ValueType> const& coverageThreshold, boost::optional<uint64_t> const& refinementDepthThreshold = boost::none, storm::modelchecker::RegionResultHypothesis hypothesis = storm::modelchecker::RegionResultHypothesis::Unknown, bool allowModelSimplification = true, MonotonicitySetting monotonicitySetting = MonotonicitySetting(), uint64_t monThresh = 0) {
+        std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> checkAndRefineRegionWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, storm::storage::ParameterRegion<ValueType> const& region, storm::modelchecker::RegionCheckEngine engine, boost::optional<ValueType> const& coverageThreshold, boost::optional<uint64_t> const& refinementDepthThreshold = boost::none, storm::modelchecker::RegionResultHypothesis hypothesis = storm::modelchecker::RegionResultHypothesis::Unknown, bool allowModelSimplification = true, MonotonicitySetting monotonicitySetting = MonotonicitySetting(), uint64_t monThresh = 0, uint64_t numberOfThreads = 1) {
             Environment env;
             bool preconditionsValidated = false;
             auto regionChecker = initializeRegionModelChecker(env, model, task, engine, true, allowModelSimplification, preconditionsValidated, monotonicitySetting);
+            STORM_LOG_WARN_COND(numberOfThreads <= 1 || !monotonicitySetting.useMonotonicity, "Parallel region refinement is not supported when using monotonicity, continuing with a single thread.");
+            STORM_LOG_WARN_COND(numberOfThreads <= 1 || regionChecker->isConcurrentRegionAnalysisSupported(), "Parallel region refinement is only supported for parameter lifting with floating point numbers, continuing with a single thread.");
+            numberOfThreads = std::min<uint64_t>(numberOfThreads, storm::utility::ThreadPool::getGlobalPool().getNumberOfThreads());
+            if (numberOfThreads > 1 && !monotonicitySetting.useMonotonicity && regionChecker->isConcurrentRegionAnalysisSupported()) {
+                // Each thread gets its own region model checker as these are not thread-safe.
+                std::vector<std::shared_ptr<storm::modelchecker::RegionModelChecker<ValueType>>> checkers = {regionChecker};
+                while (checkers.size() < numberOfThreads) {
+                    checkers.push_back(initializeRegionModelChecker(env, model, task, engine, true, allowModelSimplification, true, monotonicitySetting));
+                }
+                return storm::modelchecker::RegionModelChecker<ValueType>::performParallelRegionRefinement(env, checkers, region, coverageThreshold, refinementDepthThreshold, hypothesis);
+            }
             return regionChecker->performRegionRefinement(env, region, coverageThreshold, refinementDepthThreshold, hypothesis, monThresh);
         }
 
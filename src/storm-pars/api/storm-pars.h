@@ -3,3 +3,4 @@
 #include "storm-pars/api/region.h"
 #include "storm-pars/api/export.h"
 #include "storm-pars/api/analysis.h"
+#include "storm-pars/api/instantiation.h"
@@ -1,5 +1,10 @@
+#include <algorithm>
 #include <sstream>
 #include <queue>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <condition_variable>
 
 #include "storm-pars/analysis/OrderExtender.cpp"
 #include "storm-pars/modelchecker/region/RegionModelChecker.h"
@@ -11,6 +16,7 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
+#include "storm/utility/ThreadPool.h"
 
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/exceptions/NotSupportedException.h"
@@ -324,6 +330,180 @@ namespace storm {
                 return std::make_unique<storm::modelchecker::RegionRefinementCheckResult<ParametricType>>(std::move(result), std::move(regionCopyForResult));
             }
 
+            template <typename ParametricType>
+            std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> RegionModelChecker<ParametricType>::performParallelRegionRefinement(Environment const& env, std::vector<std::shared_ptr<RegionModelChecker<ParametricType>>> const& checkers, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold, boost::optional<uint64_t> depthThreshold, RegionResultHypothesis const& hypothesis) {
+                STORM_LOG_THROW(!checkers.empty(), storm::exceptions::InvalidArgumentException, "No region model checker given.");
+                bool concurrentAnalysisSupported = std::all_of(checkers.begin(), checkers.end(), [](auto const& checker) { return checker->isConcurrentRegionAnalysisSupported(); });
+                if (checkers.size() == 1 || !concurrentAnalysisSupported) {
+                    STORM_LOG_WARN_COND(checkers.size() == 1, "The region model checkers do not support concurrent region analysis. Refining the region sequentially.");
+                    return checkers.front()->performRegionRefinement(env, region, coverageThreshold, depthThreshold, hypothesis);
+                }
+                for (auto& checker : checkers) {
+                    checker->prepareConcurrentRegionAnalysis();
+                }
+                STORM_LOG_INFO("Applying refinement on region: " << region.toString(true) << " using " << checkers.size() << " threads.");
+                bool showStatistics = storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet();
+
+                auto thresholdAsCoefficient = coverageThreshold ? storm::utility::convertNumber<CoefficientType>(coverageThreshold.get()) : storm::utility::zero<CoefficientType>();
+                auto areaOfParameterSpace = region.area();
+                auto fractionOfUndiscoveredArea = storm::utility::one<CoefficientType>();
+
+                // The resulting (sub-)regions
+                std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> result;
+
+                // The regions that we still need to process in the same (FIFO) order as in the sequential refinement.
+                // Regions are analyzed concurrently, but a result is only processed (i.e. the region is split or added to the result) once all previous results are processed.
+                struct UnprocessedRegion {
+                    storm::storage::ParameterRegion<ParametricType> region;
+                    RegionResult initialResult;
+                    uint64_t depth;
+                    boost::optional<RegionResult> result;
+                };
+                std::deque<UnprocessedRegion> unprocessedRegions;
+                unprocessedRegions.push_back({region, RegionResult::Unknown, 0, boost::none});
+                // Regions are identified by their position in the (infinite) sequence of regions that are ever inserted into the queue.
+                uint64_t indexOfFirstUnprocessedRegion = 0;
+                uint64_t indexOfNextRegionToAnalyze = 0;
+
+                uint_fast64_t numOfAnalyzedRegions = 0;
+                CoefficientType displayedProgress = storm::utility::zero<CoefficientType>();
+                if (showStatistics) {
+                    STORM_PRINT_AND_LOG("Progress (solved fraction) :\n" <<  "0% [");
+                    while (displayedProgress < storm::utility::one<CoefficientType>() - thresholdAsCoefficient) {
+                        STORM_PRINT_AND_LOG(" ");
+                        displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
+                    }
+                    while (displayedProgress < storm::utility::one<CoefficientType>()) {
+                        STORM_PRINT_AND_LOG("-");
+                        displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
+                    }
+                    STORM_PRINT_AND_LOG("] 100%\n" << "   [");
+                    displayedProgress = storm::utility::zero<CoefficientType>();
+                }
+
+                std::mutex mutex;
+                std::condition_variable queueChanged;
+                bool done = !(fractionOfUndiscoveredArea > thresholdAsCoefficient);
+
+                // Processes the results at the front of the queue. The mutex has to be locked when calling this.
+                auto processResults = [&]() {
+                    while (!done && unprocessedRegions.front().result) {
+                        auto& currentRegion = unprocessedRegions.front().region;
+                        RegionResult res = unprocessedRegions.front().result.get();
+                        uint64_t currentDepth = unprocessedRegions.front().depth;
+                        STORM_LOG_INFO("Processing result of region #" << numOfAnalyzedRegions << " (Refinement depth " << currentDepth << "; " << storm::utility::convertNumber<double>(fractionOfUndiscoveredArea) * 100 << "% still unknown)");
+                        switch (res) {
+                            case RegionResult::AllSat:
+                            case RegionResult::AllViolated:
+                                fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
+                                result.emplace_back(std::move(currentRegion), res);
+                                break;
+                            default:
+                                // Split the region as long as the desired refinement depth is not reached.
+                                if (!depthThreshold || currentDepth < depthThreshold.get()) {
+                                    std::vector<storm::storage::ParameterRegion<ParametricType>> newRegions;
+                                    RegionResult initResForNewRegions = (res == RegionResult::CenterSat) ? RegionResult::ExistsSat :
+                                                                        ((res == RegionResult::CenterViolated) ? RegionResult::ExistsViolated :
+                                                                         RegionResult::Unknown);
+                                    currentRegion.split(currentRegion.getCenterPoint(), newRegions);
+                                    for (auto& newRegion : newRegions) {
+                                        unprocessedRegions.push_back({std::move(newRegion), initResForNewRegions, currentDepth + 1, boost::none});
+                                    }
+                                } else {
+                                    // If the region is not further refined, it is still added to the result
+                                    result.emplace_back(std::move(currentRegion), res);
+                                }
+                                break;
+                        }
+                        ++numOfAnalyzedRegions;
+                        unprocessedRegions.pop_front();
+                        ++indexOfFirstUnprocessedRegion;
+                        if (showStatistics) {
+                            while (displayedProgress < storm::utility::one<CoefficientType>() - fractionOfUndiscoveredArea) {
+                                STORM_PRINT_AND_LOG("#");
+                                displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
+                            }
+                        }
+                        done = !(fractionOfUndiscoveredArea > thresholdAsCoefficient) || unprocessedRegions.empty();
+                    }
+                };
+
+                auto worker = [&](uint64_t workerIndex) {
+                    RegionModelChecker<ParametricType>& checker = *checkers[workerIndex];
+                    std::unique_lock<std::mutex> lock(mutex);
+                    while (true) {
+                        queueChanged.wait(lock, [&]() { return done || indexOfNextRegionToAnalyze < indexOfFirstUnprocessedRegion + unprocessedRegions.size(); });
+                        if (done) {
+                            break;
+                        }
+                        uint64_t index = indexOfNextRegionToAnalyze++;
+                        auto const& entry = unprocessedRegions[index - indexOfFirstUnprocessedRegion];
+                        // A plain copy of the region would share the reference counted representation of its (exact) boundaries with the queued region,
+                        // which is accessed by other threads while they process results (e.g. in getCenterPoint and split).
+                        // We therefore copy the boundaries as doubles and rebuild the region once the lock is released.
+                        std::map<VariableType, double> lowerBoundaries, upperBoundaries;
+                        for (auto const& boundary : entry.region.getLowerBoundaries()) {
+                            lowerBoundaries.emplace(boundary.first, storm::utility::convertNumber<double>(boundary.second));
+                        }
+                        for (auto const& boundary : entry.region.getUpperBoundaries()) {
+                            upperBoundaries.emplace(boundary.first, storm::utility::convertNumber<double>(boundary.second));
+                        }
+                        uint_fast64_t splitThreshold = entry.region.getSplitThreshold();
+                        RegionResult initialResult = entry.initialResult;
+                        lock.unlock();
+
+                        typename storm::storage::ParameterRegion<ParametricType>::Valuation lowerValuation, upperValuation;
+                        for (auto const& boundary : lowerBoundaries) {
+                            lowerValuation.emplace(boundary.first, storm::utility::convertNumber<CoefficientType>(boundary.second));
+                        }
+                        for (auto const& boundary : upperBoundaries) {
+                            upperValuation.emplace(boundary.first, storm::utility::convertNumber<CoefficientType>(boundary.second));
+                        }
+                        storm::storage::ParameterRegion<ParametricType> currentRegion(std::move(lowerValuation), std::move(upperValuation));
+                        currentRegion.setSplitThreshold(splitThreshold);
+
+                        RegionResult res;
+                        try {
+                            res = checker.analyzeRegion(env, currentRegion, hypothesis, initialResult, false);
+                        } catch (...) {
+                            // Make sure that the remaining workers do not wait for this result.
+                            lock.lock();
+                            done = true;
+                            queueChanged.notify_all();
+                            throw;
+                        }
+
+                        lock.lock();
+                        if (!done) {
+                            // As the region was not analyzed yet, it is still in the queue.
+                            unprocessedRegions[index - indexOfFirstUnprocessedRegion].result = res;
+                            processResults();
+                        }
+                        queueChanged.notify_all();
+                    }
+                };
+                storm::utility::ThreadPool::getGlobalPool().parallelFor(0, checkers.size(), worker, checkers.size());
+
+                // Add the still unprocessed regions to the result. Results of regions that were analyzed after the refinement finished are discarded.
+                for (auto& entry : unprocessedRegions) {
+                    result.emplace_back(std::move(entry.region), entry.initialResult);
+                }
+
+                if (showStatistics) {
+                    while (displayedProgress < storm::utility::one<CoefficientType>()) {
+                        STORM_PRINT_AND_LOG("-");
+                        displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
+                    }
+                    STORM_PRINT_AND_LOG("]\n");
+
+                    STORM_PRINT_AND_LOG("Region Refinement Statistics:\n");
+                    STORM_PRINT_AND_LOG("    Analyzed a total of " << numOfAnalyzedRegions << " regions using " << checkers.size() << " threads.\n");
+                }
+
+                auto regionCopyForResult = region;
+                return std::make_unique<storm::modelchecker::RegionRefinementCheckResult<ParametricType>>(std::move(result), std::move(regionCopyForResult));
+            }
+
 
         template <typename ParametricType>
         void RegionModelChecker<ParametricType>::extendLocalMonotonicityResult(storm::storage::ParameterRegion<ParametricType> const& region, std::shared_ptr<storm::analysis::Order> order, std::shared_ptr<storm::analysis::LocalMonotonicityResult<VariableType>> localMonotonicityResult){
@@ -343,6 +523,16 @@ namespace storm {
         }
 
         
+        template <typename ParametricType>
+        bool RegionModelChecker<ParametricType>::isConcurrentRegionAnalysisSupported() const {
+            return false;
+        }
+
+        template <typename ParametricType>
+        void RegionModelChecker<ParametricType>::prepareConcurrentRegionAnalysis() {
+            // Intentionally left empty.
+        }
+
         template <typename ParametricType>
         bool RegionModelChecker<ParametricType>::isRegionSplitEstimateSupported() const {
             return false;
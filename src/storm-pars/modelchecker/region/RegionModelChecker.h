@@ -62,6 +62,19 @@ namespace storm {
              */
             std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> performRegionRefinement(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold, boost::optional<uint64_t> depthThreshold = boost::none, RegionResultHypothesis const& hypothesis = RegionResultHypothesis::Unknown, uint64_t monThresh = 0);
 
+            /*!
+             * Iteratively refines the region like performRegionRefinement (without monotonicity), but analyzes several regions concurrently.
+             * Each worker thread pulls the next unknown region from a shared queue and analyzes it with its own region model checker.
+             * The analysis results are processed in the same order as in performRegionRefinement, i.e., the resulting subregions do not depend on the number of threads.
+             * If the checkers do not support concurrent region analysis (see isConcurrentRegionAnalysisSupported), the first checker refines the region sequentially.
+             * @param checkers the region model checkers used by the worker threads (one per thread). They all have to be specified for the same model and check task.
+             * @param region the considered region
+             * @param coverageThreshold if given, the refinement stops as soon as the fraction of the area of the subregions with inconclusive result is less then this threshold
+             * @param depthThreshold if given, the refinement stops at the given depth. depth=0 means no refinement.
+             * @param hypothesis if not 'unknown', it is only checked whether the hypothesis holds within the given region.
+             */
+            static std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> performParallelRegionRefinement(Environment const& env, std::vector<std::shared_ptr<RegionModelChecker<ParametricType>>> const& checkers, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold, boost::optional<uint64_t> depthThreshold = boost::none, RegionResultHypothesis const& hypothesis = RegionResultHypothesis::Unknown);
+
             // TODO: documentation
             /*!
              * Finds the extremal value within the given region and with the given precision.
@@ -71,6 +84,18 @@ namespace storm {
             virtual std::pair<ParametricType, typename storm::storage::ParameterRegion<ParametricType>::Valuation> computeExtremalValue(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dir, ParametricType const& precision, bool absolutePrecision);
             virtual bool checkExtremalValue(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dir, ParametricType const& precision, bool absolutePrecision, ParametricType const& valueToCheck);
 
+            /*!
+             * Returns true if regions can be analyzed concurrently by different instances of this region model checker.
+             * This requires that the analysis does not perform arithmetic on (non thread-safe) rational functions or rational numbers.
+             */
+            virtual bool isConcurrentRegionAnalysisSupported() const;
+
+            /*!
+             * Prepares this region model checker for analyzing regions concurrently with other instances, e.g., by initializing data that is otherwise created lazily.
+             * This is invoked before the worker threads are started.
+             */
+            virtual void prepareConcurrentRegionAnalysis();
+
             /*!
              * Returns true if region split estimation (a) was enabled when model and check task have been specified and (b) is supported by this region model checker.
              */
@@ -525,6 +525,14 @@ namespace storm {
             return result;
         }
         
+        template <typename SparseModelType, typename ConstantType>
+        void SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::prepareConcurrentRegionAnalysis() {
+            SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::prepareConcurrentRegionAnalysis();
+            if (parameterLifter) {
+                parameterLifter->compileCollectedFunctions();
+            }
+        }
+
         template <typename SparseModelType, typename ConstantType>
         bool SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::isRegionSplitEstimateSupported() const {
             return regionSplitEstimationsEnabled && !stepBound;
@@ -39,6 +39,11 @@ namespace storm {
             virtual bool isRegionSplitEstimateSupported() const override;
             virtual std::map<VariableType, double> getRegionSplitEstimate() const override;
 
+            /*!
+             * Also compiles the functions of the lifted model, which are otherwise compiled upon the first region analysis.
+             */
+            virtual void prepareConcurrentRegionAnalysis() override;
+
             virtual std::shared_ptr<storm::analysis::Order> extendOrder(std::shared_ptr<storm::analysis::Order> order, storm::storage::ParameterRegion<ValueType> region) override;
 
             virtual void extendLocalMonotonicityResult(storm::storage::ParameterRegion<ValueType> const& region, std::shared_ptr<storm::analysis::Order> order, std::shared_ptr<storm::analysis::LocalMonotonicityResult<VariableType>> localMonotonicityResult) override;
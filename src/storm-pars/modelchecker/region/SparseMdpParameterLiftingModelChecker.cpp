@@ -334,6 +334,14 @@ namespace storm {
             player1Matrix = matrixBuilder.build();
         }
 
+        template <typename SparseModelType, typename ConstantType>
+        void SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>::prepareConcurrentRegionAnalysis() {
+            SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::prepareConcurrentRegionAnalysis();
+            if (parameterLifter) {
+                parameterLifter->compileCollectedFunctions();
+            }
+        }
+
         template <typename SparseModelType, typename ConstantType>
         void SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>::reset() {
             maybeStates.resize(0);
@@ -34,6 +34,11 @@ namespace storm {
             boost::optional<storm::storage::Scheduler<ConstantType>> getCurrentMinScheduler();
             boost::optional<storm::storage::Scheduler<ConstantType>> getCurrentMaxScheduler();
             boost::optional<storm::storage::Scheduler<ConstantType>> getCurrentPlayer1Scheduler();
+
+            /*!
+             * Also compiles the functions of the lifted model, which are otherwise compiled upon the first region analysis.
+             */
+            virtual void prepareConcurrentRegionAnalysis() override;
                 
         protected:
                 
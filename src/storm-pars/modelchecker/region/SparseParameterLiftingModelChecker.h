@@ -60,6 +60,16 @@ namespace storm {
             virtual std::pair<typename SparseModelType::ValueType, typename storm::storage::ParameterRegion<typename SparseModelType::ValueType>::Valuation> computeExtremalValue(Environment const& env, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters, typename SparseModelType::ValueType const& precision, bool absolutePrecision) override;
             virtual bool checkExtremalValue(Environment const& env, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters, typename SparseModelType::ValueType const& precision, bool absolutePrecision, typename SparseModelType::ValueType const& valueToCheck) override;
 
+            /*!
+             * Regions can only be analyzed concurrently if the lifted model is evaluated with floating point numbers.
+             */
+            virtual bool isConcurrentRegionAnalysisSupported() const override;
+
+            /*!
+             * Creates the instantiation checker that is otherwise created upon the first region analysis.
+             */
+            virtual void prepareConcurrentRegionAnalysis() override;
+
             SparseModelType const& getConsideredParametricModel() const;
             CheckTask<storm::logic::Formula, ConstantType> const& getCurrentCheckTask() const;
             
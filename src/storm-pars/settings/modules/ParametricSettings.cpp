@@ -4,7 +4,10 @@
 #include "storm/settings/OptionBuilder.h"
 #include "storm/settings/ArgumentBuilder.h"
 #include "storm/settings/Argument.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/macros.h"
 #include "storm/exceptions/IllegalArgumentValueException.h"
 
@@ -21,6 +24,7 @@ namespace storm {
             const std::string ParametricSettings::samplesOptionName = "samples";
             const std::string ParametricSettings::samplesGraphPreservingOptionName = "samples-graph-preserving";
             const std::string ParametricSettings::sampleExactOptionName = "sample-exact";
+            const std::string ParametricSettings::sampleThreadsOptionName = "sample-threads";
             const std::string ParametricSettings::useMonotonicityName = "use-monotonicity";
 //            const std::string ParametricSettings::onlyGlobalName = "onlyGlobal";
             const std::string ParametricSettings::timeTravellingEnabledName = "time-travel";
@@ -36,6 +40,8 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("samples", "The samples are semicolon-separated entries of the form 'Var1=Val1:Val2:...:Valk,Var2=... that span the sample spaces.").setDefaultValueString("").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, samplesGraphPreservingOptionName, false, "Sets whether it can be assumed that the samples are graph-preserving.").build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, sampleExactOptionName, false, "Sets whether to sample using exact arithmetic.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, sampleThreadsOptionName, false, "Sets the number of threads that check samples concurrently. If not set, the number of threads of the core settings is used.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads. If zero, the number of available hardware threads is used.").setDefaultValueUnsignedInteger(1).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, useMonotonicityName, false, "If set, monotonicity will be used.").build());
 //                this->addOption(storm::settings::OptionBuilder(moduleName, onlyGlobalName, false, "If set, only global monotonicity will be used.").build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, timeTravellingEnabledName, false, "Enabled time travelling (flip transitions to improve PLA bounds).").build());
@@ -74,6 +80,13 @@ namespace storm {
                 return this->getOption(sampleExactOptionName).getHasOptionBeenSet();
             }
 
+            uint64_t ParametricSettings::getNumberOfSampleThreads() const {
+                if (!this->getOption(sampleThreadsOptionName).getHasOptionBeenSet()) {
+                    return storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads();
+                }
+                return storm::utility::getNumberOfThreads(this->getOption(sampleThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger());
+            }
+
             bool ParametricSettings::isUseMonotonicitySet() const {
                 return this->getOption(useMonotonicityName).getHasOptionBeenSet();
             }
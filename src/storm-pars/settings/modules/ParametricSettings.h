@@ -64,6 +64,12 @@ namespace storm {
                  */
                 bool isSampleExactSet() const;
 
+                /*!
+                 * Retrieves the number of threads that check samples concurrently.
+                 * If the option is not set, the number of threads of the core settings is returned.
+                 */
+                uint64_t getNumberOfSampleThreads() const;
+
                 /*!
                  * Retrieves whether monotonicity should be used
                  */
@@ -92,6 +98,7 @@ namespace storm {
                 const static std::string samplesOptionName;
                 const static std::string samplesGraphPreservingOptionName;
                 const static std::string sampleExactOptionName;
+                const static std::string sampleThreadsOptionName;
                 const static std::string useMonotonicityName;
 				const static std::string timeTravellingEnabledName;
 				const static std::string linearToSimpleEnabledName;
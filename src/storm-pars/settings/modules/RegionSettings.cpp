@@ -7,6 +7,7 @@
 #include "storm/settings/OptionBuilder.h"
 #include "storm/settings/ArgumentBuilder.h"
 
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/macros.h"
 #include "storm/exceptions/IllegalArgumentValueException.h"
 #include "storm/exceptions/InvalidOperationException.h"
@@ -28,6 +29,7 @@ namespace storm {
             const std::string RegionSettings::checkEngineOptionName = "engine";
             const std::string RegionSettings::printNoIllustrationOptionName = "noillustration";
             const std::string RegionSettings::printFullResultOptionName = "printfullresult";
+            const std::string RegionSettings::numberOfThreadsOptionName = "threads";
             
             RegionSettings::RegionSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, regionOptionName, false, "Sets the region(s) considered for analysis.").setShortName(regionShortOptionName)
@@ -64,6 +66,9 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, printNoIllustrationOptionName, false, "If set, no illustration of the result is printed.").build());
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, printFullResultOptionName, false, "If set, the full result for every region is printed.").build());
+
+                this->addOption(storm::settings::OptionBuilder(moduleName, numberOfThreadsOptionName, true, "Sets the number of threads that analyze regions concurrently during region refinement. If not set, the number of threads of the core settings is used.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads. If zero, the number of available hardware threads is used.").setDefaultValueUnsignedInteger(1).build()).build());
             }
             
             bool RegionSettings::isRegionSet() const {
@@ -197,6 +202,14 @@ namespace storm {
                 return this->getOption(printNoIllustrationOptionName).getHasOptionBeenSet();
             }
             
+            bool RegionSettings::isNumberOfThreadsSet() const {
+                return this->getOption(numberOfThreadsOptionName).getHasOptionBeenSet();
+            }
+
+            uint64_t RegionSettings::getNumberOfThreads() const {
+                return storm::utility::getNumberOfThreads(this->getOption(numberOfThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger());
+            }
+
             bool RegionSettings::isPrintFullResultSet() const {
                 return this->getOption(printFullResultOptionName).getHasOptionBeenSet();
             }
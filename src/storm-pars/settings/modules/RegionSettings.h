@@ -110,6 +110,16 @@ namespace storm {
                  * Retrieves whether the full result should be printed
                  */
                 bool isPrintFullResultSet() const;
+
+                /*!
+                 * Retrieves whether the number of threads that analyze regions concurrently during region refinement has been set.
+                 */
+                bool isNumberOfThreadsSet() const;
+
+                /*!
+                 * Retrieves the number of threads that analyze regions concurrently during region refinement.
+                 */
+                uint64_t getNumberOfThreads() const;
                 
                 bool check() const override;
                 
@@ -128,6 +138,7 @@ namespace storm {
 				const static std::string checkEngineOptionName;
 				const static std::string printNoIllustrationOptionName;
 				const static std::string printFullResultOptionName;
+				const static std::string numberOfThreadsOptionName;
             };
             
         } // namespace modules
@@ -1,5 +1,8 @@
 #include "storm-pars/transformer/ParameterLifter.h"
 
+#include <algorithm>
+#include <map>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/utility/vector.h"
 #include "storm/exceptions/UnexpectedException.h"
@@ -230,6 +233,13 @@ namespace storm {
             return occurringVariablesAtState;
         }
 
+        template<typename ParametricType, typename ConstantType>
+        void ParameterLifter<ParametricType, ConstantType>::compileCollectedFunctions() {
+            if constexpr (std::is_same<ParametricType, storm::RationalFunction>::value && std::is_same<ConstantType, double>::value) {
+                functionValuationCollector.compileCollectedFunctions();
+            }
+        }
+
         template<typename ParametricType, typename ConstantType>
         std::map<typename ParameterLifter<ParametricType, ConstantType>::VariableType, std::set<uint_fast64_t>> ParameterLifter<ParametricType, ConstantType>::getOccuringStatesAtVariable() const {
             return occuringStatesAtVariable;
@@ -326,29 +336,129 @@ namespace storm {
             // insert the function and the valuation
             //Note that references to elements of an unordered map remain valid after calling unordered_map::insert.
             auto insertionRes = collectedFunctions.insert(std::pair<FunctionValuation, ConstantType>(FunctionValuation(std::move(simplifiedFunction), std::move(simplifiedValuation)), storm::utility::one<ConstantType>()));
+            if (insertionRes.second) {
+                collectedFunctionsCompiled = false;
+            }
             return insertionRes.first->second;
         }
     
         template<typename ParametricType, typename ConstantType>
         void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::evaluateCollectedFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters) {
+            if constexpr (std::is_same<ParametricType, storm::RationalFunction>::value && std::is_same<ConstantType, double>::value) {
+                evaluateCompiledFunctions(region, dirForUnspecifiedParameters);
+            } else {
+                for (auto &collectedFunctionValuationPlaceholder : collectedFunctions) {
+                    ParametricType const &function = collectedFunctionValuationPlaceholder.first.first;
+                    AbstractValuation const &abstrValuation = collectedFunctionValuationPlaceholder.first.second;
+                    ConstantType &placeholder = collectedFunctionValuationPlaceholder.second;
+                    auto concreteValuations = abstrValuation.getConcreteValuations(region);
+                    auto concreteValuationIt = concreteValuations.begin();
+                    placeholder = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(function, *concreteValuationIt));
+                    for (++concreteValuationIt; concreteValuationIt != concreteValuations.end(); ++concreteValuationIt) {
+                        ConstantType currentResult = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(function, *concreteValuationIt));
+                        if (storm::solver::minimize(dirForUnspecifiedParameters)) {
+                            placeholder = std::min(placeholder, currentResult);
+                        } else {
+                            placeholder = std::max(placeholder, currentResult);
+                        }
+                    }
+                }
+            }
+        }
+        
+        template<typename ParametricType, typename ConstantType>
+        void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::compileCollectedFunctions() {
+            if (collectedFunctionsCompiled) {
+                return;
+            }
+            std::map<std::set<VariableType>, uint64_t> variablesToGroup;
+            std::vector<std::vector<ParametricType>> groupFunctions;
+            compiledFunctionGroups.clear();
             for (auto &collectedFunctionValuationPlaceholder : collectedFunctions) {
                 ParametricType const &function = collectedFunctionValuationPlaceholder.first.first;
                 AbstractValuation const &abstrValuation = collectedFunctionValuationPlaceholder.first.second;
-                ConstantType &placeholder = collectedFunctionValuationPlaceholder.second;
-                auto concreteValuations = abstrValuation.getConcreteValuations(region);
-                auto concreteValuationIt = concreteValuations.begin();
-                placeholder = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(function, *concreteValuationIt));
-                for (++concreteValuationIt; concreteValuationIt != concreteValuations.end(); ++concreteValuationIt) {
-                    ConstantType currentResult = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(function, *concreteValuationIt));
-                    if (storm::solver::minimize(dirForUnspecifiedParameters)) {
-                        placeholder = std::min(placeholder, currentResult);
-                    } else {
-                        placeholder = std::max(placeholder, currentResult);
+                std::set<VariableType> variables;
+                storm::utility::parametric::gatherOccurringVariables(function, variables);
+                STORM_LOG_THROW(variables.size() < 64, storm::exceptions::NotSupportedException, "Functions with " << variables.size() << " parameters are not supported.");
+                auto groupIt = variablesToGroup.emplace(variables, compiledFunctionGroups.size()).first;
+                if (groupIt->second == compiledFunctionGroups.size()) {
+                    compiledFunctionGroups.emplace_back();
+                    groupFunctions.emplace_back();
+                }
+                CompiledFunctionGroup& group = compiledFunctionGroups[groupIt->second];
+                groupFunctions[groupIt->second].push_back(function);
+                group.placeholders.push_back(&collectedFunctionValuationPlaceholder.second);
+
+                // The base vertex sets the upper parameters to their upper bound. The unspecified parameters range over both bounds.
+                uint64_t baseVertex = 0, unspecifiedMask = 0, bit = 1;
+                for (auto const& var : variables) {
+                    if (abstrValuation.getUpperParameters().count(var) > 0) {
+                        baseVertex |= bit;
+                    } else if (abstrValuation.getUnspecifiedParameters().count(var) > 0) {
+                        unspecifiedMask |= bit;
+                    }
+                    bit <<= 1;
+                }
+                std::vector<uint64_t> vertices;
+                for (uint64_t subset = unspecifiedMask; ; subset = (subset - 1) & unspecifiedMask) {
+                    vertices.push_back(baseVertex | subset);
+                    if (subset == 0) {
+                        break;
+                    }
+                }
+                group.vertices.push_back(std::move(vertices));
+            }
+            for (uint64_t groupIndex = 0; groupIndex < compiledFunctionGroups.size(); ++groupIndex) {
+                CompiledFunctionGroup& group = compiledFunctionGroups[groupIndex];
+                group.functions = std::make_shared<storm::utility::parametric::CompiledRationalFunctions>(groupFunctions[groupIndex]);
+                // Only the vertices that are referenced by one of the functions are evaluated.
+                for (auto const& vertices : group.vertices) {
+                    group.evaluatedVertices.insert(group.evaluatedVertices.end(), vertices.begin(), vertices.end());
+                }
+                std::sort(group.evaluatedVertices.begin(), group.evaluatedVertices.end());
+                group.evaluatedVertices.erase(std::unique(group.evaluatedVertices.begin(), group.evaluatedVertices.end()), group.evaluatedVertices.end());
+                for (auto& vertices : group.vertices) {
+                    for (auto& vertex : vertices) {
+                        vertex = std::lower_bound(group.evaluatedVertices.begin(), group.evaluatedVertices.end(), vertex) - group.evaluatedVertices.begin();
                     }
                 }
             }
+            collectedFunctionsCompiled = true;
         }
-        
+
+        template<typename ParametricType, typename ConstantType>
+        void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::evaluateCompiledFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters) {
+            compileCollectedFunctions();
+            for (auto& group : compiledFunctionGroups) {
+                auto const& variables = group.functions->getVariables();
+                uint64_t const numberOfVertices = group.evaluatedVertices.size();
+                variableValues.resize(variables.size() * numberOfVertices);
+                for (uint64_t var = 0; var < variables.size(); ++var) {
+                    double lower = storm::utility::convertNumber<double>(region.getLowerBoundary(variables[var]));
+                    double upper = storm::utility::convertNumber<double>(region.getUpperBoundary(variables[var]));
+                    for (uint64_t vertexIndex = 0; vertexIndex < numberOfVertices; ++vertexIndex) {
+                        variableValues[var * numberOfVertices + vertexIndex] = ((group.evaluatedVertices[vertexIndex] >> var) & 1) ? upper : lower;
+                    }
+                }
+                group.functions->evaluate(variableValues, numberOfVertices, functionValues);
+
+                for (uint64_t function = 0; function < group.placeholders.size(); ++function) {
+                    double const* values = functionValues.data() + function * numberOfVertices;
+                    auto vertexIt = group.vertices[function].begin();
+                    ConstantType result = storm::utility::convertNumber<ConstantType>(values[*vertexIt]);
+                    for (++vertexIt; vertexIt != group.vertices[function].end(); ++vertexIt) {
+                        ConstantType currentResult = storm::utility::convertNumber<ConstantType>(values[*vertexIt]);
+                        if (storm::solver::minimize(dirForUnspecifiedParameters)) {
+                            result = std::min(result, currentResult);
+                        } else {
+                            result = std::max(result, currentResult);
+                        }
+                    }
+                    *group.placeholders[function] = result;
+                }
+            }
+        }
+
         template class ParameterLifter<storm::RationalFunction, double>;
         template class ParameterLifter<storm::RationalFunction, storm::RationalNumber>;
     }
@@ -7,6 +7,7 @@
 
 
 #include "storm-pars/storage/ParameterRegion.h"
+#include "storm-pars/utility/CompiledRationalFunctions.h"
 #include "storm-pars/utility/parametric.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
@@ -71,6 +72,12 @@ namespace storm {
 
             std::vector<std::set<VariableType>> const& getOccurringVariablesAtState() const;
 
+            /*!
+             * If the functions are evaluated with floating point numbers, the collected functions are compiled (see CompiledRationalFunctions).
+             * Otherwise, this has no effect. Without calling this, the functions are compiled when a region is specified for the first time.
+             */
+            void compileCollectedFunctions();
+
             std::map<VariableType, std::set<uint_fast64_t>> getOccuringStatesAtVariable() const;
 
             uint_fast64_t getRowGroupIndex(uint_fast64_t originalState) const;
@@ -133,6 +140,11 @@ namespace storm {
                 ConstantType& add(ParametricType const& function, AbstractValuation const& valuation);
 
                 void evaluateCollectedFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters);
+
+                /*!
+                 * Compiles the collected functions such that they can be evaluated with floating point numbers (only if ConstantType is double).
+                 */
+                void compileCollectedFunctions();
                 
             private:
                 // Stores a function and a valuation. The valuation is stored as an index of the collectedValuations-vector.
@@ -150,6 +162,26 @@ namespace storm {
 
                 // Stores the collected functions with the valuations together with a placeholder for the result.
                 std::unordered_map<FunctionValuation, ConstantType, FuncValHash> collectedFunctions;
+
+                /*!
+                 * Evaluates the collected functions using compiled functions (only if ConstantType is double).
+                 * The collected functions are compiled upon the first call.
+                 */
+                void evaluateCompiledFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters);
+
+                // Functions over the same set of variables are compiled together and evaluated at the vertices of the region w.r.t. these variables.
+                // A vertex is encoded by a bit mask where bit i is set iff the i-th variable is at its upper bound.
+                struct CompiledFunctionGroup {
+                    std::shared_ptr<storm::utility::parametric::CompiledRationalFunctions> functions;
+                    std::vector<ConstantType*> placeholders;
+                    // The (sorted) vertices at which the functions are evaluated, i.e., the vertices that are referenced by at least one function.
+                    std::vector<uint64_t> evaluatedVertices;
+                    // For each function, the positions (in evaluatedVertices) of the vertices that are represented by the abstract valuation of the function.
+                    std::vector<std::vector<uint64_t>> vertices;
+                };
+                std::vector<CompiledFunctionGroup> compiledFunctionGroups;
+                bool collectedFunctionsCompiled = false;
+                std::vector<double> variableValues, functionValues;
             };
             
             FunctionValuationCollector functionValuationCollector;
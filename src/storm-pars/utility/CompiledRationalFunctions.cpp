@@ -0,0 +1,195 @@
+#include "storm-pars/utility/CompiledRationalFunctions.h"
+
+#include <algorithm>
+#include <limits>
+#include <set>
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace utility {
+        namespace parametric {
+
+#ifdef STORM_HAVE_CARL
+            const uint64_t CompiledRationalFunctions::NoDenominator = std::numeric_limits<uint64_t>::max();
+            const uint64_t CompiledRationalFunctions::BlockSize = 64;
+
+            CompiledRationalFunctions::CompiledRationalFunctions(std::vector<storm::RationalFunction> const& functions) {
+                std::set<storm::RationalFunctionVariable> variableSet;
+                for (auto const& function : functions) {
+                    function.gatherVariables(variableSet);
+                }
+                variables.assign(variableSet.begin(), variableSet.end());
+                for (uint64_t i = 0; i < variables.size(); ++i) {
+                    variableToValueIndex.emplace(variables[i], i + 1);
+                }
+
+                termOffsets.push_back(0);
+                numerators.reserve(functions.size());
+                denominators.reserve(functions.size());
+                for (auto const& function : functions) {
+                    if (function.isConstant()) {
+                        storm::RawPolynomial constant(function.constantPart());
+                        numerators.push_back(addPolynomial(constant, 1.0));
+                        denominators.push_back(NoDenominator);
+                    } else if (function.denominator().isConstant()) {
+                        // Constant denominators are folded into the coefficients of the numerator.
+                        double factor = storm::utility::one<double>() / storm::utility::convertNumber<double>(function.denominator().constantPart());
+                        numerators.push_back(addPolynomial(function.nominator().polynomialWithCoefficient(), factor));
+                        denominators.push_back(NoDenominator);
+                    } else {
+                        numerators.push_back(addPolynomial(function.nominator().polynomialWithCoefficient(), 1.0));
+                        denominators.push_back(addPolynomial(function.denominator().polynomialWithCoefficient(), 1.0));
+                    }
+                }
+                STORM_LOG_DEBUG("Compiled " << functions.size() << " functions into " << (termOffsets.size() - 1) << " polynomials with " << termCoefficients.size() << " terms and " << products.size() << " products.");
+            }
+
+            std::vector<storm::RationalFunctionVariable> const& CompiledRationalFunctions::getVariables() const {
+                return variables;
+            }
+
+            uint64_t CompiledRationalFunctions::getNumberOfFunctions() const {
+                return numerators.size();
+            }
+
+            void CompiledRationalFunctions::evaluate(std::vector<double> const& variableValues, uint64_t numberOfPoints, std::vector<double>& result) {
+                STORM_LOG_ASSERT(variableValues.size() == variables.size() * numberOfPoints, "Unexpected number of variable values.");
+                result.resize(numerators.size() * numberOfPoints);
+                values.resize((1 + variables.size() + products.size()) * BlockSize);
+                polynomialValues.resize((termOffsets.size() - 1) * BlockSize);
+
+                for (uint64_t blockStart = 0; blockStart < numberOfPoints; blockStart += BlockSize) {
+                    uint64_t const blockSize = std::min(BlockSize, numberOfPoints - blockStart);
+
+                    // Values of the monomials. The i-th value of the block is stored at positions i * BlockSize, ..., i * BlockSize + blockSize - 1.
+                    std::fill(values.begin(), values.begin() + blockSize, storm::utility::one<double>());
+                    for (uint64_t variable = 0; variable < variables.size(); ++variable) {
+                        auto sourceIt = variableValues.begin() + variable * numberOfPoints + blockStart;
+                        std::copy(sourceIt, sourceIt + blockSize, values.begin() + (variable + 1) * BlockSize);
+                    }
+                    double* target = values.data() + (variables.size() + 1) * BlockSize;
+                    for (auto const& product : products) {
+                        double const* left = values.data() + product.first * BlockSize;
+                        double const* right = values.data() + product.second * BlockSize;
+                        for (uint64_t point = 0; point < blockSize; ++point) {
+                            target[point] = left[point] * right[point];
+                        }
+                        target += BlockSize;
+                    }
+
+                    // Values of the polynomials.
+                    for (uint64_t polynomial = 0; polynomial + 1 < termOffsets.size(); ++polynomial) {
+                        double* polynomialTarget = polynomialValues.data() + polynomial * BlockSize;
+                        std::fill(polynomialTarget, polynomialTarget + blockSize, storm::utility::zero<double>());
+                        for (uint64_t term = termOffsets[polynomial]; term < termOffsets[polynomial + 1]; ++term) {
+                            double const coefficient = termCoefficients[term];
+                            double const* monomial = values.data() + termValueIndices[term] * BlockSize;
+                            for (uint64_t point = 0; point < blockSize; ++point) {
+                                polynomialTarget[point] += coefficient * monomial[point];
+                            }
+                        }
+                    }
+
+                    // Values of the functions.
+                    for (uint64_t function = 0; function < numerators.size(); ++function) {
+                        double const* numerator = polynomialValues.data() + numerators[function] * BlockSize;
+                        double* functionTarget = result.data() + function * numberOfPoints + blockStart;
+                        if (denominators[function] == NoDenominator) {
+                            std::copy(numerator, numerator + blockSize, functionTarget);
+                        } else {
+                            double const* denominator = polynomialValues.data() + denominators[function] * BlockSize;
+                            for (uint64_t point = 0; point < blockSize; ++point) {
+                                functionTarget[point] = numerator[point] / denominator[point];
+                            }
+                        }
+                    }
+                }
+            }
+
+            void CompiledRationalFunctions::evaluate(Valuation<storm::RationalFunction> const& valuation, std::vector<double>& result) {
+                pointValues.resize(variables.size());
+                for (uint64_t variable = 0; variable < variables.size(); ++variable) {
+                    auto valueIt = valuation.find(variables[variable]);
+                    STORM_LOG_THROW(valueIt != valuation.end(), storm::exceptions::InvalidArgumentException, "No value given for variable " << variables[variable] << ".");
+                    pointValues[variable] = storm::utility::convertNumber<double>(valueIt->second);
+                }
+                evaluate(pointValues, 1, result);
+            }
+
+            uint64_t CompiledRationalFunctions::getPowerIndex(uint64_t variable, uint64_t exponent) {
+                if (exponent == 1) {
+                    return variable;
+                }
+                std::vector<std::pair<uint64_t, uint64_t>> key = {{variable, exponent}};
+                auto findRes = monomialToValueIndex.find(key);
+                if (findRes != monomialToValueIndex.end()) {
+                    return findRes->second;
+                }
+                // Powers are obtained by repeated squaring such that they share their intermediate results.
+                uint64_t result;
+                if (exponent % 2 == 0) {
+                    uint64_t half = getPowerIndex(variable, exponent / 2);
+                    result = addProduct(half, half);
+                } else {
+                    result = addProduct(getPowerIndex(variable, exponent - 1), variable);
+                }
+                monomialToValueIndex.emplace(std::move(key), result);
+                return result;
+            }
+
+            uint64_t CompiledRationalFunctions::getMonomialIndex(std::vector<std::pair<uint64_t, uint64_t>> const& monomial) {
+                if (monomial.empty()) {
+                    return 0;
+                } else if (monomial.size() == 1) {
+                    return getPowerIndex(monomial.front().first, monomial.front().second);
+                }
+                auto findRes = monomialToValueIndex.find(monomial);
+                if (findRes != monomialToValueIndex.end()) {
+                    return findRes->second;
+                }
+                // Multiply the monomial without its last variable with the power of the last variable.
+                std::vector<std::pair<uint64_t, uint64_t>> prefix(monomial.begin(), monomial.end() - 1);
+                uint64_t result = addProduct(getMonomialIndex(prefix), getPowerIndex(monomial.back().first, monomial.back().second));
+                monomialToValueIndex.emplace(monomial, result);
+                return result;
+            }
+
+            uint64_t CompiledRationalFunctions::addPolynomial(storm::RawPolynomial const& polynomial, double factor) {
+                std::vector<std::pair<uint64_t, double>> terms;
+                std::set<storm::RationalFunctionVariable> termVariables;
+                for (auto termIt = polynomial.begin(); termIt != polynomial.end(); ++termIt) {
+                    double coefficient = factor * storm::utility::convertNumber<double>(termIt->coeff());
+                    std::vector<std::pair<uint64_t, uint64_t>> monomial;
+                    termVariables.clear();
+                    termIt->gatherVariables(termVariables);
+                    for (auto const& variable : termVariables) {
+                        monomial.emplace_back(variableToValueIndex.at(variable), termIt->monomial()->exponentOfVariable(variable));
+                    }
+                    terms.emplace_back(getMonomialIndex(monomial), coefficient);
+                }
+
+                auto findRes = termsToPolynomialIndex.find(terms);
+                if (findRes != termsToPolynomialIndex.end()) {
+                    return findRes->second;
+                }
+                for (auto const& term : terms) {
+                    termValueIndices.push_back(term.first);
+                    termCoefficients.push_back(term.second);
+                }
+                termOffsets.push_back(termCoefficients.size());
+                uint64_t result = termOffsets.size() - 2;
+                termsToPolynomialIndex.emplace(std::move(terms), result);
+                return result;
+            }
+
+            uint64_t CompiledRationalFunctions::addProduct(uint64_t left, uint64_t right) {
+                products.emplace_back(left, right);
+                return variables.size() + products.size();
+            }
+#endif
+        }
+    }
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "storm-pars/utility/parametric.h"
+
+namespace storm {
+    namespace utility {
+        namespace parametric {
+
+            /*!
+             * Compiles a collection of rational functions into a flat program that evaluates all functions at once using floating point arithmetic.
+             * Monomials are shared among all functions and each monomial (and each power of a variable) is obtained with a single multiplication
+             * from a previously computed monomial. Polynomials that occur several times (e.g. common denominators) are evaluated only once.
+             *
+             * The program can evaluate the functions for many valuations in one call. Valuations are processed in blocks such that
+             * the innermost loops run over the valuations of a block, which allows the compiler to vectorize them.
+             *
+             * @note In contrast to storm::utility::parametric::evaluate, the results are subject to rounding errors.
+             */
+            class CompiledRationalFunctions {
+            public:
+                /*!
+                 * Compiles the given functions.
+                 */
+                CompiledRationalFunctions(std::vector<storm::RationalFunction> const& functions);
+
+                /*!
+                 * Retrieves the variables occurring in the compiled functions (in ascending order).
+                 * Values of variables are passed to evaluate in this order.
+                 */
+                std::vector<storm::RationalFunctionVariable> const& getVariables() const;
+
+                /*!
+                 * Retrieves the number of compiled functions.
+                 */
+                uint64_t getNumberOfFunctions() const;
+
+                /*!
+                 * Evaluates all functions for the given points.
+                 *
+                 * @param variableValues The value of the i-th variable at the j-th point is stored at position i * numberOfPoints + j.
+                 * @param numberOfPoints The number of points.
+                 * @param result The value of the k-th function at the j-th point is written to position k * numberOfPoints + j.
+                 */
+                void evaluate(std::vector<double> const& variableValues, uint64_t numberOfPoints, std::vector<double>& result);
+
+                /*!
+                 * Evaluates all functions for the given valuation, which has to assign a value to each occurring variable.
+                 * The value of the k-th function is written to position k of the result.
+                 */
+                void evaluate(Valuation<storm::RationalFunction> const& valuation, std::vector<double>& result);
+
+            private:
+                /*!
+                 * Retrieves the index of the value that holds the given variable raised to the given exponent, adding the required products.
+                 */
+                uint64_t getPowerIndex(uint64_t variable, uint64_t exponent);
+
+                /*!
+                 * Retrieves the index of the value that holds the given monomial (given as pairs of variables and exponents, ordered by variable),
+                 * adding the required products.
+                 */
+                uint64_t getMonomialIndex(std::vector<std::pair<uint64_t, uint64_t>> const& monomial);
+
+                /*!
+                 * Adds the given polynomial (scaled with the given factor) unless the same polynomial was added before and returns its index.
+                 */
+                uint64_t addPolynomial(storm::RawPolynomial const& polynomial, double factor);
+
+                /*!
+                 * Adds a product of the two given values and returns its index.
+                 */
+                uint64_t addProduct(uint64_t left, uint64_t right);
+
+                /// Marks functions without denominator.
+                static const uint64_t NoDenominator;
+
+                /// The number of points that are evaluated together.
+                static const uint64_t BlockSize;
+
+                /// The occurring variables. Value 0 is the constant one and values 1 to n are the variables.
+                std::vector<storm::RationalFunctionVariable> variables;
+                std::map<storm::RationalFunctionVariable, uint64_t> variableToValueIndex;
+
+                /// The remaining values are products of two previously computed values.
+                std::vector<std::pair<uint64_t, uint64_t>> products;
+                std::map<std::vector<std::pair<uint64_t, uint64_t>>, uint64_t> monomialToValueIndex;
+
+                /// The terms of the i-th polynomial are the ones with indices termOffsets[i], ..., termOffsets[i+1] - 1.
+                std::vector<uint64_t> termOffsets;
+                std::vector<double> termCoefficients;
+                std::vector<uint64_t> termValueIndices;
+                std::map<std::vector<std::pair<uint64_t, double>>, uint64_t> termsToPolynomialIndex;
+
+                /// For each function, the indices of the polynomials of the numerator and the denominator.
+                std::vector<uint64_t> numerators;
+                std::vector<uint64_t> denominators;
+
+                /// Workspace for the values of monomials and polynomials of the current block.
+                std::vector<double> values;
+                std::vector<double> polynomialValues;
+                std::vector<double> pointValues;
+            };
+
+        }
+    }
+}
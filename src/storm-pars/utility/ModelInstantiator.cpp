@@ -1,5 +1,10 @@
 #include "storm-pars/utility/ModelInstantiator.h"
+
+#include <algorithm>
+
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 
 namespace storm {
     namespace utility {
@@ -21,6 +26,16 @@ namespace storm {
                         initializeMatrixMapping(rewModel.second.getTransitionRewardMatrix(), this->functions, this->matrixMapping, parametricModel.getRewardModel(rewModel.first).getTransitionRewardMatrix());
                     }
                 }
+
+                if constexpr (std::is_same<ParametricType, storm::RationalFunction>::value && std::is_same<ConstantType, double>::value) {
+                    std::vector<ParametricType> functionVector;
+                    functionVector.reserve(this->functions.size());
+                    for (auto& functionResult : this->functions) {
+                        functionVector.push_back(functionResult.first);
+                        compiledFunctionPlaceholders.push_back(&functionResult.second);
+                    }
+                    compiledFunctions = std::make_shared<storm::utility::parametric::CompiledRationalFunctions>(functionVector);
+                }
             }
             
             template<typename ParametricSparseModelType, typename ConstantType>
@@ -137,8 +152,58 @@ namespace storm {
             template<typename ParametricSparseModelType, typename ConstantSparseModelType>
             ConstantSparseModelType const& ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::instantiate(storm::utility::parametric::Valuation<ParametricType> const& valuation){
                 //Write results into the placeholders
-                instantiate_helper(valuation);
+                if (compiledFunctions) {
+                    compiledFunctions->evaluate(valuation, compiledFunctionValues);
+                    for (uint_fast64_t function = 0; function < compiledFunctionPlaceholders.size(); ++function) {
+                        *compiledFunctionPlaceholders[function] = storm::utility::convertNumber<ConstantType>(compiledFunctionValues[function]);
+                    }
+                } else {
+                    instantiate_helper(valuation);
+                }
                 
+                writePlaceholderValues();
+                return *this->instantiatedModel;
+            }
+
+            template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+            void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::instantiate(std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations,
+                                                                                                   std::function<void(uint64_t, ConstantSparseModelType const&)> const& callback) {
+                if (!compiledFunctions) {
+                    for (uint_fast64_t index = 0; index < valuations.size(); ++index) {
+                        callback(index, instantiate(valuations[index]));
+                    }
+                    return;
+                }
+
+                // Evaluate the functions for a chunk of valuations at once. The size of a chunk bounds the memory required for the results.
+                uint_fast64_t const chunkSize = 1024;
+                auto const& variables = compiledFunctions->getVariables();
+                std::vector<double> variableValues;
+                for (uint_fast64_t chunkStart = 0; chunkStart < valuations.size(); chunkStart += chunkSize) {
+                    uint_fast64_t const numberOfPoints = std::min<uint_fast64_t>(chunkSize, valuations.size() - chunkStart);
+                    variableValues.resize(variables.size() * numberOfPoints);
+                    for (uint_fast64_t point = 0; point < numberOfPoints; ++point) {
+                        auto const& valuation = valuations[chunkStart + point];
+                        for (uint_fast64_t variable = 0; variable < variables.size(); ++variable) {
+                            auto valueIt = valuation.find(variables[variable]);
+                            STORM_LOG_THROW(valueIt != valuation.end(), storm::exceptions::InvalidArgumentException, "No value given for variable " << variables[variable] << ".");
+                            variableValues[variable * numberOfPoints + point] = storm::utility::convertNumber<double>(valueIt->second);
+                        }
+                    }
+                    compiledFunctions->evaluate(variableValues, numberOfPoints, compiledFunctionValues);
+
+                    for (uint_fast64_t point = 0; point < numberOfPoints; ++point) {
+                        for (uint_fast64_t function = 0; function < compiledFunctionPlaceholders.size(); ++function) {
+                            *compiledFunctionPlaceholders[function] = storm::utility::convertNumber<ConstantType>(compiledFunctionValues[function * numberOfPoints + point]);
+                        }
+                        writePlaceholderValues();
+                        callback(chunkStart + point, *this->instantiatedModel);
+                    }
+                }
+            }
+
+            template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+            void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::writePlaceholderValues() {
                 //Write the instantiated values to the matrices and vectors according to the stored mappings
                 for(auto& entryValuePair : this->matrixMapping){
                     entryValuePair.first->setValue(*(entryValuePair.second));
@@ -146,8 +211,6 @@ namespace storm {
                 for(auto& entryValuePair : this->vectorMapping){
                     *(entryValuePair.first)=*(entryValuePair.second);
                 }
-                
-                return *this->instantiatedModel;
             }
         
         template<typename ParametricSparseModelType, typename ConstantSparseModelType>
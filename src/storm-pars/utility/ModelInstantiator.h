@@ -2,9 +2,11 @@
 #define	STORM_UTILITY_MODELINSTANTIATOR_H
 
 #include <unordered_map>
+#include <functional>
 #include <memory>
 #include <type_traits>
 
+#include "storm-pars/utility/CompiledRationalFunctions.h"
 #include "storm-pars/utility/parametric.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
@@ -21,6 +23,8 @@ namespace storm {
          * This class allows efficient instantiation of the given parametric model.
          * The key to efficiency is to evaluate every distinct transition- (or reward-) function only once
          * instead of evaluating the same function for each occurrence in the model. 
+         * If the model is instantiated with floating point numbers, the functions are compiled into a program that evaluates them
+         * without invoking CArL (see CompiledRationalFunctions).
          */
         template<typename ParametricSparseModelType, typename ConstantSparseModelType>
             class ModelInstantiator {
@@ -47,12 +51,25 @@ namespace storm {
                  * @return The instantiated model
                  */
                 ConstantSparseModelType const& instantiate(storm::utility::parametric::Valuation<ParametricType> const& valuation);
+
+                /*!
+                 * Instantiates the model for each of the given valuations (one after another) and invokes the given callback with the index of
+                 * the valuation and the instantiated model. The occurring functions are evaluated for many valuations at once.
+                 * @note The instantiated model passed to the callback is only valid until the callback returns.
+                 */
+                void instantiate(std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations,
+                                 std::function<void(uint64_t, ConstantSparseModelType const&)> const& callback);
                 
                 /*!
                  *  Check validity
                  */
                 void checkValid() const;
             private:
+                /*!
+                 * Writes the values of the placeholders to the matrices and vectors of the instantiated model.
+                 */
+                void writePlaceholderValues();
+
                 /*!
                  * Initializes the instantiatedModel with dummy data by considering the model-specific ingredients.
                  * Also initializes other model-specific data, e.g., the exitRate vector of a markov automaton
@@ -189,6 +206,10 @@ namespace storm {
                 std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType*>> matrixMapping; 
                 /// Connection of Vector entries with placeholders
                 std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType*>> vectorMapping; 
+                /// If the functions are evaluated with floating point numbers, the compiled functions together with the corresponding placeholders
+                std::shared_ptr<storm::utility::parametric::CompiledRationalFunctions> compiledFunctions;
+                std::vector<ConstantType*> compiledFunctionPlaceholders;
+                std::vector<double> compiledFunctionValues;
                 
                 
             };
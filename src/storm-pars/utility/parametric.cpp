@@ -1,4 +1,7 @@
 #include <string>
+#include <algorithm>
+#include <cmath>
+#include <numeric>
 
 #include "storm-pars/utility/parametric.h"
 #include "storm/utility/constants.h"
@@ -17,6 +20,46 @@ namespace storm {
         namespace parametric {
             
 #ifdef STORM_HAVE_CARL
+            namespace {
+                /*!
+                 * Computes the index of the given point on a Hilbert curve through the cube [0, 2^bits)^n (J. Skilling, Programming the Hilbert curve, 2004).
+                 * @note The product of n and bits must not exceed 64.
+                 */
+                uint64_t getHilbertIndex(std::vector<uint64_t> coordinates, uint64_t bits) {
+                    uint64_t const n = coordinates.size();
+                    // Transform the coordinates into the transposed index by undoing the excess work of the Gray code.
+                    for (uint64_t q = 1ull << (bits - 1); q > 1; q >>= 1) {
+                        uint64_t const p = q - 1;
+                        for (uint64_t i = 0; i < n; ++i) {
+                            if (coordinates[i] & q) {
+                                coordinates[0] ^= p;
+                            } else {
+                                uint64_t const t = (coordinates[0] ^ coordinates[i]) & p;
+                                coordinates[0] ^= t;
+                                coordinates[i] ^= t;
+                            }
+                        }
+                    }
+                    for (uint64_t i = 1; i < n; ++i) {
+                        coordinates[i] ^= coordinates[i - 1];
+                    }
+                    uint64_t t = 0;
+                    for (uint64_t q = 1ull << (bits - 1); q > 1; q >>= 1) {
+                        if (coordinates[n - 1] & q) {
+                            t ^= q - 1;
+                        }
+                    }
+                    // Interleave the bits of the transposed index.
+                    uint64_t result = 0;
+                    for (uint64_t bit = bits; bit > 0; --bit) {
+                        for (uint64_t i = 0; i < n; ++i) {
+                            result = (result << 1) | (((coordinates[i] ^ t) >> (bit - 1)) & 1);
+                        }
+                    }
+                    return result;
+                }
+            }
+
             template<>
             typename CoefficientType<storm::RationalFunction>::type evaluate<storm::RationalFunction>(storm::RationalFunction const& function, Valuation<storm::RationalFunction> const& valuation){
                 return function.evaluate(valuation);
@@ -51,6 +94,52 @@ namespace storm {
                 }
                 return true;
             }
+
+            template<>
+            std::vector<uint64_t> getLocalityPreservingOrder<storm::RationalFunction>(std::vector<Valuation<storm::RationalFunction>> const& valuations) {
+                std::vector<uint64_t> order(valuations.size());
+                std::iota(order.begin(), order.end(), 0);
+
+                // Get the bounding box of the valuations.
+                std::map<storm::RationalFunctionVariable, std::pair<double, double>> bounds;
+                for (auto const& valuation : valuations) {
+                    for (auto const& entry : valuation) {
+                        double value = storm::utility::convertNumber<double>(entry.second);
+                        auto insertionRes = bounds.emplace(entry.first, std::make_pair(value, value));
+                        if (!insertionRes.second) {
+                            insertionRes.first->second.first = std::min(insertionRes.first->second.first, value);
+                            insertionRes.first->second.second = std::max(insertionRes.first->second.second, value);
+                        }
+                    }
+                }
+                if (valuations.size() <= 2 || bounds.empty() || bounds.size() > 64) {
+                    return order;
+                }
+
+                // Discretize each coordinate such that the index on the curve fits into 64 bits.
+                uint64_t const bits = std::min<uint64_t>(16, 64 / bounds.size());
+                double const maxCoordinate = static_cast<double>((1ull << bits) - 1);
+                std::vector<uint64_t> curveIndices;
+                curveIndices.reserve(valuations.size());
+                std::vector<uint64_t> coordinates(bounds.size());
+                for (auto const& valuation : valuations) {
+                    uint64_t dimension = 0;
+                    for (auto const& variableBounds : bounds) {
+                        auto valueIt = valuation.find(variableBounds.first);
+                        double const width = variableBounds.second.second - variableBounds.second.first;
+                        if (valueIt == valuation.end() || width <= 0.0) {
+                            coordinates[dimension] = 0;
+                        } else {
+                            double const value = storm::utility::convertNumber<double>(valueIt->second);
+                            coordinates[dimension] = static_cast<uint64_t>(std::round((value - variableBounds.second.first) / width * maxCoordinate));
+                        }
+                        ++dimension;
+                    }
+                    curveIndices.push_back(getHilbertIndex(coordinates, bits));
+                }
+                std::stable_sort(order.begin(), order.end(), [&curveIndices] (uint64_t const& first, uint64_t const& second) { return curveIndices[first] < curveIndices[second]; });
+                return order;
+            }
 #endif
         }
     }
@@ -4,6 +4,7 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include <map>
+#include <vector>
 
 namespace storm {
     namespace utility {
@@ -59,6 +60,14 @@ namespace storm {
              */
             template<typename FunctionType>
             bool isMultiLinearPolynomial(FunctionType const& function);
+
+            /*!
+             * Computes an order of the given valuations in which consecutive valuations tend to be close to each other.
+             * For this, the valuations are sorted along a Hilbert curve through the bounding box of all valuations.
+             * @return the indices of the valuations in the computed order
+             */
+            template<typename FunctionType>
+            std::vector<uint64_t> getLocalityPreservingOrder(std::vector<Valuation<FunctionType>> const& valuations);
             
         }
         
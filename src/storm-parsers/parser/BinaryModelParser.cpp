@@ -0,0 +1,196 @@
+#include "storm-parsers/parser/BinaryModelParser.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "storm-parsers/parser/MappedFile.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/io/BinaryModelExporter.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace parser {
+
+namespace {
+/*!
+ * Reads the components of a model from a sequence of 64-bit words (see BinaryWriter in BinaryModelExporter.cpp).
+ */
+class BinaryReader {
+   public:
+    BinaryReader(char const* begin, char const* end, std::string const& filename) : current(begin), end(end), filename(filename) {
+        // Intentionally left empty.
+    }
+
+    char const* readBytes(uint64_t numberOfBytes) {
+        STORM_LOG_THROW(numberOfBytes <= static_cast<uint64_t>(end - current), storm::exceptions::WrongFormatException,
+                        "Unexpected end of file " << filename << ".");
+        char const* result = current;
+        current += numberOfBytes;
+        return result;
+    }
+
+    char const* readArrayBytes(uint64_t size, uint64_t elementSize) {
+        STORM_LOG_THROW(size <= static_cast<uint64_t>(end - current) / elementSize, storm::exceptions::WrongFormatException,
+                        "Unexpected end of file " << filename << ".");
+        return readBytes(size * elementSize);
+    }
+
+    uint64_t readWord() {
+        uint64_t result;
+        std::memcpy(&result, readBytes(sizeof(result)), sizeof(result));
+        return result;
+    }
+
+    std::string readString() {
+        uint64_t size = readWord();
+        std::string result(readBytes(size), size);
+        readBytes((8 - size % 8) % 8);
+        return result;
+    }
+
+    template<typename T>
+    std::vector<T> readArray() {
+        static_assert(sizeof(T) == 8, "Only arrays of 64-bit values can be read.");
+        uint64_t size = readWord();
+        char const* data = readArrayBytes(size, sizeof(T));
+        std::vector<T> result(size);
+        std::memcpy(result.data(), data, size * sizeof(T));
+        return result;
+    }
+
+    template<typename T>
+    std::vector<T> readArray(uint64_t expectedSize) {
+        std::vector<T> result = readArray<T>();
+        STORM_LOG_THROW(result.size() == expectedSize, storm::exceptions::WrongFormatException,
+                        "Unexpected array size " << result.size() << " (expected " << expectedSize << ") in file " << filename << ".");
+        return result;
+    }
+
+    storm::storage::BitVector readBitVector(uint64_t expectedSize) {
+        uint64_t size = readWord();
+        STORM_LOG_THROW(size == expectedSize, storm::exceptions::WrongFormatException,
+                        "Unexpected bit vector size " << size << " (expected " << expectedSize << ") in file " << filename << ".");
+        storm::storage::BitVector result(size);
+        for (uint64_t bitIndex = 0; bitIndex < size; bitIndex += 64) {
+            result.setFromInt(bitIndex, std::min<uint64_t>(64, size - bitIndex), readWord());
+        }
+        return result;
+    }
+
+    storm::storage::SparseMatrix<double> readMatrix() {
+        typedef storm::storage::SparseMatrix<double>::index_type index_type;
+        uint64_t rowCount = readWord();
+        uint64_t columnCount = readWord();
+        boost::optional<std::vector<index_type>> rowGroupIndices;
+        if (readWord() != 0) {
+            rowGroupIndices = readArray<index_type>();
+            STORM_LOG_THROW(!rowGroupIndices->empty() && rowGroupIndices->front() == 0 && rowGroupIndices->back() == rowCount,
+                            storm::exceptions::WrongFormatException, "Invalid row groups in file " << filename << ".");
+        }
+        std::vector<index_type> rowIndications = readArray<index_type>(rowCount + 1);
+        STORM_LOG_THROW(rowIndications.front() == 0 && std::is_sorted(rowIndications.begin(), rowIndications.end()), storm::exceptions::WrongFormatException,
+                        "Invalid row indications in file " << filename << ".");
+        uint64_t entryCount = rowIndications.back();
+
+        // The columns and values are stored in separate arrays that are merged into the entries of the matrix.
+        STORM_LOG_THROW(readWord() == entryCount, storm::exceptions::WrongFormatException, "Unexpected number of columns in file " << filename << ".");
+        char const* columns = readArrayBytes(entryCount, sizeof(index_type));
+        STORM_LOG_THROW(readWord() == entryCount, storm::exceptions::WrongFormatException, "Unexpected number of values in file " << filename << ".");
+        char const* values = readArrayBytes(entryCount, sizeof(double));
+        std::vector<storm::storage::MatrixEntry<index_type, double>> columnsAndValues(entryCount);
+        for (uint64_t entry = 0; entry < entryCount; ++entry) {
+            index_type column;
+            double value;
+            std::memcpy(&column, columns + entry * sizeof(index_type), sizeof(index_type));
+            std::memcpy(&value, values + entry * sizeof(double), sizeof(double));
+            STORM_LOG_THROW(column < columnCount, storm::exceptions::WrongFormatException, "Column index out of bounds in file " << filename << ".");
+            columnsAndValues[entry] = storm::storage::MatrixEntry<index_type, double>(column, value);
+        }
+        return storm::storage::SparseMatrix<double>(columnCount, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
+    }
+
+    bool isAtEnd() const {
+        return current == end;
+    }
+
+   private:
+    char const* current;
+    char const* end;
+    std::string const& filename;
+};
+}  // namespace
+
+std::shared_ptr<storm::models::sparse::Model<double>> BinaryModelParser::parseModel(std::string const& filename) {
+    STORM_LOG_INFO("Reading from file " << filename);
+    MappedFile file(filename.c_str());
+    BinaryReader reader(file.getData(), file.getDataEnd(), filename);
+
+    // Header.
+    typedef storm::exporter::BinaryModelFormat Format;
+    STORM_LOG_THROW(std::memcmp(reader.readBytes(sizeof(Format::magic)), Format::magic, sizeof(Format::magic)) == 0, storm::exceptions::WrongFormatException,
+                    "File " << filename << " does not contain a model in binary format.");
+    uint64_t version = reader.readWord();
+    STORM_LOG_THROW(version == Format::version, storm::exceptions::WrongFormatException,
+                    "File " << filename << " has version " << version << " of the binary format, but only version " << Format::version << " is supported.");
+    STORM_LOG_THROW(reader.readWord() == Format::byteOrderMark, storm::exceptions::WrongFormatException,
+                    "File " << filename << " was written on a machine with a different byte order.");
+    storm::models::ModelType type = storm::models::getModelType(reader.readString());
+
+    storm::storage::sparse::ModelComponents<double> components(reader.readMatrix());
+    uint64_t stateCount = components.transitionMatrix.getRowGroupCount();
+    uint64_t choiceCount = components.transitionMatrix.getRowCount();
+
+    components.stateLabeling = storm::models::sparse::StateLabeling(stateCount);
+    for (uint64_t labelCount = reader.readWord(); labelCount > 0; --labelCount) {
+        std::string label = reader.readString();
+        components.stateLabeling.addLabel(label, reader.readBitVector(stateCount));
+    }
+
+    for (uint64_t rewardModelCount = reader.readWord(); rewardModelCount > 0; --rewardModelCount) {
+        std::string name = reader.readString();
+        uint64_t flags = reader.readWord();
+        std::optional<std::vector<double>> stateRewards;
+        std::optional<std::vector<double>> stateActionRewards;
+        std::optional<storm::storage::SparseMatrix<double>> transitionRewards;
+        if (flags & Format::stateRewardsFlag) {
+            stateRewards = reader.readArray<double>(stateCount);
+        }
+        if (flags & Format::stateActionRewardsFlag) {
+            stateActionRewards = reader.readArray<double>(choiceCount);
+        }
+        if (flags & Format::transitionRewardsFlag) {
+            transitionRewards = reader.readMatrix();
+        }
+        components.rewardModels.emplace(
+            name, storm::models::sparse::StandardRewardModel<double>(std::move(stateRewards), std::move(stateActionRewards), std::move(transitionRewards)));
+    }
+
+    if (reader.readWord() != 0) {
+        components.choiceLabeling = storm::models::sparse::ChoiceLabeling(choiceCount);
+        for (uint64_t labelCount = reader.readWord(); labelCount > 0; --labelCount) {
+            std::string label = reader.readString();
+            components.choiceLabeling->addLabel(label, reader.readBitVector(choiceCount));
+        }
+    }
+
+    // Model type specific components.
+    if (type == storm::models::ModelType::Ctmc) {
+        components.rateTransitions = true;
+        components.exitRates = reader.readArray<double>(stateCount);
+    } else if (type == storm::models::ModelType::MarkovAutomaton) {
+        components.exitRates = reader.readArray<double>(stateCount);
+        components.markovianStates = reader.readBitVector(stateCount);
+    } else if (type == storm::models::ModelType::Pomdp) {
+        std::vector<uint64_t> observations = reader.readArray<uint64_t>(stateCount);
+        components.observabilityClasses = std::vector<uint32_t>(observations.begin(), observations.end());
+    }
+    STORM_LOG_THROW(reader.isAtEnd(), storm::exceptions::WrongFormatException, "Unexpected data at the end of file " << filename << ".");
+
+    return storm::utility::builder::buildModelFromComponents(type, std::move(components));
+}
+
+}  // namespace parser
+}  // namespace storm
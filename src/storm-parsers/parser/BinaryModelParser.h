@@ -0,0 +1,33 @@
+#ifndef STORM_PARSER_BINARYMODELPARSER_H_
+#define STORM_PARSER_BINARYMODELPARSER_H_
+
+#include <memory>
+#include <string>
+
+#include "storm/models/sparse/Model.h"
+
+namespace storm {
+namespace parser {
+
+/*!
+ * Parser for models in the binary format written by storm::exporter::exportSparseModelAsBinary.
+ *
+ * The file is mapped to memory and the arrays of the model are copied directly from the mapped file, so loading a
+ * model is typically much faster than parsing it from the DRN format.
+ */
+class BinaryModelParser {
+   public:
+    /*!
+     * Loads a model in the binary format from a file.
+     *
+     * @param filename The file to be loaded.
+     *
+     * @return A sparse model
+     */
+    static std::shared_ptr<storm::models::sparse::Model<double>> parseModel(std::string const& filename);
+};
+
+}  // namespace parser
+}  // namespace storm
+
+#endif /* STORM_PARSER_BINARYMODELPARSER_H_ */
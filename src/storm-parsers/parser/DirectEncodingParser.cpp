@@ -2,10 +2,17 @@
 
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/predicate.hpp>
+#include <algorithm>
+#include <charconv>
+#include <cstdlib>
 #include <iostream>
+#include <map>
 #include <regex>
 #include <string>
+#include <string_view>
+#include <type_traits>
 
+#include "storm-parsers/parser/MappedFile.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/exceptions/AbortException.h"
@@ -23,6 +30,7 @@
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/builder.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
@@ -30,6 +38,214 @@
 namespace storm {
 namespace parser {
 
+namespace {
+std::string_view trimLeft(std::string_view str) {
+    size_t pos = str.find_first_not_of(" \t");
+    return pos == std::string_view::npos ? std::string_view() : str.substr(pos);
+}
+
+std::string_view trim(std::string_view str) {
+    str = trimLeft(str);
+    size_t pos = str.find_last_not_of(" \t");
+    return pos == std::string_view::npos ? std::string_view() : str.substr(0, pos + 1);
+}
+
+bool startsWith(std::string_view str, std::string_view prefix) {
+    return str.substr(0, prefix.size()) == prefix;
+}
+
+/*!
+ * Removes the first whitespace-separated token from the given string and returns it.
+ */
+std::string_view nextToken(std::string_view& str) {
+    str = trimLeft(str);
+    size_t pos = str.find_first_of(" \t");
+    std::string_view token = str.substr(0, pos);
+    str = pos == std::string_view::npos ? std::string_view() : str.substr(pos);
+    return token;
+}
+
+uint64_t parseIndex(std::string_view str, char const* description) {
+    uint64_t result = 0;
+    auto parseResult = std::from_chars(str.data(), str.data() + str.size(), result);
+    STORM_LOG_THROW(!str.empty() && parseResult.ec == std::errc() && parseResult.ptr == str.data() + str.size(), storm::exceptions::WrongFormatException,
+                    "Could not parse " << description << " '" << str << "'.");
+    return result;
+}
+
+/*!
+ * Retrieves the beginning of the first line in [position, end) that declares a state (or end if there is no such line).
+ * The given position has to be the beginning of a line.
+ */
+char const* findNextStateLine(char const* position, char const* end) {
+    while (position != end) {
+        char const* lineEnd = std::find(position, end, '\n');
+        if (startsWith(trimLeft(std::string_view(position, lineEnd - position)), "state ")) {
+            return position;
+        }
+        position = lineEnd == end ? end : lineEnd + 1;
+    }
+    return end;
+}
+
+/*!
+ * The components of the model given by a consecutive range of states. States and rows are given relative to the first
+ * state and the first row of the chunk, respectively.
+ */
+template<typename ValueType>
+struct StateChunk {
+    uint64_t firstState = 0;
+    uint64_t numberOfStates = 0;
+    // The first row of each state.
+    std::vector<uint64_t> rowGroupStarts;
+    storm::storage::SparseMatrix<ValueType> transitions;
+    std::vector<ValueType> exitRates;
+    std::vector<uint32_t> observations;
+    // The nonzero state (action) rewards of each reward model.
+    std::vector<std::vector<std::pair<uint64_t, ValueType>>> stateRewards;
+    std::vector<std::vector<std::pair<uint64_t, ValueType>>> actionRewards;
+    std::map<std::string, std::vector<uint64_t>> stateLabels;
+    std::map<std::string, std::vector<uint64_t>> choiceLabels;
+};
+
+/*!
+ * Parses rewards of the form [r_1, ..., r_n] at the beginning of the given string and removes them from the string.
+ */
+template<typename ValueType, typename ValueFunction>
+void parseRewards(std::string_view& line, uint64_t index, std::vector<std::vector<std::pair<uint64_t, ValueType>>>& rewards, ValueFunction const& valueOf) {
+    size_t posEndReward = line.find(']');
+    STORM_LOG_THROW(posEndReward != std::string_view::npos, storm::exceptions::WrongFormatException, "] missing in '" << line << "'.");
+    std::string_view rewardsStr = line.substr(1, posEndReward - 1);
+    line = line.substr(posEndReward + 1);
+    for (uint64_t rewardModelIndex = 0;; ++rewardModelIndex) {
+        size_t posComma = rewardsStr.find(',');
+        ValueType rewardValue = valueOf(trim(rewardsStr.substr(0, posComma)));
+        if (rewards.size() <= rewardModelIndex) {
+            rewards.resize(rewardModelIndex + 1);
+        }
+        if (!storm::utility::isZero(rewardValue)) {
+            rewards[rewardModelIndex].emplace_back(index, std::move(rewardValue));
+        }
+        if (posComma == std::string_view::npos) {
+            break;
+        }
+        rewardsStr = rewardsStr.substr(posComma + 1);
+    }
+}
+
+/*!
+ * Parses the states declared in [begin, end). This mirrors DirectEncodingParser::parseStates, but works on the memory
+ * mapped file and collects the components of the chunk such that they can later be moved to their global positions.
+ */
+template<typename ValueType, typename ValueFunction>
+StateChunk<ValueType> parseStateChunk(char const* begin, char const* end, storm::models::ModelType type, uint64_t stateSize, bool buildChoiceLabeling,
+                                      ValueFunction const& valueOf) {
+    bool continuousTime = (type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::MarkovAutomaton);
+    StateChunk<ValueType> chunk;
+    storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, false, 0);
+    uint64_t row = 0;
+    bool firstState = true;
+    bool firstActionForState = true;
+    for (char const* position = begin; position != end;) {
+        char const* lineEnd = std::find(position, end, '\n');
+        std::string_view line(position, lineEnd - position);
+        position = lineEnd == end ? end : lineEnd + 1;
+        while (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        if (line.empty() || startsWith(line, "//")) {
+            continue;
+        }
+        line = trimLeft(line);
+        if (startsWith(line, "state ")) {
+            // New state
+            line.remove_prefix(6);
+            uint64_t state = parseIndex(nextToken(line), "state id");
+            if (firstState) {
+                firstState = false;
+                chunk.firstState = state;
+            } else {
+                ++row;
+                STORM_LOG_THROW(state == chunk.firstState + chunk.numberOfStates, storm::exceptions::WrongFormatException,
+                                "State ids are not ordered and without gaps. Expected " << chunk.firstState + chunk.numberOfStates << " but got " << state
+                                                                                        << ".");
+            }
+            STORM_LOG_THROW(state < stateSize, storm::exceptions::WrongFormatException, "More states detected than declared (in @nr_states).");
+            uint64_t localState = chunk.numberOfStates++;
+            chunk.rowGroupStarts.push_back(row);
+            firstActionForState = true;
+
+            if (continuousTime) {
+                // Parse exit rate for CTMC or MA
+                line = trimLeft(line);
+                STORM_LOG_THROW(startsWith(line, "!"), storm::exceptions::WrongFormatException, "Exit rate missing for state " << state << ".");
+                line.remove_prefix(1);
+                chunk.exitRates.push_back(valueOf(nextToken(line)));
+            }
+
+            line = trimLeft(line);
+            if (startsWith(line, "[")) {
+                parseRewards(line, localState, chunk.stateRewards, valueOf);
+            }
+
+            if (type == storm::models::ModelType::Pomdp) {
+                line = trimLeft(line);
+                size_t posEndObservation = line.find('}');
+                STORM_LOG_THROW(startsWith(line, "{") && posEndObservation != std::string_view::npos, storm::exceptions::WrongFormatException,
+                                "Expected an observation for state " << state << ".");
+                chunk.observations.push_back(static_cast<uint32_t>(parseIndex(line.substr(1, posEndObservation - 1), "observation")));
+                line = line.substr(posEndObservation + 1);
+            }
+
+            // Parse labels. Labels are separated by whitespace and can optionally be enclosed in quotation marks.
+            for (line = trimLeft(line); !line.empty(); line = trimLeft(line)) {
+                std::string_view label;
+                if (line.front() == '"') {
+                    size_t posEndLabel = line.find('"', 1);
+                    STORM_LOG_THROW(posEndLabel != std::string_view::npos, storm::exceptions::WrongFormatException,
+                                    "Quotation mark missing in label of state " << state << ".");
+                    label = line.substr(1, posEndLabel - 1);
+                    line = line.substr(posEndLabel + 1);
+                } else {
+                    label = nextToken(line);
+                }
+                if (!label.empty()) {
+                    chunk.stateLabels[std::string(label)].push_back(localState);
+                }
+            }
+        } else if (startsWith(line, "action ")) {
+            // New action
+            STORM_LOG_THROW(!firstState, storm::exceptions::WrongFormatException, "Action declared before the first state.");
+            if (firstActionForState) {
+                firstActionForState = false;
+            } else {
+                ++row;
+            }
+            line.remove_prefix(7);
+            std::string_view actionName = nextToken(line);
+            if (buildChoiceLabeling && actionName != "__NOLABEL__") {
+                chunk.choiceLabels[std::string(actionName)].push_back(row);
+            }
+            line = trimLeft(line);
+            if (startsWith(line, "[")) {
+                parseRewards(line, row, chunk.actionRewards, valueOf);
+            }
+        } else {
+            // New transition
+            STORM_LOG_THROW(!firstState, storm::exceptions::WrongFormatException, "Transition declared before the first state.");
+            size_t posColon = line.find(':');
+            STORM_LOG_THROW(posColon != std::string_view::npos, storm::exceptions::WrongFormatException, "':' not found in '" << line << "'.");
+            uint64_t target = parseIndex(trim(line.substr(0, posColon)), "target state");
+            STORM_LOG_THROW(target < stateSize, storm::exceptions::WrongFormatException,
+                            "Target state " << target << " is greater than state size " << stateSize << ".");
+            builder.addNextValue(row, target, valueOf(trim(line.substr(posColon + 1))));
+        }
+    }
+    chunk.transitions = builder.build(firstState ? 0 : row + 1, stateSize, 0);
+    return chunk;
+}
+}  // namespace
+
 template<typename ValueType, typename RewardModelType>
 std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> DirectEncodingParser<ValueType, RewardModelType>::parseModel(
     std::string const& filename, DirectEncodingParserOptions const& options) {
@@ -118,7 +334,12 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
                             "No. of actions (@nr_choices) has to be declared before model.");
             STORM_LOG_WARN_COND(nrChoices != 0, "No. of actions has to be declared. We may continue now, but future versions might not support this.");
             // Construct model components
-            modelComponents = parseStates(file, type, nrStates, nrChoices, placeholders, valueParser, rewardModelNames, options);
+            std::streamoff offset = file.tellg();
+            if (options.numberOfThreads > 1 && std::is_same<ValueType, double>::value && offset >= 0) {
+                modelComponents = parseStatesParallel(filename, offset, type, nrStates, nrChoices, placeholders, valueParser, rewardModelNames, options);
+            } else {
+                modelComponents = parseStates(file, type, nrStates, nrChoices, placeholders, valueParser, rewardModelNames, options);
+            }
             break;
         } else {
             STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Could not parse line '" << line << "'.");
@@ -411,6 +632,200 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
     return modelComponents;
 }
 
+template<typename ValueType, typename RewardModelType>
+std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> DirectEncodingParser<ValueType, RewardModelType>::parseStatesParallel(
+    std::string const& filename, uint64_t offset, storm::models::ModelType type, size_t stateSize, size_t nrChoices,
+    std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
+    std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options) {
+    typedef typename storm::storage::SparseMatrix<ValueType>::index_type index_type;
+    auto modelComponents = std::make_shared<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>>();
+    bool nonDeterministic =
+        (type == storm::models::ModelType::Mdp || type == storm::models::ModelType::MarkovAutomaton || type == storm::models::ModelType::Pomdp);
+    bool continuousTime = (type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::MarkovAutomaton);
+
+    MappedFile file(filename.c_str());
+    STORM_LOG_THROW(offset <= file.getDataSize(), storm::exceptions::FileIoException, "Unexpected end of file " << filename << ".");
+    char const* begin = file.getData() + offset;
+    char const* end = file.getDataEnd();
+
+    // Split the file into chunks that start at the declaration of a state.
+    uint64_t const minimalChunkSize = std::max<uint64_t>(1, options.minimalChunkSize);
+    uint64_t numberOfChunks = std::max<uint64_t>(1, std::min<uint64_t>(4 * options.numberOfThreads, (end - begin) / minimalChunkSize));
+    std::vector<char const*> chunkBegins = {begin};
+    for (uint64_t chunkIndex = 1; chunkIndex < numberOfChunks; ++chunkIndex) {
+        char const* position = std::find(std::max(chunkBegins.back(), begin + (end - begin) * chunkIndex / numberOfChunks), end, '\n');
+        position = findNextStateLine(position == end ? end : position + 1, end);
+        if (position != end) {
+            chunkBegins.push_back(position);
+        }
+    }
+    chunkBegins.push_back(end);
+
+    // Parse the chunks. Plain numbers are parsed directly, only other values (such as placeholders or fractions) use the value parser.
+    auto valueOf = [&placeholders, &valueParser](std::string_view str) -> ValueType {
+        if constexpr (std::is_same<ValueType, double>::value) {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+            double result;
+            auto parseResult = std::from_chars(str.data(), str.data() + str.size(), result);
+            if (parseResult.ec == std::errc() && parseResult.ptr == str.data() + str.size()) {
+                return result;
+            }
+#else
+            // Some standard libraries (e.g. libstdc++ before GCC 11 and libc++) do not provide std::from_chars for floating point numbers.
+            std::string const nullTerminated(str);
+            char* parseEnd = nullptr;
+            double result = std::strtod(nullTerminated.c_str(), &parseEnd);
+            if (!nullTerminated.empty() && parseEnd == nullTerminated.c_str() + nullTerminated.size()) {
+                return result;
+            }
+#endif
+        }
+        return parseValue(std::string(str), placeholders, valueParser);
+    };
+    std::vector<StateChunk<ValueType>> chunks(chunkBegins.size() - 1);
+    auto& threadPool = storm::utility::ThreadPool::getGlobalPool();
+    threadPool.parallelFor(
+        0, chunks.size(),
+        [&](uint64_t chunkIndex) {
+            chunks[chunkIndex] =
+                parseStateChunk<ValueType>(chunkBegins[chunkIndex], chunkBegins[chunkIndex + 1], type, stateSize, options.buildChoiceLabeling, valueOf);
+            STORM_LOG_THROW(!storm::utility::resources::isTerminate(), storm::exceptions::AbortException, "Aborted in state space exploration.");
+        },
+        options.numberOfThreads);
+    STORM_LOG_TRACE("Finished parsing " << chunks.size() << " chunks");
+
+    // Compute the position of each chunk in the model.
+    std::vector<uint64_t> rowOffsets(chunks.size() + 1, 0);
+    std::vector<uint64_t> entryOffsets(chunks.size() + 1, 0);
+    uint64_t numberOfStates = 0;
+    uint64_t numberOfStateRewardModels = 0;
+    uint64_t numberOfActionRewardModels = 0;
+    for (uint64_t chunkIndex = 0; chunkIndex < chunks.size(); ++chunkIndex) {
+        auto const& chunk = chunks[chunkIndex];
+        STORM_LOG_THROW(chunk.numberOfStates == 0 || chunk.firstState == numberOfStates, storm::exceptions::WrongFormatException,
+                        "State ids are not ordered and without gaps. Expected " << numberOfStates << " but got " << chunk.firstState << ".");
+        numberOfStates += chunk.numberOfStates;
+        rowOffsets[chunkIndex + 1] = rowOffsets[chunkIndex] + chunk.transitions.getRowCount();
+        entryOffsets[chunkIndex + 1] = entryOffsets[chunkIndex] + chunk.transitions.getEntryCount();
+        numberOfStateRewardModels = std::max<uint64_t>(numberOfStateRewardModels, chunk.stateRewards.size());
+        numberOfActionRewardModels = std::max<uint64_t>(numberOfActionRewardModels, chunk.actionRewards.size());
+    }
+    uint64_t rowCount = rowOffsets.back();
+    if (nonDeterministic) {
+        STORM_LOG_THROW(nrChoices == 0 || rowCount == nrChoices, storm::exceptions::WrongFormatException,
+                        "Number of actions detected (" << rowCount << ") does not match number of actions declared (" << nrChoices << ", in @nr_choices).");
+    }
+
+    // Stitch the chunks together.
+    std::vector<index_type> rowIndications(rowCount + 1);
+    std::vector<storm::storage::MatrixEntry<index_type, ValueType>> entries(entryOffsets.back());
+    boost::optional<std::vector<index_type>> rowGroupIndices;
+    if (nonDeterministic) {
+        rowGroupIndices = std::vector<index_type>(stateSize + 1, rowCount);
+    }
+    modelComponents->observabilityClasses = std::vector<uint32_t>(stateSize);
+    if (continuousTime) {
+        modelComponents->exitRates = std::vector<ValueType>(stateSize);
+    }
+    threadPool.parallelFor(
+        0, chunks.size(),
+        [&](uint64_t chunkIndex) {
+            auto const& chunk = chunks[chunkIndex];
+            auto const& transitions = chunk.transitions;
+            for (uint64_t row = 0; row < transitions.getRowCount(); ++row) {
+                rowIndications[rowOffsets[chunkIndex] + row] = entryOffsets[chunkIndex] + (transitions.begin(row) - transitions.begin());
+            }
+            std::copy(transitions.begin(), transitions.end(), entries.begin() + entryOffsets[chunkIndex]);
+            for (uint64_t state = 0; state < chunk.numberOfStates; ++state) {
+                if (nonDeterministic) {
+                    rowGroupIndices.get()[chunk.firstState + state] = rowOffsets[chunkIndex] + chunk.rowGroupStarts[state];
+                }
+                if (continuousTime) {
+                    modelComponents->exitRates.get()[chunk.firstState + state] = chunk.exitRates[state];
+                }
+                if (type == storm::models::ModelType::Pomdp) {
+                    modelComponents->observabilityClasses.value()[chunk.firstState + state] = chunk.observations[state];
+                }
+            }
+        },
+        options.numberOfThreads);
+    rowIndications.back() = entries.size();
+    modelComponents->transitionMatrix =
+        storm::storage::SparseMatrix<ValueType>(stateSize, std::move(rowIndications), std::move(entries), std::move(rowGroupIndices));
+    STORM_LOG_TRACE("Built matrix");
+
+    if (type == storm::models::ModelType::Ctmc) {
+        modelComponents->rateTransitions = true;
+    } else if (type == storm::models::ModelType::MarkovAutomaton) {
+        modelComponents->markovianStates = storm::storage::BitVector(stateSize);
+        for (uint64_t state = 0; state < stateSize; ++state) {
+            if (!storm::utility::isZero(modelComponents->exitRates.get()[state])) {
+                modelComponents->markovianStates.get().set(state);
+            }
+        }
+    }
+
+    // Build labelings
+    modelComponents->stateLabeling = storm::models::sparse::StateLabeling(stateSize);
+    if (options.buildChoiceLabeling) {
+        modelComponents->choiceLabeling = storm::models::sparse::ChoiceLabeling(nrChoices);
+    }
+    for (uint64_t chunkIndex = 0; chunkIndex < chunks.size(); ++chunkIndex) {
+        auto const& chunk = chunks[chunkIndex];
+        for (auto const& labelAndStates : chunk.stateLabels) {
+            if (!modelComponents->stateLabeling.containsLabel(labelAndStates.first)) {
+                modelComponents->stateLabeling.addLabel(labelAndStates.first);
+            }
+            for (auto const& state : labelAndStates.second) {
+                modelComponents->stateLabeling.addLabelToState(labelAndStates.first, chunk.firstState + state);
+            }
+        }
+        for (auto const& labelAndChoices : chunk.choiceLabels) {
+            if (!modelComponents->choiceLabeling.value().containsLabel(labelAndChoices.first)) {
+                modelComponents->choiceLabeling.value().addLabel(labelAndChoices.first);
+            }
+            for (auto const& row : labelAndChoices.second) {
+                modelComponents->choiceLabeling.value().addLabelToChoice(labelAndChoices.first, rowOffsets[chunkIndex] + row);
+            }
+        }
+    }
+
+    // Build reward models
+    uint64_t numRewardModels = std::max(numberOfStateRewardModels, numberOfActionRewardModels);
+    for (uint64_t i = 0; i < numRewardModels; ++i) {
+        std::string rewardModelName;
+        if (rewardModelNames.size() <= i) {
+            rewardModelName = "rew" + std::to_string(i);
+        } else {
+            rewardModelName = rewardModelNames[i];
+        }
+        std::optional<std::vector<ValueType>> stateRewardVector, actionRewardVector;
+        for (uint64_t chunkIndex = 0; chunkIndex < chunks.size(); ++chunkIndex) {
+            auto const& chunk = chunks[chunkIndex];
+            if (i < chunk.stateRewards.size()) {
+                for (auto const& stateAndReward : chunk.stateRewards[i]) {
+                    if (!stateRewardVector) {
+                        stateRewardVector = std::vector<ValueType>(stateSize, storm::utility::zero<ValueType>());
+                    }
+                    stateRewardVector.value()[chunk.firstState + stateAndReward.first] = stateAndReward.second;
+                }
+            }
+            if (i < chunk.actionRewards.size()) {
+                for (auto const& rowAndReward : chunk.actionRewards[i]) {
+                    if (!actionRewardVector) {
+                        actionRewardVector = std::vector<ValueType>(rowCount, storm::utility::zero<ValueType>());
+                    }
+                    actionRewardVector.value()[rowOffsets[chunkIndex] + rowAndReward.first] = rowAndReward.second;
+                }
+            }
+        }
+        modelComponents->rewardModels.emplace(
+            rewardModelName, storm::models::sparse::StandardRewardModel<ValueType>(std::move(stateRewardVector), std::move(actionRewardVector)));
+    }
+    STORM_LOG_TRACE("Built reward models");
+    return modelComponents;
+}
+
 template<typename ValueType, typename RewardModelType>
 ValueType DirectEncodingParser<ValueType, RewardModelType>::parseValue(std::string const& valueStr,
                                                                        std::unordered_map<std::string, ValueType> const& placeholders,
@@ -11,6 +11,11 @@ namespace parser {
 
 struct DirectEncodingParserOptions {
     bool buildChoiceLabeling = false;
+    // The number of threads used to parse the states. If this is larger than one (and the values are doubles), the
+    // states are split into chunks that are parsed in parallel.
+    uint64_t numberOfThreads = 1;
+    // Files are only split into chunks of at least this many bytes. Tests use small chunks to exercise the chunk boundaries.
+    uint64_t minimalChunkSize = 1ull << 16;
 };
 /*!
  *	Parser for models in the DRN format with explicit encoding.
@@ -45,6 +50,25 @@ class DirectEncodingParser {
         std::istream& file, storm::models::ModelType type, size_t stateSize, size_t nrChoices, std::unordered_map<std::string, ValueType> const& placeholders,
         ValueParser<ValueType> const& valueParser, std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options);
 
+    /*!
+     * Parse states and return transition matrix. The part of the file after the @model section is mapped to memory,
+     * split into chunks at the beginning of states and the chunks are parsed in parallel.
+     *
+     * @param filename The DRN file.
+     * @param offset The position of the first line after @model in the file.
+     * @param type Model type.
+     * @param stateSize No. of states
+     * @param placeholders Placeholders for values.
+     * @param valueParser Value parser.
+     * @param rewardModelNames Names of reward models.
+     *
+     * @return Transition matrix.
+     */
+    static std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> parseStatesParallel(
+        std::string const& filename, uint64_t offset, storm::models::ModelType type, size_t stateSize, size_t nrChoices,
+        std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
+        std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options);
+
     /*!
      * Parse value from string while using placeholders.
      * @param valueStr String.
@@ -3,6 +3,7 @@
 #include "storm/settings/SettingsManager.h"
 
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/io/BinaryModelExporter.h"
 #include "storm/io/DDEncodingExporter.h"
 #include "storm/io/DirectEncodingExporter.h"
 #include "storm/io/file.h"
@@ -33,6 +34,19 @@ void exportSparseModelAsDrn(std::shared_ptr<storm::models::sparse::Model<ValueTy
     storm::utility::closeFile(stream);
 }
 
+template<typename ValueType>
+void exportSparseModelAsBinary(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::string const& filename) {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        std::ofstream stream(filename, std::ios::out | std::ios::binary);
+        STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+        STORM_PRINT_AND_LOG("Write to file " << filename << ".\n");
+        storm::exporter::exportSparseModelAsBinary(stream, *model);
+        storm::utility::closeFile(stream);
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exporting exact or parametric models in binary format is not supported.");
+    }
+}
+
 template<storm::dd::DdType Type, typename ValueType>
 void exportSymbolicModelAsDrdd(std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> const& model, std::string const& filename) {
     storm::exporter::explicitExportSymbolicModel(filename, model);
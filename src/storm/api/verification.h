@@ -1,5 +1,6 @@
 #pragma once
 
+#include <map>
 #include <type_traits>
 
 #include "storm/environment/Environment.h"
@@ -15,6 +16,7 @@
 #include "storm/modelchecker/prctl/HybridMdpPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/SparseOnTheFlyLtlModelChecker.h"
 #include "storm/modelchecker/prctl/SymbolicDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SymbolicMdpPrctlModelChecker.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
@@ -185,6 +187,47 @@ std::unique_ptr<storm::modelchecker::CheckResult> verifyWithExplorationEngine(st
     return verifyWithExplorationEngine(env, model, task);
 }
 
+//
+// Verifying LTL properties with the product being explored on the fly
+//
+template<typename ValueType>
+typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type
+verifyWithOnTheFlyProduct(storm::Environment const& env, storm::storage::SymbolicModelDescription const& model,
+                          storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task,
+                          storm::generator::NextStateGeneratorOptions const& options = storm::generator::NextStateGeneratorOptions()) {
+    std::unique_ptr<storm::modelchecker::CheckResult> result;
+    if (model.getModelType() == storm::storage::SymbolicModelDescription::ModelType::DTMC) {
+        storm::modelchecker::SparseOnTheFlyLtlModelChecker<storm::models::sparse::Dtmc<ValueType>> checker(model, options);
+        if (checker.canHandle(task)) {
+            result = checker.check(env, task);
+        }
+    } else if (model.getModelType() == storm::storage::SymbolicModelDescription::ModelType::MDP) {
+        storm::modelchecker::SparseOnTheFlyLtlModelChecker<storm::models::sparse::Mdp<ValueType>> checker(model, options);
+        if (checker.canHandle(task)) {
+            result = checker.check(env, task);
+        }
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                        "The model type " << model.getModelType() << " is not supported when exploring the product on the fly.");
+    }
+    return result;
+}
+
+template<typename ValueType>
+typename std::enable_if<std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type
+verifyWithOnTheFlyProduct(storm::Environment const&, storm::storage::SymbolicModelDescription const&,
+                          storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const&,
+                          storm::generator::NextStateGeneratorOptions const& = storm::generator::NextStateGeneratorOptions()) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exploring the product on the fly does not support data type.");
+}
+
+template<typename ValueType>
+std::unique_ptr<storm::modelchecker::CheckResult> verifyWithOnTheFlyProduct(storm::storage::SymbolicModelDescription const& model,
+                                                                            storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+    Environment env;
+    return verifyWithOnTheFlyProduct(env, model, task);
+}
+
 //
 // Verifying with Sparse engine
 //
@@ -352,6 +395,117 @@ std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(std::sh
     return verifyWithSparseEngine(env, model, task);
 }
 
+/*!
+ * If the given task asks for the optimal probabilities or rewards of an operator formula (possibly compared against a bound), this
+ * retrieves the formula that asks for these values without a bound. Otherwise, nullptr is returned.
+ */
+template<typename ValueType>
+std::shared_ptr<storm::logic::Formula const> getQuantitativeOperatorFormula(storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+    // Qualitative tasks are cheaper than computing the values, so we do not touch them.
+    if (task.isQualitativeSet() || task.isProduceSchedulersSet() || !task.getHint().isEmpty() || !task.isOptimizationDirectionSet()) {
+        return nullptr;
+    }
+    storm::logic::Formula const& formula = task.getFormula();
+    storm::logic::OperatorInformation operatorInformation(task.getOptimizationDirection());
+    if (formula.isProbabilityOperatorFormula()) {
+        return std::make_shared<storm::logic::ProbabilityOperatorFormula>(formula.asProbabilityOperatorFormula().getSubformula().asSharedPointer(),
+                                                                          operatorInformation);
+    } else if (formula.isRewardOperatorFormula()) {
+        auto const& rewardOperatorFormula = formula.asRewardOperatorFormula();
+        return std::make_shared<storm::logic::RewardOperatorFormula>(rewardOperatorFormula.getSubformula().asSharedPointer(),
+                                                                     rewardOperatorFormula.getOptionalRewardModelName(), operatorInformation,
+                                                                     rewardOperatorFormula.getMeasureType());
+    }
+    return nullptr;
+}
+
+/*!
+ * Checks several tasks on the same MDP using a single model checker. Hence, precomputations like the states with probability 0 or 1,
+ * the end components of the maybe states and the equation solvers for the maybe states are shared among the tasks.
+ * Moreover, tasks that ask for the same values and only differ in the bound (e.g. P>=0.5 [F "a"] and Pmin=? [F "a"]) are grouped such
+ * that the values are computed once and compared against the bound of each task afterwards.
+ *
+ * @return The results of the tasks (in the same order). The result for a task that can not be handled is a nullptr.
+ */
+template<typename ValueType>
+typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value, std::vector<std::unique_ptr<storm::modelchecker::CheckResult>>>::type
+verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Mdp<ValueType>> const& mdp,
+                       std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>> const& tasks) {
+    std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results(tasks.size());
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<ValueType>> modelchecker(*mdp);
+    if (tasks.size() > 1) {
+        modelchecker.enablePrecomputationCache();
+    }
+
+    // Group the tasks that ask for the same values.
+    std::vector<std::shared_ptr<storm::logic::Formula const>> quantitativeFormulas(tasks.size());
+    std::map<std::pair<std::string, bool>, std::vector<uint64_t>> groups;
+    for (uint64_t taskIndex = 0; taskIndex < tasks.size(); ++taskIndex) {
+        quantitativeFormulas[taskIndex] = getQuantitativeOperatorFormula(tasks[taskIndex]);
+        if (quantitativeFormulas[taskIndex]) {
+            groups[std::make_pair(quantitativeFormulas[taskIndex]->toString(), tasks[taskIndex].isOnlyInitialStatesRelevantSet())].push_back(taskIndex);
+        }
+    }
+    std::vector<bool> solved(tasks.size(), false);
+    for (auto const& group : groups) {
+        uint64_t const firstTaskIndex = group.second.front();
+        storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> quantitativeTask(*quantitativeFormulas[firstTaskIndex], group.first.second);
+        if (group.second.size() < 2 || !modelchecker.canHandle(quantitativeTask)) {
+            continue;
+        }
+        STORM_LOG_INFO("Computing the values for " << group.second.size() << " properties via " << *quantitativeFormulas[firstTaskIndex] << ".");
+        std::unique_ptr<storm::modelchecker::CheckResult> values = modelchecker.check(env, quantitativeTask);
+        for (auto taskIndex : group.second) {
+            auto const& task = tasks[taskIndex];
+            if (task.isBoundSet()) {
+                results[taskIndex] =
+                    values->template asQuantitativeCheckResult<ValueType>().compareAgainstBound(task.getBoundComparisonType(), task.getBoundThreshold());
+            } else {
+                results[taskIndex] = values->clone();
+            }
+            solved[taskIndex] = true;
+        }
+    }
+
+    // Check the remaining tasks individually.
+    for (uint64_t taskIndex = 0; taskIndex < tasks.size(); ++taskIndex) {
+        if (!solved[taskIndex] && modelchecker.canHandle(tasks[taskIndex])) {
+            results[taskIndex] = modelchecker.check(env, tasks[taskIndex]);
+        }
+    }
+    return results;
+}
+
+template<typename ValueType>
+typename std::enable_if<std::is_same<ValueType, storm::RationalFunction>::value, std::vector<std::unique_ptr<storm::modelchecker::CheckResult>>>::type
+verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Mdp<ValueType>> const& mdp,
+                       std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>> const& tasks) {
+    std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results;
+    for (auto const& task : tasks) {
+        results.push_back(verifyWithSparseEngine(env, mdp, task));
+    }
+    return results;
+}
+
+/*!
+ * Checks several tasks on the same model. For MDPs, precomputations are shared among the tasks (see above).
+ *
+ * @return The results of the tasks (in the same order). The result for a task that can not be handled is a nullptr.
+ */
+template<typename ValueType>
+std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> verifyWithSparseEngine(
+    storm::Environment const& env, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+    std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>> const& tasks) {
+    if (model->getType() == storm::models::ModelType::Mdp) {
+        return verifyWithSparseEngine(env, model->template as<storm::models::sparse::Mdp<ValueType>>(), tasks);
+    }
+    std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results;
+    for (auto const& task : tasks) {
+        results.push_back(verifyWithSparseEngine(env, model, task));
+    }
+    return results;
+}
+
 template<typename ValueType>
 std::unique_ptr<storm::modelchecker::CheckResult> computeSteadyStateDistributionWithSparseEngine(
     storm::Environment const& env, std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> const& dtmc) {
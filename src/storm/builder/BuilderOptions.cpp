@@ -52,6 +52,7 @@ BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels)
       addOverlappingGuardsLabel(false),
       addOutOfBoundsState(false),
       reservedBitsForUnboundedVariables(32),
+      numberOfExplorationThreads(1),
       showProgress(false),
       showProgressDelay(0) {
     // Intentionally left empty.
@@ -186,6 +187,10 @@ uint64_t BuilderOptions::getReservedBitsForUnboundedVariables() const {
     return reservedBitsForUnboundedVariables;
 }
 
+uint64_t BuilderOptions::getNumberOfExplorationThreads() const {
+    return numberOfExplorationThreads;
+}
+
 bool BuilderOptions::isAddOverlappingGuardLabelSet() const {
     return addOverlappingGuardsLabel;
 }
@@ -286,6 +291,12 @@ BuilderOptions& BuilderOptions::setReservedBitsForUnboundedVariables(uint64_t ne
     return *this;
 }
 
+BuilderOptions& BuilderOptions::setNumberOfExplorationThreads(uint64_t newValue) {
+    STORM_LOG_THROW(newValue > 0, storm::exceptions::InvalidSettingsException, "The number of exploration threads must be positive.");
+    numberOfExplorationThreads = newValue;
+    return *this;
+}
+
 BuilderOptions& BuilderOptions::setAddOverlappingGuardsLabel(bool newValue) {
     addOverlappingGuardsLabel = newValue;
     return *this;
@@ -119,6 +119,7 @@ class BuilderOptions {
     bool isScaleAndLiftTransitionRewardsSet() const;
     bool isAddOutOfBoundsStateSet() const;
     uint64_t getReservedBitsForUnboundedVariables() const;
+    uint64_t getNumberOfExplorationThreads() const;
     bool isAddOverlappingGuardLabelSet() const;
     uint64_t getShowProgressDelay() const;
 
@@ -211,6 +212,12 @@ class BuilderOptions {
      */
     BuilderOptions& setReservedBitsForUnboundedVariables(uint64_t value);
 
+    /**
+     * Sets the number of threads that expand states during explicit (breadth-first) exploration.
+     * The resulting model does not depend on this value.
+     */
+    BuilderOptions& setNumberOfExplorationThreads(uint64_t value);
+
     /**
      * Substitutes all expressions occurring in these options.
      */
@@ -271,6 +278,9 @@ class BuilderOptions {
     /// Indicates the number of bits that are reserved for the storage of unbounded integer variables.
     uint64_t reservedBitsForUnboundedVariables;
 
+    /// The number of threads used for expanding states during explicit exploration.
+    uint64_t numberOfExplorationThreads;
+
     /// A flag that stores whether the progress of exploration is to be printed.
     bool showProgress;
 
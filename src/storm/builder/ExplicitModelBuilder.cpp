@@ -1,14 +1,23 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 
+#include <atomic>
+#include <limits>
 #include <map>
+#include <unordered_map>
 
+#include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 
+#include "storm/automata/AcceptanceCondition.h"
+#include "storm/automata/DeterministicAutomaton.h"
+
 #include "storm/builder/RewardModelBuilder.h"
 #include "storm/builder/StateAndChoiceInformationBuilder.h"
 
 #include "storm/exceptions/AbortException.h"
 #include "storm/exceptions/IllegalArgumentException.h"
+#include "storm/exceptions/InvalidOperationException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/WrongFormatException.h"
 
 #include "storm/generator/JaniNextStateGenerator.h"
@@ -22,6 +31,7 @@
 
 #include "storm/settings/modules/BuildSettings.h"
 
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/jani/Automaton.h"
 #include "storm/storage/jani/AutomatonComposition.h"
@@ -30,6 +40,7 @@
 
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/builder.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
@@ -106,6 +117,68 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Explic
     return nullptr;
 }
 
+template<typename ValueType, typename RewardModelType, typename StateType>
+typename ExplicitModelBuilder<ValueType, RewardModelType, StateType>::AutomatonProduct
+ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildProduct(storm::automata::DeterministicAutomaton const& automaton,
+                                                                          std::map<std::string, storm::expressions::Expression> const& apToExpression) {
+    STORM_LOG_THROW(generator->getModelType() == storm::generator::ModelType::DTMC || generator->getModelType() == storm::generator::ModelType::MDP,
+                    storm::exceptions::NotSupportedException, "The product with a deterministic automaton can only be built for DTMCs and MDPs.");
+    STORM_LOG_THROW(stateStorage.getNumberOfStates() == 0, storm::exceptions::InvalidOperationException, "The builder has already been used.");
+
+    productInformation = std::make_unique<ProductExplorationInformation>();
+    productInformation->automaton = &automaton;
+    productInformation->modelStateSize = generator->getStateSize();
+    for (auto const& ap : automaton.getAPSet().getAPs()) {
+        auto apIt = apToExpression.find(ap);
+        STORM_LOG_THROW(apIt != apToExpression.end(), storm::exceptions::IllegalArgumentException,
+                        "No expression was given for atomic proposition " << ap << " of the deterministic automaton.");
+        productInformation->apExpressions.push_back(apIt->second);
+    }
+    if (!productInformation->apExpressions.empty()) {
+        productInformation->apEvaluator =
+            std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(productInformation->apExpressions.front().getManager());
+    }
+
+    // The automaton state is stored in an additional bucket behind the model state.
+    stateStorage = storm::storage::sparse::StateStorage<StateType>(productInformation->modelStateSize + 64);
+
+    AutomatonProduct product;
+    product.model = build();
+    STORM_LOG_INFO("Product with deterministic automaton has " << product.model->getNumberOfStates() << " states and "
+                                                               << product.model->getNumberOfTransitions() << " transitions.");
+
+    std::vector<uint64_t> automatonStates(stateStorage.getNumberOfStates());
+    for (auto const& stateIndexPair : stateStorage.stateToId) {
+        automatonStates[stateIndexPair.second] = stateIndexPair.first.getAsInt(productInformation->modelStateSize, 64);
+    }
+    product.acceptance =
+        automaton.getAcceptance()->lift(automatonStates.size(), [&automatonStates](std::size_t productState) { return automatonStates[productState]; });
+
+    productInformation.reset();
+    return product;
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+StateType ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddProductStateIndex(CompressedState const& state) {
+    CompressedState productState(state);
+    // States that are not derived from an already explored product state (e.g. initial states) only consist of the model variables.
+    productState.resize(stateStorage.bitsPerState);
+
+    storm::automata::APSet const& apSet = productInformation->automaton->getAPSet();
+    storm::automata::APSet::alphabet_element label = apSet.elementAllFalse();
+    if (!productInformation->apExpressions.empty()) {
+        unpackStateIntoEvaluator(productState, generator->getVariableInformation(), *productInformation->apEvaluator);
+        for (uint64_t ap = 0; ap < productInformation->apExpressions.size(); ++ap) {
+            if (productInformation->apEvaluator->asBool(productInformation->apExpressions[ap])) {
+                label = apSet.elementAddAP(label, ap);
+            }
+        }
+    }
+    productState.setFromInt(productInformation->modelStateSize, 64,
+                            productInformation->automaton->getSuccessor(productInformation->currentAutomatonState, label));
+    return getOrAddStateIndex(productState);
+}
+
 template<typename ValueType, typename RewardModelType, typename StateType>
 StateType ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddStateIndex(CompressedState const& state) {
     StateType newIndex = static_cast<StateType>(stateStorage.getNumberOfStates());
@@ -147,8 +220,14 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
     }
 
     // Create a callback for the next-state generator to enable it to request the index of states.
-    std::function<StateType(CompressedState const&)> stateToIdCallback =
-        std::bind(&ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddStateIndex, this, std::placeholders::_1);
+    std::function<StateType(CompressedState const&)> stateToIdCallback;
+    if (productInformation) {
+        stateToIdCallback = std::bind(&ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddProductStateIndex, this, std::placeholders::_1);
+        // The initial states of the product are reached by reading the labels of the initial model states in the initial automaton state.
+        productInformation->currentAutomatonState = productInformation->automaton->getInitialState();
+    } else {
+        stateToIdCallback = std::bind(&ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddStateIndex, this, std::placeholders::_1);
+    }
 
     // If the exploration order is something different from breadth-first, we need to keep track of the remapping
     // from state ids to row groups. For this, we actually store the reversed mapping of row groups to state-ids
@@ -162,6 +241,15 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
     STORM_LOG_THROW(!this->stateStorage.initialStateIndices.empty(), storm::exceptions::WrongFormatException,
                     "The model does not have a single initial state.");
 
+    uint64_t numberOfThreads = generator->getOptions().getNumberOfExplorationThreads();
+    if (numberOfThreads > 1) {
+        if (isParallelExplorationSupported()) {
+            exploreStatesInParallel(numberOfThreads, transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder);
+            return;
+        }
+        STORM_LOG_WARN("Parallel exploration is not supported for the given model and options. Exploring the state space sequentially.");
+    }
+
     // Now explore the current state until there is no more reachable state.
     uint_fast64_t currentRowGroup = 0;
     uint_fast64_t currentRow = 0;
@@ -188,109 +276,17 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
             STORM_LOG_TRACE("Exploring state with id " << currentIndex << ".");
         }
 
+        if (productInformation) {
+            productInformation->currentAutomatonState = currentState.getAsInt(productInformation->modelStateSize, 64);
+        }
+
         generator->load(currentState);
         if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
             generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
         }
         storm::generator::StateBehavior<ValueType, StateType> behavior = generator->expand(stateToIdCallback);
-
-        // If there is no behavior, we might have to introduce a self-loop.
-        if (behavior.empty()) {
-            if (!storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded()) {
-                // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
-                if (behavior.wasExpanded()) {
-                    this->stateStorage.deadlockStateIndices.push_back(currentIndex);
-                }
-
-                if (!generator->isDeterministicModel()) {
-                    transitionMatrixBuilder.newRowGroup(currentRow);
-                }
-
-                transitionMatrixBuilder.addNextValue(currentRow, currentIndex, storm::utility::one<ValueType>());
-
-                for (auto& rewardModelBuilder : rewardModelBuilders) {
-                    if (rewardModelBuilder.hasStateRewards()) {
-                        rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
-                    }
-
-                    if (rewardModelBuilder.hasStateActionRewards()) {
-                        rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
-                    }
-                }
-
-                // This state shall be Markovian (to not introduce Zeno behavior)
-                if (stateAndChoiceInformationBuilder.isBuildMarkovianStates()) {
-                    stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
-                }
-                // Other state-based information does not need to be treated, in particular:
-                // * StateValuations have already been set above
-                // * The associated player shall be the "default" player, i.e. INVALID_PLAYER_INDEX
-
-                ++currentRow;
-                ++currentRowGroup;
-            } else {
-                STORM_LOG_THROW(false, storm::exceptions::WrongFormatException,
-                                "Error while creating sparse matrix from probabilistic program: found deadlock state ("
-                                    << generator->stateToString(currentState) << "). For fixing these, please provide the appropriate option.");
-            }
-        } else {
-            // Add the state rewards to the corresponding reward models.
-            auto stateRewardIt = behavior.getStateRewards().begin();
-            for (auto& rewardModelBuilder : rewardModelBuilders) {
-                if (rewardModelBuilder.hasStateRewards()) {
-                    rewardModelBuilder.addStateReward(*stateRewardIt);
-                }
-                ++stateRewardIt;
-            }
-
-            // If the model is nondeterministic, we need to open a row group.
-            if (!generator->isDeterministicModel()) {
-                transitionMatrixBuilder.newRowGroup(currentRow);
-            }
-
-            // Now add all choices.
-            bool firstChoiceOfState = true;
-            for (auto const& choice : behavior) {
-                // add the generated choice information
-                if (stateAndChoiceInformationBuilder.isBuildChoiceLabels() && choice.hasLabels()) {
-                    for (auto const& label : choice.getLabels()) {
-                        stateAndChoiceInformationBuilder.addChoiceLabel(label, currentRow);
-                    }
-                }
-                if (stateAndChoiceInformationBuilder.isBuildChoiceOrigins() && choice.hasOriginData()) {
-                    stateAndChoiceInformationBuilder.addChoiceOriginData(choice.getOriginData(), currentRow);
-                }
-                if (stateAndChoiceInformationBuilder.isBuildStatePlayerIndications() && choice.hasPlayerIndex()) {
-                    STORM_LOG_ASSERT(
-                        firstChoiceOfState || stateAndChoiceInformationBuilder.hasStatePlayerIndicationBeenSet(choice.getPlayerIndex(), currentRowGroup),
-                        "There is a state where different players have an enabled choice.");  // Should have been detected in generator, already
-                    if (firstChoiceOfState) {
-                        stateAndChoiceInformationBuilder.addStatePlayerIndication(choice.getPlayerIndex(), currentRowGroup);
-                    }
-                }
-                if (stateAndChoiceInformationBuilder.isBuildMarkovianStates() && choice.isMarkovian()) {
-                    stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
-                }
-
-                // Add the probabilistic behavior to the matrix.
-                for (auto const& stateProbabilityPair : choice) {
-                    transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
-                }
-
-                // Add the rewards to the reward models.
-                auto choiceRewardIt = choice.getRewards().begin();
-                for (auto& rewardModelBuilder : rewardModelBuilders) {
-                    if (rewardModelBuilder.hasStateActionRewards()) {
-                        rewardModelBuilder.addStateActionReward(*choiceRewardIt);
-                    }
-                    ++choiceRewardIt;
-                }
-                ++currentRow;
-                firstChoiceOfState = false;
-            }
-
-            ++currentRowGroup;
-        }
+        addStateBehavior(currentState, currentIndex, behavior, nullptr, transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder,
+                         currentRow, currentRowGroup);
 
         ++numberOfExploredStates;
         if (generator->getOptions().isShowProgressSet()) {
@@ -345,6 +341,291 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
     }
 }
 
+template<typename ValueType, typename RewardModelType, typename StateType>
+void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::addStateBehavior(
+    CompressedState const& state, StateType stateIndex, storm::generator::StateBehavior<ValueType, StateType> const& behavior,
+    std::vector<StateType> const* localToGlobalIndices, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
+    std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder,
+    uint_fast64_t& currentRow, uint_fast64_t& currentRowGroup) {
+    // If there is no behavior, we might have to introduce a self-loop.
+    if (behavior.empty()) {
+        if (!storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded()) {
+            // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
+            if (behavior.wasExpanded()) {
+                this->stateStorage.deadlockStateIndices.push_back(stateIndex);
+            }
+
+            if (!generator->isDeterministicModel()) {
+                transitionMatrixBuilder.newRowGroup(currentRow);
+            }
+
+            // In the product with an automaton, the automaton keeps reading the label of the model state, so the self-loop of the model state
+            // may lead to a different product state.
+            StateType selfLoopTarget = productInformation ? getOrAddProductStateIndex(state) : stateIndex;
+            transitionMatrixBuilder.addNextValue(currentRow, selfLoopTarget, storm::utility::one<ValueType>());
+
+            for (auto& rewardModelBuilder : rewardModelBuilders) {
+                if (rewardModelBuilder.hasStateRewards()) {
+                    rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
+                }
+
+                if (rewardModelBuilder.hasStateActionRewards()) {
+                    rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
+                }
+            }
+
+            // This state shall be Markovian (to not introduce Zeno behavior)
+            if (stateAndChoiceInformationBuilder.isBuildMarkovianStates()) {
+                stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
+            }
+            // Other state-based information does not need to be treated, in particular:
+            // * StateValuations have already been set above
+            // * The associated player shall be the "default" player, i.e. INVALID_PLAYER_INDEX
+
+            ++currentRow;
+            ++currentRowGroup;
+        } else {
+            STORM_LOG_THROW(false, storm::exceptions::WrongFormatException,
+                            "Error while creating sparse matrix from probabilistic program: found deadlock state ("
+                                << generator->stateToString(state) << "). For fixing these, please provide the appropriate option.");
+        }
+    } else {
+        // Add the state rewards to the corresponding reward models.
+        auto stateRewardIt = behavior.getStateRewards().begin();
+        for (auto& rewardModelBuilder : rewardModelBuilders) {
+            if (rewardModelBuilder.hasStateRewards()) {
+                rewardModelBuilder.addStateReward(*stateRewardIt);
+            }
+            ++stateRewardIt;
+        }
+
+        // If the model is nondeterministic, we need to open a row group.
+        if (!generator->isDeterministicModel()) {
+            transitionMatrixBuilder.newRowGroup(currentRow);
+        }
+
+        // Now add all choices.
+        bool firstChoiceOfState = true;
+        std::vector<std::pair<StateType, ValueType>> rowEntries;
+        for (auto const& choice : behavior) {
+            // add the generated choice information
+            if (stateAndChoiceInformationBuilder.isBuildChoiceLabels() && choice.hasLabels()) {
+                for (auto const& label : choice.getLabels()) {
+                    stateAndChoiceInformationBuilder.addChoiceLabel(label, currentRow);
+                }
+            }
+            if (stateAndChoiceInformationBuilder.isBuildChoiceOrigins() && choice.hasOriginData()) {
+                stateAndChoiceInformationBuilder.addChoiceOriginData(choice.getOriginData(), currentRow);
+            }
+            if (stateAndChoiceInformationBuilder.isBuildStatePlayerIndications() && choice.hasPlayerIndex()) {
+                STORM_LOG_ASSERT(
+                    firstChoiceOfState || stateAndChoiceInformationBuilder.hasStatePlayerIndicationBeenSet(choice.getPlayerIndex(), currentRowGroup),
+                    "There is a state where different players have an enabled choice.");  // Should have been detected in generator, already
+                if (firstChoiceOfState) {
+                    stateAndChoiceInformationBuilder.addStatePlayerIndication(choice.getPlayerIndex(), currentRowGroup);
+                }
+            }
+            if (stateAndChoiceInformationBuilder.isBuildMarkovianStates() && choice.isMarkovian()) {
+                stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
+            }
+
+            // Add the probabilistic behavior to the matrix.
+            if (localToGlobalIndices) {
+                // The choice refers to positions in the given vector, so we need to translate them and restore the order of the columns.
+                rowEntries.clear();
+                for (auto const& stateProbabilityPair : choice) {
+                    rowEntries.emplace_back((*localToGlobalIndices)[stateProbabilityPair.first], stateProbabilityPair.second);
+                }
+                std::sort(rowEntries.begin(), rowEntries.end(),
+                          [](std::pair<StateType, ValueType> const& a, std::pair<StateType, ValueType> const& b) { return a.first < b.first; });
+                for (auto const& stateProbabilityPair : rowEntries) {
+                    transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
+                }
+            } else {
+                for (auto const& stateProbabilityPair : choice) {
+                    transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
+                }
+            }
+
+            // Add the rewards to the reward models.
+            auto choiceRewardIt = choice.getRewards().begin();
+            for (auto& rewardModelBuilder : rewardModelBuilders) {
+                if (rewardModelBuilder.hasStateActionRewards()) {
+                    rewardModelBuilder.addStateActionReward(*choiceRewardIt);
+                }
+                ++choiceRewardIt;
+            }
+            ++currentRow;
+            firstChoiceOfState = false;
+        }
+
+        ++currentRowGroup;
+    }
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+bool ExplicitModelBuilder<ValueType, RewardModelType, StateType>::isParallelExplorationSupported() const {
+    if (std::is_same<ValueType, storm::RationalFunction>::value) {
+        // Operations on rational functions are not thread-safe.
+        return false;
+    }
+    if (productInformation) {
+        // The successors of a state depend on the automaton state that is currently expanded.
+        return false;
+    }
+    // The remaining restrictions stem from information that generators collect while expanding states, which is not merged across threads.
+    return options.explorationOrder == ExplorationOrder::Bfs && generator->isCloneable() && !generator->isPartiallyObservable() &&
+           !generator->getOptions().isAddOverlappingGuardLabelSet();
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::exploreStatesInParallel(
+    uint64_t numberOfThreads, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
+    std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder) {
+    STORM_LOG_INFO("Exploring the state space with " << numberOfThreads << " threads.");
+
+    // The result of expanding a single state. The choices refer to the successors by their position in the list of successors.
+    struct ExpandedState {
+        storm::generator::StateBehavior<ValueType, StateType> behavior;
+        std::vector<CompressedState> successors;
+        std::vector<StateType> successorIndices;
+    };
+    StateType const unknownIndex = std::numeric_limits<StateType>::max();
+
+    std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> generators;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        generators.push_back(generator->clone());
+    }
+
+    // During the exploration, the threads concurrently insert the states they discover into this map. As the order in which this happens
+    // depends on the scheduling of the threads, a state is mapped to the (arbitrary) index of its discovery. The actual state indices are
+    // assigned in the order of the breadth-first search afterwards.
+    storm::storage::ConcurrentBitVectorHashMap<StateType> discoveredStates(stateStorage.bitsPerState, 100000);
+    std::vector<StateType> discoveryToStateIndex;
+    for (auto const& stateIndexPair : stateStorage.stateToId) {
+        discoveredStates.findOrAdd(stateIndexPair.first, static_cast<StateType>(discoveryToStateIndex.size()));
+        discoveryToStateIndex.push_back(stateIndexPair.second);
+    }
+    std::atomic<uint64_t> numberOfDiscoveredStates(discoveryToStateIndex.size());
+    std::function<StateType()> discover = [&numberOfDiscoveredStates]() { return static_cast<StateType>(numberOfDiscoveredStates++); };
+    uint64_t numberOfStates = stateStorage.getNumberOfStates();
+
+    // The states are processed in batches taken from the front of the queue. Since newly discovered states are appended to the queue
+    // in the same order as in the sequential exploration, the resulting state indices and rows coincide with the ones of a sequential
+    // breadth-first search.
+    uint64_t const maximalBatchSize = numberOfThreads * 4096;
+    std::vector<std::pair<CompressedState, StateType>> batch;
+    std::vector<ExpandedState> expandedStates;
+
+    uint_fast64_t currentRowGroup = 0;
+    uint_fast64_t currentRow = 0;
+
+    auto timeOfStart = std::chrono::high_resolution_clock::now();
+    auto timeOfLastMessage = std::chrono::high_resolution_clock::now();
+    uint64_t numberOfExploredStates = 0;
+    uint64_t numberOfExploredStatesSinceLastMessage = 0;
+
+    while (!statesToExplore.empty()) {
+        uint64_t batchSize = std::min<uint64_t>(maximalBatchSize, statesToExplore.size());
+        batch.clear();
+        for (uint64_t index = 0; index < batchSize; ++index) {
+            batch.push_back(std::move(statesToExplore.front()));
+            statesToExplore.pop_front();
+        }
+        expandedStates.clear();
+        expandedStates.resize(batchSize);
+
+        // Expand the states of the batch and register their successors. Each participating thread uses its own generator and takes the
+        // states to expand from a shared counter.
+        std::atomic<uint64_t> nextIndex(0);
+        storm::utility::ThreadPool::getGlobalPool().parallelFor(
+            0, numberOfThreads,
+            [&](uint64_t thread) {
+                try {
+                    auto& threadGenerator = *generators[thread];
+                    std::unordered_map<CompressedState, StateType> localIndices;
+                    ExpandedState* expandedState = nullptr;
+                    std::function<StateType(CompressedState const&)> localStateToIdCallback = [&localIndices, &expandedState](CompressedState const& state) {
+                        auto insertionResult = localIndices.emplace(state, static_cast<StateType>(expandedState->successors.size()));
+                        if (insertionResult.second) {
+                            expandedState->successors.push_back(state);
+                        }
+                        return insertionResult.first->second;
+                    };
+
+                    for (uint64_t index = nextIndex++; index < batchSize; index = nextIndex++) {
+                        expandedState = &expandedStates[index];
+                        localIndices.clear();
+                        threadGenerator.load(batch[index].first);
+                        expandedState->behavior = threadGenerator.expand(localStateToIdCallback);
+
+                        expandedState->successorIndices.reserve(expandedState->successors.size());
+                        for (auto const& successor : expandedState->successors) {
+                            expandedState->successorIndices.push_back(discoveredStates.findOrAddWithGenerator(successor, discover).first);
+                        }
+                    }
+                } catch (...) {
+                    // Let the other threads stop early.
+                    nextIndex = batchSize;
+                    throw;
+                }
+            },
+            numberOfThreads);
+
+        // Now sequentially assign indices to the new successors and add the behaviors in the order of the batch.
+        discoveryToStateIndex.resize(numberOfDiscoveredStates.load(), unknownIndex);
+        for (uint64_t index = 0; index < batchSize; ++index) {
+            ExpandedState& expandedState = expandedStates[index];
+            CompressedState const& currentState = batch[index].first;
+            StateType currentIndex = batch[index].second;
+
+            for (uint64_t successor = 0; successor < expandedState.successors.size(); ++successor) {
+                StateType& stateIndex = discoveryToStateIndex[expandedState.successorIndices[successor]];
+                if (stateIndex == unknownIndex) {
+                    stateIndex = static_cast<StateType>(numberOfStates++);
+                    statesToExplore.emplace_back(std::move(expandedState.successors[successor]), stateIndex);
+                }
+                expandedState.successorIndices[successor] = stateIndex;
+            }
+
+            if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
+                generator->load(currentState);
+                generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
+            }
+            addStateBehavior(currentState, currentIndex, expandedState.behavior, &expandedState.successorIndices, transitionMatrixBuilder,
+                             rewardModelBuilders, stateAndChoiceInformationBuilder, currentRow, currentRowGroup);
+        }
+
+        numberOfExploredStates += batchSize;
+        if (generator->getOptions().isShowProgressSet()) {
+            numberOfExploredStatesSinceLastMessage += batchSize;
+
+            auto now = std::chrono::high_resolution_clock::now();
+            auto durationSinceLastMessage = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfLastMessage).count();
+            if (static_cast<uint64_t>(durationSinceLastMessage) >= generator->getOptions().getShowProgressDelay() && durationSinceLastMessage > 0) {
+                auto statesPerSecond = numberOfExploredStatesSinceLastMessage / durationSinceLastMessage;
+                auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfStart).count();
+                std::cout << "Explored " << numberOfExploredStates << " states in " << durationSinceStart << " seconds (currently " << statesPerSecond
+                          << " states per second).\n";
+                timeOfLastMessage = std::chrono::high_resolution_clock::now();
+                numberOfExploredStatesSinceLastMessage = 0;
+            }
+        }
+
+        if (storm::utility::resources::isTerminate()) {
+            auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - timeOfStart).count();
+            std::cout << "Explored " << numberOfExploredStates << " states in " << durationSinceStart << " seconds before abort.\n";
+            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
+        }
+    }
+
+    // Finally, make the explored states available with their actual indices.
+    for (auto const& stateDiscoveryPair : discoveredStates) {
+        stateStorage.stateToId.findOrAdd(stateDiscoveryPair.first, discoveryToStateIndex[stateDiscoveryPair.second]);
+    }
+    STORM_LOG_ASSERT(stateStorage.getNumberOfStates() == numberOfStates, "Unexpected number of states.");
+}
+
 template<typename ValueType, typename RewardModelType, typename StateType>
 storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildModelComponents() {
     // Determine whether we have to combine different choices to one or whether this model can have more than
@@ -33,6 +33,11 @@
 
 namespace storm {
 
+namespace automata {
+class AcceptanceCondition;
+class DeterministicAutomaton;
+}  // namespace automata
+
 namespace builder {
 
 using namespace storm::utility::prism;
@@ -80,6 +85,14 @@ class ExplicitModelBuilder {
         ExplorationOrder explorationOrder;
     };
 
+    /*!
+     * The product of the model with a deterministic automaton together with the acceptance condition lifted to the states of the product.
+     */
+    struct AutomatonProduct {
+        std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> model;
+        std::shared_ptr<storm::automata::AcceptanceCondition> acceptance;
+    };
+
     /*!
      * Creates an explicit model builder that uses the provided generator.
      *
@@ -114,6 +127,20 @@ class ExplicitModelBuilder {
      */
     std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> build();
 
+    /*!
+     * Builds the product of the model with the given deterministic automaton, i.e., the model is explored together with the automaton such that
+     * only reachable product states are generated and the model never needs to be built separately. As for the product of an already built model
+     * (see storm::transformer::DAProductBuilder), a product state (s, q) is reached if the automaton moves to q when reading the label of s.
+     * Only discrete-time models that are fully observable are supported and the exploration is always performed sequentially.
+     *
+     * @param automaton The deterministic automaton.
+     * @param apToExpression Maps each atomic proposition of the automaton to an expression over the model variables that characterizes the
+     * states satisfying the proposition.
+     * @return The product model and the acceptance condition lifted to the states of the product.
+     */
+    AutomatonProduct buildProduct(storm::automata::DeterministicAutomaton const& automaton,
+                                  std::map<std::string, storm::expressions::Expression> const& apToExpression);
+
     /*!
      * Export a wrapper that contains (a copy of) the internal information that maps states to ids.
      * This wrapper can be helpful to find states in later stages.
@@ -133,6 +160,16 @@ class ExplicitModelBuilder {
      */
     StateType getOrAddStateIndex(CompressedState const& state);
 
+    /*!
+     * Retrieves the state id of the product state that is reached when moving to the given model state. The automaton state of the product
+     * state is obtained by letting the automaton read the label of the given model state in the automaton state that is currently expanded.
+     * The state is added if it has not been encountered yet.
+     *
+     * @param state The model state. It may already contain the bits of an automaton state, which are then overwritten.
+     * @return The state id of the product state.
+     */
+    StateType getOrAddProductStateIndex(CompressedState const& state);
+
     /*!
      * Builds the transition matrix and the transition reward matrix based for the given program.
      *
@@ -144,6 +181,38 @@ class ExplicitModelBuilder {
                        std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
                        StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder);
 
+    /*!
+     * Adds the behavior of the given state to the matrix builder, the reward model builders and the state and choice information builder.
+     *
+     * @param state The state whose behavior is added.
+     * @param stateIndex The index of the state.
+     * @param behavior The behavior of the state as generated by a next-state generator.
+     * @param localToGlobalIndices If given, the target states of the choices in the behavior are considered to be positions in this
+     * vector, which holds the actual indices of the target states.
+     * @param currentRow The row of the first choice of the state. It is moved beyond the last choice of the state.
+     * @param currentRowGroup The row group of the state. It is moved to the next row group.
+     */
+    void addStateBehavior(CompressedState const& state, StateType stateIndex, storm::generator::StateBehavior<ValueType, StateType> const& behavior,
+                          std::vector<StateType> const* localToGlobalIndices, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
+                          std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+                          StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder, uint_fast64_t& currentRow, uint_fast64_t& currentRowGroup);
+
+    /*!
+     * Retrieves whether the states can be expanded by multiple threads.
+     */
+    bool isParallelExplorationSupported() const;
+
+    /*!
+     * Explores all states that are still to be explored by expanding them with multiple threads of the global thread pool. Each thread
+     * uses its own copy of the generator and registers the discovered states in a concurrent hash map. The state indices and the order
+     * of the rows are the same as for the sequential breadth-first exploration.
+     *
+     * @param numberOfThreads The number of threads to use.
+     */
+    void exploreStatesInParallel(uint64_t numberOfThreads, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
+                                 std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+                                 StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder);
+
     /*!
      * Explores the state space of the given program and returns the components of the model as a result.
      *
@@ -173,6 +242,27 @@ class ExplicitModelBuilder {
     /// An optional mapping from state indices to the row groups in which they actually reside. This needs to be
     /// built in case the exploration order is not BFS.
     boost::optional<std::vector<uint_fast64_t>> stateRemapping;
+
+    /// Information that is needed while exploring the product with a deterministic automaton.
+    struct ProductExplorationInformation {
+        /// The automaton.
+        storm::automata::DeterministicAutomaton const* automaton;
+
+        /// The number of bits that encode the model state. The automaton state is stored in the subsequent 64 bits.
+        uint64_t modelStateSize;
+
+        /// The expressions of the atomic propositions in the order of the atomic propositions of the automaton.
+        std::vector<storm::expressions::Expression> apExpressions;
+
+        /// The evaluator that is used to evaluate the atomic propositions.
+        std::unique_ptr<storm::expressions::ExpressionEvaluator<ValueType>> apEvaluator;
+
+        /// The automaton state of the product state that is currently expanded.
+        uint64_t currentAutomatonState;
+    };
+
+    /// If set, the model is explored as product with a deterministic automaton.
+    std::unique_ptr<ProductExplorationInformation> productInformation;
 };
 
 }  // namespace builder
@@ -1,6 +1,7 @@
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
 
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/LongRunAverageSolverSettings.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
@@ -19,6 +20,11 @@ LongRunAverageSolverEnvironment::LongRunAverageSolverEnvironment() {
         maxIters = lraSettings.getMaximalIterationCount();
     }
     aperiodicFactor = storm::utility::convertNumber<storm::RationalNumber>(lraSettings.getAperiodicFactor());
+    if (lraSettings.isNumberOfThreadsSet()) {
+        numberOfThreads = lraSettings.getNumberOfThreads();
+    } else {
+        numberOfThreads = storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads();
+    }
 }
 
 LongRunAverageSolverEnvironment::~LongRunAverageSolverEnvironment() {
@@ -91,4 +97,13 @@ void LongRunAverageSolverEnvironment::setAperiodicFactor(storm::RationalNumber v
     aperiodicFactor = value;
 }
 
+uint64_t const& LongRunAverageSolverEnvironment::getNumberOfThreads() const {
+    return numberOfThreads;
+}
+
+void LongRunAverageSolverEnvironment::setNumberOfThreads(uint64_t value) {
+    STORM_LOG_ASSERT(value > 0, "Expected a positive number of threads.");
+    numberOfThreads = value;
+}
+
 }  // namespace storm
@@ -1,6 +1,7 @@
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/MinMaxEquationSolverSettings.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
@@ -25,6 +26,11 @@ MinMaxSolverEnvironment::MinMaxSolverEnvironment() {
                      "Unknown convergence criterion");
     multiplicationStyle = minMaxSettings.getValueIterationMultiplicationStyle();
     forceRequireUnique = minMaxSettings.isForceUniqueSolutionRequirementSet();
+    if (minMaxSettings.isNumberOfThreadsSet()) {
+        numberOfThreads = minMaxSettings.getNumberOfThreads();
+    } else {
+        numberOfThreads = storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads();
+    }
 }
 
 MinMaxSolverEnvironment::~MinMaxSolverEnvironment() {
@@ -84,4 +90,13 @@ void MinMaxSolverEnvironment::setForceRequireUnique(bool value) {
     forceRequireUnique = value;
 }
 
+uint64_t const& MinMaxSolverEnvironment::getNumberOfThreads() const {
+    return numberOfThreads;
+}
+
+void MinMaxSolverEnvironment::setNumberOfThreads(uint64_t value) {
+    STORM_LOG_ASSERT(value > 0, "Expected a positive number of threads.");
+    numberOfThreads = value;
+}
+
 }  // namespace storm
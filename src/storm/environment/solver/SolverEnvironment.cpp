@@ -18,6 +18,7 @@ SolverEnvironment::SolverEnvironment() {
     forceExact = generalSettings.isExactSet() || generalSettings.isExactFinitePrecisionSet();
     linearEquationSolverType = storm::settings::getModule<storm::settings::modules::CoreSettings>().getEquationSolver();
     linearEquationSolverTypeSetFromDefault = storm::settings::getModule<storm::settings::modules::CoreSettings>().isEquationSolverSetFromDefaultValue();
+    numberOfThreads = storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads();
 }
 
 SolverEnvironment::~SolverEnvironment() {
@@ -120,6 +121,15 @@ void SolverEnvironment::setForceExact(bool value) {
     SolverEnvironment::forceExact = value;
 }
 
+uint64_t const& SolverEnvironment::getNumberOfThreads() const {
+    return numberOfThreads;
+}
+
+void SolverEnvironment::setNumberOfThreads(uint64_t value) {
+    STORM_LOG_ASSERT(value > 0, "Expected a positive number of threads.");
+    numberOfThreads = value;
+}
+
 storm::solver::EquationSolverType const& SolverEnvironment::getLinearEquationSolverType() const {
     return linearEquationSolverType;
 }
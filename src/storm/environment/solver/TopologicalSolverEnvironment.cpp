@@ -1,6 +1,7 @@
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/TopologicalEquationSolverSettings.h"
 #include "storm/utility/macros.h"
 
@@ -15,6 +16,12 @@ TopologicalSolverEnvironment::TopologicalSolverEnvironment() {
 
     underlyingMinMaxMethod = topologicalSettings.getUnderlyingMinMaxMethod();
     underlyingMinMaxMethodSetFromDefault = topologicalSettings.isUnderlyingMinMaxMethodSetFromDefaultValue();
+
+    if (topologicalSettings.isNumberOfThreadsSet()) {
+        numberOfThreads = topologicalSettings.getNumberOfThreads();
+    } else {
+        numberOfThreads = storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads();
+    }
 }
 
 TopologicalSolverEnvironment::~TopologicalSolverEnvironment() {
@@ -51,4 +58,13 @@ void TopologicalSolverEnvironment::setUnderlyingMinMaxMethod(storm::solver::MinM
     underlyingMinMaxMethod = value;
 }
 
+uint64_t const& TopologicalSolverEnvironment::getNumberOfThreads() const {
+    return numberOfThreads;
+}
+
+void TopologicalSolverEnvironment::setNumberOfThreads(uint64_t value) {
+    STORM_LOG_ASSERT(value > 0, "Expected a positive number of threads.");
+    numberOfThreads = value;
+}
+
 }  // namespace storm
@@ -0,0 +1,395 @@
+#include "storm/generator/CompiledStateExpression.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/ExpressionVisitor.h"
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace generator {
+
+class CompiledStateExpression::Compiler : public storm::expressions::ExpressionVisitor {
+   public:
+    Compiler(VariableInformation const& variableInformation, std::vector<Instruction>& instructions)
+        : variableInformation(variableInformation), instructions(instructions), stackSize(0), supported(true) {
+        // Intentionally left empty.
+    }
+
+    /*!
+     * Appends the instructions for the given expression.
+     *
+     * @return True iff the expression could be translated.
+     */
+    bool translate(storm::expressions::BaseExpression const& expression) {
+        expression.accept(*this, boost::none);
+        return supported;
+    }
+
+    virtual boost::any visit(storm::expressions::IfThenElseExpression const& expression, boost::any const& data) override {
+        expression.getCondition()->accept(*this, data);
+        uint64_t jumpToElse = emit(OpCode::JumpIfFalse, -1);
+        expression.getThenExpression()->accept(*this, data);
+        uint64_t jumpToEnd = emit(OpCode::Jump, 0);
+        // The value of the then-branch is not on the stack when evaluating the else-branch.
+        --stackSize;
+        instructions[jumpToElse].argument = instructions.size();
+        expression.getElseExpression()->accept(*this, data);
+        instructions[jumpToEnd].argument = instructions.size();
+        return boost::none;
+    }
+
+    virtual boost::any visit(storm::expressions::BinaryBooleanFunctionExpression const& expression, boost::any const& data) override {
+        expression.getFirstOperand()->accept(*this, data);
+        expression.getSecondOperand()->accept(*this, data);
+        switch (expression.getOperatorType()) {
+            case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::And:
+                emit(OpCode::And, -1);
+                break;
+            case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Or:
+                emit(OpCode::Or, -1);
+                break;
+            case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Xor:
+                emit(OpCode::Xor, -1);
+                break;
+            case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Implies:
+                emit(OpCode::Implies, -1);
+                break;
+            case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Iff:
+                emit(OpCode::Iff, -1);
+                break;
+        }
+        return boost::none;
+    }
+
+    virtual boost::any visit(storm::expressions::BinaryNumericalFunctionExpression const& expression, boost::any const& data) override {
+        expression.getFirstOperand()->accept(*this, data);
+        expression.getSecondOperand()->accept(*this, data);
+        switch (expression.getOperatorType()) {
+            case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Plus:
+                emit(OpCode::Plus, -1);
+                break;
+            case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Minus:
+                emit(OpCode::Minus, -1);
+                break;
+            case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Times:
+                emit(OpCode::Times, -1);
+                break;
+            case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Divide:
+                emit(OpCode::Divide, -1);
+                break;
+            case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Power:
+                emit(OpCode::Power, -1);
+                break;
+            case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Modulo:
+                emit(OpCode::Modulo, -1);
+                break;
+            case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Min:
+                emit(OpCode::Min, -1);
+                break;
+            case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Max:
+                emit(OpCode::Max, -1);
+                break;
+            case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Logarithm:
+                // The evaluators pick different implementations of the logarithm depending on the base, so we leave it to them.
+                supported = false;
+                break;
+        }
+        return boost::none;
+    }
+
+    virtual boost::any visit(storm::expressions::BinaryRelationExpression const& expression, boost::any const& data) override {
+        expression.getFirstOperand()->accept(*this, data);
+        expression.getSecondOperand()->accept(*this, data);
+        switch (expression.getRelationType()) {
+            case storm::expressions::RelationType::Equal:
+                emit(OpCode::Equal, -1);
+                break;
+            case storm::expressions::RelationType::NotEqual:
+                emit(OpCode::NotEqual, -1);
+                break;
+            case storm::expressions::RelationType::Less:
+                emit(OpCode::Less, -1);
+                break;
+            case storm::expressions::RelationType::LessOrEqual:
+                emit(OpCode::LessOrEqual, -1);
+                break;
+            case storm::expressions::RelationType::Greater:
+                emit(OpCode::Greater, -1);
+                break;
+            case storm::expressions::RelationType::GreaterOrEqual:
+                emit(OpCode::GreaterOrEqual, -1);
+                break;
+        }
+        return boost::none;
+    }
+
+    virtual boost::any visit(storm::expressions::VariableExpression const& expression, boost::any const&) override {
+        storm::expressions::Variable const& variable = expression.getVariable();
+        for (auto const& booleanVariable : variableInformation.booleanVariables) {
+            if (booleanVariable.variable == variable) {
+                instructions[emit(OpCode::LoadBoolean, 1)].argument = booleanVariable.bitOffset;
+                return boost::none;
+            }
+        }
+        for (auto const& integerVariable : variableInformation.integerVariables) {
+            if (integerVariable.variable == variable) {
+                emitLoadInteger(integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound);
+                return boost::none;
+            }
+        }
+        for (auto const& locationVariable : variableInformation.locationVariables) {
+            if (locationVariable.variable == variable) {
+                emitLoadInteger(locationVariable.bitOffset, locationVariable.bitWidth, 0);
+                return boost::none;
+            }
+        }
+        // The variable is not part of the state.
+        supported = false;
+        return boost::none;
+    }
+
+    virtual boost::any visit(storm::expressions::UnaryBooleanFunctionExpression const& expression, boost::any const& data) override {
+        expression.getOperand()->accept(*this, data);
+        switch (expression.getOperatorType()) {
+            case storm::expressions::UnaryBooleanFunctionExpression::OperatorType::Not:
+                emit(OpCode::Not, 0);
+                break;
+        }
+        return boost::none;
+    }
+
+    virtual boost::any visit(storm::expressions::UnaryNumericalFunctionExpression const& expression, boost::any const& data) override {
+        expression.getOperand()->accept(*this, data);
+        switch (expression.getOperatorType()) {
+            case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Minus:
+                emit(OpCode::Negate, 0);
+                break;
+            case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Floor:
+                emit(OpCode::Floor, 0);
+                break;
+            case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Ceil:
+                emit(OpCode::Ceil, 0);
+                break;
+        }
+        return boost::none;
+    }
+
+    virtual boost::any visit(storm::expressions::BooleanLiteralExpression const& expression, boost::any const&) override {
+        emitConstant(expression.getValue() ? 1.0 : 0.0);
+        return boost::none;
+    }
+
+    virtual boost::any visit(storm::expressions::IntegerLiteralExpression const& expression, boost::any const&) override {
+        emitConstant(static_cast<double>(expression.getValue()));
+        return boost::none;
+    }
+
+    virtual boost::any visit(storm::expressions::RationalLiteralExpression const& expression, boost::any const&) override {
+        emitConstant(expression.getValueAsDouble());
+        return boost::none;
+    }
+
+    virtual boost::any visit(storm::expressions::PredicateExpression const&, boost::any const&) override {
+        supported = false;
+        return boost::none;
+    }
+
+   private:
+    /*!
+     * Appends an instruction with the given opcode and keeps track of the size of the stack.
+     *
+     * @param opCode The opcode of the instruction.
+     * @param stackSizeChange The number of values the instruction adds to (or removes from) the stack.
+     * @return The index of the new instruction.
+     */
+    uint64_t emit(OpCode opCode, int64_t stackSizeChange) {
+        instructions.push_back(Instruction{opCode, 0, 0, 0, 0.0});
+        stackSize += stackSizeChange;
+        if (stackSize > static_cast<int64_t>(maximalStackSize)) {
+            supported = false;
+        }
+        return instructions.size() - 1;
+    }
+
+    void emitConstant(double value) {
+        instructions[emit(OpCode::Constant, 1)].value = value;
+    }
+
+    void emitLoadInteger(uint64_t bitOffset, uint64_t bitWidth, int64_t lowerBound) {
+        if (bitWidth == 0) {
+            // The variable can only have a single value, which is not stored in the state.
+            emitConstant(static_cast<double>(lowerBound));
+        } else {
+            Instruction& instruction = instructions[emit(OpCode::LoadInteger, 1)];
+            instruction.argument = bitOffset;
+            instruction.bitWidth = bitWidth;
+            instruction.lowerBound = lowerBound;
+        }
+    }
+
+    VariableInformation const& variableInformation;
+    std::vector<Instruction>& instructions;
+
+    // The number of values on the stack after executing the instructions emitted so far.
+    int64_t stackSize;
+
+    // Whether all parts of the expression could be translated so far.
+    bool supported;
+};
+
+boost::optional<CompiledStateExpression> CompiledStateExpression::compile(storm::expressions::Expression const& expression,
+                                                                          VariableInformation const& variableInformation) {
+    CompiledStateExpression result;
+    Compiler compiler(variableInformation, result.instructions);
+    if (!expression.isInitialized() || !compiler.translate(expression.getBaseExpression())) {
+        return boost::none;
+    }
+    result.instructions.shrink_to_fit();
+    return result;
+}
+
+bool CompiledStateExpression::evaluateAsBool(CompressedState const& state) const {
+    return evaluate(state) == 1.0;
+}
+
+int64_t CompiledStateExpression::evaluateAsInt(CompressedState const& state) const {
+    return static_cast<int64_t>(evaluate(state));
+}
+
+double CompiledStateExpression::evaluateAsDouble(CompressedState const& state) const {
+    return evaluate(state);
+}
+
+uint64_t CompiledStateExpression::getNumberOfInstructions() const {
+    return instructions.size();
+}
+
+// Checks two values for equality in the same way as exprtk does.
+static inline bool equalValues(double first, double second) {
+    return std::abs(first - second) <= std::max(1.0, std::max(std::abs(first), std::abs(second))) * 1e-10;
+}
+
+static inline double fromBool(bool value) {
+    return value ? 1.0 : 0.0;
+}
+
+double CompiledStateExpression::evaluate(CompressedState const& state) const {
+    std::array<double, maximalStackSize> stack;
+    // The index one past the top of the stack.
+    uint64_t top = 0;
+
+    uint64_t const numberOfInstructions = instructions.size();
+    uint64_t position = 0;
+    while (position < numberOfInstructions) {
+        Instruction const& instruction = instructions[position];
+        ++position;
+        switch (instruction.opCode) {
+            case OpCode::Constant:
+                stack[top++] = instruction.value;
+                break;
+            case OpCode::LoadBoolean:
+                stack[top++] = fromBool(state.get(instruction.argument));
+                break;
+            case OpCode::LoadInteger:
+                stack[top++] = static_cast<double>(static_cast<int64_t>(state.getAsInt(instruction.argument, instruction.bitWidth)) + instruction.lowerBound);
+                break;
+            case OpCode::JumpIfFalse:
+                if (stack[--top] == 0.0) {
+                    position = instruction.argument;
+                }
+                break;
+            case OpCode::Jump:
+                position = instruction.argument;
+                break;
+            case OpCode::Not:
+                stack[top - 1] = fromBool(stack[top - 1] == 0.0);
+                break;
+            case OpCode::Negate:
+                stack[top - 1] = -stack[top - 1];
+                break;
+            case OpCode::Floor:
+                stack[top - 1] = std::floor(stack[top - 1]);
+                break;
+            case OpCode::Ceil:
+                stack[top - 1] = std::ceil(stack[top - 1]);
+                break;
+            default: {
+                // All remaining instructions are binary operations.
+                --top;
+                double const first = stack[top - 1];
+                double const second = stack[top];
+                double& result = stack[top - 1];
+                switch (instruction.opCode) {
+                    case OpCode::And:
+                        result = fromBool(first != 0.0 && second != 0.0);
+                        break;
+                    case OpCode::Or:
+                        result = fromBool(first != 0.0 || second != 0.0);
+                        break;
+                    case OpCode::Xor:
+                        result = fromBool((first == 0.0) != (second == 0.0));
+                        break;
+                    case OpCode::Implies:
+                        result = fromBool(first == 0.0 || second != 0.0);
+                        break;
+                    case OpCode::Iff:
+                    case OpCode::Equal:
+                        result = fromBool(equalValues(first, second));
+                        break;
+                    case OpCode::NotEqual:
+                        result = fromBool(!equalValues(first, second));
+                        break;
+                    case OpCode::Plus:
+                        result = first + second;
+                        break;
+                    case OpCode::Minus:
+                        result = first - second;
+                        break;
+                    case OpCode::Times:
+                        result = first * second;
+                        break;
+                    case OpCode::Divide:
+                        result = first / second;
+                        break;
+                    case OpCode::Power:
+                        result = std::pow(first, second);
+                        break;
+                    case OpCode::Modulo:
+                        result = std::fmod(first, second);
+                        break;
+                    case OpCode::Min:
+                        result = std::min(first, second);
+                        break;
+                    case OpCode::Max:
+                        result = std::max(first, second);
+                        break;
+                    case OpCode::Less:
+                        result = fromBool(first < second);
+                        break;
+                    case OpCode::LessOrEqual:
+                        result = fromBool(first <= second);
+                        break;
+                    case OpCode::Greater:
+                        result = fromBool(first > second);
+                        break;
+                    case OpCode::GreaterOrEqual:
+                        result = fromBool(first >= second);
+                        break;
+                    default:
+                        STORM_LOG_ASSERT(false, "Unexpected instruction.");
+                        break;
+                }
+            }
+        }
+    }
+    STORM_LOG_ASSERT(top == 1, "Unexpected size of the stack after evaluating a compiled expression.");
+    return stack[0];
+}
+
+}  // namespace generator
+}  // namespace storm
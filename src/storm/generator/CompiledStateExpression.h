@@ -0,0 +1,133 @@
+#ifndef STORM_GENERATOR_COMPILEDSTATEEXPRESSION_H_
+#define STORM_GENERATOR_COMPILEDSTATEEXPRESSION_H_
+
+#include <cstdint>
+#include <vector>
+
+#include <boost/optional/optional.hpp>
+
+#include "storm/generator/CompressedState.h"
+
+namespace storm {
+namespace expressions {
+class Expression;
+}
+
+namespace generator {
+struct VariableInformation;
+
+/*!
+ * An expression that is translated to a flat sequence of instructions (for a small stack machine) which is evaluated
+ * directly on compressed states. In contrast to evaluating an expression with an ExpressionEvaluator, the state does
+ * not need to be unpacked first, because the values of the variables are read from the bits of the state.
+ *
+ * All computations are carried out in double precision and follow the semantics of the exprtk-based evaluators
+ * (e.g. values are compared for equality with the same tolerance). Hence, the results of evaluateAsBool and
+ * evaluateAsInt coincide with ExpressionEvaluator::asBool and asInt (for all value types) and the result of
+ * evaluateAsDouble coincides with ExpressionEvaluator<double>::asRational up to rounding errors (exprtk may
+ * rearrange some arithmetic operations).
+ */
+class CompiledStateExpression {
+   public:
+    /*!
+     * Translates the given expression. The translation fails if the expression refers to variables that are not
+     * stored in the compressed states (e.g. undefined constants) or uses operators that are not supported.
+     *
+     * @param expression The expression to translate.
+     * @param variableInformation The information about how the variables are packed within the states.
+     * @return The translated expression or none if the expression could not be translated.
+     */
+    static boost::optional<CompiledStateExpression> compile(storm::expressions::Expression const& expression,
+                                                            VariableInformation const& variableInformation);
+
+    /*!
+     * Evaluates the expression as a boolean in the given state.
+     */
+    bool evaluateAsBool(CompressedState const& state) const;
+
+    /*!
+     * Evaluates the expression as an integer in the given state.
+     */
+    int64_t evaluateAsInt(CompressedState const& state) const;
+
+    /*!
+     * Evaluates the expression as a double in the given state.
+     */
+    double evaluateAsDouble(CompressedState const& state) const;
+
+    /*!
+     * Retrieves the number of instructions of the translated expression.
+     */
+    uint64_t getNumberOfInstructions() const;
+
+   private:
+    // The supported instructions. Unless stated otherwise, instructions pop their operands from the stack and push the result.
+    enum class OpCode : uint8_t {
+        // Pushes a constant value.
+        Constant,
+        // Pushes the value of a boolean variable.
+        LoadBoolean,
+        // Pushes the value of an integer (or location) variable.
+        LoadInteger,
+        // Pops the condition and jumps to the target if it does not hold.
+        JumpIfFalse,
+        // Jumps to the target.
+        Jump,
+        Not,
+        And,
+        Or,
+        Xor,
+        Implies,
+        Iff,
+        Negate,
+        Floor,
+        Ceil,
+        Plus,
+        Minus,
+        Times,
+        Divide,
+        Power,
+        Modulo,
+        Min,
+        Max,
+        Equal,
+        NotEqual,
+        Less,
+        LessOrEqual,
+        Greater,
+        GreaterOrEqual
+    };
+
+    struct Instruction {
+        OpCode opCode;
+        // The bit offset of a variable or the target of a jump.
+        uint64_t argument;
+        // The bit width of an integer variable.
+        uint64_t bitWidth;
+        // The lower bound of an integer variable.
+        int64_t lowerBound;
+        // The value of a constant.
+        double value;
+    };
+
+    // The visitor translating expressions.
+    class Compiler;
+
+    CompiledStateExpression() = default;
+
+    /*!
+     * Evaluates the instructions in the given state.
+     */
+    double evaluate(CompressedState const& state) const;
+
+    // The maximal number of values on the stack during the evaluation.
+    static constexpr uint64_t maximalStackSize = 64;
+
+    // The instructions of the expression.
+    std::vector<Instruction> instructions;
+};
+
+}  // namespace generator
+}  // namespace storm
+
+#endif /* STORM_GENERATOR_COMPILEDSTATEEXPRESSION_H_ */
@@ -0,0 +1,179 @@
+#include "storm/generator/GuardIndex.h"
+
+#include <map>
+#include <set>
+#include <numeric>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace generator {
+
+namespace {
+// The maximal number of values of a variable such that guards are bucketed by the value of this variable.
+uint64_t const maximalNumberOfBuckets = 1ull << 12;
+
+// The maximal total size of all buckets.
+uint64_t const maximalNumberOfBucketEntries = 1ull << 20;
+
+/*!
+ * Collects values that variables need to have such that the given guard is satisfied. This only considers the top-level
+ * conjunction of the guard, whose conjuncts are of the form 'b', '!b' or 'x = c' for a boolean variable b, an integer
+ * variable x and a constant c.
+ */
+void collectRequiredValues(storm::expressions::BaseExpression const& expression,
+                           std::vector<std::pair<storm::expressions::Variable, int64_t>>& requiredValues) {
+    if (expression.isBinaryBooleanFunctionExpression()) {
+        auto const& function = expression.asBinaryBooleanFunctionExpression();
+        if (function.getOperatorType() == storm::expressions::BinaryBooleanFunctionExpression::OperatorType::And) {
+            collectRequiredValues(*function.getFirstOperand(), requiredValues);
+            collectRequiredValues(*function.getSecondOperand(), requiredValues);
+        }
+    } else if (expression.isVariableExpression()) {
+        if (expression.hasBooleanType()) {
+            requiredValues.emplace_back(expression.asVariableExpression().getVariable(), 1);
+        }
+    } else if (expression.isUnaryBooleanFunctionExpression()) {
+        auto const& operand = *expression.asUnaryBooleanFunctionExpression().getOperand();
+        if (operand.isVariableExpression()) {
+            requiredValues.emplace_back(operand.asVariableExpression().getVariable(), 0);
+        }
+    } else if (expression.isBinaryRelationExpression()) {
+        auto const& relation = expression.asBinaryRelationExpression();
+        if (relation.getRelationType() == storm::expressions::RelationType::Equal) {
+            auto const& first = *relation.getFirstOperand();
+            auto const& second = *relation.getSecondOperand();
+            if (first.isVariableExpression() && first.hasIntegerType() && second.hasIntegerType() && !second.containsVariables()) {
+                requiredValues.emplace_back(first.asVariableExpression().getVariable(), second.evaluateAsInt());
+            } else if (second.isVariableExpression() && second.hasIntegerType() && first.hasIntegerType() && !first.containsVariables()) {
+                requiredValues.emplace_back(second.asVariableExpression().getVariable(), first.evaluateAsInt());
+            }
+        }
+    }
+}
+
+// A variable stored in the compressed states that can be used to bucket the guards.
+struct IndexVariableCandidate {
+    storm::expressions::Variable variable;
+    uint64_t bitOffset;
+    uint64_t bitWidth;
+    int64_t lowerBound;
+    uint64_t numberOfValues;
+};
+}  // namespace
+
+GuardIndex::GuardIndex(std::vector<storm::expressions::Expression> const& guards, VariableInformation const& variableInformation) : allGuards(guards.size()) {
+    std::iota(allGuards.begin(), allGuards.end(), 0ull);
+
+    // Determine the values that the guards require and count for each variable the number of guards that fix its value.
+    std::vector<std::vector<std::pair<storm::expressions::Variable, int64_t>>> requiredValues(guards.size());
+    std::map<storm::expressions::Variable, uint64_t> numberOfGuardsFixingVariable;
+    for (uint64_t guardIndex = 0; guardIndex < guards.size(); ++guardIndex) {
+        if (!guards[guardIndex].isInitialized()) {
+            continue;
+        }
+        collectRequiredValues(guards[guardIndex].getBaseExpression(), requiredValues[guardIndex]);
+        std::set<storm::expressions::Variable> fixedVariables;
+        for (auto const& variableValuePair : requiredValues[guardIndex]) {
+            if (fixedVariables.insert(variableValuePair.first).second) {
+                ++numberOfGuardsFixingVariable[variableValuePair.first];
+            }
+        }
+    }
+    if (numberOfGuardsFixingVariable.empty()) {
+        return;
+    }
+
+    // Pick the variable whose value is fixed by the most guards. Only variables with a small domain are considered.
+    std::vector<IndexVariableCandidate> candidates;
+    for (auto const& booleanVariable : variableInformation.booleanVariables) {
+        candidates.push_back({booleanVariable.variable, booleanVariable.bitOffset, 1, 0, 2});
+    }
+    for (auto const& integerVariable : variableInformation.integerVariables) {
+        if (integerVariable.bitWidth > 0) {
+            candidates.push_back({integerVariable.variable, integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound,
+                                  static_cast<uint64_t>(integerVariable.upperBound - integerVariable.lowerBound) + 1});
+        }
+    }
+    for (auto const& locationVariable : variableInformation.locationVariables) {
+        if (locationVariable.bitWidth > 0) {
+            candidates.push_back({locationVariable.variable, locationVariable.bitOffset, locationVariable.bitWidth, 0, locationVariable.highestValue + 1});
+        }
+    }
+    IndexVariableCandidate const* bestCandidate = nullptr;
+    uint64_t bestNumberOfGuards = 1;
+    for (auto const& candidate : candidates) {
+        auto countIt = numberOfGuardsFixingVariable.find(candidate.variable);
+        if (countIt == numberOfGuardsFixingVariable.end() || candidate.numberOfValues > maximalNumberOfBuckets) {
+            continue;
+        }
+        uint64_t numberOfUnfixingGuards = guards.size() - countIt->second;
+        if (numberOfUnfixingGuards * candidate.numberOfValues + countIt->second > maximalNumberOfBucketEntries) {
+            continue;
+        }
+        if (countIt->second > bestNumberOfGuards || (countIt->second == bestNumberOfGuards && bestCandidate != nullptr &&
+                                                     candidate.numberOfValues < bestCandidate->numberOfValues)) {
+            bestCandidate = &candidate;
+            bestNumberOfGuards = countIt->second;
+        }
+    }
+    if (bestCandidate == nullptr) {
+        // No variable is fixed by more than one guard, so bucketing would not pay off.
+        return;
+    }
+
+    // Bucket the guards by the value they require for the picked variable.
+    indexVariable = bestCandidate->variable;
+    bitOffset = bestCandidate->bitOffset;
+    bitWidth = bestCandidate->bitWidth;
+    guardsPerValue.resize(bestCandidate->numberOfValues);
+    for (uint64_t guardIndex = 0; guardIndex < guards.size(); ++guardIndex) {
+        boost::optional<int64_t> requiredValue;
+        bool satisfiable = true;
+        for (auto const& variableValuePair : requiredValues[guardIndex]) {
+            if (variableValuePair.first == bestCandidate->variable) {
+                if (requiredValue && requiredValue.get() != variableValuePair.second) {
+                    satisfiable = false;
+                }
+                requiredValue = variableValuePair.second;
+            }
+        }
+        if (!requiredValue) {
+            for (auto& bucket : guardsPerValue) {
+                bucket.push_back(guardIndex);
+            }
+        } else if (satisfiable) {
+            // Guards requiring a value outside of the domain of the variable can never be satisfied.
+            int64_t storedValue = requiredValue.get() - bestCandidate->lowerBound;
+            if (storedValue >= 0 && static_cast<uint64_t>(storedValue) < guardsPerValue.size()) {
+                guardsPerValue[storedValue].push_back(guardIndex);
+            }
+        }
+    }
+    STORM_LOG_TRACE("Bucketing " << guards.size() << " guards by the value of variable " << indexVariable->getName() << ".");
+}
+
+std::vector<uint64_t> const& GuardIndex::getPotentiallySatisfiedGuards(CompressedState const& state) const {
+    if (!guardsPerValue.empty()) {
+        uint64_t value = state.getAsInt(bitOffset, bitWidth);
+        if (value < guardsPerValue.size()) {
+            return guardsPerValue[value];
+        }
+    }
+    return allGuards;
+}
+
+bool GuardIndex::hasIndexVariable() const {
+    return indexVariable.is_initialized();
+}
+
+storm::expressions::Variable const& GuardIndex::getIndexVariable() const {
+    STORM_LOG_ASSERT(hasIndexVariable(), "The guards are not bucketed.");
+    return indexVariable.get();
+}
+
+}  // namespace generator
+}  // namespace storm
@@ -0,0 +1,84 @@
+#ifndef STORM_GENERATOR_GUARDINDEX_H_
+#define STORM_GENERATOR_GUARDINDEX_H_
+
+#include <cstdint>
+#include <vector>
+
+#include <boost/optional/optional.hpp>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+namespace expressions {
+class Expression;
+}
+
+namespace generator {
+struct VariableInformation;
+
+/*!
+ * An index over a sequence of guards (e.g. the guards of the commands of a module or the guards of the edges leaving
+ * a location) that, given a state, yields the guards that are potentially satisfied in the state. This is meant to
+ * avoid evaluating guards that are obviously not satisfied.
+ *
+ * Typical guards are conjunctions that fix the value of some variable, e.g. a local counter of the module
+ * (s = 3 & ...). The index picks the state variable that is fixed by the most guards and buckets the guards by
+ * the value they require for this variable. Guards that do not fix the value of this variable are contained in
+ * all buckets.
+ */
+class GuardIndex {
+   public:
+    /*!
+     * Creates an index for an empty sequence of guards.
+     */
+    GuardIndex() = default;
+
+    /*!
+     * Creates an index for the given guards.
+     *
+     * @param guards The guards. The guards are identified by their position in this vector.
+     * @param variableInformation The information about how the variables are packed within the states.
+     */
+    GuardIndex(std::vector<storm::expressions::Expression> const& guards, VariableInformation const& variableInformation);
+
+    /*!
+     * Retrieves the (positions of the) guards that are potentially satisfied in the given state. All other guards
+     * are definitely not satisfied in the state.
+     *
+     * @param state The state.
+     * @return The positions of the guards in ascending order.
+     */
+    std::vector<uint64_t> const& getPotentiallySatisfiedGuards(CompressedState const& state) const;
+
+    /*!
+     * Retrieves whether the guards are bucketed by the value of some variable. If not, all guards are considered to be
+     * potentially satisfied in every state.
+     */
+    bool hasIndexVariable() const;
+
+    /*!
+     * Retrieves the variable by whose value the guards are bucketed.
+     */
+    storm::expressions::Variable const& getIndexVariable() const;
+
+   private:
+    // The positions of all guards.
+    std::vector<uint64_t> allGuards;
+
+    // The variable by whose value the guards are bucketed (if any).
+    boost::optional<storm::expressions::Variable> indexVariable;
+
+    // The bit offset and bit width of the index variable in the compressed states.
+    uint64_t bitOffset = 0;
+    uint64_t bitWidth = 0;
+
+    // The positions of the guards that are potentially satisfied, indexed by the value of the index variable as
+    // stored in the compressed states (i.e., the value minus the lower bound of the variable).
+    std::vector<std::vector<uint64_t>> guardsPerValue;
+};
+
+}  // namespace generator
+}  // namespace storm
+
+#endif /* STORM_GENERATOR_GUARDINDEX_H_ */
@@ -91,14 +91,33 @@ JaniNextStateGenerator<ValueType, StateType>::JaniNextStateGenerator(storm::jani
         evaluateRewardExpressionsAtEdges = true;
     }
 
+    initializeFromPreprocessedModel();
+}
+
+template<typename ValueType, typename StateType>
+JaniNextStateGenerator<ValueType, StateType>::JaniNextStateGenerator(JaniNextStateGenerator<ValueType, StateType> const& other)
+    : NextStateGenerator<ValueType, StateType>(other.model.getExpressionManager(), other.options),
+      model(other.model),
+      rewardExpressions(other.rewardExpressions),
+      hasStateActionRewards(false),
+      evaluateRewardExpressionsAtEdges(other.evaluateRewardExpressionsAtEdges),
+      evaluateRewardExpressionsAtDestinations(other.evaluateRewardExpressionsAtDestinations),
+      arrayEliminatorData(other.arrayEliminatorData) {
+    // The model and the options of the other generator are already preprocessed.
+    initializeFromPreprocessedModel();
+}
+
+template<typename ValueType, typename StateType>
+void JaniNextStateGenerator<ValueType, StateType>::initializeFromPreprocessedModel() {
     // Create all synchronization-related information, e.g. the automata that are put in parallel.
     this->createSynchronizationInformation();
 
     // Now we are ready to initialize the variable information.
     this->checkValid();
-    this->variableInformation =
-        VariableInformation(this->model, this->parallelAutomata, options.getReservedBitsForUnboundedVariables(), options.isAddOutOfBoundsStateSet());
+    this->variableInformation = VariableInformation(this->model, this->parallelAutomata, this->options.getReservedBitsForUnboundedVariables(),
+                                                    this->options.isAddOutOfBoundsStateSet());
     this->variableInformation.registerArrayVariableReplacements(arrayEliminatorData);
+    this->buildGuardIndices();
     this->transientVariableInformation = TransientVariableInformation<ValueType>(this->model, this->parallelAutomata);
     this->transientVariableInformation.registerArrayVariableReplacements(arrayEliminatorData);
 
@@ -135,6 +154,16 @@ JaniNextStateGenerator<ValueType, StateType>::JaniNextStateGenerator(storm::jani
     }
 }
 
+template<typename ValueType, typename StateType>
+bool JaniNextStateGenerator<ValueType, StateType>::isCloneable() const {
+    return true;
+}
+
+template<typename ValueType, typename StateType>
+std::shared_ptr<NextStateGenerator<ValueType, StateType>> JaniNextStateGenerator<ValueType, StateType>::clone() const {
+    return std::shared_ptr<NextStateGenerator<ValueType, StateType>>(new JaniNextStateGenerator<ValueType, StateType>(*this));
+}
+
 template<typename ValueType, typename StateType>
 storm::jani::ModelFeatures JaniNextStateGenerator<ValueType, StateType>::getSupportedJaniFeatures() {
     storm::jani::ModelFeatures features;
@@ -1039,9 +1068,11 @@ std::vector<Choice<ValueType>> JaniNextStateGenerator<ValueType, StateType>::get
 
     // To avoid reallocations, we declare some memory here here.
     // This vector will store for each automaton the set of edges with the current output and the current source location
-    std::vector<EdgeSetWithIndices const*> edgeSetsMemory;
+    std::vector<IndexedEdgeSet const*> edgeSetsMemory;
+    // This vector will store for each automaton the positions of the edges (within the set above) whose guard is potentially satisfied.
+    std::vector<std::vector<uint64_t> const*> candidatesMemory;
     // This vector will store the 'first' combination of edges that is productive.
-    std::vector<typename EdgeSetWithIndices::const_iterator> edgeIteratorMemory;
+    std::vector<typename std::vector<uint64_t>::const_iterator> edgeIteratorMemory;
 
     for (OutputAndEdges const& outputAndEdges : edges) {
         auto const& edges = outputAndEdges.second;
@@ -1052,7 +1083,9 @@ std::vector<Choice<ValueType>> JaniNextStateGenerator<ValueType, StateType>::get
 
             auto edgesIt = nonsychingEdges.second.find(locations[automatonIndex]);
             if (edgesIt != nonsychingEdges.second.end()) {
-                for (auto const& indexAndEdge : edgesIt->second) {
+                // Only consider the edges whose guard is potentially satisfied.
+                for (auto const& candidate : edgesIt->second.guardIndex.getPotentiallySatisfiedGuards(state)) {
+                    auto const& indexAndEdge = edgesIt->second.edges[candidate];
                     if (edgeFilter != EdgeFilter::All) {
                         STORM_LOG_ASSERT(edgeFilter == EdgeFilter::WithRate || edgeFilter == EdgeFilter::WithoutRate, "Unexpected edge filter.");
                         if ((edgeFilter == EdgeFilter::WithRate) != indexAndEdge.second->hasRate()) {
@@ -1084,6 +1117,7 @@ std::vector<Choice<ValueType>> JaniNextStateGenerator<ValueType, StateType>::get
             // First check, whether each automaton has at least one edge with the current output and the current source location
             // We will also store the edges of each automaton with the current outputAction
             edgeSetsMemory.clear();
+            candidatesMemory.clear();
             for (auto const& automatonAndEdges : outputAndEdges.second) {
                 uint64_t automatonIndex = automatonAndEdges.first;
                 LocationsAndEdges const& locationsAndEdges = automatonAndEdges.second;
@@ -1093,16 +1127,18 @@ std::vector<Choice<ValueType>> JaniNextStateGenerator<ValueType, StateType>::get
                     break;
                 }
                 edgeSetsMemory.push_back(&edgesIt->second);
+                candidatesMemory.push_back(&edgesIt->second.guardIndex.getPotentiallySatisfiedGuards(state));
             }
 
             if (productiveCombination) {
                 // second, check whether each automaton has at least one enabled action
                 edgeIteratorMemory.clear();  // Store the first enabled edge in each automaton.
-                for (auto const& edgesIt : edgeSetsMemory) {
+                for (uint64_t automatonPosition = 0; automatonPosition < edgeSetsMemory.size(); ++automatonPosition) {
                     bool atLeastOneEdge = false;
-                    EdgeSetWithIndices const& edgeSetWithIndices = *edgesIt;
-                    for (auto indexAndEdgeIt = edgeSetWithIndices.begin(), indexAndEdgeIte = edgeSetWithIndices.end(); indexAndEdgeIt != indexAndEdgeIte;
-                         ++indexAndEdgeIt) {
+                    EdgeSetWithIndices const& edgeSetWithIndices = edgeSetsMemory[automatonPosition]->edges;
+                    std::vector<uint64_t> const& candidates = *candidatesMemory[automatonPosition];
+                    for (auto candidateIt = candidates.begin(), candidateIte = candidates.end(); candidateIt != candidateIte; ++candidateIt) {
+                        auto indexAndEdgeIt = edgeSetWithIndices.begin() + *candidateIt;
                         // check whether we do not consider this edge
                         if (edgeFilter != EdgeFilter::All) {
                             STORM_LOG_ASSERT(edgeFilter == EdgeFilter::WithRate || edgeFilter == EdgeFilter::WithoutRate, "Unexpected edge filter.");
@@ -1117,7 +1153,7 @@ std::vector<Choice<ValueType>> JaniNextStateGenerator<ValueType, StateType>::get
 
                         // If we reach this point, the edge is considered enabled.
                         atLeastOneEdge = true;
-                        edgeIteratorMemory.push_back(indexAndEdgeIt);
+                        edgeIteratorMemory.push_back(candidateIt);
                         break;
                     }
 
@@ -1136,16 +1172,18 @@ std::vector<Choice<ValueType>> JaniNextStateGenerator<ValueType, StateType>::get
                 STORM_LOG_ASSERT(edgeSetsMemory.size() == outputAndEdges.second.size(), "Unexpected number of edge sets stored.");
                 STORM_LOG_ASSERT(edgeIteratorMemory.size() == outputAndEdges.second.size(), "Unexpected number of edge iterators stored.");
                 auto edgeSetIt = edgeSetsMemory.begin();
+                auto candidatesIt = candidatesMemory.begin();
                 auto edgeIteratorIt = edgeIteratorMemory.begin();
                 for (auto const& automatonAndEdges : outputAndEdges.second) {
                     EdgeSetWithIndices enabledEdgesOfAutomaton;
                     uint64_t automatonIndex = automatonAndEdges.first;
-                    EdgeSetWithIndices const& edgeSetWithIndices = **edgeSetIt;
-                    auto indexAndEdgeIt = *edgeIteratorIt;
+                    EdgeSetWithIndices const& edgeSetWithIndices = (*edgeSetIt)->edges;
+                    auto candidateIt = *edgeIteratorIt;
                     // The first edge where the edgeIterator points to is always enabled.
-                    enabledEdgesOfAutomaton.emplace_back(*indexAndEdgeIt);
-                    auto indexAndEdgeIte = edgeSetWithIndices.end();
-                    for (++indexAndEdgeIt; indexAndEdgeIt != indexAndEdgeIte; ++indexAndEdgeIt) {
+                    enabledEdgesOfAutomaton.emplace_back(edgeSetWithIndices[*candidateIt]);
+                    auto candidateIte = (*candidatesIt)->end();
+                    for (++candidateIt; candidateIt != candidateIte; ++candidateIt) {
+                        auto indexAndEdgeIt = edgeSetWithIndices.begin() + *candidateIt;
                         // check whether we do not consider this edge
                         if (edgeFilter != EdgeFilter::All) {
                             STORM_LOG_ASSERT(edgeFilter == EdgeFilter::WithRate || edgeFilter == EdgeFilter::WithoutRate, "Unexpected edge filter.");
@@ -1162,6 +1200,7 @@ std::vector<Choice<ValueType>> JaniNextStateGenerator<ValueType, StateType>::get
                     }
                     automataEdgeSets.emplace_back(std::move(automatonIndex), std::move(enabledEdgesOfAutomaton));
                     ++edgeSetIt;
+                    ++candidatesIt;
                     ++edgeIteratorIt;
                 }
                 // insert choices in the result vector.
@@ -1274,7 +1313,7 @@ void JaniNextStateGenerator<ValueType, StateType>::createSynchronizationInformat
         LocationsAndEdges locationsAndEdges;
         uint64_t edgeIndex = 0;
         for (auto const& edge : automaton.getEdges()) {
-            locationsAndEdges[edge.getSourceLocationIndex()].emplace_back(std::make_pair(edgeIndex, &edge));
+            locationsAndEdges[edge.getSourceLocationIndex()].edges.emplace_back(std::make_pair(edgeIndex, &edge));
             ++edgeIndex;
         }
 
@@ -1299,7 +1338,7 @@ void JaniNextStateGenerator<ValueType, StateType>::createSynchronizationInformat
             uint64_t edgeIndex = 0;
             for (auto const& edge : parallelAutomata.back().get().getEdges()) {
                 if (edge.getActionIndex() == storm::jani::Model::SILENT_ACTION_INDEX) {
-                    locationsAndEdges[edge.getSourceLocationIndex()].emplace_back(std::make_pair(edgeIndex, &edge));
+                    locationsAndEdges[edge.getSourceLocationIndex()].edges.emplace_back(std::make_pair(edgeIndex, &edge));
                 }
                 ++edgeIndex;
             }
@@ -1325,7 +1364,7 @@ void JaniNextStateGenerator<ValueType, StateType>::createSynchronizationInformat
                     uint64_t edgeIndex = 0;
                     for (auto const& edge : parallelAutomata[automatonIndex].get().getEdges()) {
                         if (edge.getActionIndex() == actionIndex) {
-                            locationsAndEdges[edge.getSourceLocationIndex()].emplace_back(std::make_pair(edgeIndex, &edge));
+                            locationsAndEdges[edge.getSourceLocationIndex()].edges.emplace_back(std::make_pair(edgeIndex, &edge));
                         }
                         ++edgeIndex;
                     }
@@ -1347,6 +1386,23 @@ void JaniNextStateGenerator<ValueType, StateType>::createSynchronizationInformat
     STORM_LOG_TRACE("Number of synchronizations: " << this->edges.size() << ".");
 }
 
+template<typename ValueType, typename StateType>
+void JaniNextStateGenerator<ValueType, StateType>::buildGuardIndices() {
+    for (auto& outputAndEdges : this->edges) {
+        for (auto& automatonAndEdges : outputAndEdges.second) {
+            for (auto& locationAndEdges : automatonAndEdges.second) {
+                IndexedEdgeSet& edgeSet = locationAndEdges.second;
+                std::vector<storm::expressions::Expression> guards;
+                guards.reserve(edgeSet.edges.size());
+                for (auto const& indexAndEdge : edgeSet.edges) {
+                    guards.push_back(indexAndEdge.second->getGuard());
+                }
+                edgeSet.guardIndex = GuardIndex(guards, this->variableInformation);
+            }
+        }
+    }
+}
+
 template<typename ValueType, typename StateType>
 std::shared_ptr<storm::storage::sparse::ChoiceOrigins> JaniNextStateGenerator<ValueType, StateType>::generateChoiceOrigins(
     std::vector<boost::any>& dataForChoiceOrigins) const {
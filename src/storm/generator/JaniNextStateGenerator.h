@@ -1,5 +1,6 @@
 #pragma once
 
+#include "storm/generator/GuardIndex.h"
 #include "storm/generator/NextStateGenerator.h"
 #include "storm/generator/TransientVariableInformation.h"
 
@@ -43,6 +44,8 @@ class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
     virtual bool isDeterministicModel() const override;
     virtual bool isDiscreteTimeModel() const override;
     virtual bool isPartiallyObservable() const override;
+    virtual bool isCloneable() const override;
+    virtual std::shared_ptr<NextStateGenerator<ValueType, StateType>> clone() const override;
     virtual std::vector<StateType> getInitialStates(StateToIdCallback const& stateToIdCallback) override;
 
     /// Initializes a builder for state valuations by adding the appropriate variables.
@@ -97,6 +100,17 @@ class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
      */
     JaniNextStateGenerator(storm::jani::Model const& model, NextStateGeneratorOptions const& options, bool flag);
 
+    /*!
+     * Creates a generator for the (already preprocessed) model and options of the given generator. The new generator does not share any mutable data
+     * with the given one (see clone()).
+     */
+    JaniNextStateGenerator(JaniNextStateGenerator<ValueType, StateType> const& other);
+
+    /*!
+     * Initializes the information that is derived from the preprocessed model, e.g., the variable information and the evaluator.
+     */
+    void initializeFromPreprocessedModel();
+
     /*!
      * Applies an update to the state currently loaded into the evaluator and applies the resulting values to
      * the given compressed state.
@@ -158,7 +172,14 @@ class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
                                                  CompressedState const& state, StateToIdCallback stateToIdCallback);
 
     typedef std::vector<std::pair<uint64_t, storm::jani::Edge const*>> EdgeSetWithIndices;
-    typedef std::unordered_map<uint64_t, EdgeSetWithIndices> LocationsAndEdges;
+
+    // A set of edges leaving the same location together with an index over their guards.
+    struct IndexedEdgeSet {
+        EdgeSetWithIndices edges;
+        GuardIndex guardIndex;
+    };
+
+    typedef std::unordered_map<uint64_t, IndexedEdgeSet> LocationsAndEdges;
     typedef std::vector<std::pair<uint64_t, LocationsAndEdges>> AutomataAndEdges;
     typedef std::pair<boost::optional<uint64_t>, AutomataAndEdges> OutputAndEdges;
 
@@ -197,6 +218,12 @@ class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
      */
     void createSynchronizationInformation();
 
+    /*!
+     * Builds the indices over the guards of the edges leaving each location (see GuardIndex). This requires the
+     * variable information to be present.
+     */
+    void buildGuardIndices();
+
     /*!
      * Checks the underlying model for validity for this next-state generator.
      */
@@ -1,5 +1,6 @@
 #include "storm/generator/NextStateGenerator.h"
 #include <storm/exceptions/NotImplementedException.h>
+#include <storm/exceptions/NotSupportedException.h>
 #include <storm/exceptions/WrongFormatException.h>
 
 #include "storm/adapters/JsonAdapter.h"
@@ -41,6 +42,8 @@ NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions:
       variableInformation(variableInformation),
       evaluator(nullptr),
       state(nullptr),
+      unpackStatesLazily(false),
+      stateIsUnpacked(false),
       actionMask(mask) {
     if (variableInformation.hasOutOfBoundsBit()) {
         outOfBoundsState = createOutOfBoundsState(variableInformation);
@@ -54,7 +57,14 @@ template<typename ValueType, typename StateType>
 NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager,
                                                              NextStateGeneratorOptions const& options,
                                                              std::shared_ptr<ActionMask<ValueType, StateType>> const& mask)
-    : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(), evaluator(nullptr), state(nullptr), actionMask(mask) {
+    : options(options),
+      expressionManager(expressionManager.getSharedPointer()),
+      variableInformation(),
+      evaluator(nullptr),
+      state(nullptr),
+      unpackStatesLazily(false),
+      stateIsUnpacked(false),
+      actionMask(mask) {
     if (variableInformation.hasOutOfBoundsBit()) {
         outOfBoundsState = createOutOfBoundsState(variableInformation);
     }
@@ -68,6 +78,16 @@ NextStateGeneratorOptions const& NextStateGenerator<ValueType, StateType>::getOp
     return options;
 }
 
+template<typename ValueType, typename StateType>
+bool NextStateGenerator<ValueType, StateType>::isCloneable() const {
+    return false;
+}
+
+template<typename ValueType, typename StateType>
+std::shared_ptr<NextStateGenerator<ValueType, StateType>> NextStateGenerator<ValueType, StateType>::clone() const {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This next-state generator cannot be cloned.");
+}
+
 template<typename ValueType, typename StateType>
 uint64_t NextStateGenerator<ValueType, StateType>::getStateSize() const {
     return variableInformation.getTotalBitOffset(true);
@@ -109,11 +129,26 @@ storm::storage::sparse::StateValuationsBuilder NextStateGenerator<ValueType, Sta
 
 template<typename ValueType, typename StateType>
 void NextStateGenerator<ValueType, StateType>::load(CompressedState const& state) {
-    // Since almost all subsequent operations are based on the evaluator, we load the state into it now.
-    unpackStateIntoEvaluator(state, variableInformation, *evaluator);
-
-    // Also, we need to store a pointer to the state itself, because we need to be able to access it when expanding it.
+    // We need to store a pointer to the state itself, because we need to be able to access it when expanding it.
     this->state = &state;
+
+    // Unless the generator evaluates (most) expressions directly on the state, almost all subsequent operations are
+    // based on the evaluator, so we load the state into it now.
+    if (unpackStatesLazily) {
+        stateIsUnpacked = false;
+    } else {
+        unpackStateIntoEvaluator(state, variableInformation, *evaluator);
+        stateIsUnpacked = true;
+    }
+}
+
+template<typename ValueType, typename StateType>
+void NextStateGenerator<ValueType, StateType>::unpackCurrentStateIntoEvaluator() const {
+    if (!stateIsUnpacked) {
+        STORM_LOG_ASSERT(state != nullptr, "No state is loaded.");
+        unpackStateIntoEvaluator(*state, variableInformation, *evaluator);
+        stateIsUnpacked = true;
+    }
 }
 
 template<typename ValueType, typename StateType>
@@ -121,6 +156,7 @@ bool NextStateGenerator<ValueType, StateType>::satisfies(storm::expressions::Exp
     if (expression.isTrue()) {
         return true;
     }
+    unpackCurrentStateIntoEvaluator();
     return evaluator->asBool(expression);
 }
 
@@ -195,6 +231,8 @@ storm::models::sparse::StateLabeling NextStateGenerator<ValueType, StateType>::l
         result.addLabel(label.first);
     }
 
+    // The evaluator no longer holds the currently loaded state.
+    stateIsUnpacked = false;
     auto const& states = stateStorage.stateToId;
     for (auto const& stateIndexPair : states) {
         unpackStateIntoEvaluator(stateIndexPair.first, variableInformation, *this->evaluator);
@@ -124,6 +124,17 @@ class NextStateGenerator {
 
     NextStateGeneratorOptions const& getOptions() const;
 
+    /*!
+     * Retrieves whether this generator is able to create independent copies of itself (see clone()).
+     */
+    virtual bool isCloneable() const;
+
+    /*!
+     * Creates a generator for the same model and options that does not share any mutable data with this one.
+     * In particular, this and the cloned generator can load and expand states concurrently.
+     */
+    virtual std::shared_ptr<NextStateGenerator<ValueType, StateType>> clone() const;
+
     VariableInformation const& getVariableInformation() const;
 
     virtual std::shared_ptr<storm::storage::sparse::ChoiceOrigins> generateChoiceOrigins(std::vector<boost::any>& dataForChoiceOrigins) const;
@@ -155,6 +166,11 @@ class NextStateGenerator {
 
     virtual storm::storage::BitVector evaluateObservationLabels(CompressedState const& state) const = 0;
 
+    /*!
+     * Unpacks the currently loaded state into the evaluator, unless this already happened since it was loaded.
+     */
+    void unpackCurrentStateIntoEvaluator() const;
+
     virtual void extendStateInformation(storm::json<ValueType>& stateInfo) const;
 
     virtual storm::storage::sparse::StateValuationsBuilder initializeObservationValuationsBuilder() const;
@@ -179,6 +195,12 @@ class NextStateGenerator {
     /// The currently loaded state.
     CompressedState const* state;
 
+    /// If set, loading a state does not unpack it into the evaluator. Instead, this is done on demand (see unpackCurrentStateIntoEvaluator).
+    bool unpackStatesLazily;
+
+    /// A flag indicating whether the evaluator holds the values of the currently loaded state.
+    mutable bool stateIsUnpacked;
+
     /// A comparator used to compare constants.
     storm::utility::ConstantsComparator<ValueType> comparator;
 
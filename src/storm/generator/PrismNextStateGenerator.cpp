@@ -1,5 +1,7 @@
 #include "storm/generator/PrismNextStateGenerator.h"
 
+#include <type_traits>
+
 #include <boost/any.hpp>
 #include <boost/container/flat_map.hpp>
 
@@ -11,10 +13,12 @@
 #include "storm/storage/sparse/PrismChoiceOrigins.h"
 
 #include "storm/generator/Distribution.h"
+#include "storm/generator/VariableInformation.h"
 
 #include "storm/solver/SmtSolver.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UnexpectedException.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/storage/expressions/ExpressionEvaluator.h"
@@ -101,6 +105,148 @@ PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::pr
         moduleIndexToPlayerIndexMap = program.buildModuleIndexToPlayerIndexMap();
         actionIndexToPlayerIndexMap = program.buildActionIndexToPlayerIndexMap();
     }
+
+    // Most expressions can be evaluated directly on the compressed states, so we only unpack states if necessary.
+    compileExpressions();
+    this->unpackStatesLazily = true;
+
+    buildGuardIndices();
+}
+
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::compileExpressions() {
+    // Likelihoods and reward values are only evaluated in double precision if this is also done by the evaluator.
+    bool const compileRationalExpressions = std::is_same<ValueType, double>::value;
+    auto compile = [this](storm::expressions::Expression const& expression) {
+        return CompiledStateExpression::compile(expression, this->variableInformation);
+    };
+
+    for (auto const& module : program.getModules()) {
+        for (auto const& command : module.getCommands()) {
+            if (command.getGlobalIndex() >= compiledGuards.size()) {
+                compiledGuards.resize(command.getGlobalIndex() + 1);
+            }
+            compiledGuards[command.getGlobalIndex()] = compile(command.getGuardExpression());
+
+            for (auto const& update : command.getUpdates()) {
+                if (update.getGlobalIndex() >= compiledAssignments.size()) {
+                    compiledLikelihoods.resize(update.getGlobalIndex() + 1);
+                    compiledAssignments.resize(update.getGlobalIndex() + 1);
+                }
+                if (compileRationalExpressions) {
+                    compiledLikelihoods[update.getGlobalIndex()] = compile(update.getLikelihoodExpression());
+                }
+                auto& assignments = compiledAssignments[update.getGlobalIndex()];
+                for (auto const& assignment : update.getAssignments()) {
+                    assignments.push_back(compile(assignment.getExpression()));
+                }
+            }
+        }
+    }
+
+    auto compileRewards = [&](auto const& rewards) {
+        std::vector<CompiledRewardExpressions> result;
+        for (auto const& reward : rewards) {
+            result.emplace_back();
+            result.back().statePredicate = compile(reward.getStatePredicateExpression());
+            if (compileRationalExpressions) {
+                result.back().rewardValue = compile(reward.getRewardValueExpression());
+            }
+        }
+        return result;
+    };
+    for (auto const& rewardModel : rewardModels) {
+        compiledStateRewards.push_back(compileRewards(rewardModel.get().getStateRewards()));
+        compiledStateActionRewards.push_back(compileRewards(rewardModel.get().getStateActionRewards()));
+    }
+
+    for (auto const& expressionBool : this->terminalStates) {
+        compiledTerminalStates.push_back(compile(expressionBool.first));
+    }
+}
+
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::buildGuardIndices() {
+    auto indexCommands = [this](storm::prism::Module const& module, std::vector<uint_fast64_t>&& commandIndices) {
+        std::vector<storm::expressions::Expression> guards;
+        guards.reserve(commandIndices.size());
+        for (auto const& commandIndex : commandIndices) {
+            guards.push_back(module.getCommand(commandIndex).getGuardExpression());
+        }
+        IndexedCommands result;
+        result.guardIndex = GuardIndex(guards, this->variableInformation);
+        result.commandIndices = std::move(commandIndices);
+        return result;
+    };
+
+    for (auto const& module : program.getModules()) {
+        std::vector<uint_fast64_t> commandIndices;
+        for (uint_fast64_t commandIndex = 0; commandIndex < module.getNumberOfCommands(); ++commandIndex) {
+            if (!isCommandPotentiallySynchronizing(module.getCommand(commandIndex))) {
+                commandIndices.push_back(commandIndex);
+            }
+        }
+        asynchronousCommands.push_back(indexCommands(module, std::move(commandIndices)));
+
+        synchronizingCommands.emplace_back();
+        for (auto const& actionIndex : program.getSynchronizingActionIndices()) {
+            if (!module.hasActionIndex(actionIndex)) {
+                continue;
+            }
+            std::set<uint_fast64_t> const& commandIndicesOfAction = module.getCommandIndicesByActionIndex(actionIndex);
+            synchronizingCommands.back().emplace(
+                actionIndex, indexCommands(module, std::vector<uint_fast64_t>(commandIndicesOfAction.begin(), commandIndicesOfAction.end())));
+        }
+    }
+}
+
+template<typename ValueType, typename StateType>
+bool PrismNextStateGenerator<ValueType, StateType>::evaluateBooleanExpression(storm::expressions::Expression const& expression,
+                                                                              boost::optional<CompiledStateExpression> const& compiledExpression) const {
+    if (compiledExpression) {
+        return compiledExpression->evaluateAsBool(*this->state);
+    }
+    this->unpackCurrentStateIntoEvaluator();
+    return this->evaluator->asBool(expression);
+}
+
+template<typename ValueType, typename StateType>
+int_fast64_t PrismNextStateGenerator<ValueType, StateType>::evaluateIntegerExpression(
+    storm::expressions::Expression const& expression, boost::optional<CompiledStateExpression> const& compiledExpression) const {
+    if (compiledExpression) {
+        return compiledExpression->evaluateAsInt(*this->state);
+    }
+    this->unpackCurrentStateIntoEvaluator();
+    return this->evaluator->asInt(expression);
+}
+
+template<typename ValueType, typename StateType>
+ValueType PrismNextStateGenerator<ValueType, StateType>::evaluateRationalExpression(storm::expressions::Expression const& expression,
+                                                                                    boost::optional<CompiledStateExpression> const& compiledExpression) const {
+    if (compiledExpression) {
+        return storm::utility::convertNumber<ValueType>(compiledExpression->evaluateAsDouble(*this->state));
+    }
+    this->unpackCurrentStateIntoEvaluator();
+    return ValueType(this->evaluator->asRational(expression));
+}
+
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::addStateActionRewards(Choice<ValueType>& choice) const {
+    for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModels.size(); ++rewardModelIndex) {
+        auto const& rewardModel = rewardModels[rewardModelIndex].get();
+        ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
+        if (rewardModel.hasStateActionRewards()) {
+            for (uint64_t rewardIndex = 0; rewardIndex < rewardModel.getStateActionRewards().size(); ++rewardIndex) {
+                auto const& stateActionReward = rewardModel.getStateActionRewards()[rewardIndex];
+                auto const& compiledStateActionReward = compiledStateActionRewards[rewardModelIndex][rewardIndex];
+                if (stateActionReward.getActionIndex() == choice.getActionIndex() &&
+                    evaluateBooleanExpression(stateActionReward.getStatePredicateExpression(), compiledStateActionReward.statePredicate)) {
+                    stateActionRewardValue += evaluateRationalExpression(stateActionReward.getRewardValueExpression(), compiledStateActionReward.rewardValue);
+                }
+            }
+        }
+        choice.addReward(stateActionRewardValue);
+    }
 }
 
 template<typename ValueType, typename StateType>
@@ -177,6 +323,19 @@ bool PrismNextStateGenerator<ValueType, StateType>::isPartiallyObservable() cons
     return program.isPartiallyObservable();
 }
 
+template<typename ValueType, typename StateType>
+bool PrismNextStateGenerator<ValueType, StateType>::isCloneable() const {
+    // Action masks may carry state that we cannot duplicate.
+    return !this->actionMask;
+}
+
+template<typename ValueType, typename StateType>
+std::shared_ptr<NextStateGenerator<ValueType, StateType>> PrismNextStateGenerator<ValueType, StateType>::clone() const {
+    STORM_LOG_THROW(isCloneable(), storm::exceptions::NotSupportedException, "Cannot clone a PRISM next-state generator that uses an action mask.");
+    // The program stored here is already preprocessed, so we can directly use the delegate constructor.
+    return std::shared_ptr<NextStateGenerator<ValueType, StateType>>(new PrismNextStateGenerator<ValueType, StateType>(program, this->options, nullptr, false));
+}
+
 template<typename ValueType, typename StateType>
 std::vector<StateType> PrismNextStateGenerator<ValueType, StateType>::getInitialStates(StateToIdCallback const& stateToIdCallback) {
     std::vector<StateType> initialStateIndices;
@@ -285,12 +444,15 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
 
     // First, construct the state rewards, as we may return early if there are no choices later and we already
     // need the state rewards then.
-    for (auto const& rewardModel : rewardModels) {
+    for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModels.size(); ++rewardModelIndex) {
+        auto const& rewardModel = rewardModels[rewardModelIndex].get();
         ValueType stateRewardValue = storm::utility::zero<ValueType>();
-        if (rewardModel.get().hasStateRewards()) {
-            for (auto const& stateReward : rewardModel.get().getStateRewards()) {
-                if (this->evaluator->asBool(stateReward.getStatePredicateExpression())) {
-                    stateRewardValue += ValueType(this->evaluator->asRational(stateReward.getRewardValueExpression()));
+        if (rewardModel.hasStateRewards()) {
+            for (uint64_t rewardIndex = 0; rewardIndex < rewardModel.getStateRewards().size(); ++rewardIndex) {
+                auto const& stateReward = rewardModel.getStateRewards()[rewardIndex];
+                auto const& compiledStateReward = compiledStateRewards[rewardModelIndex][rewardIndex];
+                if (evaluateBooleanExpression(stateReward.getStatePredicateExpression(), compiledStateReward.statePredicate)) {
+                    stateRewardValue += evaluateRationalExpression(stateReward.getRewardValueExpression(), compiledStateReward.rewardValue);
                 }
             }
         }
@@ -299,8 +461,9 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
 
     // If a terminal expression was set and we must not expand this state, return now.
     if (!this->terminalStates.empty()) {
-        for (auto const& expressionBool : this->terminalStates) {
-            if (this->evaluator->asBool(expressionBool.first) == expressionBool.second) {
+        for (uint64_t terminalStateIndex = 0; terminalStateIndex < this->terminalStates.size(); ++terminalStateIndex) {
+            auto const& expressionBool = this->terminalStates[terminalStateIndex];
+            if (evaluateBooleanExpression(expressionBool.first, compiledTerminalStates[terminalStateIndex]) == expressionBool.second) {
                 return result;
             }
         }
@@ -368,15 +531,19 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
         }
 
         // Now construct the state-action reward for all selected reward models.
-        for (auto const& rewardModel : rewardModels) {
+        for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModels.size(); ++rewardModelIndex) {
+            auto const& rewardModel = rewardModels[rewardModelIndex].get();
             ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
-            if (rewardModel.get().hasStateActionRewards()) {
-                for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
+            if (rewardModel.hasStateActionRewards()) {
+                for (uint64_t rewardIndex = 0; rewardIndex < rewardModel.getStateActionRewards().size(); ++rewardIndex) {
+                    auto const& stateActionReward = rewardModel.getStateActionRewards()[rewardIndex];
+                    auto const& compiledStateActionReward = compiledStateActionRewards[rewardModelIndex][rewardIndex];
                     for (auto const& choice : allChoices) {
                         if (stateActionReward.getActionIndex() == choice.getActionIndex() &&
-                            this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
+                            evaluateBooleanExpression(stateActionReward.getStatePredicateExpression(), compiledStateActionReward.statePredicate)) {
                             stateActionRewardValue +=
-                                ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression())) * choice.getTotalMass();
+                                evaluateRationalExpression(stateActionReward.getRewardValueExpression(), compiledStateActionReward.rewardValue) *
+                                choice.getTotalMass();
                         }
                     }
                 }
@@ -426,6 +593,7 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
 
 template<typename ValueType, typename StateType>
 bool PrismNextStateGenerator<ValueType, StateType>::evaluateBooleanExpressionInCurrentState(expressions::Expression const& expr) const {
+    this->unpackCurrentStateIntoEvaluator();
     return this->evaluator->asBool(expr);
 }
 
@@ -437,26 +605,29 @@ CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(Compr
     // assignments to boolean variables precede the assignments to all integer variables and that within the
     // types, the assignments to variables are ordered (in ascending order) by the expression variables.
     // This is guaranteed for PRISM models, by sorting the assignments as soon as an update is created.
+    // Note that the assigned expressions are evaluated in the currently loaded state, which differs from the given
+    // state if the update is applied as part of a synchronized choice.
 
     auto assignmentIt = update.getAssignments().begin();
     auto assignmentIte = update.getAssignments().end();
+    auto compiledAssignmentIt = compiledAssignments[update.getGlobalIndex()].begin();
 
     // Iterate over all boolean assignments and carry them out.
     auto boolIt = this->variableInformation.booleanVariables.begin();
-    for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasBooleanType(); ++assignmentIt) {
+    for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasBooleanType(); ++assignmentIt, ++compiledAssignmentIt) {
         while (assignmentIt->getVariable() != boolIt->variable) {
             ++boolIt;
         }
-        newState.set(boolIt->bitOffset, this->evaluator->asBool(assignmentIt->getExpression()));
+        newState.set(boolIt->bitOffset, evaluateBooleanExpression(assignmentIt->getExpression(), *compiledAssignmentIt));
     }
 
     // Iterate over all integer assignments and carry them out.
     auto integerIt = this->variableInformation.integerVariables.begin();
-    for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasIntegerType(); ++assignmentIt) {
+    for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasIntegerType(); ++assignmentIt, ++compiledAssignmentIt) {
         while (assignmentIt->getVariable() != integerIt->variable) {
             ++integerIt;
         }
-        int_fast64_t assignedValue = this->evaluator->asInt(assignmentIt->getExpression());
+        int_fast64_t assignedValue = evaluateIntegerExpression(assignmentIt->getExpression(), *compiledAssignmentIt);
         if (this->options.isAddOutOfBoundsStateSet()) {
             if (assignedValue < integerIt->lowerBound || assignedValue > integerIt->upperBound) {
                 return this->outOfBoundsState;
@@ -482,14 +653,16 @@ CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(Compr
 }
 
 struct ActiveCommandData {
-    ActiveCommandData(storm::prism::Module const* modulePtr, std::set<uint_fast64_t> const* commandIndicesPtr,
-                      typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt)
-        : modulePtr(modulePtr), commandIndicesPtr(commandIndicesPtr), currentCommandIndexIt(currentCommandIndexIt) {
+    ActiveCommandData(storm::prism::Module const* modulePtr, std::vector<uint64_t> const* candidatesPtr, std::vector<uint_fast64_t> const* commandIndicesPtr,
+                      typename std::vector<uint64_t>::const_iterator currentCandidateIt)
+        : modulePtr(modulePtr), candidatesPtr(candidatesPtr), commandIndicesPtr(commandIndicesPtr), currentCandidateIt(currentCandidateIt) {
         // Intentionally left empty
     }
     storm::prism::Module const* modulePtr;
-    std::set<uint_fast64_t> const* commandIndicesPtr;
-    typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt;
+    // The positions (within the command indices) of the commands whose guard is potentially satisfied.
+    std::vector<uint64_t> const* candidatesPtr;
+    std::vector<uint_fast64_t> const* commandIndicesPtr;
+    typename std::vector<uint64_t>::const_iterator currentCandidateIt;
 };
 
 template<typename ValueType, typename StateType>
@@ -506,11 +679,12 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
         storm::prism::Module const& module = program.getModule(i);
 
         // If the module has no command labeled with the given action, we can skip this module.
-        if (!module.hasActionIndex(actionIndex)) {
+        auto indexedCommandsIt = synchronizingCommands[i].find(actionIndex);
+        if (indexedCommandsIt == synchronizingCommands[i].end()) {
             continue;
         }
 
-        std::set<uint_fast64_t> const& commandIndices = module.getCommandIndicesByActionIndex(actionIndex);
+        std::vector<uint_fast64_t> const& commandIndices = indexedCommandsIt->second.commandIndices;
 
         // If the module contains the action, but there is no command in the module that is labeled with
         // this action, we don't have any feasible command combinations.
@@ -518,10 +692,12 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
             return boost::none;
         }
 
-        // Look up commands by their indices and check if the guard evaluates to true in the given state.
+        // Look up commands by their indices and check if the guard evaluates to true in the given state. Commands whose
+        // guard is known to be violated by the guard index are skipped right away.
+        std::vector<uint64_t> const& candidates = indexedCommandsIt->second.guardIndex.getPotentiallySatisfiedGuards(*this->state);
         bool hasOneEnabledCommand = false;
-        for (auto commandIndexIt = commandIndices.begin(), commandIndexIte = commandIndices.end(); commandIndexIt != commandIndexIte; ++commandIndexIt) {
-            storm::prism::Command const& command = module.getCommand(*commandIndexIt);
+        for (auto candidateIt = candidates.begin(), candidateIte = candidates.end(); candidateIt != candidateIte; ++candidateIt) {
+            storm::prism::Command const& command = module.getCommand(commandIndices[*candidateIt]);
             if (!isCommandPotentiallySynchronizing(command)) {
                 continue;
             }
@@ -531,10 +707,10 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
                     continue;
                 }
             }
-            if (this->evaluator->asBool(command.getGuardExpression())) {
+            if (evaluateBooleanExpression(command.getGuardExpression(), compiledGuards[command.getGlobalIndex()])) {
                 // Found the first enabled command for this module.
                 hasOneEnabledCommand = true;
-                activeCommands.emplace_back(&module, &commandIndices, commandIndexIt);
+                activeCommands.emplace_back(&module, &candidates, &commandIndices, candidateIt);
                 break;
             }
         }
@@ -551,21 +727,21 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
     for (auto const& activeCommand : activeCommands) {
         std::vector<std::reference_wrapper<storm::prism::Command const>> commands;
 
-        auto commandIndexIt = activeCommand.currentCommandIndexIt;
+        auto candidateIt = activeCommand.currentCandidateIt;
         // The command at the current position is already known to be enabled
-        commands.push_back(activeCommand.modulePtr->getCommand(*commandIndexIt));
+        commands.push_back(activeCommand.modulePtr->getCommand((*activeCommand.commandIndicesPtr)[*candidateIt]));
 
         // Look up commands by their indices and add them if the guard evaluates to true in the given state.
-        auto commandIndexIte = activeCommand.commandIndicesPtr->end();
-        for (++commandIndexIt; commandIndexIt != commandIndexIte; ++commandIndexIt) {
-            storm::prism::Command const& command = activeCommand.modulePtr->getCommand(*commandIndexIt);
+        auto candidateIte = activeCommand.candidatesPtr->end();
+        for (++candidateIt; candidateIt != candidateIte; ++candidateIt) {
+            storm::prism::Command const& command = activeCommand.modulePtr->getCommand((*activeCommand.commandIndicesPtr)[*candidateIt]);
             if (commandFilter != CommandFilter::All) {
                 STORM_LOG_ASSERT(commandFilter == CommandFilter::Markovian || commandFilter == CommandFilter::Probabilistic, "Unexpected command filter.");
                 if ((commandFilter == CommandFilter::Markovian) != command.isMarkovian()) {
                     continue;
                 }
             }
-            if (this->evaluator->asBool(command.getGuardExpression())) {
+            if (evaluateBooleanExpression(command.getGuardExpression(), compiledGuards[command.getGlobalIndex()])) {
                 commands.push_back(command);
             }
         }
@@ -587,13 +763,10 @@ std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::ge
     for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
         storm::prism::Module const& module = program.getModule(i);
 
-        // Iterate over all commands.
-        for (uint_fast64_t j = 0; j < module.getNumberOfCommands(); ++j) {
-            storm::prism::Command const& command = module.getCommand(j);
-
-            // Only consider commands that are not possibly synchronizing.
-            if (isCommandPotentiallySynchronizing(command))
-                continue;
+        // Iterate over all commands that are not possibly synchronizing and whose guard is potentially satisfied.
+        IndexedCommands const& indexedCommands = asynchronousCommands[i];
+        for (auto const& candidate : indexedCommands.guardIndex.getPotentiallySatisfiedGuards(state)) {
+            storm::prism::Command const& command = module.getCommand(indexedCommands.commandIndices[candidate]);
 
             if (commandFilter != CommandFilter::All) {
                 STORM_LOG_ASSERT(commandFilter == CommandFilter::Markovian || commandFilter == CommandFilter::Probabilistic, "Unexpected command filter.");
@@ -608,7 +781,7 @@ std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::ge
             }
 
             // Skip the command, if it is not enabled.
-            if (!this->evaluator->asBool(command.getGuardExpression())) {
+            if (!evaluateBooleanExpression(command.getGuardExpression(), compiledGuards[command.getGlobalIndex()])) {
                 continue;
             }
 
@@ -626,7 +799,7 @@ std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::ge
             for (uint_fast64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
                 storm::prism::Update const& update = command.getUpdate(k);
 
-                ValueType probability = this->evaluator->asRational(update.getLikelihoodExpression());
+                ValueType probability = evaluateRationalExpression(update.getLikelihoodExpression(), compiledLikelihoods[update.getGlobalIndex()]);
                 if (probability != storm::utility::zero<ValueType>()) {
                     // Obtain target state index and add it to the list of known states. If it has not yet been
                     // seen, we also add it to the set of states that have yet to be explored.
@@ -641,18 +814,7 @@ std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::ge
             }
 
             // Create the state-action reward for the newly created choice.
-            for (auto const& rewardModel : rewardModels) {
-                ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
-                if (rewardModel.get().hasStateActionRewards()) {
-                    for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
-                        if (stateActionReward.getActionIndex() == choice.getActionIndex() &&
-                            this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
-                            stateActionRewardValue += ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression()));
-                        }
-                    }
-                }
-                choice.addReward(stateActionRewardValue);
-            }
+            addStateActionRewards(choice);
 
             if (this->options.isBuildChoiceLabelsSet() && command.isLabeled()) {
                 choice.addLabel(program.getActionName(command.getActionIndex()));
@@ -692,8 +854,8 @@ void PrismNextStateGenerator<ValueType, StateType>::generateSynchronizedDistribu
         storm::prism::Command const& command = *iteratorList[position];
         for (uint_fast64_t j = 0; j < command.getNumberOfUpdates(); ++j) {
             storm::prism::Update const& update = command.getUpdate(j);
-            generateSynchronizedDistribution(applyUpdate(state, update), probability * this->evaluator->asRational(update.getLikelihoodExpression()),
-                                             position + 1, iteratorList, distribution, stateToIdCallback);
+            ValueType likelihood = evaluateRationalExpression(update.getLikelihoodExpression(), compiledLikelihoods[update.getGlobalIndex()]);
+            generateSynchronizedDistribution(applyUpdate(state, update), probability * likelihood, position + 1, iteratorList, distribution, stateToIdCallback);
         }
     }
 }
@@ -775,18 +937,7 @@ void PrismNextStateGenerator<ValueType, StateType>::addSynchronousChoices(std::v
                 }
 
                 // Create the state-action reward for the newly created choice.
-                for (auto const& rewardModel : rewardModels) {
-                    ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
-                    if (rewardModel.get().hasStateActionRewards()) {
-                        for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
-                            if (stateActionReward.getActionIndex() == choice.getActionIndex() &&
-                                this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
-                                stateActionRewardValue += ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression()));
-                            }
-                        }
-                    }
-                    choice.addReward(stateActionRewardValue);
-                }
+                addStateActionRewards(choice);
 
                 // Now, check whether there is one more command combination to consider.
                 bool movedIterator = false;
@@ -844,6 +995,8 @@ storm::storage::BitVector PrismNextStateGenerator<ValueType, StateType>::evaluat
         return result;
     }
     unpackStateIntoEvaluator(state, this->variableInformation, *this->evaluator);
+    // The evaluator no longer holds the currently loaded state.
+    this->stateIsUnpacked = false;
     for (uint64_t i = 0; i < program.getNumberOfObservationLabels(); ++i) {
         result.setFromInt(64 * i, 64, this->evaluator->asInt(program.getObservationLabels()[i].getStatePredicateExpression()));
     }
@@ -852,6 +1005,7 @@ storm::storage::BitVector PrismNextStateGenerator<ValueType, StateType>::evaluat
 
 template<typename ValueType, typename StateType>
 void PrismNextStateGenerator<ValueType, StateType>::extendStateInformation(storm::json<ValueType>& result) const {
+    this->unpackCurrentStateIntoEvaluator();
     for (uint64_t i = 0; i < program.getNumberOfObservationLabels(); ++i) {
         result[program.getObservationLabels()[i].getName()] = this->evaluator->asInt(program.getObservationLabels()[i].getStatePredicateExpression());
     }
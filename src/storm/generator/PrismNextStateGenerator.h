@@ -1,6 +1,8 @@
 #ifndef STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 #define STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 
+#include "storm/generator/CompiledStateExpression.h"
+#include "storm/generator/GuardIndex.h"
 #include "storm/generator/NextStateGenerator.h"
 
 #include "storm/storage/BoostTypes.h"
@@ -32,6 +34,8 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
     virtual bool isDeterministicModel() const override;
     virtual bool isDiscreteTimeModel() const override;
     virtual bool isPartiallyObservable() const override;
+    virtual bool isCloneable() const override;
+    virtual std::shared_ptr<NextStateGenerator<ValueType, StateType>> clone() const override;
     virtual std::vector<StateType> getInitialStates(StateToIdCallback const& stateToIdCallback) override;
 
     virtual StateBehavior<ValueType, StateType> expand(StateToIdCallback const& stateToIdCallback) override;
@@ -125,6 +129,32 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
 
     bool isCommandPotentiallySynchronizing(prism::Command const& command) const;
 
+    /*!
+     * Translates the guards, updates, reward expressions and terminal state expressions such that they can be
+     * evaluated directly on compressed states (see CompiledStateExpression).
+     */
+    void compileExpressions();
+
+    /*!
+     * Builds the indices over the guards of the commands of each module (see GuardIndex).
+     */
+    void buildGuardIndices();
+
+    /*!
+     * Evaluates the given expression in the currently loaded state. If a translation of the expression is given, it
+     * is used. Otherwise, the expression is evaluated with the evaluator.
+     */
+    bool evaluateBooleanExpression(storm::expressions::Expression const& expression, boost::optional<CompiledStateExpression> const& compiledExpression) const;
+    int_fast64_t evaluateIntegerExpression(storm::expressions::Expression const& expression,
+                                           boost::optional<CompiledStateExpression> const& compiledExpression) const;
+    ValueType evaluateRationalExpression(storm::expressions::Expression const& expression,
+                                         boost::optional<CompiledStateExpression> const& compiledExpression) const;
+
+    /*!
+     * Adds the state-action rewards of all selected reward models for the given choice of the currently loaded state.
+     */
+    void addStateActionRewards(Choice<ValueType>& choice) const;
+
     // The program used for the generation of next states.
     storm::prism::Program program;
 
@@ -137,6 +167,41 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
     // Mappings from module/action indices to the programs players
     std::vector<storm::storage::PlayerIndex> moduleIndexToPlayerIndexMap;
     std::map<uint_fast64_t, storm::storage::PlayerIndex> actionIndexToPlayerIndexMap;
+
+    // The translations of the expressions of the program that are evaluated directly on compressed states. Expressions
+    // that could not be translated are none and are evaluated with the evaluator instead.
+    struct CompiledRewardExpressions {
+        boost::optional<CompiledStateExpression> statePredicate;
+        boost::optional<CompiledStateExpression> rewardValue;
+    };
+
+    // The guards, indexed by the global index of the command.
+    std::vector<boost::optional<CompiledStateExpression>> compiledGuards;
+
+    // The likelihoods, indexed by the global index of the update.
+    std::vector<boost::optional<CompiledStateExpression>> compiledLikelihoods;
+
+    // The assignments, indexed by the global index of the update and the position of the assignment within the update.
+    std::vector<std::vector<boost::optional<CompiledStateExpression>>> compiledAssignments;
+
+    // The state rewards and state-action rewards, indexed like the rewards in the (selected) reward models.
+    std::vector<std::vector<CompiledRewardExpressions>> compiledStateRewards;
+    std::vector<std::vector<CompiledRewardExpressions>> compiledStateActionRewards;
+
+    // The expressions defining terminal states, indexed like the terminal states.
+    std::vector<boost::optional<CompiledStateExpression>> compiledTerminalStates;
+
+    // Commands of a module (in the order of their indices within the module) together with an index over their guards.
+    struct IndexedCommands {
+        std::vector<uint_fast64_t> commandIndices;
+        GuardIndex guardIndex;
+    };
+
+    // The commands of each module that are not potentially synchronizing, indexed by the module index.
+    std::vector<IndexedCommands> asynchronousCommands;
+
+    // The commands of each module that are labeled with an action, indexed by the module index and the action index.
+    std::vector<std::map<uint_fast64_t, IndexedCommands>> synchronizingCommands;
 };
 
 }  // namespace generator
@@ -0,0 +1,165 @@
+#include "storm/io/BinaryModelExporter.h"
+
+#include <algorithm>
+#include <set>
+#include <sstream>
+
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace exporter {
+
+namespace {
+/*!
+ * Writes the components of a model as a sequence of 64-bit words.
+ */
+class BinaryWriter {
+   public:
+    BinaryWriter(std::ostream& os) : os(os) {
+        // Intentionally left empty.
+    }
+
+    void writeWord(uint64_t word) {
+        os.write(reinterpret_cast<char const*>(&word), sizeof(word));
+    }
+
+    void writeString(std::string const& str) {
+        writeWord(str.size());
+        os.write(str.data(), str.size());
+        // Pad the string such that the next word is aligned.
+        uint64_t padding = (8 - str.size() % 8) % 8;
+        for (uint64_t i = 0; i < padding; ++i) {
+            os.put('\0');
+        }
+    }
+
+    template<typename T>
+    void writeArray(std::vector<T> const& values) {
+        static_assert(sizeof(T) == 8, "Only arrays of 64-bit values can be written.");
+        writeWord(values.size());
+        os.write(reinterpret_cast<char const*>(values.data()), values.size() * sizeof(T));
+    }
+
+    void writeBitVector(storm::storage::BitVector const& bitVector) {
+        writeWord(bitVector.size());
+        for (uint64_t bitIndex = 0; bitIndex < bitVector.size(); bitIndex += 64) {
+            writeWord(bitVector.getAsInt(bitIndex, std::min<uint64_t>(64, bitVector.size() - bitIndex)));
+        }
+    }
+
+    void writeMatrix(storm::storage::SparseMatrix<double> const& matrix) {
+        writeWord(matrix.getRowCount());
+        writeWord(matrix.getColumnCount());
+        writeWord(matrix.hasTrivialRowGrouping() ? 0 : 1);
+        if (!matrix.hasTrivialRowGrouping()) {
+            writeArray(matrix.getRowGroupIndices());
+        }
+
+        std::vector<uint64_t> rowIndications;
+        rowIndications.reserve(matrix.getRowCount() + 1);
+        std::vector<uint64_t> columns;
+        columns.reserve(matrix.getEntryCount());
+        std::vector<double> values;
+        values.reserve(matrix.getEntryCount());
+        rowIndications.push_back(0);
+        for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+            for (auto const& entry : matrix.getRow(row)) {
+                columns.push_back(entry.getColumn());
+                values.push_back(entry.getValue());
+            }
+            rowIndications.push_back(columns.size());
+        }
+        writeArray(rowIndications);
+        writeArray(columns);
+        writeArray(values);
+    }
+
+    void writeLabeling(storm::models::sparse::StateLabeling const& labeling) {
+        std::set<std::string> labels = labeling.getLabels();
+        writeWord(labels.size());
+        for (auto const& label : labels) {
+            writeString(label);
+            writeBitVector(labeling.getStates(label));
+        }
+    }
+
+    void writeLabeling(storm::models::sparse::ChoiceLabeling const& labeling) {
+        std::set<std::string> labels = labeling.getLabels();
+        writeWord(labels.size());
+        for (auto const& label : labels) {
+            writeString(label);
+            writeBitVector(labeling.getChoices(label));
+        }
+    }
+
+   private:
+    std::ostream& os;
+};
+}  // namespace
+
+void exportSparseModelAsBinary(std::ostream& os, storm::models::sparse::Model<double> const& sparseModel) {
+    STORM_LOG_THROW(sparseModel.getType() != storm::models::ModelType::S2pg && sparseModel.getType() != storm::models::ModelType::Smg,
+                    storm::exceptions::NotSupportedException, "Exporting " << sparseModel.getType() << " models in binary format is not supported.");
+    STORM_LOG_WARN_COND(!sparseModel.hasStateValuations(), "State valuations are not exported in binary format.");
+    STORM_LOG_WARN_COND(!sparseModel.hasChoiceOrigins(), "Choice origins are not exported in binary format.");
+
+    BinaryWriter writer(os);
+
+    // Header.
+    os.write(BinaryModelFormat::magic, sizeof(BinaryModelFormat::magic));
+    writer.writeWord(BinaryModelFormat::version);
+    writer.writeWord(BinaryModelFormat::byteOrderMark);
+    std::stringstream modelType;
+    modelType << sparseModel.getType();
+    writer.writeString(modelType.str());
+
+    writer.writeMatrix(sparseModel.getTransitionMatrix());
+    writer.writeLabeling(sparseModel.getStateLabeling());
+
+    writer.writeWord(sparseModel.getNumberOfRewardModels());
+    for (auto const& rewardModel : sparseModel.getRewardModels()) {
+        writer.writeString(rewardModel.first);
+        uint64_t flags = 0;
+        flags |= rewardModel.second.hasStateRewards() ? BinaryModelFormat::stateRewardsFlag : 0;
+        flags |= rewardModel.second.hasStateActionRewards() ? BinaryModelFormat::stateActionRewardsFlag : 0;
+        flags |= rewardModel.second.hasTransitionRewards() ? BinaryModelFormat::transitionRewardsFlag : 0;
+        writer.writeWord(flags);
+        if (rewardModel.second.hasStateRewards()) {
+            writer.writeArray(rewardModel.second.getStateRewardVector());
+        }
+        if (rewardModel.second.hasStateActionRewards()) {
+            writer.writeArray(rewardModel.second.getStateActionRewardVector());
+        }
+        if (rewardModel.second.hasTransitionRewards()) {
+            writer.writeMatrix(rewardModel.second.getTransitionRewardMatrix());
+        }
+    }
+
+    writer.writeWord(sparseModel.hasChoiceLabeling() ? 1 : 0);
+    if (sparseModel.hasChoiceLabeling()) {
+        writer.writeLabeling(sparseModel.getChoiceLabeling());
+    }
+
+    // Model type specific components.
+    if (sparseModel.getType() == storm::models::ModelType::Ctmc) {
+        writer.writeArray(dynamic_cast<storm::models::sparse::Ctmc<double> const&>(sparseModel).getExitRateVector());
+    } else if (sparseModel.getType() == storm::models::ModelType::MarkovAutomaton) {
+        auto const& ma = dynamic_cast<storm::models::sparse::MarkovAutomaton<double> const&>(sparseModel);
+        writer.writeArray(ma.getExitRates());
+        writer.writeBitVector(ma.getMarkovianStates());
+    } else if (sparseModel.getType() == storm::models::ModelType::Pomdp) {
+        auto const& observations = dynamic_cast<storm::models::sparse::Pomdp<double> const&>(sparseModel).getObservations();
+        writer.writeArray(std::vector<uint64_t>(observations.begin(), observations.end()));
+    }
+
+    STORM_LOG_THROW(os.good(), storm::exceptions::FileIoException, "Writing the model in binary format failed.");
+}
+
+}  // namespace exporter
+}  // namespace storm
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+
+#include "storm/models/sparse/Model.h"
+
+namespace storm {
+namespace exporter {
+
+/*!
+ * Constants describing the binary format for sparse models (see exportSparseModelAsBinary).
+ */
+struct BinaryModelFormat {
+    // The first eight bytes of every file.
+    static constexpr char magic[8] = {'S', 'T', 'O', 'R', 'M', 'S', 'M', 'B'};
+
+    // The version of the format. Files with a different version are rejected.
+    static constexpr uint64_t version = 1;
+
+    // A word that is written in the byte order of the exporting machine. This is used to reject files written on machines
+    // with a different byte order.
+    static constexpr uint64_t byteOrderMark = 0x0102030405060708ull;
+
+    // Flags indicating which components of a reward model are present.
+    static constexpr uint64_t stateRewardsFlag = 1;
+    static constexpr uint64_t stateActionRewardsFlag = 2;
+    static constexpr uint64_t transitionRewardsFlag = 4;
+};
+
+/*!
+ * Exports a sparse model into a binary format that can be loaded without any parsing effort.
+ *
+ * The file is a sequence of 64-bit words (in the byte order of the exporting machine). It starts with the magic bytes,
+ * the version, the byte order mark and the model type followed by the transition matrix (as compressed row storage),
+ * the state labeling, the reward models, the choice labeling and, depending on the model type, the exit rates, the
+ * Markovian states and the observations. Strings are padded to a multiple of eight bytes, so every array in the file is
+ * aligned at a word boundary and can directly be read from a memory-mapped file.
+ *
+ * State valuations and choice origins are not exported.
+ *
+ * @param os Stream to export to. The stream needs to be opened in binary mode.
+ * @param sparseModel Model to export.
+ */
+void exportSparseModelAsBinary(std::ostream& os, storm::models::sparse::Model<double> const& sparseModel);
+
+}  // namespace exporter
+}  // namespace storm
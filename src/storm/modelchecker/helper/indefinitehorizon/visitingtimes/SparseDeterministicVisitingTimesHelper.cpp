@@ -9,6 +9,7 @@
 
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
@@ -171,8 +172,10 @@ void SparseDeterministicVisitingTimesHelper<ValueType>::createDecomposition(Envi
 
     if (!this->_sccDecomposition) {
         // The decomposition has not been provided or computed, yet.
-        auto options =
-            storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(env.solver().isForceSoundness());
+        auto options = storm::storage::StronglyConnectedComponentDecompositionOptions()
+                           .forceTopologicalSort()
+                           .computeSccDepths(env.solver().isForceSoundness())
+                           .useThreads(storm::utility::getNumberOfThreads<ValueType>(env.solver().getNumberOfThreads()));
         this->_computedSccDecomposition =
             std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(this->_transitionMatrix, options);
         this->_sccDecomposition = this->_computedSccDecomposition.get();
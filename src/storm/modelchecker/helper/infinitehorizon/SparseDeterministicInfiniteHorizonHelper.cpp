@@ -13,6 +13,7 @@
 #include "storm/solver/LinearEquationSolver.h"
 
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/solver.h"
 #include "storm/utility/vector.h"
 
@@ -41,11 +42,12 @@ SparseDeterministicInfiniteHorizonHelper<ValueType>::SparseDeterministicInfinite
 }
 
 template<typename ValueType>
-void SparseDeterministicInfiniteHorizonHelper<ValueType>::createDecomposition() {
+void SparseDeterministicInfiniteHorizonHelper<ValueType>::createDecomposition(Environment const& env) {
     if (this->_longRunComponentDecomposition == nullptr) {
         // The decomposition has not been provided or computed, yet.
+        uint64_t const numberOfThreads = storm::utility::getNumberOfThreads<ValueType>(env.solver().lra().getNumberOfThreads());
         this->_computedLongRunComponentDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(
-            this->_transitionMatrix, storm::storage::StronglyConnectedComponentDecompositionOptions().onlyBottomSccs());
+            this->_transitionMatrix, storm::storage::StronglyConnectedComponentDecompositionOptions().onlyBottomSccs().useThreads(numberOfThreads));
         this->_longRunComponentDecomposition = this->_computedLongRunComponentDecomposition.get();
     }
 }
@@ -484,7 +486,7 @@ std::vector<ValueType> SparseDeterministicInfiniteHorizonHelper<ValueType>::buil
 
 template<typename ValueType>
 std::vector<ValueType> SparseDeterministicInfiniteHorizonHelper<ValueType>::computeLongRunAverageStateDistribution(Environment const& env) {
-    createDecomposition();
+    createDecomposition(env);
     STORM_LOG_THROW(this->_longRunComponentDecomposition->size() <= 1, storm::exceptions::InvalidOperationException, "");
     return computeLongRunAverageStateDistribution(env, [](uint64_t) { return storm::utility::zero<ValueType>(); });
 }
@@ -502,7 +504,7 @@ std::vector<ValueType> SparseDeterministicInfiniteHorizonHelper<ValueType>::comp
 template<typename ValueType>
 std::vector<ValueType> SparseDeterministicInfiniteHorizonHelper<ValueType>::computeLongRunAverageStateDistribution(
     Environment const& env, ValueGetter const& initialDistributionGetter) {
-    createDecomposition();
+    createDecomposition(env);
 
     // Compute for each BSCC get the probability with which we reach that BSCC
     auto bsccReachProbs = computeBsccReachabilityProbabilities(env, initialDistributionGetter);
@@ -18,6 +18,7 @@
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/solver.h"
 #include "storm/utility/vector.h"
 
@@ -159,7 +160,7 @@ std::vector<ValueType> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>:
     STORM_LOG_ASSERT(Nondeterministic || !this->isProduceSchedulerSet(), "Scheduler production enabled for deterministic model.");
 
     // Decompose the model to their bottom components (MECS or BSCCS)
-    createDecomposition();
+    createDecomposition(env);
 
     // Compute the long-run average for all components in isolation.
     // Set up some logging
@@ -170,10 +171,36 @@ std::vector<ValueType> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>:
     progress.startNewMeasurement(0);
     STORM_LOG_INFO("Computing long run average values for " << _longRunComponentDecomposition->size() << " " << componentString << " individually...");
     std::vector<ValueType> componentLraValues;
-    componentLraValues.reserve(_longRunComponentDecomposition->size());
-    for (auto const& c : *_longRunComponentDecomposition) {
-        componentLraValues.push_back(computeLraForComponent(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter, c));
+    uint64_t numberOfThreads =
+        std::min<uint64_t>(storm::utility::getNumberOfThreads<ValueType>(env.solver().lra().getNumberOfThreads()), _longRunComponentDecomposition->size());
+    // The LP solver interfaces may not be used from several threads, so LP-based computations (and forced exact ones) stay sequential.
+    if (numberOfThreads > 1 &&
+        (env.solver().isForceExact() || (Nondeterministic && env.solver().lra().getNondetLraMethod() == storm::solver::LraMethod::LinearProgramming))) {
+        STORM_LOG_WARN("Computing the long run averages of different components concurrently is not supported for the selected method. Using a single thread.");
+        numberOfThreads = 1;
+    }
+    if (numberOfThreads > 1) {
+        // The components are independent of each other. The blocks are small enough to balance components of different sizes.
+        // Each block uses its own copy of the environment as sub-environments are created lazily (even on const access).
+        uint64_t const blockSize = std::max<uint64_t>(1, _longRunComponentDecomposition->size() / (16 * numberOfThreads));
+        componentLraValues.resize(_longRunComponentDecomposition->size());
+        storm::utility::ThreadPool::getGlobalPool().parallelForBlocks(
+            0, _longRunComponentDecomposition->size(), blockSize,
+            [&](uint64_t begin, uint64_t end) {
+                Environment blockEnvironment = underlyingSolverEnvironment;
+                for (uint64_t componentIndex = begin; componentIndex < end; ++componentIndex) {
+                    componentLraValues[componentIndex] =
+                        computeLraForComponent(blockEnvironment, stateRewardsGetter, actionRewardsGetter, (*_longRunComponentDecomposition)[componentIndex]);
+                }
+            },
+            numberOfThreads);
         progress.updateProgress(componentLraValues.size());
+    } else {
+        componentLraValues.reserve(_longRunComponentDecomposition->size());
+        for (auto const& c : *_longRunComponentDecomposition) {
+            componentLraValues.push_back(computeLraForComponent(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter, c));
+            progress.updateProgress(componentLraValues.size());
+        }
     }
 
     // Solve the resulting SSP where end components are collapsed into single auxiliary states
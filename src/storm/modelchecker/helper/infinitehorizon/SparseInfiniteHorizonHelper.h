@@ -119,9 +119,10 @@ class SparseInfiniteHorizonHelper : public SingleValueModelCheckerHelper<ValueTy
     void createBackwardTransitions();
 
     /*!
+     * @param env The environment whose number of threads for long run average computations is used for the decomposition.
      * @post _longRunComponentDecomposition points to a decomposition of the long run components (MECs, BSCCs)
      */
-    virtual void createDecomposition() = 0;
+    virtual void createDecomposition(Environment const& env) = 0;
 
     /*!
      * @pre if scheduler production is enabled and Nondeterministic is true, a choice for each state within a component must be set such that the choices yield
@@ -65,12 +65,12 @@ storm::storage::Scheduler<ValueType> SparseNondeterministicInfiniteHorizonHelper
 }
 
 template<typename ValueType>
-void SparseNondeterministicInfiniteHorizonHelper<ValueType>::createDecomposition() {
+void SparseNondeterministicInfiniteHorizonHelper<ValueType>::createDecomposition(Environment const& env) {
     if (this->_longRunComponentDecomposition == nullptr) {
         // The decomposition has not been provided or computed, yet.
         this->createBackwardTransitions();
-        this->_computedLongRunComponentDecomposition =
-            std::make_unique<storm::storage::MaximalEndComponentDecomposition<ValueType>>(this->_transitionMatrix, *this->_backwardTransitions);
+        this->_computedLongRunComponentDecomposition = std::make_unique<storm::storage::MaximalEndComponentDecomposition<ValueType>>(
+            this->_transitionMatrix, *this->_backwardTransitions, env.solver().lra().getNumberOfThreads());
         this->_longRunComponentDecomposition = this->_computedLongRunComponentDecomposition.get();
     }
 }
@@ -82,11 +82,14 @@ ValueType SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForC
     // For models with potential nondeterminisim, we compute the LRA for a maximal end component (MEC)
 
     // Allocate memory for the nondeterministic choices.
+    // This is usually already done such that components can be processed concurrently, writing only the choices of their own states.
     if (this->isProduceSchedulerSet()) {
         if (!this->_producedOptimalChoices.is_initialized()) {
             this->_producedOptimalChoices.emplace();
         }
-        this->_producedOptimalChoices->resize(this->_transitionMatrix.getRowGroupCount());
+        if (this->_producedOptimalChoices->size() != this->_transitionMatrix.getRowGroupCount()) {
+            this->_producedOptimalChoices->resize(this->_transitionMatrix.getRowGroupCount());
+        }
     }
 
     auto trivialResult = this->computeLraForTrivialMec(env, stateRewardsGetter, actionRewardsGetter, component);
@@ -63,7 +63,7 @@ class SparseNondeterministicInfiniteHorizonHelper : public SparseInfiniteHorizon
                                              storm::storage::MaximalEndComponent const& component) override;
 
    protected:
-    virtual void createDecomposition() override;
+    virtual void createDecomposition(Environment const& env) override;
 
     std::pair<bool, ValueType> computeLraForTrivialMec(Environment const& env, ValueGetter const& stateValuesGetter, ValueGetter const& actionValuesGetter,
                                                        storm::storage::MaximalEndComponent const& mec);
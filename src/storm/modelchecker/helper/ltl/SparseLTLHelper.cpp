@@ -4,6 +4,7 @@
 #include "storm/automata/LTL2DeterministicAutomaton.h"
 
 #include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/logic/ExtractMaximalStateFormulasVisitor.h"
 
@@ -14,6 +15,7 @@
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/SchedulerChoice.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/ThreadPool.h"
 
 #include "storm/exceptions/InvalidPropertyException.h"
 
@@ -66,7 +68,8 @@ std::map<std::string, storm::storage::BitVector> SparseLTLHelper<ValueType, Nond
 }
 
 template<typename ValueType, bool Nondeterministic>
-storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeAcceptingECs(automata::AcceptanceCondition const& acceptance,
+storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeAcceptingECs(Environment const& env,
+                                                                                            automata::AcceptanceCondition const& acceptance,
                                                                                             storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                             storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                             typename transformer::DAProduct<productModelType>::ptr product) {
@@ -81,14 +84,13 @@ storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeA
 
     std::vector<std::vector<automata::AcceptanceCondition::acceptance_expr::ptr>> dnf = acceptance.extractFromDNF();
 
-    storm::storage::BitVector acceptingStates(transitionMatrix.getRowGroupCount(), false);
-
-    std::size_t accMECs = 0;
-    std::size_t allMECs = 0;
-
+    // Determine for each conjunction the set of states of the subMDP that can satisfy the condition.
+    std::vector<storm::storage::BitVector> allowedStates;
+    allowedStates.reserve(dnf.size());
     for (auto const& conjunction : dnf) {
-        // Determine the set of states of the subMDP that can satisfy the condition, remove all states that would violate Fins in the conjunction.
-        storm::storage::BitVector allowed(transitionMatrix.getRowGroupCount(), true);
+        // Remove all states that would violate Fins in the conjunction.
+        allowedStates.emplace_back(transitionMatrix.getRowGroupCount(), true);
+        storm::storage::BitVector& allowed = allowedStates.back();
 
         for (auto const& literal : conjunction) {
             if (literal->isTRUE()) {
@@ -111,14 +113,43 @@ storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeA
                 }
             }
         }
+    }
 
+    // Compute MECs in the allowed fragments. Each of them is contained in an MEC of the whole model. If there are multiple conjunctions, the MECs
+    // of the whole model are thus only computed once and then refined for each conjunction. The refinements are independent of each other.
+    std::unique_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType>> modelMecs;
+    if (dnf.size() > 1) {
+        modelMecs = std::make_unique<storm::storage::MaximalEndComponentDecomposition<ValueType>>(transitionMatrix, backwardTransitions);
+    }
+    std::vector<storm::storage::MaximalEndComponentDecomposition<ValueType>> allowedMecs(dnf.size());
+    auto computeAllowedMecs = [&](uint64_t conjunctionIndex) {
+        storm::storage::BitVector const& allowed = allowedStates[conjunctionIndex];
         if (allowed.empty()) {
             // skip
-            continue;
+        } else if (modelMecs) {
+            allowedMecs[conjunctionIndex] = storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions, allowed, *modelMecs);
+        } else {
+            allowedMecs[conjunctionIndex] = storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions, allowed);
+        }
+    };
+    // Checking for zero entries of rational functions is not thread-safe.
+    if (env.solver().getNumberOfThreads() > 1 && dnf.size() > 1 && !std::is_same<ValueType, storm::RationalFunction>::value) {
+        storm::utility::ThreadPool::getGlobalPool().parallelFor(0, dnf.size(), computeAllowedMecs, env.solver().getNumberOfThreads());
+    } else {
+        for (uint64_t conjunctionIndex = 0; conjunctionIndex < dnf.size(); ++conjunctionIndex) {
+            computeAllowedMecs(conjunctionIndex);
         }
+    }
 
-        // Compute MECs in the allowed fragment
-        storm::storage::MaximalEndComponentDecomposition<ValueType> mecs(transitionMatrix, backwardTransitions, allowed);
+    storm::storage::BitVector acceptingStates(transitionMatrix.getRowGroupCount(), false);
+
+    std::size_t accMECs = 0;
+    std::size_t allMECs = 0;
+
+    // Check the acceptance of the MECs in the order of the conjunctions, which determines the choices saved for the scheduler.
+    for (uint64_t conjunctionIndex = 0; conjunctionIndex < dnf.size(); ++conjunctionIndex) {
+        auto const& conjunction = dnf[conjunctionIndex];
+        auto const& mecs = allowedMecs[conjunctionIndex];
         allMECs += mecs.size();
         for (const auto& mec : mecs) {
             bool accepting = true;
@@ -239,7 +270,7 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAPr
     storm::storage::BitVector acceptingStates;
     if (Nondeterministic) {
         STORM_LOG_INFO("Computing MECs and checking for acceptance...");
-        acceptingStates = computeAcceptingECs(*product->getAcceptance(), product->getProductModel().getTransitionMatrix(),
+        acceptingStates = computeAcceptingECs(env, *product->getAcceptance(), product->getProductModel().getTransitionMatrix(),
                                               product->getProductModel().getBackwardTransitions(), product);
 
     } else {
@@ -298,6 +329,48 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAPr
     return numericResult;
 }
 
+template<typename ValueType, bool Nondeterministic>
+std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeProductProbabilities(Environment const& env,
+                                                                                                 storm::automata::AcceptanceCondition const& acceptance) {
+    STORM_LOG_THROW(!this->isProduceSchedulerSet(), storm::exceptions::InvalidOperationException,
+                    "Scheduler export is not supported for products with a deterministic automaton that were not built by this helper.");
+    storm::storage::SparseMatrix<ValueType> backwardTransitions = this->_transitionMatrix.transpose(true);
+
+    // Compute accepting states
+    storm::storage::BitVector acceptingStates;
+    if (Nondeterministic) {
+        STORM_LOG_INFO("Computing MECs and checking for acceptance...");
+        acceptingStates = computeAcceptingECs(env, acceptance, this->_transitionMatrix, backwardTransitions, nullptr);
+    } else {
+        STORM_LOG_INFO("Computing BSCCs and checking for acceptance...");
+        acceptingStates = computeAcceptingBCCs(acceptance, this->_transitionMatrix);
+    }
+
+    if (acceptingStates.empty()) {
+        STORM_LOG_INFO("No accepting states, skipping probability computation.");
+        return std::vector<ValueType>(this->_transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+    }
+
+    STORM_LOG_INFO("Computing probabilities for reaching accepting components...");
+
+    storm::storage::BitVector bvTrue(this->_transitionMatrix.getRowGroupCount(), true);
+
+    // Create goal for computeUntilProbabilities, always compute maximizing probabilities
+    storm::solver::SolveGoal<ValueType> solveGoal(OptimizationDirection::Maximize);
+    if (this->hasRelevantStates()) {
+        solveGoal.setRelevantValues(this->getRelevantStates());
+    }
+
+    if (Nondeterministic) {
+        return storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(
+                   env, std::move(solveGoal), this->_transitionMatrix, backwardTransitions, bvTrue, acceptingStates, this->isQualitativeSet(), false)
+            .values;
+    } else {
+        return storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeUntilProbabilities(
+            env, std::move(solveGoal), this->_transitionMatrix, backwardTransitions, bvTrue, acceptingStates, this->isQualitativeSet());
+    }
+}
+
 template<typename ValueType, bool Nondeterministic>
 std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeLTLProbabilities(Environment const& env, storm::logic::PathFormula const& formula,
                                                                                              std::map<std::string, storm::storage::BitVector>& apSatSets) {
@@ -77,6 +77,16 @@ class SparseLTLHelper : public SingleValueModelCheckerHelper<ValueType, storm::m
     std::vector<ValueType> computeDAProductProbabilities(Environment const& env, storm::automata::DeterministicAutomaton const& da,
                                                          std::map<std::string, storm::storage::BitVector>& apSatSets);
 
+    /*!
+     * Computes the (maximizing) probabilities to satisfy the given acceptance condition.
+     * In contrast to computeDAProductProbabilities, the transition matrix given at construction time is assumed to already be the one of a product
+     * with a deterministic automaton (e.g. one that was explored on the fly), so no product is built here.
+     * Scheduler generation is not supported.
+     * @param acceptance the acceptance condition of the automaton, lifted to the states of the product
+     * @return a value for each state of the product
+     */
+    std::vector<ValueType> computeProductProbabilities(Environment const& env, storm::automata::AcceptanceCondition const& acceptance);
+
     /*!
      * Computes the LTL probabilities
      * @param formula the LTL formula (without PCTL*-like nesting)
@@ -95,11 +105,12 @@ class SparseLTLHelper : public SingleValueModelCheckerHelper<ValueType, storm::m
      *   P1acc be the set of states that satisfy Pmax=1[ F accEC ].
      * This function then computes a set that contains accEC and is contained by P1acc.
      * However, if the acceptance condition consists of 'true', the whole state space can be returned.
+     * The end components for the different conjunctions of the acceptance condition are computed concurrently if multiple threads are available.
      * @param acceptance the acceptance condition (in DNF)
      * @param transitionMatrix the transition matrix of the model
      * @param backwardTransitions the reversed transition relation
      */
-    storm::storage::BitVector computeAcceptingECs(automata::AcceptanceCondition const& acceptance,
+    storm::storage::BitVector computeAcceptingECs(Environment const& env, automata::AcceptanceCondition const& acceptance,
                                                   storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                   storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                   typename transformer::DAProduct<productModelType>::ptr product);
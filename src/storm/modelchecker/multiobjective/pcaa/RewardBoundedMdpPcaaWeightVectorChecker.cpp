@@ -3,6 +3,7 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/exceptions/IllegalArgumentException.h"
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
@@ -20,8 +21,10 @@
 #include "storm/settings/modules/IOSettings.h"
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/solver/helper/ValueIterationHelper.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
 
@@ -246,20 +249,40 @@ void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::computeEpochSo
             result.back().push_back(cachedData.xMinMax[state]);
         }
 
+        // The linear equation systems of the objectives only differ in their right-hand sides.
+        // For the native power method, we solve them together so that each iteration requires only a single pass over the matrix.
+        bool const solveObjectivesTogether = !storm::NumberTraits<ValueType>::IsExact && this->objectives.size() > 1 && !env.solver().isForceExact() &&
+                                             !env.solver().isForceSoundness() &&
+                                             env.solver().getLinearEquationSolverType() == storm::solver::EquationSolverType::Native &&
+                                             env.solver().native().getMethod() == storm::solver::NativeLinearEquationSolverMethod::Power;
+
         // Check whether the linear equation solver needs to be updated
         auto const& choices = cachedData.minMaxSolver->getSchedulerChoices();
-        if (cachedData.schedulerChoices != choices) {
+        if (cachedData.schedulerChoices != choices || solveObjectivesTogether != static_cast<bool>(cachedData.linEqViOperator)) {
             std::vector<uint64_t> choicesTmp = choices;
             cachedData.minMaxSolver->setInitialScheduler(std::move(choicesTmp));
             cachedData.schedulerChoices = choices;
             storm::solver::GeneralLinearEquationSolverFactory<ValueType> linEqSolverFactory;
-            bool needEquationSystem = linEqSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
+            bool needEquationSystem = !solveObjectivesTogether &&
+                                      linEqSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
             storm::storage::SparseMatrix<ValueType> subMatrix = epochModel.epochMatrix.selectRowsFromRowGroups(choices, needEquationSystem);
-            if (needEquationSystem) {
-                subMatrix.convertToEquationSystem();
+            if (solveObjectivesTogether) {
+                cachedData.linEqSolver.reset();
+                cachedData.linEqViOperator = std::make_shared<storm::solver::helper::ValueIterationOperator<ValueType, true>>();
+                cachedData.linEqViOperator->setMatrixBackwards(std::move(subMatrix));
+                cachedData.bLinEqObjectives.resize(this->objectives.size());
+                for (auto& b_o : cachedData.bLinEqObjectives) {
+                    b_o.resize(choices.size());
+                }
+            } else {
+                if (needEquationSystem) {
+                    subMatrix.convertToEquationSystem();
+                }
+                cachedData.linEqViOperator.reset();
+                cachedData.bLinEqObjectives.clear();
+                cachedData.linEqSolver = linEqSolverFactory.create(env, std::move(subMatrix));
+                cachedData.linEqSolver->setCachingEnabled(true);
             }
-            cachedData.linEqSolver = linEqSolverFactory.create(env, std::move(subMatrix));
-            cachedData.linEqSolver->setCachingEnabled(true);
         }
 
         // Formulate for each objective the linear equation system induced by the performed choices
@@ -272,8 +295,9 @@ void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::computeEpochSo
             auto stepChoiceIt = epochModel.stepChoices.begin();
             auto stepSolutionIt = epochModel.stepSolutions.begin();
             std::vector<ValueType>& x = cachedData.xLinEq[objIndex];
+            std::vector<ValueType>& b = solveObjectivesTogether ? cachedData.bLinEqObjectives[objIndex] : cachedData.bLinEq;
             auto xIt = x.begin();
-            for (auto& b_i : cachedData.bLinEq) {
+            for (auto& b_i : b) {
                 uint64_t i = *rowGroupIndexIt + *choiceIt;
                 if (epochModel.objectiveRewardFilter[objIndex].get(i)) {
                     b_i = objectiveReward[i];
@@ -299,6 +323,10 @@ void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::computeEpochSo
                 ++choiceIt;
             }
             assert(x.size() == choices.size());
+            if (solveObjectivesTogether) {
+                // The systems of all objectives are solved below.
+                continue;
+            }
             auto req = cachedData.linEqSolver->getRequirements(env);
             cachedData.linEqSolver->clearBounds();
             if (obj.lowerResultBound) {
@@ -318,6 +346,26 @@ void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::computeEpochSo
                 ++resultIt;
             }
         }
+        if (solveObjectivesTogether) {
+            storm::solver::helper::ValueIterationHelper<ValueType, true> viHelper(cachedData.linEqViOperator);
+            uint64_t numIterations{0};
+            uint64_t const maxIterations = env.solver().native().getMaximalNumberOfIterations();
+            auto viCallback = [&numIterations, &maxIterations](storm::solver::SolverStatus const& current) {
+                return numIterations >= maxIterations ? storm::solver::SolverStatus::MaximalIterationsExceeded : current;
+            };
+            auto status = viHelper.VI(cachedData.xLinEq, cachedData.bLinEqObjectives, numIterations, env.solver().native().getRelativeTerminationCriterion(),
+                                      storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision()), {}, viCallback,
+                                      env.solver().native().getPowerMethodMultiplicationStyle());
+            STORM_LOG_WARN_COND(status == storm::solver::SolverStatus::Converged,
+                                "Iterative solver for the objectives of the current epoch did not converge after " << numIterations << " iterations.");
+            auto resultIt = result.begin();
+            for (auto state : epochModel.epochInStates) {
+                for (auto const& x : cachedData.xLinEq) {
+                    resultIt->push_back(x[state]);
+                }
+                ++resultIt;
+            }
+        }
     }
     rewardUnfolding.setSolutionForCurrentEpoch(std::move(result));
     swEpochModelAnalysis.stop();
@@ -6,6 +6,7 @@
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/solver/helper/ValueIterationOperator.h"
 
 #include "storm/utility/Stopwatch.h"
 
@@ -57,6 +58,10 @@ class RewardBoundedMdpPcaaWeightVectorChecker : public PcaaWeightVectorChecker<S
         std::vector<std::vector<ValueType>> xLinEq;
         std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> linEqSolver;
 
+        // If the native power method is selected, the linear equation systems of all objectives are solved together using this operator
+        std::shared_ptr<storm::solver::helper::ValueIterationOperator<ValueType, true>> linEqViOperator;
+        std::vector<std::vector<ValueType>> bLinEqObjectives;
+
         std::vector<typename helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, false>::SolutionType> solutions;
     };
 
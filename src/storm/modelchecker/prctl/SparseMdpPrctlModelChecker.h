@@ -1,6 +1,7 @@
 #ifndef STORM_MODELCHECKER_SPARSEMDPPRCTLMODELCHECKER_H_
 #define STORM_MODELCHECKER_SPARSEMDPPRCTLMODELCHECKER_H_
 
+#include "storm/modelchecker/prctl/helper/SparseMdpPrecomputationCache.h"
 #include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
@@ -24,6 +25,22 @@ class SparseMdpPrctlModelChecker : public SparsePropositionalModelChecker<Sparse
      */
     static bool canHandleStatic(CheckTask<storm::logic::Formula, ValueType> const& checkTask, bool* requiresSingleInitialState = nullptr);
 
+    /*!
+     * Lets all properties that are subsequently checked with this model checker share graph analyses on the model (e.g. probability 0/1 states).
+     * As the analyses are kept in memory, this only pays off if several properties are checked.
+     */
+    void enablePrecomputationCache();
+
+    /*!
+     * Drops the shared graph analyses (if any) and stops sharing them among subsequently checked properties.
+     */
+    void disablePrecomputationCache();
+
+    /*!
+     * Retrieves the shared graph analyses or nullptr if they are not enabled.
+     */
+    helper::SparseMdpPrecomputationCache<ValueType> const* getPrecomputationCache() const;
+
     // The implemented methods of the AbstractModelChecker interface.
     virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
     virtual std::unique_ptr<CheckResult> computeBoundedUntilProbabilities(Environment const& env,
@@ -61,6 +78,16 @@ class SparseMdpPrctlModelChecker : public SparsePropositionalModelChecker<Sparse
                                                                   CheckTask<storm::logic::MultiObjectiveFormula, ValueType> const& checkTask) override;
     virtual std::unique_ptr<CheckResult> checkQuantileFormula(Environment const& env,
                                                               CheckTask<storm::logic::QuantileFormula, ValueType> const& checkTask) override;
+
+   private:
+    /*!
+     * Retrieves the backward transitions of the model. If graph analyses are shared, they are taken from the cache. Otherwise, they are
+     * computed and stored in the given matrix.
+     */
+    storm::storage::SparseMatrix<ValueType> const& getBackwardTransitions(storm::storage::SparseMatrix<ValueType>& storage);
+
+    // Graph analyses on the model (e.g. probability 0/1 states) that are reused by all properties checked with this model checker (if enabled).
+    std::unique_ptr<helper::SparseMdpPrecomputationCache<ValueType>> precomputationCache;
 };
 }  // namespace modelchecker
 }  // namespace storm
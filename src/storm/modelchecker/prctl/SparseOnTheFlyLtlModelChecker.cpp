@@ -0,0 +1,155 @@
+#include "storm/modelchecker/prctl/SparseOnTheFlyLtlModelChecker.h"
+
+#include "storm/automata/AcceptanceCondition.h"
+#include "storm/automata/DeterministicAutomaton.h"
+#include "storm/automata/LTL2DeterministicAutomaton.h"
+
+#include "storm/builder/ExplicitModelBuilder.h"
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+
+#include "storm/logic/ExtractMaximalStateFormulasVisitor.h"
+#include "storm/logic/FragmentSpecification.h"
+
+#include "storm/modelchecker/helper/ltl/SparseLTLHelper.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+
+#include "storm/storage/jani/Model.h"
+#include "storm/storage/prism/Program.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidPropertyException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace modelchecker {
+
+template<typename ModelType>
+SparseOnTheFlyLtlModelChecker<ModelType>::SparseOnTheFlyLtlModelChecker(storm::storage::SymbolicModelDescription const& model,
+                                                                        storm::generator::NextStateGeneratorOptions const& options)
+    : model(model.isPrismProgram() ? storm::storage::SymbolicModelDescription(model.asPrismProgram().substituteConstantsFormulas())
+                                   : storm::storage::SymbolicModelDescription(model.asJaniModel().substituteConstantsFunctions())),
+      options(options) {
+    this->model.requireNoUndefinedConstants();
+}
+
+template<typename ModelType>
+bool SparseOnTheFlyLtlModelChecker<ModelType>::canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const {
+    storm::logic::Formula const& formula = checkTask.getFormula();
+    storm::logic::FragmentSpecification fragment = storm::logic::propositional();
+    fragment.setProbabilityOperatorsAllowed(true);
+    fragment.setGloballyFormulasAllowed(true);
+    fragment.setReachabilityProbabilityFormulasAllowed(true);
+    fragment.setNextFormulasAllowed(true);
+    fragment.setUntilFormulasAllowed(true);
+    fragment.setBinaryBooleanPathFormulasAllowed(true);
+    fragment.setUnaryBooleanPathFormulasAllowed(true);
+    fragment.setNestedPathFormulasAllowed(true);
+    fragment.setOperatorAtTopLevelRequired(true);
+    fragment.setNestedOperatorsAllowed(false);
+    return formula.isInFragment(fragment) && formula.asProbabilityOperatorFormula().getSubformula().isPathFormula() &&
+           checkTask.isOnlyInitialStatesRelevantSet();
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> SparseOnTheFlyLtlModelChecker<ModelType>::computeProbabilities(Environment const& env,
+                                                                                         CheckTask<storm::logic::Formula, ValueType> const& checkTask) {
+    // As the automaton is built anyway, also simple path formulas (e.g. reachability) are treated as LTL formulas.
+    storm::logic::Formula const& formula = checkTask.getFormula();
+    STORM_LOG_THROW(formula.isPathFormula(), storm::exceptions::NotSupportedException, "The formula '" << formula << "' is not a path formula.");
+    return this->computeLTLProbabilities(env, checkTask.substituteFormula(formula.asPathFormula()));
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> SparseOnTheFlyLtlModelChecker<ModelType>::computeLTLProbabilities(
+    Environment const& env, CheckTask<storm::logic::PathFormula, ValueType> const& checkTask) {
+    bool constexpr Nondeterministic = std::is_same<ModelType, storm::models::sparse::Mdp<ValueType>>::value;
+    STORM_LOG_THROW(!Nondeterministic || checkTask.isOptimizationDirectionSet(), storm::exceptions::InvalidPropertyException,
+                    "Formula needs to specify whether minimal or maximal values are to be computed on nondeterministic model.");
+    STORM_LOG_THROW(!checkTask.isProduceSchedulersSet(), storm::exceptions::NotSupportedException,
+                    "Scheduler generation is not supported if the product is explored on the fly.");
+
+    // Replace the maximal state subformulas by atomic propositions that are characterized by expressions over the model variables.
+    storm::logic::ExtractMaximalStateFormulasVisitor::ApToFormulaMap extracted;
+    std::shared_ptr<storm::logic::Formula const> ltlFormula = storm::logic::ExtractMaximalStateFormulasVisitor::extract(checkTask.getFormula(), extracted);
+    std::map<std::string, storm::expressions::Expression> labelToExpressionMapping = getLabelToExpressionMapping();
+    std::map<std::string, storm::expressions::Expression> apToExpression;
+    for (auto const& apFormulaPair : extracted) {
+        STORM_LOG_THROW(apFormulaPair.second->isInFragment(storm::logic::propositional()), storm::exceptions::NotSupportedException,
+                        "The state subformula '" << *apFormulaPair.second << "' needs to be propositional if the product is explored on the fly.");
+        apToExpression[apFormulaPair.first] = apFormulaPair.second->toExpression(model.getManager(), labelToExpressionMapping);
+    }
+
+    bool const minimize = Nondeterministic && checkTask.getOptimizationDirection() == OptimizationDirection::Minimize;
+    if (minimize) {
+        // negate formula in order to compute 1-Pmax[!formula]
+        ltlFormula = std::make_shared<storm::logic::UnaryBooleanPathFormula>(storm::logic::UnaryBooleanOperatorType::Not, ltlFormula);
+        STORM_LOG_INFO("Computing Pmin, proceeding with negated LTL formula.");
+    }
+
+    // Convert LTL formula to a deterministic automaton
+    std::shared_ptr<storm::automata::DeterministicAutomaton> da;
+    if (env.modelchecker().isLtl2daToolSet()) {
+        da = storm::automata::LTL2DeterministicAutomaton::ltl2daExternalTool(*ltlFormula, env.modelchecker().getLtl2daTool());
+    } else {
+        // For nondeterministic models the acceptance condition is transformed into DNF
+        da = storm::automata::LTL2DeterministicAutomaton::ltl2daSpot(*ltlFormula, Nondeterministic);
+    }
+    STORM_LOG_INFO("Deterministic automaton for LTL formula has " << da->getNumberOfStates() << " states and " << da->getAPSet().size()
+                                                                  << " atomic propositions.");
+
+    // Explore the product of the model and the automaton.
+    typename storm::builder::ExplicitModelBuilder<ValueType>::AutomatonProduct product;
+    if (model.isPrismProgram()) {
+        product = storm::builder::ExplicitModelBuilder<ValueType>(model.asPrismProgram(), options).buildProduct(*da, apToExpression);
+    } else {
+        product = storm::builder::ExplicitModelBuilder<ValueType>(model.asJaniModel(), options).buildProduct(*da, apToExpression);
+    }
+    STORM_LOG_THROW(product.model->isNondeterministicModel() == Nondeterministic, storm::exceptions::NotSupportedException,
+                    "The model type " << product.model->getType() << " does not match the type of the model checker.");
+
+    storm::modelchecker::helper::SparseLTLHelper<ValueType, Nondeterministic> helper(product.model->getTransitionMatrix());
+    helper.setRelevantStates(product.model->getInitialStates());
+    helper.setQualitative(checkTask.isQualitativeSet());
+    std::vector<ValueType> productValues = helper.computeProductProbabilities(env, *product.acceptance);
+
+    typename ExplicitQuantitativeCheckResult<ValueType>::map_type result;
+    for (auto const& initialState : product.model->getInitialStates()) {
+        // compute 1-Pmax[!fomula] if necessary
+        result[initialState] = minimize ? storm::utility::one<ValueType>() - productValues[initialState] : productValues[initialState];
+    }
+    return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(std::move(result));
+}
+
+template<typename ModelType>
+std::map<std::string, storm::expressions::Expression> SparseOnTheFlyLtlModelChecker<ModelType>::getLabelToExpressionMapping() const {
+    std::map<std::string, storm::expressions::Expression> labelToExpressionMapping;
+    if (model.isPrismProgram()) {
+        labelToExpressionMapping = model.asPrismProgram().getLabelToExpressionMapping();
+    } else {
+        storm::jani::Model const& janiModel = model.asJaniModel();
+        for (auto const& variable : janiModel.getGlobalVariables().getBooleanVariables()) {
+            if (variable.isTransient()) {
+                labelToExpressionMapping[variable.getName()] = janiModel.getLabelExpression(variable);
+            }
+        }
+    }
+    return labelToExpressionMapping;
+}
+
+template class SparseOnTheFlyLtlModelChecker<storm::models::sparse::Dtmc<double>>;
+template class SparseOnTheFlyLtlModelChecker<storm::models::sparse::Mdp<double>>;
+
+#ifdef STORM_HAVE_CARL
+template class SparseOnTheFlyLtlModelChecker<storm::models::sparse::Dtmc<storm::RationalNumber>>;
+template class SparseOnTheFlyLtlModelChecker<storm::models::sparse::Mdp<storm::RationalNumber>>;
+#endif
+
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "storm/generator/NextStateGenerator.h"
+#include "storm/modelchecker/AbstractModelChecker.h"
+#include "storm/storage/SymbolicModelDescription.h"
+
+namespace storm {
+
+class Environment;
+
+namespace modelchecker {
+
+/*!
+ * Model checker for LTL formulas on DTMCs and MDPs that are given as PRISM program or JANI model.
+ * Instead of building the model and afterwards the product with a deterministic automaton for the formula, the model is explored together
+ * with the automaton (see storm::builder::ExplicitModelBuilder::buildProduct). Hence, only the reachable product states are generated.
+ * All maximal state subformulas of the LTL formula need to be propositional. Results are only computed for the initial states of the product,
+ * which are identified by their index in the product.
+ *
+ * @tparam ModelType The type of the model (sparse DTMC or MDP) that is described by the symbolic model description.
+ */
+template<typename ModelType>
+class SparseOnTheFlyLtlModelChecker : public AbstractModelChecker<ModelType> {
+   public:
+    typedef typename ModelType::ValueType ValueType;
+
+    /*!
+     * Creates a model checker for the given model description.
+     *
+     * @param model The PRISM program or JANI model. All constants need to be defined.
+     * @param options The options for the next-state generator that explores the model.
+     */
+    SparseOnTheFlyLtlModelChecker(storm::storage::SymbolicModelDescription const& model,
+                                  storm::generator::NextStateGeneratorOptions const& options = storm::generator::NextStateGeneratorOptions());
+
+    virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
+
+    virtual std::unique_ptr<CheckResult> computeProbabilities(Environment const& env, CheckTask<storm::logic::Formula, ValueType> const& checkTask) override;
+
+    virtual std::unique_ptr<CheckResult> computeLTLProbabilities(Environment const& env,
+                                                                 CheckTask<storm::logic::PathFormula, ValueType> const& checkTask) override;
+
+   private:
+    /*!
+     * Retrieves the expressions that characterize the labels of the model.
+     */
+    std::map<std::string, storm::expressions::Expression> getLabelToExpressionMapping() const;
+
+    // The model description in which constants and formulas are substituted.
+    storm::storage::SymbolicModelDescription model;
+
+    // The options for the next-state generator.
+    storm::generator::NextStateGeneratorOptions options;
+};
+
+}  // namespace modelchecker
+}  // namespace storm
@@ -2,6 +2,8 @@
 
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 
+#include "storm/environment/solver/SolverEnvironment.h"
+
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
@@ -101,12 +103,12 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeUn
 
             // Translate the symbolic matrix/vector to their explicit representations and solve the equation system.
             conversionWatch.start();
-            storm::storage::SparseMatrix<ValueType> explicitSubmatrix = submatrix.toMatrix(odd, odd);
+            auto explicitSubmatrix = model.toExplicitMatrix(submatrix, maybeStates, odd, {}, env.solver().getNumberOfThreads());
             std::vector<ValueType> b = subvector.toVector(odd);
             conversionWatch.stop();
             STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
-            std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, std::move(explicitSubmatrix));
+            std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, *explicitSubmatrix);
             solver->setBounds(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
             solver->solveEquations(env, x, b);
 
@@ -182,12 +184,12 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeBo
 
         // Translate the symbolic matrix/vector to their explicit representations.
         conversionWatch.start();
-        storm::storage::SparseMatrix<ValueType> explicitSubmatrix = submatrix.toMatrix(odd, odd);
+        auto explicitSubmatrix = model.toExplicitMatrix(submatrix, maybeStates, odd, {}, env.solver().getNumberOfThreads());
         std::vector<ValueType> b = subvector.toVector(odd);
         conversionWatch.stop();
         STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
-        auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitSubmatrix);
+        auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *explicitSubmatrix);
         multiplier->repeatedMultiply(env, x, &b, stepBound);
 
         // Return a hybrid check result that stores the numerical values explicitly.
@@ -353,7 +355,7 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeRe
 
             // Translate the symbolic matrix/vector to their explicit representations.
             conversionWatch.start();
-            storm::storage::SparseMatrix<ValueType> explicitSubmatrix = submatrix.toMatrix(odd, odd);
+            auto explicitSubmatrix = model.toExplicitMatrix(submatrix, maybeStates, odd, {}, env.solver().getNumberOfThreads());
             std::vector<ValueType> b = subvector.toVector(odd);
             conversionWatch.stop();
             STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
@@ -363,11 +365,11 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeRe
             if (oneStepTargetProbs) {
                 // FIXME: This will fail if we already converted the matrix to the equation problem format.
                 STORM_LOG_ASSERT(!convertToEquationSystem, "Upper reward bounds required, but the matrix is in the wrong format for the computation.");
-                upperBounds = computeUpperRewardBounds(explicitSubmatrix, b, oneStepTargetProbs->toVector(odd));
+                upperBounds = computeUpperRewardBounds(*explicitSubmatrix, b, oneStepTargetProbs->toVector(odd));
             }
 
             // Now solve the resulting equation system.
-            std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, std::move(explicitSubmatrix));
+            std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, *explicitSubmatrix);
             solver->setLowerBound(storm::utility::zero<ValueType>());
             if (upperBounds) {
                 solver->setUpperBounds(std::move(upperBounds.get()));
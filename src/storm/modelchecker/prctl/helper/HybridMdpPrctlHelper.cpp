@@ -2,6 +2,8 @@
 
 #include "storm/modelchecker/prctl/helper/SymbolicMdpPrctlHelper.h"
 
+#include "storm/environment/solver/SolverEnvironment.h"
+
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
@@ -212,14 +214,16 @@ std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeUnt
             storm::dd::Add<DdType, ValueType> submatrix = transitionMatrix * maybeStatesAdd;
 
             // If the maybe states were extended, we generate the explicit representation slightly differently.
-            std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> explicitRepresentation;
+            std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitMatrix;
+            std::shared_ptr<std::vector<ValueType> const> explicitVector;
             if (extendMaybeStates) {
                 // Eliminate all transitions to non-extended-maybe states.
                 submatrix *= extendedMaybeStates.template toAdd<ValueType>().swapVariables(model.getRowColumnMetaVariablePairs());
 
-                // Only translate the matrix for now.
+                // Only translate the matrix for now. As the explicit representation is modified below, it is not cached in the model.
                 conversionWatch.start();
-                explicitRepresentation.first = submatrix.toMatrix(model.getNondeterminismVariables(), odd, odd);
+                std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> explicitRepresentation;
+                explicitRepresentation.first = submatrix.toMatrix(model.getNondeterminismVariables(), odd, odd, env.solver().getNumberOfThreads());
 
                 // Get all original maybe states in the extended matrix.
                 solverRequirementsData.properMaybeStates = maybeStates.toVector(odd);
@@ -230,7 +234,8 @@ std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeUnt
 
                 // Eliminate the end components and remove the states that are not interesting (target or non-filter).
                 eliminateEndComponentsAndExtendedStatesUntilProbabilities(explicitRepresentation, solverRequirementsData, targetStates);
-
+                explicitMatrix = std::make_shared<storm::storage::SparseMatrix<ValueType> const>(std::move(explicitRepresentation.first));
+                explicitVector = std::make_shared<std::vector<ValueType> const>(std::move(explicitRepresentation.second));
             } else {
                 // Then compute the vector that contains the one-step probabilities to a state with probability 1 for all
                 // maybe states.
@@ -244,22 +249,22 @@ std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeUnt
 
                 // Translate the symbolic matrix/vector to their explicit representations and solve the equation system.
                 conversionWatch.start();
-                explicitRepresentation = submatrix.toMatrixVector(subvector, model.getNondeterminismVariables(), odd, odd);
+                std::tie(explicitMatrix, explicitVector) =
+                    model.toExplicitMatrixVector(submatrix, subvector, maybeStates, odd, model.getNondeterminismVariables(), env.solver().getNumberOfThreads());
                 conversionWatch.stop();
 
                 if (requirements.validInitialScheduler()) {
                     solverRequirementsData.initialScheduler =
-                        computeValidInitialSchedulerForUntilProbabilities<ValueType>(explicitRepresentation.first, explicitRepresentation.second);
+                        computeValidInitialSchedulerForUntilProbabilities<ValueType>(*explicitMatrix, *explicitVector);
                 }
             }
 
             STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
             // Create the solution vector.
-            std::vector<ValueType> x(explicitRepresentation.first.getRowGroupCount(), storm::utility::zero<ValueType>());
+            std::vector<ValueType> x(explicitMatrix->getRowGroupCount(), storm::utility::zero<ValueType>());
 
-            std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver =
-                linearEquationSolverFactory.create(env, std::move(explicitRepresentation.first));
+            std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, *explicitMatrix);
 
             // Set whether the equation system will have a unique solution / no end components
             solver->setHasUniqueSolution(hasNoEndComponents);
@@ -270,7 +275,7 @@ std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeUnt
             }
             solver->setBounds(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
             solver->setRequirementsChecked();
-            solver->solveEquations(env, dir, x, explicitRepresentation.second);
+            solver->solveEquations(env, dir, x, *explicitVector);
 
             // If we included some target and non-filter states in the ODD, we need to expand the result from the solver.
             if (requirements.uniqueSolution() && solverRequirementsData.ecInformation) {
@@ -359,13 +364,13 @@ std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeBou
 
         // Translate the symbolic matrix/vector to their explicit representations.
         conversionWatch.start();
-        std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> explicitRepresentation =
-            submatrix.toMatrixVector(subvector, model.getNondeterminismVariables(), odd, odd);
+        auto explicitRepresentation =
+            model.toExplicitMatrixVector(submatrix, subvector, maybeStates, odd, model.getNondeterminismVariables(), env.solver().getNumberOfThreads());
         conversionWatch.stop();
         STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
-        auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitRepresentation.first);
-        multiplier->repeatedMultiplyAndReduce(env, dir, x, &explicitRepresentation.second, stepBound);
+        auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *explicitRepresentation.first);
+        multiplier->repeatedMultiplyAndReduce(env, dir, x, explicitRepresentation.second.get(), stepBound);
 
         // Return a hybrid check result that stores the numerical values explicitly.
         return std::unique_ptr<CheckResult>(new storm::modelchecker::HybridQuantitativeCheckResult<DdType, ValueType>(
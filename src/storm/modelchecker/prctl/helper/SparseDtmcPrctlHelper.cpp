@@ -31,6 +31,7 @@
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/ThreadPool.h"
 
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/macros.h"
@@ -79,22 +80,13 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
 
     // In case of cdf export we store the necessary data.
     std::vector<std::vector<ValueType>> cdfData;
+    std::vector<typename rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>::Epoch> cdfEpochs;
 
     // Set the correct equation problem format.
     storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
     rewardUnfolding.setEquationSystemFormatForEpochModel(linearEquationSolverFactory.getEquationProblemFormat(preciseEnv));
 
-    storm::utility::ProgressMeasurement progress("epochs");
-    progress.setMaxCount(epochOrder.size());
-    progress.startNewMeasurement(0);
-    uint64_t numCheckedEpochs = 0;
-    for (auto const& epoch : epochOrder) {
-        swBuild.start();
-        auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-        swBuild.stop();
-        swCheck.start();
-        rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, x, b, linEqSolver, lowerBound, upperBound));
-        swCheck.stop();
+    auto storeCdfEntry = [&](typename rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>::Epoch const& epoch) {
         if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
             !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
             std::vector<ValueType> cdfEntry;
@@ -105,11 +97,59 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
             }
             cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
             cdfData.push_back(std::move(cdfEntry));
+            cdfEpochs.push_back(epoch);
         }
-        ++numCheckedEpochs;
-        progress.updateProgress(numCheckedEpochs);
-        if (storm::utility::resources::isTerminate()) {
-            break;
+    };
+
+    // Epochs that do not depend on each other can be analyzed concurrently (except when exact results are forced).
+    uint64_t numberOfThreads = std::min<uint64_t>(storm::utility::getNumberOfThreads<ValueType>(env.solver().getNumberOfThreads()), epochOrder.size());
+    if (numberOfThreads > 1 && env.solver().isForceExact()) {
+        STORM_LOG_INFO("Analyzing different epochs concurrently is not supported for the selected method. Using a single thread.");
+        numberOfThreads = 1;
+    }
+
+    storm::utility::ProgressMeasurement progress("epochs");
+    progress.setMaxCount(epochOrder.size());
+    progress.startNewMeasurement(0);
+    uint64_t numCheckedEpochs = 0;
+    if (numberOfThreads > 1) {
+        // Each chunk of epochs uses its own copy of the environment as sub-environments are created lazily (even on const access).
+        std::vector<Environment> chunkEnvironments(numberOfThreads, preciseEnv);
+        std::vector<std::vector<ValueType>> chunkX(numberOfThreads), chunkB(numberOfThreads);
+        std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> chunkLinEqSolvers(numberOfThreads);
+        rewardUnfolding.analyzeEpochs(
+            epochOrder, numberOfThreads,
+            [&](uint64_t chunk, rewardbounded::EpochModel<ValueType, true>& epochModel) {
+                return epochModel.analyzeSingleObjective(chunkEnvironments[chunk], chunkX[chunk], chunkB[chunk], chunkLinEqSolvers[chunk], lowerBound,
+                                                         upperBound);
+            },
+            [&](typename rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>::Epoch const& epoch) {
+                storeCdfEntry(epoch);
+                ++numCheckedEpochs;
+                progress.updateProgress(numCheckedEpochs);
+            },
+            &swBuild, &swCheck);
+
+        // The epochs are analyzed level by level. The cdf is exported in the computation order, as if a single thread was used.
+        auto cdfOrder = storm::utility::vector::buildVectorForRange<uint64_t>(0, cdfData.size());
+        std::sort(cdfOrder.begin(), cdfOrder.end(), [&rewardUnfolding, &cdfEpochs](uint64_t index1, uint64_t index2) {
+            return rewardUnfolding.getEpochManager().epochClassZigZagOrder(cdfEpochs[index1], cdfEpochs[index2]);
+        });
+        cdfData = storm::utility::vector::applyInversePermutation(cdfOrder, cdfData);
+    } else {
+        for (auto const& epoch : epochOrder) {
+            swBuild.start();
+            auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
+            swBuild.stop();
+            swCheck.start();
+            rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, x, b, linEqSolver, lowerBound, upperBound));
+            swCheck.stop();
+            storeCdfEntry(epoch);
+            ++numCheckedEpochs;
+            progress.updateProgress(numCheckedEpochs);
+            if (storm::utility::resources::isTerminate()) {
+                break;
+            }
         }
     }
 
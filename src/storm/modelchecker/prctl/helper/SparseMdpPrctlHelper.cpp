@@ -6,6 +6,7 @@
 #include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
 #include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpEndComponentInformation.h"
+#include "storm/modelchecker/prctl/helper/SparseMdpPrecomputationCache.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -35,6 +36,7 @@
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/ThreadPool.h"
 
 #include "storm/transformer/EndComponentEliminator.h"
 
@@ -77,18 +79,9 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseMdpPrctlHelper<Val
 
     // In case of cdf export we store the necessary data.
     std::vector<std::vector<ValueType>> cdfData;
+    std::vector<typename rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>::Epoch> cdfEpochs;
 
-    storm::utility::ProgressMeasurement progress("epochs");
-    progress.setMaxCount(epochOrder.size());
-    progress.startNewMeasurement(0);
-    uint64_t numCheckedEpochs = 0;
-    for (auto const& epoch : epochOrder) {
-        swBuild.start();
-        auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-        swBuild.stop();
-        swCheck.start();
-        rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, dir, x, b, minMaxSolver, lowerBound, upperBound));
-        swCheck.stop();
+    auto storeCdfEntry = [&](typename rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>::Epoch const& epoch) {
         if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
             !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
             std::vector<ValueType> cdfEntry;
@@ -99,11 +92,60 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseMdpPrctlHelper<Val
             }
             cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
             cdfData.push_back(std::move(cdfEntry));
+            cdfEpochs.push_back(epoch);
         }
-        ++numCheckedEpochs;
-        progress.updateProgress(numCheckedEpochs);
-        if (storm::utility::resources::isTerminate()) {
-            break;
+    };
+
+    // Epochs that do not depend on each other can be analyzed concurrently, unless the epochs are solved exactly or via linear programming.
+    uint64_t numberOfThreads = std::min<uint64_t>(storm::utility::getNumberOfThreads<ValueType>(env.solver().getNumberOfThreads()), epochOrder.size());
+    if (numberOfThreads > 1 &&
+        (env.solver().isForceExact() || preciseEnv.solver().minMax().getMethod() == storm::solver::MinMaxMethod::LinearProgramming)) {
+        STORM_LOG_INFO("Analyzing different epochs concurrently is not supported for the selected method. Using a single thread.");
+        numberOfThreads = 1;
+    }
+
+    storm::utility::ProgressMeasurement progress("epochs");
+    progress.setMaxCount(epochOrder.size());
+    progress.startNewMeasurement(0);
+    uint64_t numCheckedEpochs = 0;
+    if (numberOfThreads > 1) {
+        // Each chunk of epochs uses its own copy of the environment as sub-environments are created lazily (even on const access).
+        std::vector<Environment> chunkEnvironments(numberOfThreads, preciseEnv);
+        std::vector<std::vector<ValueType>> chunkX(numberOfThreads), chunkB(numberOfThreads);
+        std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> chunkMinMaxSolvers(numberOfThreads);
+        rewardUnfolding.analyzeEpochs(
+            epochOrder, numberOfThreads,
+            [&](uint64_t chunk, rewardbounded::EpochModel<ValueType, true>& epochModel) {
+                return epochModel.analyzeSingleObjective(chunkEnvironments[chunk], dir, chunkX[chunk], chunkB[chunk], chunkMinMaxSolvers[chunk], lowerBound,
+                                                         upperBound);
+            },
+            [&](typename rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>::Epoch const& epoch) {
+                storeCdfEntry(epoch);
+                ++numCheckedEpochs;
+                progress.updateProgress(numCheckedEpochs);
+            },
+            &swBuild, &swCheck);
+
+        // The epochs are analyzed level by level. The cdf is exported in the computation order, as if a single thread was used.
+        auto cdfOrder = storm::utility::vector::buildVectorForRange<uint64_t>(0, cdfData.size());
+        std::sort(cdfOrder.begin(), cdfOrder.end(), [&rewardUnfolding, &cdfEpochs](uint64_t index1, uint64_t index2) {
+            return rewardUnfolding.getEpochManager().epochClassZigZagOrder(cdfEpochs[index1], cdfEpochs[index2]);
+        });
+        cdfData = storm::utility::vector::applyInversePermutation(cdfOrder, cdfData);
+    } else {
+        for (auto const& epoch : epochOrder) {
+            swBuild.start();
+            auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
+            swBuild.stop();
+            swCheck.start();
+            rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, dir, x, b, minMaxSolver, lowerBound, upperBound));
+            swCheck.stop();
+            storeCdfEntry(epoch);
+            ++numCheckedEpochs;
+            progress.updateProgress(numCheckedEpochs);
+            if (storm::utility::resources::isTerminate()) {
+                break;
+            }
         }
     }
 
@@ -422,10 +464,19 @@ struct MaybeStateResult {
     boost::optional<std::vector<uint64_t>> scheduler;
 };
 
+/*!
+ * Solves the given equation system for the maybe states.
+ * If a precomputation cache is given, the solver is taken from (or stored in) the cache such that properties with the same equation
+ * system (but a different right-hand side) can reuse it. In this case, the submatrix has to be the one that is induced by the given
+ * maybe states and selected choices, i.e., no end components may have been eliminated.
+ */
 template<typename ValueType>
 MaybeStateResult<ValueType> computeValuesForMaybeStates(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                         storm::storage::SparseMatrix<ValueType>&& submatrix, std::vector<ValueType> const& b,
-                                                        bool produceScheduler, SparseMdpHintType<ValueType>& hint) {
+                                                        bool produceScheduler, SparseMdpHintType<ValueType>& hint,
+                                                        SparseMdpPrecomputationCache<ValueType>* precomputationCache = nullptr,
+                                                        storm::storage::BitVector const& maybeStates = storm::storage::BitVector(),
+                                                        boost::optional<storm::storage::BitVector> const& selectedChoices = boost::none) {
     // Initialize the solution vector.
     std::vector<ValueType> x =
         hint.hasValueHint()
@@ -433,9 +484,25 @@ MaybeStateResult<ValueType> computeValuesForMaybeStates(Environment const& env,
             : std::vector<ValueType>(submatrix.getRowGroupCount(), hint.hasLowerResultBound() ? hint.getLowerResultBound() : storm::utility::zero<ValueType>());
 
     // Set up the solver.
-    storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType> minMaxLinearEquationSolverFactory;
-    std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver =
-        storm::solver::configureMinMaxLinearEquationSolver(env, std::move(goal), minMaxLinearEquationSolverFactory, std::move(submatrix));
+    std::shared_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver;
+    if (precomputationCache) {
+        solver = precomputationCache->getMinMaxSolver(env, maybeStates, selectedChoices);
+    }
+    if (solver) {
+        // Reset everything that was set for the previous property. The matrix (and data derived from it) is kept.
+        solver->resetTerminationCondition();
+        solver->clearRelevantValues();
+        solver->clearBounds();
+        solver->clearInitialScheduler();
+        storm::solver::configureMinMaxLinearEquationSolver(std::move(goal), *solver);
+    } else {
+        storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType> minMaxLinearEquationSolverFactory;
+        solver = storm::solver::configureMinMaxLinearEquationSolver(env, std::move(goal), minMaxLinearEquationSolverFactory, std::move(submatrix));
+        if (precomputationCache) {
+            solver->setCachingEnabled(true);
+            precomputationCache->storeMinMaxSolver(env, maybeStates, selectedChoices, solver);
+        }
+    }
     solver->setRequirementsChecked();
     solver->setHasUniqueSolution(hint.hasUniqueSolution());
     solver->setHasNoEndComponents(hint.hasNoEndComponents());
@@ -513,12 +580,15 @@ QualitativeStateSetsUntilProbabilities computeQualitativeStateSetsUntilProbabili
                                                                                      storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                      storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                      storm::storage::BitVector const& phiStates,
-                                                                                     storm::storage::BitVector const& psiStates) {
+                                                                                     storm::storage::BitVector const& psiStates,
+                                                                                     SparseMdpPrecomputationCache<ValueType>* precomputationCache) {
     QualitativeStateSetsUntilProbabilities result;
 
     // Get all states that have probability 0 and 1 of satisfying the until-formula.
     std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01;
-    if (goal.minimize()) {
+    if (precomputationCache) {
+        statesWithProbability01 = precomputationCache->getProb01(goal.direction(), phiStates, psiStates);
+    } else if (goal.minimize()) {
         statesWithProbability01 =
             storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
     } else {
@@ -537,11 +607,12 @@ QualitativeStateSetsUntilProbabilities getQualitativeStateSetsUntilProbabilities
                                                                                  storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                  storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                  storm::storage::BitVector const& phiStates,
-                                                                                 storm::storage::BitVector const& psiStates, ModelCheckerHint const& hint) {
+                                                                                 storm::storage::BitVector const& psiStates, ModelCheckerHint const& hint,
+                                                                                 SparseMdpPrecomputationCache<ValueType>* precomputationCache) {
     if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().getComputeOnlyMaybeStates()) {
         return getQualitativeStateSetsUntilProbabilitiesFromHint<ValueType>(hint);
     } else {
-        return computeQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates);
+        return computeQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, precomputationCache);
     }
 }
 
@@ -598,21 +669,29 @@ template<typename ValueType>
 boost::optional<SparseMdpEndComponentInformation<ValueType>> computeFixedPointSystemUntilProbabilitiesEliminateEndComponents(
     storm::solver::SolveGoal<ValueType>& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, QualitativeStateSetsUntilProbabilities const& qualitativeStateSets,
-    storm::storage::SparseMatrix<ValueType>& submatrix, std::vector<ValueType>& b, bool produceScheduler) {
-    // Get the set of states that (under some scheduler) can stay in the set of maybestates forever
-    storm::storage::BitVector candidateStates = storm::utility::graph::performProb0E(
-        transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, qualitativeStateSets.maybeStates, ~qualitativeStateSets.maybeStates);
-
-    bool doDecomposition = !candidateStates.empty();
-
-    storm::storage::MaximalEndComponentDecomposition<ValueType> endComponentDecomposition;
-    if (doDecomposition) {
-        // Compute the states that are in MECs.
-        endComponentDecomposition = storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions, candidateStates);
+    storm::storage::SparseMatrix<ValueType>& submatrix, std::vector<ValueType>& b, bool produceScheduler,
+    SparseMdpPrecomputationCache<ValueType>* precomputationCache) {
+    // The end components only depend on the maybe states, so they can be shared with other properties.
+    std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType> const> cachedEndComponentDecomposition;
+    storm::storage::MaximalEndComponentDecomposition<ValueType> localEndComponentDecomposition;
+    if (precomputationCache) {
+        cachedEndComponentDecomposition = precomputationCache->getEndComponentsOfMaybeStates(qualitativeStateSets.maybeStates);
+    } else {
+        // Get the set of states that (under some scheduler) can stay in the set of maybestates forever
+        storm::storage::BitVector candidateStates = storm::utility::graph::performProb0E(
+            transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, qualitativeStateSets.maybeStates, ~qualitativeStateSets.maybeStates);
+
+        if (!candidateStates.empty()) {
+            // Compute the states that are in MECs.
+            localEndComponentDecomposition =
+                storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions, candidateStates);
+        }
     }
+    storm::storage::MaximalEndComponentDecomposition<ValueType> const& endComponentDecomposition =
+        cachedEndComponentDecomposition ? *cachedEndComponentDecomposition : localEndComponentDecomposition;
 
     // Only do more work if there are actually end-components.
-    if (doDecomposition && !endComponentDecomposition.empty()) {
+    if (!endComponentDecomposition.empty()) {
         STORM_LOG_DEBUG("Eliminating " << endComponentDecomposition.size() << " EC(s).");
         SparseMdpEndComponentInformation<ValueType> result = SparseMdpEndComponentInformation<ValueType>::eliminateEndComponents(
             endComponentDecomposition, transitionMatrix, qualitativeStateSets.maybeStates, &qualitativeStateSets.statesWithProbability1, nullptr, nullptr,
@@ -644,9 +723,11 @@ template<typename ValueType>
 MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-    bool qualitative, bool produceScheduler, ModelCheckerHint const& hint) {
+    bool qualitative, bool produceScheduler, ModelCheckerHint const& hint, SparseMdpPrecomputationCache<ValueType>* precomputationCache) {
     STORM_LOG_THROW(!qualitative || !produceScheduler, storm::exceptions::InvalidSettingsException,
                     "Cannot produce scheduler when performing qualitative model checking only.");
+    STORM_LOG_ASSERT(!precomputationCache || &precomputationCache->getTransitionMatrix() == &transitionMatrix,
+                     "The precomputation cache belongs to a different transition matrix.");
 
     // Prepare resulting vector.
     std::vector<ValueType> result(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
@@ -654,7 +735,7 @@ MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType
     // We need to identify the maybe states (states which have a probability for satisfying the until formula
     // that is strictly between 0 and 1) and the states that satisfy the formula with probablity 1 and 0, respectively.
     QualitativeStateSetsUntilProbabilities qualitativeStateSets =
-        getQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, hint);
+        getQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, hint, precomputationCache);
 
     STORM_LOG_INFO("Preprocessing: " << qualitativeStateSets.statesWithProbability1.getNumberOfSetBits() << " states with probability 1, "
                                      << qualitativeStateSets.statesWithProbability0.getNumberOfSetBits() << " with probability 0 ("
@@ -698,16 +779,18 @@ MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType
             // If the hint information tells us that we have to eliminate MECs, we do so now.
             boost::optional<SparseMdpEndComponentInformation<ValueType>> ecInformation;
             if (hintInformation.getEliminateEndComponents()) {
-                ecInformation = computeFixedPointSystemUntilProbabilitiesEliminateEndComponents(goal, transitionMatrix, backwardTransitions,
-                                                                                                qualitativeStateSets, submatrix, b, produceScheduler);
+                ecInformation = computeFixedPointSystemUntilProbabilitiesEliminateEndComponents(
+                    goal, transitionMatrix, backwardTransitions, qualitativeStateSets, submatrix, b, produceScheduler, precomputationCache);
             } else {
                 // Otherwise, we compute the standard equations.
                 computeFixedPointSystemUntilProbabilities(goal, transitionMatrix, qualitativeStateSets, submatrix, b);
             }
 
-            // Now compute the results for the maybe states.
+            // Now compute the results for the maybe states. Unless end components were eliminated, the equation system only depends on the
+            // maybe states and the solver can be shared with other properties.
             MaybeStateResult<ValueType> resultForMaybeStates =
-                computeValuesForMaybeStates(env, std::move(goal), std::move(submatrix), b, produceScheduler, hintInformation);
+                computeValuesForMaybeStates(env, std::move(goal), std::move(submatrix), b, produceScheduler, hintInformation,
+                                            ecInformation ? nullptr : precomputationCache, qualitativeStateSets.maybeStates);
 
             // If we eliminated end components, we need to extract the result differently.
             if (ecInformation && ecInformation.get().getEliminatedEndComponents()) {
@@ -911,7 +994,7 @@ template<typename RewardModelType>
 MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeReachabilityRewards(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, RewardModelType const& rewardModel, storm::storage::BitVector const& targetStates,
-    bool qualitative, bool produceScheduler, ModelCheckerHint const& hint) {
+    bool qualitative, bool produceScheduler, ModelCheckerHint const& hint, SparseMdpPrecomputationCache<ValueType>* precomputationCache) {
     // Only compute the result if the model has at least one reward this->getModel().
     STORM_LOG_THROW(!rewardModel.empty(), storm::exceptions::InvalidPropertyException, "Reward model for formula is empty. Skipping formula.");
     return computeReachabilityRewardsHelper(
@@ -920,21 +1003,21 @@ MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType
             return rewardModel.getTotalRewardVector(rowCount, transitionMatrix, maybeStates);
         },
         targetStates, qualitative, produceScheduler, [&]() { return rewardModel.getStatesWithZeroReward(transitionMatrix); },
-        [&]() { return rewardModel.getChoicesWithZeroReward(transitionMatrix); }, hint);
+        [&]() { return rewardModel.getChoicesWithZeroReward(transitionMatrix); }, hint, precomputationCache);
 }
 
 template<typename ValueType>
 MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeReachabilityTimes(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler,
-    ModelCheckerHint const& hint) {
+    ModelCheckerHint const& hint, SparseMdpPrecomputationCache<ValueType>* precomputationCache) {
     return computeReachabilityRewardsHelper(
         env, std::move(goal), transitionMatrix, backwardTransitions,
         [](uint_fast64_t rowCount, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&) {
             return std::vector<ValueType>(rowCount, storm::utility::one<ValueType>());
         },
         targetStates, qualitative, produceScheduler, [&]() { return storm::storage::BitVector(transitionMatrix.getRowGroupCount(), false); },
-        [&]() { return storm::storage::BitVector(transitionMatrix.getRowCount(), false); }, hint);
+        [&]() { return storm::storage::BitVector(transitionMatrix.getRowCount(), false); }, hint, precomputationCache);
 }
 
 #ifdef STORM_HAVE_CARL
@@ -1010,10 +1093,13 @@ template<typename ValueType>
 QualitativeStateSetsReachabilityRewards computeQualitativeStateSetsReachabilityRewards(
     storm::solver::SolveGoal<ValueType> const& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& targetStates,
-    std::function<storm::storage::BitVector()> const& zeroRewardStatesGetter, std::function<storm::storage::BitVector()> const& zeroRewardChoicesGetter) {
+    std::function<storm::storage::BitVector()> const& zeroRewardStatesGetter, std::function<storm::storage::BitVector()> const& zeroRewardChoicesGetter,
+    SparseMdpPrecomputationCache<ValueType>* precomputationCache) {
     QualitativeStateSetsReachabilityRewards result;
     storm::storage::BitVector trueStates(transitionMatrix.getRowGroupCount(), true);
-    if (goal.minimize()) {
+    if (precomputationCache) {
+        result.infinityStates = precomputationCache->getProb1(goal.direction(), targetStates);
+    } else if (goal.minimize()) {
         result.infinityStates =
             storm::utility::graph::performProb1E(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, trueStates, targetStates);
     } else {
@@ -1043,12 +1129,13 @@ QualitativeStateSetsReachabilityRewards getQualitativeStateSetsReachabilityRewar
                                                                                    storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                    storm::storage::BitVector const& targetStates, ModelCheckerHint const& hint,
                                                                                    std::function<storm::storage::BitVector()> const& zeroRewardStatesGetter,
-                                                                                   std::function<storm::storage::BitVector()> const& zeroRewardChoicesGetter) {
+                                                                                   std::function<storm::storage::BitVector()> const& zeroRewardChoicesGetter,
+                                                                                   SparseMdpPrecomputationCache<ValueType>* precomputationCache) {
     if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().getComputeOnlyMaybeStates()) {
         return getQualitativeStateSetsReachabilityRewardsFromHint<ValueType>(hint, targetStates);
     } else {
         return computeQualitativeStateSetsReachabilityRewards(goal, transitionMatrix, backwardTransitions, targetStates, zeroRewardStatesGetter,
-                                                              zeroRewardChoicesGetter);
+                                                              zeroRewardChoicesGetter, precomputationCache);
     }
 }
 
@@ -1234,13 +1321,16 @@ MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType
         totalStateRewardVectorGetter,
     storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler,
     std::function<storm::storage::BitVector()> const& zeroRewardStatesGetter, std::function<storm::storage::BitVector()> const& zeroRewardChoicesGetter,
-    ModelCheckerHint const& hint) {
+    ModelCheckerHint const& hint, SparseMdpPrecomputationCache<ValueType>* precomputationCache) {
+    STORM_LOG_ASSERT(!precomputationCache || &precomputationCache->getTransitionMatrix() == &transitionMatrix,
+                     "The precomputation cache belongs to a different transition matrix.");
+
     // Prepare resulting vector.
     std::vector<ValueType> result(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
 
     // Determine which states have a reward that is infinity or less than infinity.
     QualitativeStateSetsReachabilityRewards qualitativeStateSets = getQualitativeStateSetsReachabilityRewards(
-        goal, transitionMatrix, backwardTransitions, targetStates, hint, zeroRewardStatesGetter, zeroRewardChoicesGetter);
+        goal, transitionMatrix, backwardTransitions, targetStates, hint, zeroRewardStatesGetter, zeroRewardChoicesGetter, precomputationCache);
 
     STORM_LOG_INFO("Preprocessing: " << qualitativeStateSets.infinityStates.getNumberOfSetBits() << " states with reward infinity, "
                                      << qualitativeStateSets.rewardZeroStates.getNumberOfSetBits() << " states with reward zero ("
@@ -1307,9 +1397,11 @@ MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType
                 computeUpperRewardBounds(hintInformation, goal.direction(), submatrix, b, oneStepTargetProbabilities.get());
             }
 
-            // Now compute the results for the maybe states.
+            // Now compute the results for the maybe states. Unless end components were eliminated, the equation system only depends on the
+            // maybe states and the selected choices, so the solver can be shared with other properties.
             MaybeStateResult<ValueType> resultForMaybeStates =
-                computeValuesForMaybeStates(env, std::move(goal), std::move(submatrix), b, produceScheduler, hintInformation);
+                computeValuesForMaybeStates(env, std::move(goal), std::move(submatrix), b, produceScheduler, hintInformation,
+                                            ecInformation ? nullptr : precomputationCache, qualitativeStateSets.maybeStates, selectedChoices);
 
             // If we eliminated end components, we need to extract the result differently.
             if (ecInformation && ecInformation.get().getEliminatedEndComponents()) {
@@ -1523,7 +1615,8 @@ template std::vector<double> SparseMdpPrctlHelper<double>::computeCumulativeRewa
 template MDPSparseModelCheckingHelperReturnType<double> SparseMdpPrctlHelper<double>::computeReachabilityRewards(
     Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& transitionMatrix,
     storm::storage::SparseMatrix<double> const& backwardTransitions, storm::models::sparse::StandardRewardModel<double> const& rewardModel,
-    storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint);
+    storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint,
+    SparseMdpPrecomputationCache<double>* precomputationCache);
 template MDPSparseModelCheckingHelperReturnType<double> SparseMdpPrctlHelper<double>::computeTotalRewards(
     Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& transitionMatrix,
     storm::storage::SparseMatrix<double> const& backwardTransitions, storm::models::sparse::StandardRewardModel<double> const& rewardModel, bool qualitative,
@@ -1541,7 +1634,7 @@ template MDPSparseModelCheckingHelperReturnType<storm::RationalNumber> SparseMdp
     Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
     storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
     storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, storm::storage::BitVector const& targetStates, bool qualitative,
-    bool produceScheduler, ModelCheckerHint const& hint);
+    bool produceScheduler, ModelCheckerHint const& hint, SparseMdpPrecomputationCache<storm::RationalNumber>* precomputationCache);
 template MDPSparseModelCheckingHelperReturnType<storm::RationalNumber> SparseMdpPrctlHelper<storm::RationalNumber>::computeTotalRewards(
     Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
     storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
@@ -35,6 +35,9 @@ class CheckResult;
 
 namespace helper {
 
+template<typename ValueType>
+class SparseMdpPrecomputationCache;
+
 template<typename ValueType>
 class SparseMdpPrctlHelper {
    public:
@@ -49,7 +52,8 @@ class SparseMdpPrctlHelper {
     static MDPSparseModelCheckingHelperReturnType<ValueType> computeUntilProbabilities(
         Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
         storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-        storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint = ModelCheckerHint());
+        storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint = ModelCheckerHint(),
+        SparseMdpPrecomputationCache<ValueType>* precomputationCache = nullptr);
 
     static MDPSparseModelCheckingHelperReturnType<ValueType> computeGloballyProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                                                           storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
@@ -78,13 +82,15 @@ class SparseMdpPrctlHelper {
     static MDPSparseModelCheckingHelperReturnType<ValueType> computeReachabilityRewards(
         Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
         storm::storage::SparseMatrix<ValueType> const& backwardTransitions, RewardModelType const& rewardModel, storm::storage::BitVector const& targetStates,
-        bool qualitative, bool produceScheduler, ModelCheckerHint const& hint = ModelCheckerHint());
+        bool qualitative, bool produceScheduler, ModelCheckerHint const& hint = ModelCheckerHint(),
+        SparseMdpPrecomputationCache<ValueType>* precomputationCache = nullptr);
 
     static MDPSparseModelCheckingHelperReturnType<ValueType> computeReachabilityTimes(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                                                       storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                       storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                       storm::storage::BitVector const& targetStates, bool qualitative,
-                                                                                      bool produceScheduler, ModelCheckerHint const& hint = ModelCheckerHint());
+                                                                                      bool produceScheduler, ModelCheckerHint const& hint = ModelCheckerHint(),
+                                                                                      SparseMdpPrecomputationCache<ValueType>* precomputationCache = nullptr);
 
 #ifdef STORM_HAVE_CARL
     static std::vector<ValueType> computeReachabilityRewards(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
@@ -108,7 +114,7 @@ class SparseMdpPrctlHelper {
             totalStateRewardVectorGetter,
         storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler,
         std::function<storm::storage::BitVector()> const& zeroRewardStatesGetter, std::function<storm::storage::BitVector()> const& zeroRewardChoicesGetter,
-        ModelCheckerHint const& hint = ModelCheckerHint());
+        ModelCheckerHint const& hint = ModelCheckerHint(), SparseMdpPrecomputationCache<ValueType>* precomputationCache = nullptr);
 };
 
 }  // namespace helper
@@ -0,0 +1,208 @@
+#include "storm/modelchecker/prctl/helper/SparseMdpPrecomputationCache.h"
+
+#include <boost/functional/hash.hpp>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+
+template<typename ValueType>
+SparseMdpPrecomputationCache<ValueType>::SparseMdpPrecomputationCache(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                      uint64_t maximalNumberOfEntries)
+    : transitionMatrix(transitionMatrix), maximalNumberOfEntries(maximalNumberOfEntries) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+storm::storage::SparseMatrix<ValueType> const& SparseMdpPrecomputationCache<ValueType>::getBackwardTransitions() {
+    if (!backwardTransitions) {
+        backwardTransitions = transitionMatrix.transpose(true);
+    }
+    return backwardTransitions.get();
+}
+
+template<typename ValueType>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> SparseMdpPrecomputationCache<ValueType>::getProb01(
+    storm::OptimizationDirection const& direction, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+    std::size_t hash = static_cast<std::size_t>(direction);
+    boost::hash_combine(hash, std::hash<storm::storage::BitVector>()(phiStates));
+    boost::hash_combine(hash, std::hash<storm::storage::BitVector>()(psiStates));
+    auto findRes = prob01.find(hash);
+    if (findRes != prob01.end() && findRes->second.direction == direction && findRes->second.phiStates == phiStates &&
+        findRes->second.psiStates == psiStates) {
+        STORM_LOG_DEBUG("Reusing cached probability 0/1 states.");
+        ++numberOfHits;
+        return findRes->second.result;
+    }
+
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
+    if (storm::solver::minimize(direction)) {
+        result =
+            storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), getBackwardTransitions(), phiStates, psiStates);
+    } else {
+        result =
+            storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), getBackwardTransitions(), phiStates, psiStates);
+    }
+    if (findRes == prob01.end()) {
+        prob01.emplace(hash, Prob01Entry{direction, phiStates, psiStates, result});
+        registerEntry(EntryType::Prob01, hash);
+    } else {
+        // Hash collision: the new result replaces the old one.
+        findRes->second = Prob01Entry{direction, phiStates, psiStates, result};
+    }
+    return result;
+}
+
+template<typename ValueType>
+storm::storage::BitVector SparseMdpPrecomputationCache<ValueType>::getProb1(storm::OptimizationDirection const& direction,
+                                                                           storm::storage::BitVector const& targetStates) {
+    std::size_t hash = static_cast<std::size_t>(direction);
+    boost::hash_combine(hash, std::hash<storm::storage::BitVector>()(targetStates));
+    auto findRes = prob1.find(hash);
+    if (findRes != prob1.end() && findRes->second.direction == direction && findRes->second.targetStates == targetStates) {
+        STORM_LOG_DEBUG("Reusing cached probability 1 states.");
+        ++numberOfHits;
+        return findRes->second.result;
+    }
+
+    storm::storage::BitVector trueStates(transitionMatrix.getRowGroupCount(), true);
+    storm::storage::BitVector result;
+    if (storm::solver::minimize(direction)) {
+        result = storm::utility::graph::performProb1E(transitionMatrix, transitionMatrix.getRowGroupIndices(), getBackwardTransitions(), trueStates,
+                                                      targetStates);
+    } else {
+        result = storm::utility::graph::performProb1A(transitionMatrix, transitionMatrix.getRowGroupIndices(), getBackwardTransitions(), trueStates,
+                                                      targetStates);
+    }
+    if (findRes == prob1.end()) {
+        prob1.emplace(hash, Prob1Entry{direction, targetStates, result});
+        registerEntry(EntryType::Prob1, hash);
+    } else {
+        findRes->second = Prob1Entry{direction, targetStates, result};
+    }
+    return result;
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType> const> SparseMdpPrecomputationCache<ValueType>::getEndComponentsOfMaybeStates(
+    storm::storage::BitVector const& maybeStates) {
+    std::size_t hash = std::hash<storm::storage::BitVector>()(maybeStates);
+    auto findRes = maybeStateEndComponents.find(hash);
+    if (findRes != maybeStateEndComponents.end() && findRes->second.maybeStates == maybeStates) {
+        STORM_LOG_DEBUG("Reusing cached end components.");
+        ++numberOfHits;
+        return findRes->second.result;
+    }
+
+    // Get the set of states that (under some scheduler) can stay in the set of maybestates forever
+    storm::storage::BitVector candidateStates =
+        storm::utility::graph::performProb0E(transitionMatrix, transitionMatrix.getRowGroupIndices(), getBackwardTransitions(), maybeStates, ~maybeStates);
+    auto result = std::make_shared<storm::storage::MaximalEndComponentDecomposition<ValueType>>();
+    if (!candidateStates.empty()) {
+        *result = storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, getBackwardTransitions(), candidateStates);
+    }
+    if (findRes == maybeStateEndComponents.end()) {
+        maybeStateEndComponents.emplace(hash, EndComponentsEntry{maybeStates, result});
+        registerEntry(EntryType::EndComponents, hash);
+    } else {
+        findRes->second = EndComponentsEntry{maybeStates, result};
+    }
+    return result;
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> SparseMdpPrecomputationCache<ValueType>::getMinMaxSolver(
+    Environment const& env, storm::storage::BitVector const& maybeStates, boost::optional<storm::storage::BitVector> const& selectedChoices) {
+    auto const& solverEnvironment = env.solver();
+    auto findRes = solvers.find(getSolverHash(env, maybeStates, selectedChoices));
+    if (findRes != solvers.end() && findRes->second.method == solverEnvironment.minMax().getMethod() &&
+        findRes->second.forceExact == solverEnvironment.isForceExact() && findRes->second.forceSoundness == solverEnvironment.isForceSoundness() &&
+        findRes->second.maybeStates == maybeStates && findRes->second.selectedChoices == selectedChoices) {
+        STORM_LOG_DEBUG("Reusing cached solver for " << maybeStates.getNumberOfSetBits() << " maybe states.");
+        ++numberOfHits;
+        return findRes->second.solver;
+    }
+    return nullptr;
+}
+
+template<typename ValueType>
+void SparseMdpPrecomputationCache<ValueType>::storeMinMaxSolver(Environment const& env, storm::storage::BitVector const& maybeStates,
+                                                                boost::optional<storm::storage::BitVector> const& selectedChoices,
+                                                                std::shared_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> const& solver) {
+    SolverEntry entry{env.solver().minMax().getMethod(), env.solver().isForceExact(), env.solver().isForceSoundness(), maybeStates, selectedChoices, solver};
+    uint64_t hash = getSolverHash(env, maybeStates, selectedChoices);
+    auto findRes = solvers.find(hash);
+    if (findRes == solvers.end()) {
+        solvers.emplace(hash, std::move(entry));
+        registerEntry(EntryType::Solver, hash);
+    } else {
+        findRes->second = std::move(entry);
+    }
+}
+
+template<typename ValueType>
+storm::storage::SparseMatrix<ValueType> const& SparseMdpPrecomputationCache<ValueType>::getTransitionMatrix() const {
+    return transitionMatrix;
+}
+
+template<typename ValueType>
+uint64_t SparseMdpPrecomputationCache<ValueType>::getNumberOfHits() const {
+    return numberOfHits;
+}
+
+template<typename ValueType>
+uint64_t SparseMdpPrecomputationCache<ValueType>::getNumberOfEntries() const {
+    return insertionOrder.size();
+}
+
+template<typename ValueType>
+void SparseMdpPrecomputationCache<ValueType>::registerEntry(EntryType type, uint64_t hash) {
+    insertionOrder.emplace_back(type, hash);
+    while (insertionOrder.size() > maximalNumberOfEntries) {
+        auto const& oldest = insertionOrder.front();
+        switch (oldest.first) {
+            case EntryType::Prob01:
+                prob01.erase(oldest.second);
+                break;
+            case EntryType::Prob1:
+                prob1.erase(oldest.second);
+                break;
+            case EntryType::EndComponents:
+                maybeStateEndComponents.erase(oldest.second);
+                break;
+            case EntryType::Solver:
+                solvers.erase(oldest.second);
+                break;
+        }
+        insertionOrder.pop_front();
+    }
+}
+
+template<typename ValueType>
+uint64_t SparseMdpPrecomputationCache<ValueType>::getSolverHash(Environment const& env, storm::storage::BitVector const& maybeStates,
+                                                                boost::optional<storm::storage::BitVector> const& selectedChoices) {
+    std::size_t result = static_cast<std::size_t>(env.solver().minMax().getMethod());
+    boost::hash_combine(result, env.solver().isForceExact());
+    boost::hash_combine(result, env.solver().isForceSoundness());
+    boost::hash_combine(result, std::hash<storm::storage::BitVector>()(maybeStates));
+    if (selectedChoices) {
+        boost::hash_combine(result, std::hash<storm::storage::BitVector>()(selectedChoices.get()));
+    }
+    return result;
+}
+
+template class SparseMdpPrecomputationCache<double>;
+
+#ifdef STORM_HAVE_CARL
+template class SparseMdpPrecomputationCache<storm::RationalNumber>;
+#endif
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
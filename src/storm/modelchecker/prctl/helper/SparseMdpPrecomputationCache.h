@@ -0,0 +1,152 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+
+#include <boost/optional.hpp>
+
+#include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/SolverSelectionOptions.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+
+class Environment;
+
+namespace modelchecker {
+namespace helper {
+
+/*!
+ * Stores the results of graph analyses on the transition matrix of an MDP such that they can be reused when several
+ * properties are checked on the same model. Results are stored for the exact sets of states they were computed for.
+ * Hence, two properties share a precomputation iff they ask for the same analysis on the same sets of states (e.g.
+ * maximal reachability probabilities of the same target set).
+ * Besides the graph analyses, the cache keeps the min-max equation solvers that were set up for the maybe states of a
+ * property such that a later property with the same equation system (but different right-hand side) can reuse the solver.
+ *
+ * Entries are looked up by a hash of the involved state sets and the cache holds at most a given number of entries.
+ * If this number is exceeded, the oldest entries are dropped.
+ */
+template<typename ValueType>
+class SparseMdpPrecomputationCache {
+   public:
+    /*!
+     * Creates an empty cache for the given transition matrix. The matrix has to remain unchanged for the lifetime of the cache.
+     *
+     * @param maximalNumberOfEntries The maximal number of stored analysis results and solvers (excluding the backward transitions).
+     */
+    SparseMdpPrecomputationCache(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, uint64_t maximalNumberOfEntries = 32);
+
+    /*!
+     * Retrieves the backward transitions of the transition matrix, computing them upon the first call.
+     */
+    storm::storage::SparseMatrix<ValueType> const& getBackwardTransitions();
+
+    /*!
+     * Retrieves the states with minimal (or maximal) probability 0 and 1 of satisfying phi until psi (see storm::utility::graph::performProb01Min/Max).
+     */
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> getProb01(storm::OptimizationDirection const& direction,
+                                                                              storm::storage::BitVector const& phiStates,
+                                                                              storm::storage::BitVector const& psiStates);
+
+    /*!
+     * Retrieves the states that reach the target states with probability 1 for some (if direction is minimize) or all (if direction is
+     * maximize) schedulers (see storm::utility::graph::performProb1E/A).
+     */
+    storm::storage::BitVector getProb1(storm::OptimizationDirection const& direction, storm::storage::BitVector const& targetStates);
+
+    /*!
+     * Retrieves the maximal end components that consist only of the given maybe states.
+     */
+    std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType> const> getEndComponentsOfMaybeStates(
+        storm::storage::BitVector const& maybeStates);
+
+    /*!
+     * Retrieves the solver that was stored for the equation system induced by the given maybe states and (if given) the selected choices.
+     * Solvers are only shared among calls with the same solver settings in the environment.
+     *
+     * @return The stored solver or nullptr if there is none.
+     */
+    std::shared_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> getMinMaxSolver(
+        Environment const& env, storm::storage::BitVector const& maybeStates, boost::optional<storm::storage::BitVector> const& selectedChoices);
+
+    /*!
+     * Stores the given solver for the equation system induced by the given maybe states and (if given) the selected choices.
+     */
+    void storeMinMaxSolver(Environment const& env, storm::storage::BitVector const& maybeStates,
+                           boost::optional<storm::storage::BitVector> const& selectedChoices,
+                           std::shared_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> const& solver);
+
+    /*!
+     * Retrieves the transition matrix this cache belongs to.
+     */
+    storm::storage::SparseMatrix<ValueType> const& getTransitionMatrix() const;
+
+    /*!
+     * Retrieves how often a graph analysis or solver (other than the backward transitions) was taken from this cache instead of being computed.
+     */
+    uint64_t getNumberOfHits() const;
+
+    /*!
+     * Retrieves the number of stored analysis results and solvers.
+     */
+    uint64_t getNumberOfEntries() const;
+
+   private:
+    enum class EntryType { Prob01, Prob1, EndComponents, Solver };
+
+    struct Prob01Entry {
+        storm::OptimizationDirection direction;
+        storm::storage::BitVector phiStates;
+        storm::storage::BitVector psiStates;
+        std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
+    };
+
+    struct Prob1Entry {
+        storm::OptimizationDirection direction;
+        storm::storage::BitVector targetStates;
+        storm::storage::BitVector result;
+    };
+
+    struct EndComponentsEntry {
+        storm::storage::BitVector maybeStates;
+        std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType> const> result;
+    };
+
+    struct SolverEntry {
+        storm::solver::MinMaxMethod method;
+        bool forceExact;
+        bool forceSoundness;
+        storm::storage::BitVector maybeStates;
+        boost::optional<storm::storage::BitVector> selectedChoices;
+        std::shared_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver;
+    };
+
+    /*!
+     * Remembers that an entry with the given hash was inserted and drops the oldest entries if the cache is full.
+     */
+    void registerEntry(EntryType type, uint64_t hash);
+
+    static uint64_t getSolverHash(Environment const& env, storm::storage::BitVector const& maybeStates,
+                                  boost::optional<storm::storage::BitVector> const& selectedChoices);
+
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix;
+    uint64_t maximalNumberOfEntries;
+    boost::optional<storm::storage::SparseMatrix<ValueType>> backwardTransitions;
+    std::unordered_map<uint64_t, Prob01Entry> prob01;
+    std::unordered_map<uint64_t, Prob1Entry> prob1;
+    std::unordered_map<uint64_t, EndComponentsEntry> maybeStateEndComponents;
+    std::unordered_map<uint64_t, SolverEntry> solvers;
+    std::deque<std::pair<EntryType, uint64_t>> insertionOrder;
+    uint64_t numberOfHits{0};
+};
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
@@ -15,6 +15,8 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/expressions/Expressions.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/ThreadPool.h"
 
 #include "storm/transformer/EndComponentEliminator.h"
 
@@ -397,23 +399,167 @@ MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochComputa
     return std::vector<Epoch>(collectedEpochs.begin(), collectedEpochs.end());
 }
 
+template<typename ValueType, bool SingleObjectiveMode>
+std::vector<std::vector<typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::Epoch>>
+MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochComputationLevels(std::vector<Epoch> const& epochOrder) const {
+    // The successors of an epoch precede the epoch in the computation order, so the levels can be computed in a single pass.
+    std::vector<std::vector<Epoch>> levels;
+    std::map<Epoch, uint64_t> epochToLevelMap;
+    for (auto const& epoch : epochOrder) {
+        uint64_t level = 0;
+        for (auto const& step : possibleEpochSteps) {
+            Epoch successorEpoch = epochManager.getSuccessorEpoch(epoch, step);
+            if (successorEpoch != epoch) {
+                auto successorLevelIt = epochToLevelMap.find(successorEpoch);
+                if (successorLevelIt != epochToLevelMap.end()) {
+                    level = std::max(level, successorLevelIt->second + 1);
+                }
+            }
+        }
+        epochToLevelMap.emplace(epoch, level);
+        if (level == levels.size()) {
+            levels.emplace_back();
+        }
+        levels[level].push_back(epoch);
+    }
+    return levels;
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::analyzeEpochs(
+    std::vector<Epoch> const& epochOrder, uint64_t numberOfThreads,
+    std::function<std::vector<SolutionType>(uint64_t, EpochModel<ValueType, SingleObjectiveMode>&)> const& analyzeEpochModel,
+    std::function<void(Epoch const&)> const& epochAnalyzed, storm::utility::Stopwatch* buildWatch, storm::utility::Stopwatch* checkWatch) {
+    STORM_LOG_ASSERT(numberOfThreads > 0, "Invalid number of threads.");
+    auto levels = getEpochComputationLevels(epochOrder);
+    STORM_LOG_DEBUG("Analyzing " << epochOrder.size() << " epochs in " << levels.size() << " levels.");
+
+    // The class models of the classes occurring in the current level. Each chunk works on its own copy of such a class model.
+    std::map<EpochClass, std::shared_ptr<EpochModelData const>> classModels;
+    std::vector<EpochModelData> chunkModels(numberOfThreads);
+    std::vector<boost::optional<EpochClass>> chunkClasses(numberOfThreads);
+    std::vector<storm::utility::Stopwatch> chunkBuildWatches(numberOfThreads), chunkCheckWatches(numberOfThreads);
+
+    for (auto const& level : levels) {
+        if (buildWatch) {
+            buildWatch->start();
+        }
+        std::map<EpochClass, std::shared_ptr<EpochModelData const>> levelClassModels;
+        for (auto const& epoch : level) {
+            EpochClass epochClass = epochManager.getEpochClass(epoch);
+            if (levelClassModels.count(epochClass) == 0) {
+                auto classModelIt = classModels.find(epochClass);
+                if (classModelIt != classModels.end()) {
+                    levelClassModels.emplace(epochClass, classModelIt->second);
+                } else {
+                    auto classModel = std::make_shared<EpochModelData>();
+                    classModel->epochModel.equationSolverProblemFormat = epochModelData.epochModel.equationSolverProblemFormat;
+                    buildEpochClassModel(epoch, *classModel);
+                    levelClassModels.emplace(epochClass, std::move(classModel));
+                }
+            }
+        }
+        classModels = std::move(levelClassModels);
+        if (buildWatch) {
+            buildWatch->stop();
+        }
+
+        // Epochs of the same class are adjacent within a level. Splitting the level into consecutive chunks thus keeps the number of class changes low.
+        uint64_t const numberOfChunks = std::min<uint64_t>(numberOfThreads, level.size());
+        uint64_t const chunkSize = (level.size() + numberOfChunks - 1) / numberOfChunks;
+        std::vector<std::vector<SolutionType>> levelSolutions(level.size());
+        // The end of the analyzed epochs of each chunk. It is only smaller than the end of the chunk if termination was requested.
+        std::vector<uint64_t> chunkAnalyzedEnds(numberOfChunks);
+        auto analyzeChunk = [&](uint64_t chunk) {
+            auto& data = chunkModels[chunk];
+            uint64_t const chunkEnd = std::min<uint64_t>((chunk + 1) * chunkSize, level.size());
+            uint64_t epochIndex = chunk * chunkSize;
+            for (; epochIndex < chunkEnd && !storm::utility::resources::isTerminate(); ++epochIndex) {
+                chunkBuildWatches[chunk].start();
+                Epoch const& epoch = level[epochIndex];
+                EpochClass epochClass = epochManager.getEpochClass(epoch);
+                if (!chunkClasses[chunk] || chunkClasses[chunk].get() != epochClass) {
+                    data = *classModels.at(epochClass);
+                    data.epochModel.epochMatrixChanged = true;
+                    chunkClasses[chunk] = epochClass;
+                } else {
+                    data.epochModel.epochMatrixChanged = false;
+                }
+                setStepSolutions(epoch, data);
+                chunkBuildWatches[chunk].stop();
+                chunkCheckWatches[chunk].start();
+                levelSolutions[epochIndex] = analyzeEpochModel(chunk, data.epochModel);
+                chunkCheckWatches[chunk].stop();
+                STORM_LOG_ASSERT(levelSolutions[epochIndex].size() == data.epochModel.epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
+            }
+            chunkAnalyzedEnds[chunk] = epochIndex;
+        };
+        if (numberOfChunks > 1) {
+            storm::utility::ThreadPool::getGlobalPool().parallelFor(0, numberOfChunks, analyzeChunk, numberOfChunks);
+        } else {
+            analyzeChunk(0);
+        }
+
+        // The solutions are only stored once the whole level is analyzed as storing a solution might erase solutions of successor epochs.
+        for (uint64_t epochIndex = 0; epochIndex < level.size(); ++epochIndex) {
+            if (epochIndex >= chunkAnalyzedEnds[epochIndex / chunkSize]) {
+                continue;
+            }
+            Epoch const& epoch = level[epochIndex];
+            setSolutionForEpoch(epoch, classModels.at(epochManager.getEpochClass(epoch))->productStateToEpochModelInStateMap,
+                                std::move(levelSolutions[epochIndex]));
+            if (epochAnalyzed) {
+                epochAnalyzed(epoch);
+            }
+        }
+        if (storm::utility::resources::isTerminate()) {
+            break;
+        }
+    }
+
+    for (uint64_t chunk = 0; chunk < numberOfThreads; ++chunk) {
+        if (buildWatch) {
+            buildWatch->add(chunkBuildWatches[chunk]);
+        }
+        if (checkWatch) {
+            checkWatch->add(chunkCheckWatches[chunk]);
+        }
+    }
+}
+
 template<typename ValueType, bool SingleObjectiveMode>
 EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpoch(Epoch const& epoch) {
     STORM_LOG_DEBUG("Setting model for epoch " << epochManager.toString(epoch));
+    auto& epochModel = epochModelData.epochModel;
 
     // Check if we need to update the current epoch class
     if (!currentEpoch || !epochManager.compareEpochClass(epoch, currentEpoch.get())) {
-        setCurrentEpochClass(epoch);
+        buildEpochClassModel(epoch, epochModelData);
         epochModel.epochMatrixChanged = true;
-        if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
-            if (storm::utility::graph::hasCycle(epochModel.epochMatrix)) {
-                std::cout << "Epoch model for epoch " << epochManager.toString(epoch) << " is cyclic.\n";
-            }
-        }
     } else {
         epochModel.epochMatrixChanged = false;
     }
 
+    setStepSolutions(epoch, epochModelData);
+
+    currentEpoch = epoch;
+    /*
+    std::cout << "Epoch model for epoch " << storm::utility::vector::toString(epoch) << '\n';
+    std::cout << "Matrix: \n" << epochModel.epochMatrix << '\n';
+    std::cout << "ObjectiveRewards: " << storm::utility::vector::toString(epochModel.objectiveRewards[0]) << '\n';
+    std::cout << "steps: " << epochModel.stepChoices << '\n';
+    std::cout << "step solutions: ";
+    for (int i = 0; i < epochModel.stepSolutions.size(); ++i) {
+        std::cout << "   " << epochModel.stepSolutions[i].weightedValue;
+    }
+    std::cout << '\n';
+    */
+    return epochModel;
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setStepSolutions(Epoch const& epoch, EpochModelData& data) const {
+    auto& epochModel = data.epochModel;
     bool containsLowerBoundedObjective = false;
     for (auto const& dimension : dimensions) {
         if (dimension.boundType == DimensionBoundType::LowerBound) {
@@ -433,7 +579,7 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
     epochModel.stepSolutions.resize(epochModel.stepChoices.getNumberOfSetBits());
     auto stepSolIt = epochModel.stepSolutions.begin();
     for (auto reducedChoice : epochModel.stepChoices) {
-        uint64_t productChoice = epochModelToProductChoiceMap[reducedChoice];
+        uint64_t productChoice = data.epochModelToProductChoiceMap[reducedChoice];
         uint64_t productState = productModel->getProductStateFromChoice(productChoice);
         auto const& memoryState = productModel->getMemoryState(productState);
         Epoch successorEpoch = epochManager.getSuccessorEpoch(epoch, productModel->getSteps()[productChoice]);
@@ -494,24 +640,12 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
     assert(epochModel.objectiveRewards.front().size() == epochModel.objectiveRewardFilter.front().size());
     assert(epochModel.objectiveRewards.back().size() == epochModel.objectiveRewardFilter.back().size());
     assert(epochModel.stepChoices.getNumberOfSetBits() == epochModel.stepSolutions.size());
-
-    currentEpoch = epoch;
-    /*
-    std::cout << "Epoch model for epoch " << storm::utility::vector::toString(epoch) << '\n';
-    std::cout << "Matrix: \n" << epochModel.epochMatrix << '\n';
-    std::cout << "ObjectiveRewards: " << storm::utility::vector::toString(epochModel.objectiveRewards[0]) << '\n';
-    std::cout << "steps: " << epochModel.stepChoices << '\n';
-    std::cout << "step solutions: ";
-    for (int i = 0; i < epochModel.stepSolutions.size(); ++i) {
-        std::cout << "   " << epochModel.stepSolutions[i].weightedValue;
-    }
-    std::cout << '\n';
-    */
-    return epochModel;
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
-void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpochClass(Epoch const& epoch) {
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::buildEpochClassModel(Epoch const& epoch, EpochModelData& data) const {
+    auto& epochModel = data.epochModel;
+    auto& epochModelToProductChoiceMap = data.epochModelToProductChoiceMap;
     EpochClass epochClass = epochManager.getEpochClass(epoch);
     // std::cout << "Setting epoch class for epoch " << epochManager.toString(epoch) << '\n';
     auto productObjectiveRewards = productModel->computeObjectiveRewards(epochClass, objectives);
@@ -655,20 +789,26 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrent
     for (auto productState : productInStates) {
         toEpochModelInStatesMap[productState] = epochModelStateToInStateMap[productToEpochModelStateMapping[productState]];
     }
-    productStateToEpochModelInStateMap = std::make_shared<std::vector<uint64_t> const>(std::move(toEpochModelInStatesMap));
+    data.productStateToEpochModelInStateMap = std::make_shared<std::vector<uint64_t> const>(std::move(toEpochModelInStatesMap));
 
     epochModel.objectiveRewardFilter.clear();
     for (auto const& objRewards : epochModel.objectiveRewards) {
         epochModel.objectiveRewardFilter.push_back(storm::utility::vector::filterZero(objRewards));
         epochModel.objectiveRewardFilter.back().complement();
     }
+
+    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+        if (storm::utility::graph::hasCycle(epochModel.epochMatrix)) {
+            std::cout << "Epoch model for epoch " << epochManager.toString(epoch) << " is cyclic.\n";
+        }
+    }
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
 void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setEquationSystemFormatForEpochModel(
     storm::solver::LinearEquationSolverProblemFormat eqSysFormat) {
     STORM_LOG_ASSERT(model.isOfType(storm::models::ModelType::Dtmc), "Trying to set the equation problem format although the model is not deterministic.");
-    epochModel.equationSolverProblemFormat = eqSysFormat;
+    epochModelData.epochModel.equationSolverProblemFormat = eqSysFormat;
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
@@ -860,15 +1000,20 @@ boost::optional<ValueType> MultiDimensionalRewardUnfolding<ValueType, SingleObje
 template<typename ValueType, bool SingleObjectiveMode>
 void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionForCurrentEpoch(std::vector<SolutionType>&& inStateSolutions) {
     STORM_LOG_ASSERT(currentEpoch, "Tried to set a solution for the current epoch, but no epoch was specified before.");
-    STORM_LOG_ASSERT(inStateSolutions.size() == epochModel.epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
+    STORM_LOG_ASSERT(inStateSolutions.size() == epochModelData.epochModel.epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
+    setSolutionForEpoch(currentEpoch.get(), epochModelData.productStateToEpochModelInStateMap, std::move(inStateSolutions));
+}
 
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionForEpoch(
+    Epoch const& epoch, std::shared_ptr<std::vector<uint64_t> const> const& productStateToSolutionVectorMap, std::vector<SolutionType>&& inStateSolutions) {
     std::set<Epoch> predecessorEpochs, successorEpochs;
     for (auto const& step : possibleEpochSteps) {
-        epochManager.gatherPredecessorEpochs(predecessorEpochs, currentEpoch.get(), step);
-        successorEpochs.insert(epochManager.getSuccessorEpoch(currentEpoch.get(), step));
+        epochManager.gatherPredecessorEpochs(predecessorEpochs, epoch, step);
+        successorEpochs.insert(epochManager.getSuccessorEpoch(epoch, step));
     }
-    predecessorEpochs.erase(currentEpoch.get());
-    successorEpochs.erase(currentEpoch.get());
+    predecessorEpochs.erase(epoch);
+    successorEpochs.erase(epoch);
 
     // clean up solutions that are not needed anymore
     for (auto const& successorEpoch : successorEpochs) {
@@ -883,9 +1028,9 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutio
     // add the new solution
     EpochSolution solution;
     solution.count = predecessorEpochs.size();
-    solution.productStateToSolutionVectorMap = productStateToEpochModelInStateMap;
+    solution.productStateToSolutionVectorMap = productStateToSolutionVectorMap;
     solution.solutions = std::move(inStateSolutions);
-    epochSolutions[currentEpoch.get()] = std::move(solution);
+    epochSolutions[epoch] = std::move(solution);
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
@@ -898,7 +1043,8 @@ MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolutio
 
 template<typename ValueType, bool SingleObjectiveMode>
 typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::EpochSolution const&
-MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch) {
+MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions,
+                                                                                  Epoch const& epoch) const {
     auto epochSolutionIt = solutions.find(epoch);
     STORM_LOG_ASSERT(epochSolutionIt != solutions.end(), "Requested unexisting solution for epoch " << epochManager.toString(epoch) << ".");
     return *epochSolutionIt->second;
@@ -906,7 +1052,8 @@ MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochSolutio
 
 template<typename ValueType, bool SingleObjectiveMode>
 typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::SolutionType const&
-MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState) {
+MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolution(EpochSolution const& epochSolution,
+                                                                                  uint64_t const& productState) const {
     STORM_LOG_ASSERT(productState < epochSolution.productStateToSolutionVectorMap->size(), "Requested solution at an unexisting product state.");
     STORM_LOG_ASSERT((*epochSolution.productStateToSolutionVectorMap)[productState] < epochSolution.solutions.size(),
                      "Requested solution for epoch at product state " << productState << " for which no solution was stored.");
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <functional>
 
 #include "storm/modelchecker/multiobjective/Objective.h"
 #include "storm/modelchecker/prctl/helper/rewardbounded/Dimension.h"
@@ -62,6 +63,35 @@ class MultiDimensionalRewardUnfolding {
      */
     std::vector<Epoch> getEpochComputationOrder(Epoch const& startEpoch, bool stopAtComputedEpochs = false);
 
+    /*!
+     * Partitions the given sequence of epochs (as computed by getEpochComputationOrder) into levels.
+     * An epoch only depends on epochs of previous levels (or on epochs that are not part of the sequence), i.e.,
+     * the epochs of one level can be analyzed independently of each other. The order of the given sequence is preserved within each level.
+     */
+    std::vector<std::vector<Epoch>> getEpochComputationLevels(std::vector<Epoch> const& epochOrder) const;
+
+    /*!
+     * Analyzes the given sequence of epochs (as computed by getEpochComputationOrder) and stores the obtained solutions.
+     * The epochs are processed level by level (see getEpochComputationLevels). The epochs of a level are split into (at most) one chunk per thread
+     * and the chunks are analyzed concurrently. Each chunk has its own epoch model, which is only replaced if the epoch class changes.
+     * The parts of the epoch models that only depend on the epoch class are computed once per class and shared among the chunks.
+     * The current epoch (see setCurrentEpoch) is not affected.
+     *
+     * @param epochOrder the epochs to analyze
+     * @param numberOfThreads the number of threads (and chunks)
+     * @param analyzeEpochModel solves the given epoch model and returns the solutions for its in-states. The first argument is the index of the chunk.
+     * Calls for the same chunk index are never made concurrently, i.e., solvers and auxiliary data can be kept per chunk.
+     * @param epochAnalyzed if given, it is called (sequentially) after the solution of the given epoch has been stored.
+     * @param buildWatch if given, the time spent for building epoch models is added to this watch (summed over all threads).
+     * @param checkWatch if given, the time spent in analyzeEpochModel is added to this watch (summed over all threads).
+     *
+     * If termination is requested, the analysis stops after the current epoch of each chunk. Only the solutions of analyzed epochs are stored.
+     */
+    void analyzeEpochs(std::vector<Epoch> const& epochOrder, uint64_t numberOfThreads,
+                       std::function<std::vector<SolutionType>(uint64_t, EpochModel<ValueType, SingleObjectiveMode>&)> const& analyzeEpochModel,
+                       std::function<void(Epoch const&)> const& epochAnalyzed = {}, storm::utility::Stopwatch* buildWatch = nullptr,
+                       storm::utility::Stopwatch* checkWatch = nullptr);
+
     EpochModel<ValueType, SingleObjectiveMode>& setCurrentEpoch(Epoch const& epoch);
 
     void setEquationSystemFormatForEpochModel(storm::solver::LinearEquationSolverProblemFormat eqSysFormat);
@@ -85,7 +115,27 @@ class MultiDimensionalRewardUnfolding {
     Dimension<ValueType> const& getDimension(uint64_t dim) const;
 
    private:
-    void setCurrentEpochClass(Epoch const& epoch);
+    // An epoch model together with the mappings between the epoch model and the product model. The mappings only depend on the epoch class.
+    struct EpochModelData {
+        EpochModel<ValueType, SingleObjectiveMode> epochModel;
+        std::vector<uint64_t> epochModelToProductChoiceMap;
+        std::shared_ptr<std::vector<uint64_t> const> productStateToEpochModelInStateMap;
+    };
+
+    /*!
+     * Builds the parts of the epoch model that only depend on the class of the given epoch.
+     */
+    void buildEpochClassModel(Epoch const& epoch, EpochModelData& data) const;
+
+    /*!
+     * Sets the step solutions (and the objective reward filter) of the given epoch model, which needs to be built for the class of the given epoch.
+     * Only reads the solutions of the successor epochs, which need to be present.
+     */
+    void setStepSolutions(Epoch const& epoch, EpochModelData& data) const;
+
+    void setSolutionForEpoch(Epoch const& epoch, std::shared_ptr<std::vector<uint64_t> const> const& productStateToSolutionVectorMap,
+                             std::vector<SolutionType>&& inStateSolutions);
+
     void initialize(std::set<storm::expressions::Variable> const& infinityBoundVariables = {});
 
     void initializeObjectives(std::vector<Epoch>& epochSteps, std::set<storm::expressions::Variable> const& infinityBoundVariables);
@@ -121,19 +171,17 @@ class MultiDimensionalRewardUnfolding {
         std::vector<SolutionType> solutions;
     };
     std::map<Epoch, EpochSolution> epochSolutions;
-    EpochSolution const& getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch);
-    SolutionType const& getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState);
+    EpochSolution const& getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch) const;
+    SolutionType const& getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState) const;
 
     storm::models::sparse::Model<ValueType> const& model;
     std::vector<storm::modelchecker::multiobjective::Objective<ValueType>> objectives;
 
     std::unique_ptr<ProductModel<ValueType>> productModel;
 
-    std::vector<uint64_t> epochModelToProductChoiceMap;
-    std::shared_ptr<std::vector<uint64_t> const> productStateToEpochModelInStateMap;
     std::set<Epoch> possibleEpochSteps;
 
-    EpochModel<ValueType, SingleObjectiveMode> epochModel;
+    EpochModelData epochModelData;
     boost::optional<Epoch> currentEpoch;
 
     EpochManager epochManager;
@@ -484,6 +484,73 @@ typename std::enable_if<std::is_same<ValueType, NewValueType>::value, std::share
     return nullptr;
 }
 
+template<storm::dd::DdType Type, typename ValueType>
+void Model<Type, ValueType>::setExplicitRepresentationCacheCapacity(uint64_t capacity) {
+    explicitRepresentationCacheCapacity = capacity;
+    shrinkExplicitRepresentationCache();
+}
+
+template<storm::dd::DdType Type, typename ValueType>
+std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> Model<Type, ValueType>::toExplicitMatrix(
+    storm::dd::Add<Type, ValueType> const& matrix, storm::dd::Bdd<Type> const& states, storm::dd::Odd const& odd,
+    std::set<storm::expressions::Variable> const& groupMetaVariables, uint64_t numberOfThreads) const {
+    return getExplicitRepresentation(matrix, boost::none, states, odd, groupMetaVariables, numberOfThreads).first;
+}
+
+template<storm::dd::DdType Type, typename ValueType>
+std::pair<std::shared_ptr<storm::storage::SparseMatrix<ValueType> const>, std::shared_ptr<std::vector<ValueType> const>>
+Model<Type, ValueType>::toExplicitMatrixVector(storm::dd::Add<Type, ValueType> const& matrix, storm::dd::Add<Type, ValueType> const& vector,
+                                               storm::dd::Bdd<Type> const& states, storm::dd::Odd const& odd,
+                                               std::set<storm::expressions::Variable> const& groupMetaVariables, uint64_t numberOfThreads) const {
+    return getExplicitRepresentation(matrix, vector, states, odd, groupMetaVariables, numberOfThreads);
+}
+
+template<storm::dd::DdType Type, typename ValueType>
+std::pair<std::shared_ptr<storm::storage::SparseMatrix<ValueType> const>, std::shared_ptr<std::vector<ValueType> const>>
+Model<Type, ValueType>::getExplicitRepresentation(storm::dd::Add<Type, ValueType> const& matrix, boost::optional<storm::dd::Add<Type, ValueType>> const& vector,
+                                                  storm::dd::Bdd<Type> const& states, storm::dd::Odd const& odd,
+                                                  std::set<storm::expressions::Variable> const& groupMetaVariables, uint64_t numberOfThreads) const {
+    for (auto it = explicitRepresentationCache.begin(); it != explicitRepresentationCache.end(); ++it) {
+        if (it->matrix == matrix && it->vector == vector && it->states == states && it->groupMetaVariables == groupMetaVariables) {
+            STORM_LOG_TRACE("Reusing cached explicit representation of symbolic matrix.");
+            explicitRepresentationCache.splice(explicitRepresentationCache.begin(), explicitRepresentationCache, it);
+            return std::make_pair(it->explicitMatrix, it->explicitVector);
+        }
+    }
+
+    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitMatrix;
+    std::shared_ptr<std::vector<ValueType> const> explicitVector;
+    if (groupMetaVariables.empty()) {
+        explicitMatrix = std::make_shared<storm::storage::SparseMatrix<ValueType> const>(matrix.toMatrix(odd, odd, numberOfThreads));
+        if (vector) {
+            explicitVector = std::make_shared<std::vector<ValueType> const>(vector->toVector(odd));
+        }
+    } else if (vector) {
+        auto matrixVector = matrix.toMatrixVector(vector.get(), groupMetaVariables, odd, odd, numberOfThreads);
+        explicitMatrix = std::make_shared<storm::storage::SparseMatrix<ValueType> const>(std::move(matrixVector.first));
+        explicitVector = std::make_shared<std::vector<ValueType> const>(std::move(matrixVector.second));
+    } else {
+        explicitMatrix = std::make_shared<storm::storage::SparseMatrix<ValueType> const>(matrix.toMatrix(groupMetaVariables, odd, odd, numberOfThreads));
+    }
+
+    uint64_t size = explicitMatrix->getEntryCount() + (explicitVector ? explicitVector->size() : 0);
+    if (size <= explicitRepresentationCacheCapacity) {
+        explicitRepresentationCache.push_front(ExplicitRepresentationCacheEntry{matrix, vector, states, groupMetaVariables, explicitMatrix, explicitVector});
+        explicitRepresentationCacheSize += size;
+        shrinkExplicitRepresentationCache();
+    }
+    return std::make_pair(std::move(explicitMatrix), std::move(explicitVector));
+}
+
+template<storm::dd::DdType Type, typename ValueType>
+void Model<Type, ValueType>::shrinkExplicitRepresentationCache() const {
+    while (explicitRepresentationCacheSize > explicitRepresentationCacheCapacity) {
+        auto const& entry = explicitRepresentationCache.back();
+        explicitRepresentationCacheSize -= entry.explicitMatrix->getEntryCount() + (entry.explicitVector ? entry.explicitVector->size() : 0);
+        explicitRepresentationCache.pop_back();
+    }
+}
+
 // Explicitly instantiate the template class.
 template class Model<storm::dd::DdType::CUDD, double>;
 template class Model<storm::dd::DdType::Sylvan, double>;
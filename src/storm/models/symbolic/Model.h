@@ -1,6 +1,8 @@
 #ifndef STORM_MODELS_SYMBOLIC_MODEL_H_
 #define STORM_MODELS_SYMBOLIC_MODEL_H_
 
+#include <boost/optional.hpp>
+#include <list>
 #include <memory>
 #include <set>
 #include <unordered_map>
@@ -193,6 +195,47 @@ class Model : public storm::models::Model<CValueType> {
      */
     storm::dd::Add<Type, ValueType>& getTransitionMatrix();
 
+    /*!
+     * Enables caching the conversions performed by toExplicitMatrix and toExplicitMatrixVector. This pays off if several properties are
+     * checked that lead to the same symbolic matrix (e.g. with the same set of maybe states). By default, nothing is cached.
+     *
+     * @param capacity The maximal number of matrix and vector entries that are kept in the cache. The least recently used conversions
+     * are dropped once the capacity is exceeded. Zero disables the cache.
+     */
+    void setExplicitRepresentationCacheCapacity(uint64_t capacity);
+
+    /*!
+     * Converts the given symbolic matrix to an explicit matrix whose rows and columns are numbered according to the given ODD.
+     * If enabled (see setExplicitRepresentationCacheCapacity), the conversion is cached in the model.
+     *
+     * @param matrix The matrix to convert.
+     * @param states The states for which the ODD was created. Together with the matrix, they identify the conversion in the cache.
+     * @param odd The ODD of the given states.
+     * @param groupMetaVariables If not empty, the meta variables that are used to distinguish different rows of a row group.
+     * @param numberOfThreads The maximal number of threads used for the conversion.
+     * @return The explicit matrix, which is shared with the cache.
+     */
+    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> toExplicitMatrix(
+        storm::dd::Add<Type, ValueType> const& matrix, storm::dd::Bdd<Type> const& states, storm::dd::Odd const& odd,
+        std::set<storm::expressions::Variable> const& groupMetaVariables = std::set<storm::expressions::Variable>(), uint64_t numberOfThreads = 1) const;
+
+    /*!
+     * Converts the given symbolic matrix and vector to an explicit matrix and vector whose rows (and columns) are numbered
+     * according to the given ODD. Conversions are cached as for toExplicitMatrix.
+     *
+     * @param matrix The matrix to convert.
+     * @param vector The vector to convert.
+     * @param states The states for which the ODD was created.
+     * @param odd The ODD of the given states.
+     * @param groupMetaVariables If not empty, the meta variables that are used to distinguish different rows of a row group.
+     * @param numberOfThreads The maximal number of threads used for the conversion.
+     * @return The explicit matrix and vector, which are shared with the cache.
+     */
+    std::pair<std::shared_ptr<storm::storage::SparseMatrix<ValueType> const>, std::shared_ptr<std::vector<ValueType> const>> toExplicitMatrixVector(
+        storm::dd::Add<Type, ValueType> const& matrix, storm::dd::Add<Type, ValueType> const& vector, storm::dd::Bdd<Type> const& states,
+        storm::dd::Odd const& odd, std::set<storm::expressions::Variable> const& groupMetaVariables = std::set<storm::expressions::Variable>(),
+        uint64_t numberOfThreads = 1) const;
+
     /*!
      * Retrieves the matrix qualitatively (i.e. without probabilities) representing the transitions of the
      * model.
@@ -436,6 +479,38 @@ class Model : public storm::models::Model<CValueType> {
 
     // An empty variable set that can be used when references to non-existing sets need to be returned.
     std::set<storm::expressions::Variable> emptyVariableSet;
+
+    // A cached conversion of a symbolic matrix (and vector) to its explicit representation.
+    struct ExplicitRepresentationCacheEntry {
+        storm::dd::Add<Type, ValueType> matrix;
+        boost::optional<storm::dd::Add<Type, ValueType>> vector;
+        storm::dd::Bdd<Type> states;
+        std::set<storm::expressions::Variable> groupMetaVariables;
+
+        std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitMatrix;
+        std::shared_ptr<std::vector<ValueType> const> explicitVector;
+    };
+
+    /*!
+     * Retrieves the explicit representation of the given matrix (and vector), performing the conversion if it is not cached.
+     */
+    std::pair<std::shared_ptr<storm::storage::SparseMatrix<ValueType> const>, std::shared_ptr<std::vector<ValueType> const>> getExplicitRepresentation(
+        storm::dd::Add<Type, ValueType> const& matrix, boost::optional<storm::dd::Add<Type, ValueType>> const& vector, storm::dd::Bdd<Type> const& states,
+        storm::dd::Odd const& odd, std::set<storm::expressions::Variable> const& groupMetaVariables, uint64_t numberOfThreads) const;
+
+    /*!
+     * Drops the least recently used conversions until the cache does not exceed its capacity.
+     */
+    void shrinkExplicitRepresentationCache() const;
+
+    // The maximal number of matrix and vector entries kept in the cache of explicit representations.
+    uint64_t explicitRepresentationCacheCapacity = 0;
+
+    // The number of matrix and vector entries currently kept in the cache of explicit representations.
+    mutable uint64_t explicitRepresentationCacheSize = 0;
+
+    // The most recent conversions to explicit representations (most recently used first).
+    mutable std::list<ExplicitRepresentationCacheEntry> explicitRepresentationCache;
 };
 
 }  // namespace symbolic
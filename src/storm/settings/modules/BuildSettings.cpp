@@ -39,6 +39,7 @@ const std::string buildOverlappingGuardsLabelOptionName = "build-overlapping-gua
 const std::string noSimplifyOptionName = "no-simplify";
 const std::string bitsForUnboundedVariablesOptionName = "int-bits";
 const std::string performLocationElimination = "location-elimination";
+const std::string explorationThreadsOptionName = "explthreads";
 
 BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, prismCompatibilityOptionName, false,
@@ -101,6 +102,14 @@ BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueUnsignedInteger(32)
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, explorationThreadsOptionName, false,
+                                                   "Sets the number of threads used for the explicit exploration of the state space (only for bfs).")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "The number of threads.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, performLocationElimination, false,
                                                    "If set, location elimination will be performed before the model is built.")
                         .setIsAdvanced()
@@ -195,6 +204,10 @@ uint64_t BuildSettings::getBitsForUnboundedVariables() const {
     return this->getOption(bitsForUnboundedVariablesOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
 }
 
+uint64_t BuildSettings::getNumberOfExplorationThreads() const {
+    return this->getOption(explorationThreadsOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
+}
+
 bool BuildSettings::isLocationEliminationSet() const {
     return this->getOption(performLocationElimination).getHasOptionBeenSet();
 }
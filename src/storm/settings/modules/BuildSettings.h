@@ -119,6 +119,11 @@ class BuildSettings : public ModuleSettings {
      */
     uint64_t getBitsForUnboundedVariables() const;
 
+    /*!
+     * Retrieves the number of threads that are used for the explicit state-space exploration.
+     */
+    uint64_t getNumberOfExplorationThreads() const;
+
     /*!
      * Retrieves whether simplification of symbolic inputs through static analysis shall be disabled
      */
@@ -8,11 +8,11 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/solver/SolverSelectionOptions.h"
 
-#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/storage/dd/DdType.h"
 
 #include "storm/exceptions/IllegalArgumentValueException.h"
 #include "storm/exceptions/InvalidOptionException.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -29,6 +29,7 @@ const std::string CoreSettings::engineOptionName = "engine";
 const std::string CoreSettings::engineOptionShortName = "e";
 const std::string CoreSettings::ddLibraryOptionName = "ddlib";
 const std::string CoreSettings::cudaOptionName = "cuda";
+const std::string CoreSettings::numberOfThreadsOptionName = "threads";
 const std::string CoreSettings::intelTbbOptionName = "enable-tbb";
 const std::string CoreSettings::intelTbbOptionShortName = "tbb";
 
@@ -84,10 +85,19 @@ CoreSettings::CoreSettings() : ModuleSettings(moduleName), engine(storm::utility
                         .build());
 
     this->addOption(storm::settings::OptionBuilder(moduleName, cudaOptionName, false, "Sets whether to use CUDA.").setIsAdvanced().build());
-    this->addOption(
-        storm::settings::OptionBuilder(moduleName, intelTbbOptionName, false, "Sets whether to use Intel TBB (if Storm was built with support for TBB).")
-            .setShortName(intelTbbOptionShortName)
-            .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, numberOfThreadsOptionName, false,
+                                                   "Sets the number of threads used for parallel computations (e.g. matrix-vector multiplication).")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of threads. If zero, the number of available hardware threads is used.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, intelTbbOptionName, false,
+                                                   "Sets whether to use all available hardware threads for parallel computations. Deprecated, use --" +
+                                                       numberOfThreadsOptionName + " instead.")
+                        .setShortName(intelTbbOptionShortName)
+                        .setIsAdvanced()
+                        .build());
 }
 
 storm::solver::EquationSolverType CoreSettings::getEquationSolver() const {
@@ -162,8 +172,12 @@ bool CoreSettings::isShowStatisticsSet() const {
     return this->getOption(statisticsOptionName).getHasOptionBeenSet();
 }
 
-bool CoreSettings::isUseIntelTbbSet() const {
-    return this->getOption(intelTbbOptionName).getHasOptionBeenSet();
+uint64_t CoreSettings::getNumberOfThreads() const {
+    uint64_t numberOfThreads = this->getOption(numberOfThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+    if (!this->getOption(numberOfThreadsOptionName).getHasOptionBeenSet() && this->getOption(intelTbbOptionName).getHasOptionBeenSet()) {
+        numberOfThreads = 0;
+    }
+    return storm::utility::getNumberOfThreads(numberOfThreads);
 }
 
 bool CoreSettings::isUseCudaSet() const {
@@ -186,12 +200,9 @@ void CoreSettings::finalize() {
 }
 
 bool CoreSettings::check() const {
-#ifdef STORM_HAVE_INTELTBB
-    return true;
-#else
-    STORM_LOG_WARN_COND(!isUseIntelTbbSet(), "Enabling TBB is not supported in this version of Storm as it was not built with support for it.");
+    STORM_LOG_WARN_COND(!this->getOption(intelTbbOptionName).getHasOptionBeenSet(),
+                        "The option --" << intelTbbOptionName << " is deprecated, use --" << numberOfThreadsOptionName << " instead.");
     return true;
-#endif
 }
 
 }  // namespace modules
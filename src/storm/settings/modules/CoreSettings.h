@@ -96,11 +96,11 @@ class CoreSettings : public ModuleSettings {
     bool isShowStatisticsSet() const;
 
     /*!
-     * Retrieves whether the option to use Intel TBB is set.
+     * Retrieves the number of threads that are to be used for parallel computations.
      *
-     * @return True iff the option was set.
+     * @return The number of threads (at least one).
      */
-    bool isUseIntelTbbSet() const;
+    uint64_t getNumberOfThreads() const;
 
     /*!
      * Retrieves whether the option to use CUDA is set.
@@ -139,6 +139,7 @@ class CoreSettings : public ModuleSettings {
     static const std::string engineOptionName;
     static const std::string engineOptionShortName;
     static const std::string ddLibraryOptionName;
+    static const std::string numberOfThreadsOptionName;
     static const std::string intelTbbOptionName;
     static const std::string intelTbbOptionShortName;
     static const std::string cudaOptionName;
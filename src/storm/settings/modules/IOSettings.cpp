@@ -31,6 +31,7 @@ const std::string IOSettings::explicitOptionName = "explicit";
 const std::string IOSettings::explicitOptionShortName = "exp";
 const std::string IOSettings::explicitDrnOptionName = "explicit-drn";
 const std::string IOSettings::explicitDrnOptionShortName = "drn";
+const std::string IOSettings::explicitBinaryOptionName = "explicit-binary";
 const std::string IOSettings::explicitImcaOptionName = "explicit-imca";
 const std::string IOSettings::explicitImcaOptionShortName = "imca";
 const std::string IOSettings::prismInputOptionName = "prism";
@@ -54,6 +55,7 @@ const std::string IOSettings::qvbsInputOptionName = "qvbs";
 const std::string IOSettings::qvbsInputOptionShortName = "qvbs";
 const std::string IOSettings::qvbsRootOptionName = "qvbsroot";
 const std::string IOSettings::propertiesAsMultiOptionName = "propsasmulti";
+const std::string IOSettings::serverOptionName = "server";
 
 std::string preventDRNPlaceholderOptionName = "no-drn-placeholders";
 
@@ -74,7 +76,7 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueUnsignedInteger(0)
                                          .build())
                         .build());
-    std::vector<std::string> exportFormats({"auto", "dot", "drdd", "drn", "json"});
+    std::vector<std::string> exportFormats({"auto", "dot", "drdd", "drn", "json", "smb"});
     this->addOption(
         storm::settings::OptionBuilder(moduleName, exportBuildOptionName, false, "Exports the built model to a file.")
             .addArgument(storm::settings::ArgumentBuilder::createStringArgument("file", "The output file.").build())
@@ -143,6 +145,13 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                                          .addValidatorString(ArgumentValidatorFactory::createExistingFileValidator())
                                          .build())
                         .build());
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, explicitBinaryOptionName, false,
+                                       "Loads the model given in the binary format (as written by --" + exportBuildOptionName + " with format smb).")
+            .addArgument(storm::settings::ArgumentBuilder::createStringArgument("binary filename", "The name of the binary file containing the model.")
+                             .addValidatorString(ArgumentValidatorFactory::createExistingFileValidator())
+                             .build())
+            .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, explicitImcaOptionName, false, "Parses the model given in the IMCA format.")
                         .setShortName(explicitImcaOptionShortName)
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("imca filename", "The name of the imca file containing the model.")
@@ -250,6 +259,12 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                         .setIsAdvanced()
                         .build());
 
+    this->addOption(storm::settings::OptionBuilder(moduleName, serverOptionName, false,
+                                                   "If given, storm keeps models in memory and checks properties upon requests received via the given socket.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("socket", "The path of the (UNIX domain) socket.").build())
+                        .build());
+
 #ifdef STORM_HAVE_QVBS
     std::string qvbsRootDefault = STORM_QVBS_ROOT;
 #else
@@ -366,6 +381,14 @@ std::string IOSettings::getExplicitDRNFilename() const {
     return this->getOption(explicitDrnOptionName).getArgumentByName("drn filename").getValueAsString();
 }
 
+bool IOSettings::isExplicitBinarySet() const {
+    return this->getOption(explicitBinaryOptionName).getHasOptionBeenSet();
+}
+
+std::string IOSettings::getExplicitBinaryFilename() const {
+    return this->getOption(explicitBinaryOptionName).getArgumentByName("binary filename").getValueAsString();
+}
+
 bool IOSettings::isExplicitIMCASet() const {
     return this->getOption(explicitImcaOptionName).getHasOptionBeenSet();
 }
@@ -501,6 +524,14 @@ bool IOSettings::isPropertiesAsMultiSet() const {
     return this->getOption(propertiesAsMultiOptionName).getHasOptionBeenSet();
 }
 
+bool IOSettings::isServerSet() const {
+    return this->getOption(serverOptionName).getHasOptionBeenSet();
+}
+
+std::string IOSettings::getServerSocket() const {
+    return this->getOption(serverOptionName).getArgumentByName("socket").getValueAsString();
+}
+
 void IOSettings::finalize() {
     STORM_LOG_WARN_COND(!isExportDdSet(), "Option '--" << moduleName << ":" << exportDdOptionName << "' is depreciated. Use '--" << moduleName << ":"
                                                        << exportBuildOptionName << "' instead.");
@@ -522,6 +553,7 @@ bool IOSettings::check() const {
     // Ensure that not two explicit input models were given.
     uint64_t numExplicitInputs = isExplicitSet() ? 1 : 0;
     numExplicitInputs += isExplicitDRNSet() ? 1 : 0;
+    numExplicitInputs += isExplicitBinarySet() ? 1 : 0;
     numExplicitInputs += isExplicitIMCASet() ? 1 : 0;
     STORM_LOG_THROW(numExplicitInputs <= 1, storm::exceptions::InvalidSettingsException, "Multiple explicit input models");
 
@@ -5,6 +5,7 @@
 #include "storm/settings/OptionBuilder.h"
 
 #include "storm/exceptions/IllegalArgumentValueException.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -19,6 +20,7 @@ const std::string LongRunAverageSolverSettings::maximalIterationsOptionShortName
 const std::string LongRunAverageSolverSettings::precisionOptionName = "precision";
 const std::string LongRunAverageSolverSettings::absoluteOptionName = "absolute";
 const std::string LongRunAverageSolverSettings::aperiodicFactorOptionName = "aperiodicfactor";
+const std::string LongRunAverageSolverSettings::numberOfThreadsOptionName = "threads";
 
 LongRunAverageSolverSettings::LongRunAverageSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> detLraMethods = {"gb", "gain-bias-equations", "distr", "lra-distribution-equations", "vi", "value-iteration"};
@@ -69,6 +71,16 @@ LongRunAverageSolverSettings::LongRunAverageSolverSettings() : ModuleSettings(mo
                                          .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
                                          .build())
                         .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, numberOfThreadsOptionName, true,
+                                                   "Sets the number of threads used to compute the long run averages of different end components concurrently. "
+                                                   "If not set, the number of threads of the core settings is used.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of threads. If zero, the number of available hardware threads is used.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
 }
 
 storm::solver::LraMethod LongRunAverageSolverSettings::getDetLraMethod() const {
@@ -131,6 +143,14 @@ double LongRunAverageSolverSettings::getAperiodicFactor() const {
     return this->getOption(aperiodicFactorOptionName).getArgumentByName("value").getValueAsDouble();
 }
 
+bool LongRunAverageSolverSettings::isNumberOfThreadsSet() const {
+    return this->getOption(numberOfThreadsOptionName).getHasOptionBeenSet();
+}
+
+uint64_t LongRunAverageSolverSettings::getNumberOfThreads() const {
+    return storm::utility::getNumberOfThreads(this->getOption(numberOfThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger());
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
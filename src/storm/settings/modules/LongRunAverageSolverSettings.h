@@ -73,6 +73,20 @@ class LongRunAverageSolverSettings : public ModuleSettings {
      */
     double getAperiodicFactor() const;
 
+    /*!
+     * Retrieves whether the number of threads used to compute the long run averages of different end components concurrently has been set.
+     *
+     * @return True iff the number of threads has been set.
+     */
+    bool isNumberOfThreadsSet() const;
+
+    /*!
+     * Retrieves the number of threads used to compute the long run averages of different end components concurrently.
+     *
+     * @return The number of threads.
+     */
+    uint64_t getNumberOfThreads() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -84,6 +98,7 @@ class LongRunAverageSolverSettings : public ModuleSettings {
     static const std::string precisionOptionName;
     static const std::string absoluteOptionName;
     static const std::string aperiodicFactorOptionName;
+    static const std::string numberOfThreadsOptionName;
 };
 
 }  // namespace modules
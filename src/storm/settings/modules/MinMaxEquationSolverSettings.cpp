@@ -5,6 +5,7 @@
 #include "storm/settings/OptionBuilder.h"
 
 #include "storm/exceptions/IllegalArgumentValueException.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -19,6 +20,7 @@ const std::string precisionOptionName = "precision";
 const std::string absoluteOptionName = "absolute";
 const std::string valueIterationMultiplicationStyleOptionName = "vimult";
 const std::string forceUniqueSolutionRequirementOptionName = "force-require-unique";
+const std::string numberOfThreadsOptionName = "threads";
 
 MinMaxEquationSolverSettings::MinMaxEquationSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> minMaxSolvingTechniques = {
@@ -69,6 +71,17 @@ MinMaxEquationSolverSettings::MinMaxEquationSolverSettings() : ModuleSettings(mo
                                                    "simplify solving but causes some overhead.")
                         .setIsAdvanced()
                         .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, numberOfThreadsOptionName, true,
+                                                   "Sets the number of threads used to process the row groups in (sound, optimistic, and interval) value "
+                                                   "iteration. Using more than one thread implies the regular multiplication style. If not set, the number "
+                                                   "of threads of the core settings is used.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of threads. If zero, the number of available hardware threads is used.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
 }
 
 storm::solver::MinMaxMethod MinMaxEquationSolverSettings::getMinMaxEquationSolvingMethod() const {
@@ -147,6 +160,14 @@ bool MinMaxEquationSolverSettings::isForceUniqueSolutionRequirementSet() const {
     return this->getOption(forceUniqueSolutionRequirementOptionName).getHasOptionBeenSet();
 }
 
+bool MinMaxEquationSolverSettings::isNumberOfThreadsSet() const {
+    return this->getOption(numberOfThreadsOptionName).getHasOptionBeenSet();
+}
+
+uint64_t MinMaxEquationSolverSettings::getNumberOfThreads() const {
+    return storm::utility::getNumberOfThreads(this->getOption(numberOfThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger());
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
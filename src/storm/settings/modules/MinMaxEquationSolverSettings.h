@@ -95,6 +95,20 @@ class MinMaxEquationSolverSettings : public ModuleSettings {
      */
     bool isForceUniqueSolutionRequirementSet() const;
 
+    /*!
+     * Retrieves whether the number of threads for value iteration has been set.
+     *
+     * @return True iff the number of threads has been set.
+     */
+    bool isNumberOfThreadsSet() const;
+
+    /*!
+     * Retrieves the number of threads used for value iteration.
+     *
+     * @return The number of threads.
+     */
+    uint64_t getNumberOfThreads() const;
+
     // The name of the module.
     static const std::string moduleName;
 };
@@ -14,6 +14,7 @@ namespace modules {
 const std::string ModelCheckerSettings::moduleName = "modelchecker";
 const std::string ModelCheckerSettings::filterRewZeroOptionName = "filterrewzero";
 const std::string ModelCheckerSettings::ltl2daToolOptionName = "ltl2datool";
+const std::string ModelCheckerSettings::batchOptionName = "batch";
 
 ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, filterRewZeroOptionName, false,
@@ -27,6 +28,11 @@ ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
                                          "filename", "A script that can be called with a prefix formula and a name for the output automaton.")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, batchOptionName, false,
+                                                   "If set, all properties are checked by the same model checker such that precomputations on the model (e.g. "
+                                                   "qualitative graph analyses on MDPs) are shared between properties.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 bool ModelCheckerSettings::isFilterRewZeroSet() const {
@@ -41,6 +47,10 @@ std::string ModelCheckerSettings::getLtl2daTool() const {
     return this->getOption(ltl2daToolOptionName).getArgumentByName("filename").getValueAsString();
 }
 
+bool ModelCheckerSettings::isBatchSet() const {
+    return this->getOption(batchOptionName).getHasOptionBeenSet();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
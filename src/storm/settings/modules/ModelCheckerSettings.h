@@ -35,6 +35,13 @@ class ModelCheckerSettings : public ModuleSettings {
      */
     std::string getLtl2daTool() const;
 
+    /*!
+     * Retrieves whether all properties are to be checked by a single model checker such that precomputations are shared.
+     *
+     * @return True iff the batch mode has been set.
+     */
+    bool isBatchSet() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -42,6 +49,7 @@ class ModelCheckerSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string filterRewZeroOptionName;
     static const std::string ltl2daToolOptionName;
+    static const std::string batchOptionName;
 };
 
 }  // namespace modules
@@ -14,6 +14,7 @@
 
 #include "storm/exceptions/IllegalArgumentValueException.h"
 #include "storm/exceptions/InvalidOptionException.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -23,6 +24,7 @@ namespace modules {
 const std::string TopologicalEquationSolverSettings::moduleName = "topological";
 const std::string TopologicalEquationSolverSettings::underlyingEquationSolverOptionName = "eqsolver";
 const std::string TopologicalEquationSolverSettings::underlyingMinMaxMethodOptionName = "minmax";
+const std::string TopologicalEquationSolverSettings::numberOfThreadsOptionName = "threads";
 
 TopologicalEquationSolverSettings::TopologicalEquationSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> linearEquationSolver = {"gmm++", "native", "eigen", "elimination"};
@@ -45,6 +47,15 @@ TopologicalEquationSolverSettings::TopologicalEquationSolverSettings() : ModuleS
                                          .setDefaultValueString("value-iteration")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, numberOfThreadsOptionName, true,
+                                                   "Sets the number of threads used to compute the SCCs and to solve SCCs of the same depth concurrently. If "
+                                                   "not set, the number of threads of the core settings is used.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of threads. If zero, the number of available hardware threads is used.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
 }
 
 bool TopologicalEquationSolverSettings::isUnderlyingEquationSolverTypeSet() const {
@@ -102,6 +113,14 @@ storm::solver::MinMaxMethod TopologicalEquationSolverSettings::getUnderlyingMinM
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown underlying equation solver '" << minMaxEquationSolvingTechnique << "'.");
 }
 
+bool TopologicalEquationSolverSettings::isNumberOfThreadsSet() const {
+    return this->getOption(numberOfThreadsOptionName).getHasOptionBeenSet();
+}
+
+uint64_t TopologicalEquationSolverSettings::getNumberOfThreads() const {
+    return storm::utility::getNumberOfThreads(this->getOption(numberOfThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger());
+}
+
 bool TopologicalEquationSolverSettings::check() const {
     if (this->isUnderlyingEquationSolverTypeSet() && getUnderlyingEquationSolverType() == storm::solver::EquationSolverType::Topological) {
         STORM_LOG_WARN("Underlying solver type of the topological solver can not be the topological solver.");
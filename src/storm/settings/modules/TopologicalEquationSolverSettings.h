@@ -60,6 +60,20 @@ class TopologicalEquationSolverSettings : public ModuleSettings {
      */
     storm::solver::MinMaxMethod getUnderlyingMinMaxMethod() const;
 
+    /*!
+     * Retrieves whether the number of threads used to solve independent SCCs concurrently has been set.
+     *
+     * @return True iff the number of threads has been set.
+     */
+    bool isNumberOfThreadsSet() const;
+
+    /*!
+     * Retrieves the number of threads used to solve independent SCCs concurrently.
+     *
+     * @return The number of threads.
+     */
+    uint64_t getNumberOfThreads() const;
+
     bool check() const override;
 
     // The name of the module.
@@ -69,6 +83,7 @@ class TopologicalEquationSolverSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string underlyingEquationSolverOptionName;
     static const std::string underlyingMinMaxMethodOptionName;
+    static const std::string numberOfThreadsOptionName;
 };
 
 }  // namespace modules
@@ -405,6 +405,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsOptimisticVal
     }
 
     setUpViOperator();
+    viOperator->setNumberOfThreads(env.solver().minMax().getNumberOfThreads());
 
     helper::OptimisticValueIterationHelper<ValueType, false> oviHelper(viOperator);
     auto prec = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
@@ -446,6 +447,7 @@ template<typename ValueType>
 bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x,
                                                                                   std::vector<ValueType> const& b) const {
     setUpViOperator();
+    viOperator->setNumberOfThreads(env.solver().minMax().getNumberOfThreads());
 
     // By default, we can not provide any guarantee
     SolverGuarantee guarantee = SolverGuarantee::None;
@@ -539,6 +541,7 @@ template<typename ValueType>
 bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsIntervalIteration(Environment const& env, OptimizationDirection dir,
                                                                                      std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
     setUpViOperator();
+    viOperator->setNumberOfThreads(env.solver().minMax().getNumberOfThreads());
     helper::IntervalIterationHelper<ValueType, false> iiHelper(viOperator);
     auto prec = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
     auto lowerBoundsCallback = [&](std::vector<ValueType>& vector) { this->createLowerBoundsVector(vector); };
@@ -587,6 +590,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsSoundValueIte
     }
 
     setUpViOperator();
+    viOperator->setNumberOfThreads(env.solver().minMax().getNumberOfThreads());
 
     auto precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
     uint64_t numIterations{0};
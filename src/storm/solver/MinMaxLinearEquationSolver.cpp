@@ -135,6 +135,11 @@ void MinMaxLinearEquationSolver<ValueType>::setInitialScheduler(std::vector<uint
     initialScheduler = std::move(choices);
 }
 
+template<typename ValueType>
+void MinMaxLinearEquationSolver<ValueType>::clearInitialScheduler() {
+    initialScheduler = boost::none;
+}
+
 template<typename ValueType>
 bool MinMaxLinearEquationSolver<ValueType>::hasInitialScheduler() const {
     return static_cast<bool>(initialScheduler);
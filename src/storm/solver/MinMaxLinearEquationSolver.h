@@ -148,6 +148,11 @@ class MinMaxLinearEquationSolver : public AbstractEquationSolver<ValueType> {
      */
     void setInitialScheduler(std::vector<uint_fast64_t>&& choices);
 
+    /*!
+     * Removes the initial scheduler (if any).
+     */
+    void clearInitialScheduler();
+
     /*!
      * Returns true iff an initial scheduler is set.
      */
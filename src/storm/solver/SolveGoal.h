@@ -101,23 +101,31 @@ class SolveGoal {
     boost::optional<storm::storage::BitVector> relevantValueVector;
 };
 
-template<typename ValueType, typename MatrixType>
-std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> configureMinMaxLinearEquationSolver(
-    Environment const& env, SolveGoal<ValueType>&& goal, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& factory, MatrixType&& matrix) {
-    std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver = factory.create(env, std::forward<MatrixType>(matrix));
-    solver->setOptimizationDirection(goal.direction());
+/*!
+ * Sets the optimization direction, the termination condition and the relevant values of the given solver according to the goal.
+ */
+template<typename ValueType>
+void configureMinMaxLinearEquationSolver(SolveGoal<ValueType>&& goal, storm::solver::MinMaxLinearEquationSolver<ValueType>& solver) {
+    solver.setOptimizationDirection(goal.direction());
     if (goal.isBounded()) {
         if (goal.boundIsALowerBound()) {
-            solver->setTerminationCondition(std::make_unique<TerminateIfFilteredExtremumExceedsThreshold<ValueType>>(
+            solver.setTerminationCondition(std::make_unique<TerminateIfFilteredExtremumExceedsThreshold<ValueType>>(
                 goal.relevantValues(), goal.boundIsStrict(), goal.thresholdValue(), true));
         } else {
-            solver->setTerminationCondition(std::make_unique<TerminateIfFilteredExtremumBelowThreshold<ValueType>>(goal.relevantValues(), goal.boundIsStrict(),
-                                                                                                                   goal.thresholdValue(), false));
+            solver.setTerminationCondition(std::make_unique<TerminateIfFilteredExtremumBelowThreshold<ValueType>>(goal.relevantValues(), goal.boundIsStrict(),
+                                                                                                                  goal.thresholdValue(), false));
         }
     }
     if (goal.hasRelevantValues()) {
-        solver->setRelevantValues(std::move(goal.relevantValues()));
+        solver.setRelevantValues(std::move(goal.relevantValues()));
     }
+}
+
+template<typename ValueType, typename MatrixType>
+std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> configureMinMaxLinearEquationSolver(
+    Environment const& env, SolveGoal<ValueType>&& goal, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& factory, MatrixType&& matrix) {
+    std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver = factory.create(env, std::forward<MatrixType>(matrix));
+    configureMinMaxLinearEquationSolver(std::move(goal), *solver);
     return solver;
 }
 
@@ -2,13 +2,17 @@
 
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
+#include <atomic>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/UnexpectedException.h"
+#include "storm/solver/helper/SccScheduling.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
 
@@ -65,11 +69,17 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
     bool needAdaptPrecision =
         env.solver().isForceSoundness() &&
         env.solver().getPrecisionOfLinearEquationSolver(env.solver().topological().getUnderlyingEquationSolverType()).first.is_initialized();
+    uint64_t numberOfThreads = storm::utility::getNumberOfThreads<ValueType>(env.solver().topological().getNumberOfThreads());
+    if (numberOfThreads > 1 && env.solver().isForceExact()) {
+        STORM_LOG_INFO("Solving SCCs concurrently is not supported for exact computations. Using a single thread.");
+        numberOfThreads = 1;
+    }
 
-    if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize)) {
+    if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize) ||
+        (numberOfThreads > 1 && !this->sortedSccDecomposition->hasSccDepth())) {
         STORM_LOG_TRACE("Creating SCC decomposition.");
         storm::utility::Stopwatch sccSw(true);
-        createSortedSccDecomposition(needAdaptPrecision);
+        createSortedSccDecomposition(needAdaptPrecision, numberOfThreads);
         sccSw.stop();
         STORM_LOG_INFO("SCC decomposition computed in "
                        << sccSw << ". Found " << this->sortedSccDecomposition->size() << " SCC(s) containing a total of " << x.size()
@@ -97,42 +107,89 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
         }
     } else {
         // Solve each SCC individually
-        storm::storage::BitVector sccAsBitVector(x.size(), false);
-        uint64_t sccIndex = 0;
-        storm::utility::ProgressMeasurement progress("states");
-        progress.setMaxCount(x.size());
-        progress.startNewMeasurement(0);
-        for (auto const& scc : *this->sortedSccDecomposition) {
+        // If every depth holds a single SCC, the SCCs form a chain and can only be solved one after another.
+        if (numberOfThreads > 1 && this->sortedSccDecomposition->getMaxSccDepth() + 1 < this->sortedSccDecomposition->size()) {
+            returnValue = solveSccsConcurrently(sccSolverEnvironment, x, b, numberOfThreads);
+        } else {
+            returnValue = solveSccsSequentially(sccSolverEnvironment, x, b);
+        }
+    }
+
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
+
+    return returnValue;
+}
+
+template<typename ValueType>
+bool TopologicalLinearEquationSolver<ValueType>::solveSccsSequentially(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x,
+                                                                       std::vector<ValueType> const& b) const {
+    bool returnValue = true;
+    storm::storage::BitVector sccAsBitVector(x.size(), false);
+    uint64_t sccIndex = 0;
+    storm::utility::ProgressMeasurement progress("states");
+    progress.setMaxCount(x.size());
+    progress.startNewMeasurement(0);
+    for (auto const& scc : *this->sortedSccDecomposition) {
+        if (scc.size() == 1) {
+            returnValue = solveTrivialScc(*scc.begin(), x, b) && returnValue;
+        } else {
+            sccAsBitVector.clear();
+            for (auto const& state : scc) {
+                sccAsBitVector.set(state, true);
+            }
+            returnValue = solveScc(sccSolverEnvironment, sccAsBitVector, x, b, this->sccSolver) && returnValue;
+        }
+        ++sccIndex;
+        progress.updateProgress(sccIndex);
+        if (storm::utility::resources::isTerminate()) {
+            STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+            break;
+        }
+    }
+    return returnValue;
+}
+
+template<typename ValueType>
+bool TopologicalLinearEquationSolver<ValueType>::solveSccsConcurrently(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x,
+                                                                       std::vector<ValueType> const& b, uint64_t numberOfThreads) const {
+    std::atomic<bool> returnValue(true);
+    uint64_t numberOfSolvedSccs = storm::solver::helper::processSccsConcurrently(
+        *this->A, *this->sortedSccDecomposition,
+        [&](uint64_t sccIndex) {
+            auto const& scc = (*this->sortedSccDecomposition)[sccIndex];
+            bool sccReturnValue;
             if (scc.size() == 1) {
-                returnValue = solveTrivialScc(*scc.begin(), x, b) && returnValue;
+                sccReturnValue = solveTrivialScc(*scc.begin(), x, b);
             } else {
-                sccAsBitVector.clear();
+                // Each non-trivial SCC gets its own solver as SCCs are solved concurrently.
+                storm::storage::BitVector sccAsBitVector(x.size(), false);
                 for (auto const& state : scc) {
                     sccAsBitVector.set(state, true);
                 }
-                returnValue = solveScc(sccSolverEnvironment, sccAsBitVector, x, b) && returnValue;
+                std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver;
+                sccReturnValue = solveScc(sccSolverEnvironment, sccAsBitVector, x, b, solver);
             }
-            ++sccIndex;
-            progress.updateProgress(sccIndex);
-            if (storm::utility::resources::isTerminate()) {
-                STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
-                break;
+            if (!sccReturnValue) {
+                returnValue = false;
             }
-        }
+        },
+        numberOfThreads);
+    if (numberOfSolvedSccs < this->sortedSccDecomposition->size()) {
+        STORM_LOG_WARN("Topological solver aborted after analyzing " << numberOfSolvedSccs << "/" << this->sortedSccDecomposition->size() << " SCCs.");
     }
-
-    if (!this->isCachingEnabled()) {
-        clearCache();
-    }
-
     return returnValue;
 }
 
 template<typename ValueType>
-void TopologicalLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize) const {
-    // Obtain the scc decomposition
+void TopologicalLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize, uint64_t numberOfThreads) const {
+    // Obtain the scc decomposition. The SCC depths reveal whether solving SCCs concurrently can pay off.
     this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(
-        *this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize));
+        *this->A, storm::storage::StronglyConnectedComponentDecompositionOptions()
+                      .forceTopologicalSort()
+                      .computeSccDepths(needLongestChainSize || numberOfThreads > 1)
+                      .useThreads(numberOfThreads));
     if (needLongestChainSize) {
         this->longestSccChainSize = this->sortedSccDecomposition->getMaxSccDepth() + 1;
     }
@@ -189,20 +246,21 @@ bool TopologicalLinearEquationSolver<ValueType>::solveFullyConnectedEquationSyst
 
 template<typename ValueType>
 bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc,
-                                                          std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
+                                                          std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB,
+                                                          std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>& solver) const {
     // Set up the SCC solver
-    if (!this->sccSolver) {
-        this->sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-        this->sccSolver->setCachingEnabled(true);
+    if (!solver) {
+        solver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+        solver->setCachingEnabled(true);
     }
 
     // Matrix
-    bool asEquationSystem = this->sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
+    bool asEquationSystem = solver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
     storm::storage::SparseMatrix<ValueType> sccA = this->A->getSubmatrix(true, scc, scc, asEquationSystem);
     if (asEquationSystem) {
         sccA.convertToEquationSystem();
     }
-    this->sccSolver->setMatrix(std::move(sccA));
+    solver->setMatrix(std::move(sccA));
 
     // x Vector
     auto sccX = storm::utility::vector::filterVector(globalX, scc);
@@ -222,20 +280,20 @@ bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment con
 
     // lower/upper bounds
     if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setLowerBound(this->getLowerBound());
+        solver->setLowerBound(this->getLowerBound());
     } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
+        solver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
     }
     if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setUpperBound(this->getUpperBound());
+        solver->setUpperBound(this->getUpperBound());
     } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
+        solver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
     }
 
     // std::cout << "rhs is " << storm::utility::vector::toString(sccB) << '\n';
     // std::cout << "x is " << storm::utility::vector::toString(sccX) << '\n';
 
-    bool returnvalue = this->sccSolver->solveEquations(sccSolverEnvironment, sccX, sccB);
+    bool returnvalue = solver->solveEquations(sccSolverEnvironment, sccX, sccB);
     storm::utility::vector::setVectorValues(globalX, scc, sccX);
     return returnvalue;
 }
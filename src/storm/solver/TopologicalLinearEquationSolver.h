@@ -37,7 +37,13 @@ class TopologicalLinearEquationSolver : public LinearEquationSolver<ValueType> {
     storm::Environment getEnvironmentForUnderlyingSolver(storm::Environment const& env, bool adaptPrecision = false) const;
 
     // Creates an SCC decomposition and sorts the SCCs according to a topological sort.
-    void createSortedSccDecomposition(bool needLongestChainSize) const;
+    void createSortedSccDecomposition(bool needLongestChainSize, uint64_t numberOfThreads) const;
+
+    // Solves the SCCs one after another in topological order.
+    bool solveSccsSequentially(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+    // Solves the SCCs concurrently. An SCC is scheduled as soon as all SCCs it depends on are solved.
+    bool solveSccsConcurrently(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                               uint64_t numberOfThreads) const;
 
     // Solves the SCC with the given index
     // ... for the case that the SCC is trivial
@@ -45,8 +51,9 @@ class TopologicalLinearEquationSolver : public LinearEquationSolver<ValueType> {
     // ... for the case that there is just one large SCC
     bool solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     // ... for the remaining cases (1 < scc.size() < x.size())
+    // The given solver is created if it does not exist yet.
     bool solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX,
-                  std::vector<ValueType> const& globalB) const;
+                  std::vector<ValueType> const& globalB, std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>& solver) const;
 
     // If the solver takes posession of the matrix, we store the moved matrix in this member, so it gets deleted
     // when the solver is destructed.
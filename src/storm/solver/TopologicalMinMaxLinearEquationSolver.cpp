@@ -3,13 +3,17 @@
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
+#include <atomic>
+
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/UncheckedRequirementException.h"
 #include "storm/exceptions/UnexpectedException.h"
+#include "storm/solver/helper/SccScheduling.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
 
@@ -56,11 +60,17 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(En
 
     // For sound computations we need to increase the precision in each SCC
     bool needAdaptPrecision = env.solver().isForceSoundness();
+    uint64_t numberOfThreads = storm::utility::getNumberOfThreads<ValueType>(env.solver().topological().getNumberOfThreads());
+    if (numberOfThreads > 1 && env.solver().isForceExact()) {
+        STORM_LOG_INFO("Solving SCCs concurrently is not supported for exact computations. Using a single thread.");
+        numberOfThreads = 1;
+    }
 
-    if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize)) {
+    if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize) ||
+        (numberOfThreads > 1 && !this->sortedSccDecomposition->hasSccDepth())) {
         STORM_LOG_TRACE("Creating SCC decomposition.");
         storm::utility::Stopwatch sccSw(true);
-        createSortedSccDecomposition(needAdaptPrecision);
+        createSortedSccDecomposition(needAdaptPrecision, numberOfThreads);
         sccSw.stop();
         STORM_LOG_INFO("SCC decomposition computed in "
                        << sccSw << ". Found " << this->sortedSccDecomposition->size() << " SCC(s) containing a total of " << x.size()
@@ -98,40 +108,11 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(En
                 this->schedulerChoices = std::vector<uint64_t>(x.size());
             }
         }
-        storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
-        storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
-        uint64_t sccIndex = 0;
-        storm::utility::ProgressMeasurement progress("states");
-        progress.setMaxCount(x.size());
-        progress.startNewMeasurement(0);
-        for (auto const& scc : *this->sortedSccDecomposition) {
-            if (scc.size() == 1) {
-                returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
-            } else {
-                STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
-                sccRowGroupsAsBitVector.clear();
-                sccRowsAsBitVector.clear();
-                for (auto const& group : scc) {  // Group refers to state
-                    sccRowGroupsAsBitVector.set(group, true);
-
-                    if (!this->choiceFixedForRowGroup || !this->choiceFixedForRowGroup.get()[group]) {
-                        for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
-                            sccRowsAsBitVector.set(row, true);
-                        }
-                    } else {
-                        auto row = this->A->getRowGroupIndices()[group] + this->getInitialScheduler()[group];
-                        sccRowsAsBitVector.set(row, true);
-                        STORM_LOG_INFO("Fixing state " << group << " to choice " << this->getInitialScheduler()[group] << ".");
-                    }
-                }
-                returnValue = solveScc(sccSolverEnvironment, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b) && returnValue;
-            }
-            ++sccIndex;
-            progress.updateProgress(sccIndex);
-            if (storm::utility::resources::isTerminate()) {
-                STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
-                break;
-            }
+        // If every depth holds a single SCC, the SCCs form a chain and can only be solved one after another.
+        if (numberOfThreads > 1 && this->sortedSccDecomposition->getMaxSccDepth() + 1 < this->sortedSccDecomposition->size()) {
+            returnValue = solveSccsConcurrently(sccSolverEnvironment, dir, x, b, numberOfThreads);
+        } else {
+            returnValue = solveSccsSequentially(sccSolverEnvironment, dir, x, b);
         }
 
         // If requested, we store the scheduler for retrieval.
@@ -152,10 +133,94 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(En
 }
 
 template<typename ValueType>
-void TopologicalMinMaxLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize) const {
-    // Obtain the scc decomposition
+bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveSccsSequentially(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir,
+                                                                             std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+    bool returnValue = true;
+    storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
+    storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
+    uint64_t sccIndex = 0;
+    storm::utility::ProgressMeasurement progress("states");
+    progress.setMaxCount(x.size());
+    progress.startNewMeasurement(0);
+    for (auto const& scc : *this->sortedSccDecomposition) {
+        if (scc.size() == 1) {
+            returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
+        } else {
+            STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
+            getSccRowGroupsAndRows(scc, sccRowGroupsAsBitVector, sccRowsAsBitVector);
+            returnValue = solveScc(sccSolverEnvironment, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b, this->sccSolver) && returnValue;
+        }
+        ++sccIndex;
+        progress.updateProgress(sccIndex);
+        if (storm::utility::resources::isTerminate()) {
+            STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+            break;
+        }
+    }
+    return returnValue;
+}
+
+template<typename ValueType>
+bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveSccsConcurrently(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir,
+                                                                             std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                                                                             uint64_t numberOfThreads) const {
+    std::atomic<bool> returnValue(true);
+    uint64_t numberOfSolvedSccs = storm::solver::helper::processSccsConcurrently(
+        *this->A, *this->sortedSccDecomposition,
+        [&](uint64_t sccIndex) {
+            auto const& scc = (*this->sortedSccDecomposition)[sccIndex];
+            bool sccReturnValue;
+            if (scc.size() == 1) {
+                sccReturnValue = solveTrivialScc(*scc.begin(), dir, x, b);
+            } else {
+                STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
+                // Each non-trivial SCC gets its own solver as SCCs are solved concurrently.
+                storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
+                storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
+                getSccRowGroupsAndRows(scc, sccRowGroupsAsBitVector, sccRowsAsBitVector);
+                std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver;
+                sccReturnValue = solveScc(sccSolverEnvironment, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b, solver);
+            }
+            if (!sccReturnValue) {
+                returnValue = false;
+            }
+        },
+        numberOfThreads);
+    if (numberOfSolvedSccs < this->sortedSccDecomposition->size()) {
+        STORM_LOG_WARN("Topological solver aborted after analyzing " << numberOfSolvedSccs << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+    }
+    return returnValue;
+}
+
+template<typename ValueType>
+void TopologicalMinMaxLinearEquationSolver<ValueType>::getSccRowGroupsAndRows(storm::storage::StronglyConnectedComponent const& scc,
+                                                                              storm::storage::BitVector& sccRowGroups,
+                                                                              storm::storage::BitVector& sccRows) const {
+    sccRowGroups.clear();
+    sccRows.clear();
+    for (auto const& group : scc) {  // Group refers to state
+        sccRowGroups.set(group, true);
+
+        if (!this->choiceFixedForRowGroup || !this->choiceFixedForRowGroup.get()[group]) {
+            for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
+                sccRows.set(row, true);
+            }
+        } else {
+            auto row = this->A->getRowGroupIndices()[group] + this->getInitialScheduler()[group];
+            sccRows.set(row, true);
+            STORM_LOG_INFO("Fixing state " << group << " to choice " << this->getInitialScheduler()[group] << ".");
+        }
+    }
+}
+
+template<typename ValueType>
+void TopologicalMinMaxLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize, uint64_t numberOfThreads) const {
+    // Obtain the scc decomposition. The SCC depths reveal whether solving SCCs concurrently can pay off.
     this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(
-        *this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize));
+        *this->A, storm::storage::StronglyConnectedComponentDecompositionOptions()
+                      .forceTopologicalSort()
+                      .computeSccDepths(needLongestChainSize || numberOfThreads > 1)
+                      .useThreads(numberOfThreads));
     if (needLongestChainSize) {
         this->longestSccChainSize = this->sortedSccDecomposition->getMaxSccDepth() + 1;
     }
@@ -292,15 +357,16 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveFullyConnectedEquati
 template<typename ValueType>
 bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir,
                                                                 storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows,
-                                                                std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
+                                                                std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB,
+                                                                std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>& solver) const {
     // Set up the SCC solver
-    if (!this->sccSolver) {
-        this->sccSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-        this->sccSolver->setCachingEnabled(true);
+    if (!solver) {
+        solver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+        solver->setCachingEnabled(true);
     }
-    this->sccSolver->setHasUniqueSolution(this->hasUniqueSolution());
-    this->sccSolver->setHasNoEndComponents(this->hasNoEndComponents());
-    this->sccSolver->setTrackScheduler(this->isTrackSchedulerSet());
+    solver->setHasUniqueSolution(this->hasUniqueSolution());
+    solver->setHasNoEndComponents(this->hasNoEndComponents());
+    solver->setTrackScheduler(this->isTrackSchedulerSet());
 
     storm::storage::SparseMatrix<ValueType> sccA;
     if (this->choiceFixedForRowGroup) {
@@ -314,7 +380,7 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environme
             // As we removed the entries where the choice was fixed, we need to change the scheduler.
             // We set the scheduler to 0 for those states.
             storm::utility::vector::setVectorValues<uint_fast64_t>(sccInitChoices, choiceFixedForStateSCC, 0);
-            this->sccSolver->setInitialScheduler(std::move(sccInitChoices));
+            solver->setInitialScheduler(std::move(sccInitChoices));
         }
 
     } else {
@@ -323,11 +389,11 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environme
         // initial scheduler
         if (this->hasInitialScheduler()) {
             auto sccInitChoices = storm::utility::vector::filterVector(this->getInitialScheduler(), sccRowGroups);
-            this->sccSolver->setInitialScheduler(std::move(sccInitChoices));
+            solver->setInitialScheduler(std::move(sccInitChoices));
         }
     }
 
-    this->sccSolver->setMatrix(std::move(sccA));
+    solver->setMatrix(std::move(sccA));
 
     // x Vector
     auto sccX = storm::utility::vector::filterVector(globalX, sccRowGroups);
@@ -347,18 +413,18 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environme
 
     // lower/upper bounds
     if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setLowerBound(this->getLowerBound());
+        solver->setLowerBound(this->getLowerBound());
     } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
+        solver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
     }
     if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setUpperBound(this->getUpperBound());
+        solver->setUpperBound(this->getUpperBound());
     } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
+        solver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
     }
 
     // Requirements
-    auto req = this->sccSolver->getRequirements(sccSolverEnvironment, dir);
+    auto req = solver->getRequirements(sccSolverEnvironment, dir);
     if (req.upperBounds() && this->hasUpperBound()) {
         req.clearUpperBounds();
     }
@@ -373,14 +439,14 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environme
     }
     STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
                     "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
-    this->sccSolver->setRequirementsChecked(true);
+    solver->setRequirementsChecked(true);
 
     // Invoke scc solver
-    bool res = this->sccSolver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
+    bool res = solver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
 
     // Set Scheduler choices
     if (this->isTrackSchedulerSet()) {
-        storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, this->sccSolver->getSchedulerChoices());
+        storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, solver->getSchedulerChoices());
     }
 
     // Set solution
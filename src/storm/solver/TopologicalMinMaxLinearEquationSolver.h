@@ -34,7 +34,17 @@ class TopologicalMinMaxLinearEquationSolver : public StandardMinMaxLinearEquatio
     storm::Environment getEnvironmentForUnderlyingSolver(storm::Environment const& env, bool adaptPrecision = false) const;
 
     // Creates an SCC decomposition and sorts the SCCs according to a topological sort.
-    void createSortedSccDecomposition(bool needLongestChainSize) const;
+    void createSortedSccDecomposition(bool needLongestChainSize, uint64_t numberOfThreads) const;
+
+    // Solves the SCCs one after another in topological order.
+    bool solveSccsSequentially(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, std::vector<ValueType>& x,
+                               std::vector<ValueType> const& b) const;
+    // Solves the SCCs concurrently. An SCC is scheduled as soon as all SCCs it depends on are solved.
+    bool solveSccsConcurrently(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, std::vector<ValueType>& x,
+                               std::vector<ValueType> const& b, uint64_t numberOfThreads) const;
+    // Sets the row groups and rows of the given (non-trivial) SCC.
+    void getSccRowGroupsAndRows(storm::storage::StronglyConnectedComponent const& scc, storm::storage::BitVector& sccRowGroups,
+                                storm::storage::BitVector& sccRows) const;
 
     // Solves the SCC with the given index
     // ... for the case that the SCC is trivial
@@ -43,8 +53,10 @@ class TopologicalMinMaxLinearEquationSolver : public StandardMinMaxLinearEquatio
     bool solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, std::vector<ValueType>& x,
                                            std::vector<ValueType> const& b) const;
     // ... for the remaining cases (1 < scc.size() < x.size())
+    // The given solver is created if it does not exist yet.
     bool solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, storm::storage::BitVector const& sccRowGroups,
-                  storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+                  storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB,
+                  std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>& solver) const;
 
     // cached auxiliary data
     mutable std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> sortedSccDecomposition;
@@ -49,6 +49,10 @@ class IIBackend {
         return false;
     }
 
+    void merge([[maybe_unused]] IIBackend const& other) {
+        // intentionally left empty.
+    }
+
    private:
     storm::utility::Extremum<Dir, ValueType> xBest, yBest;
 };
@@ -103,9 +107,19 @@ SolverStatus IntervalIterationHelper<ValueType, TrivialRowGrouping>::II(std::pai
     } else {
         getNextConvergenceCheckState = [&convergenceCheckState]() { ++convergenceCheckState; };
     }
+    // Row groups can only be processed in parallel if the results are written to separate vectors.
+    std::pair<std::vector<ValueType>, std::vector<ValueType>> xyAux;
+    if (viOperator->isParallel()) {
+        xyAux = xy;
+    }
     while (status == SolverStatus::InProgress) {
         ++numIterations;
-        viOperator->template applyInPlace(xy, offsets, backend);
+        if (viOperator->isParallel()) {
+            viOperator->template apply(xy, xyAux, offsets, backend);
+            std::swap(xy, xyAux);
+        } else {
+            viOperator->template applyInPlace(xy, offsets, backend);
+        }
         if (checkConvergence(xy, convergenceCheckState, getNextConvergenceCheckState, relative, precision)) {
             status = SolverStatus::Converged;
         } else if (iterationCallback) {
@@ -58,6 +58,10 @@ class GSVIBackend {
         return false;
     }
 
+    void merge(GSVIBackend const& other) {
+        isConverged &= other.isConverged;
+    }
+
    private:
     storm::utility::Extremum<Dir, ValueType> best;
     ValueType const precision;
@@ -71,9 +75,21 @@ SolverStatus OptimisticValueIterationHelper<ValueType, TrivialRowGrouping>::GSVI
     std::function<SolverStatus(SolverStatus const&, std::vector<ValueType> const&)> const& iterationCallback) const {
     GSVIBackend<ValueType, Dir, Relative> backend{precision};
     SolverStatus status{SolverStatus::InProgress};
+    // Row groups can only be processed in parallel if the results are written to a separate vector.
+    std::vector<ValueType> operandAux;
+    if (viOperator->isParallel()) {
+        operandAux.resize(operand.size());
+    }
     while (status == SolverStatus::InProgress) {
         ++numIterations;
-        if (viOperator->template applyInPlace(operand, offsets, backend)) {
+        bool converged;
+        if (viOperator->isParallel()) {
+            converged = viOperator->template apply(operand, operandAux, offsets, backend);
+            operand.swap(operandAux);
+        } else {
+            converged = viOperator->template applyInPlace(operand, offsets, backend);
+        }
+        if (converged) {
             status = SolverStatus::Converged;
         } else if (iterationCallback) {
             status = iterationCallback(status, operand);
@@ -172,6 +188,13 @@ class OVIBackend {
         return *errorValue;
     }
 
+    void merge(OVIBackend const& other) {
+        isAllUp &= other.isAllUp;
+        isAllDown &= other.isAllDown;
+        crossed |= other.crossed;
+        errorValue &= other.errorValue;
+    }
+
    private:
     bool isAllUp{true};
     bool isAllDown{true};
@@ -194,6 +217,11 @@ SolverStatus OptimisticValueIterationHelper<ValueType, TrivialRowGrouping>::OVI(
     ValueType const& guessValue, std::optional<ValueType> const& lowerBound, std::optional<ValueType> const& upperBound,
     std::function<SolverStatus(SolverStatus const&, std::vector<ValueType> const&)> const& iterationCallback) const {
     ValueType currentGuessValue = guessValue;
+    // Row groups can only be processed in parallel if the results are written to separate vectors.
+    std::pair<std::vector<ValueType>, std::vector<ValueType>> vuAux;
+    if (viOperator->isParallel()) {
+        vuAux = vu;
+    }
     for (uint64_t numTries = 1; true; ++numTries) {
         if (SolverStatus status = GSVI<Dir, Relative>(vu.first, offsets, numIterations, currentGuessValue, iterationCallback);
             status != SolverStatus::Converged) {
@@ -210,7 +238,14 @@ SolverStatus OptimisticValueIterationHelper<ValueType, TrivialRowGrouping>::OVI(
         }
         while (numIterations < maxIters) {
             ++numIterations;
-            if (viOperator->template applyInPlace(vu, offsets, backend)) {
+            bool converged;
+            if (viOperator->isParallel()) {
+                converged = viOperator->template apply(vu, vuAux, offsets, backend);
+                std::swap(vu, vuAux);
+            } else {
+                converged = viOperator->template applyInPlace(vu, offsets, backend);
+            }
+            if (converged) {
                 if (backend.allDown()) {
                     return SolverStatus::Converged;
                 } else {
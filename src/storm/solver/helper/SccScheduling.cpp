@@ -0,0 +1,111 @@
+#include "storm/solver/helper/SccScheduling.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/utility/ProgressMeasurement.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/ThreadPool.h"
+#include "storm/utility/macros.h"
+
+namespace storm::solver::helper {
+
+template<typename ValueType>
+uint64_t processSccsConcurrently(storm::storage::SparseMatrix<ValueType> const& matrix,
+                                 storm::storage::Decomposition<storm::storage::StronglyConnectedComponent> const& sccs,
+                                 std::function<void(uint64_t)> const& processScc, uint64_t numberOfThreads) {
+    uint64_t const numberOfSccs = sccs.size();
+    uint64_t const noScc = numberOfSccs;
+    std::vector<uint64_t> sccOfState(matrix.getRowGroupCount(), noScc);
+    for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+        for (auto const& state : sccs[sccIndex]) {
+            sccOfState[state] = sccIndex;
+        }
+    }
+
+    // For each SCC, count the SCCs it directly depends on and remember the SCCs that directly depend on it.
+    std::vector<uint64_t> numberOfOpenDependencies(numberOfSccs, 0);
+    std::vector<std::vector<uint64_t>> dependentSccs(numberOfSccs);
+    std::vector<uint64_t> lastDependentScc(numberOfSccs, noScc);
+    std::vector<uint64_t> readySccs;
+    for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+        for (auto const& state : sccs[sccIndex]) {
+            for (auto const& entry : matrix.getRowGroup(state)) {
+                uint64_t const successorScc = sccOfState[entry.getColumn()];
+                STORM_LOG_ASSERT(successorScc != noScc, "State " << entry.getColumn() << " does not belong to an SCC.");
+                if (successorScc != sccIndex && lastDependentScc[successorScc] != sccIndex) {
+                    lastDependentScc[successorScc] = sccIndex;
+                    dependentSccs[successorScc].push_back(sccIndex);
+                    ++numberOfOpenDependencies[sccIndex];
+                }
+            }
+        }
+        if (numberOfOpenDependencies[sccIndex] == 0) {
+            readySccs.push_back(sccIndex);
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable queueChanged;
+    uint64_t numberOfProcessedSccs = 0;
+    bool done = numberOfSccs == 0;
+    storm::utility::ProgressMeasurement progress("SCCs");
+    progress.setMaxCount(numberOfSccs);
+    progress.startNewMeasurement(0);
+
+    auto worker = [&](uint64_t) {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            queueChanged.wait(lock, [&]() { return done || !readySccs.empty(); });
+            if (done) {
+                break;
+            }
+            uint64_t const sccIndex = readySccs.back();
+            readySccs.pop_back();
+            lock.unlock();
+
+            try {
+                processScc(sccIndex);
+            } catch (...) {
+                // Make sure that the remaining workers do not wait for this SCC.
+                lock.lock();
+                done = true;
+                queueChanged.notify_all();
+                throw;
+            }
+
+            lock.lock();
+            ++numberOfProcessedSccs;
+            for (auto const& dependentScc : dependentSccs[sccIndex]) {
+                if (--numberOfOpenDependencies[dependentScc] == 0) {
+                    readySccs.push_back(dependentScc);
+                }
+            }
+            progress.updateProgress(numberOfProcessedSccs);
+            done = numberOfProcessedSccs == numberOfSccs || storm::utility::resources::isTerminate();
+            queueChanged.notify_all();
+        }
+    };
+    numberOfThreads = std::max<uint64_t>(1, std::min<uint64_t>(numberOfThreads, storm::utility::ThreadPool::getGlobalPool().getNumberOfThreads()));
+    storm::utility::ThreadPool::getGlobalPool().parallelFor(0, numberOfThreads, worker, numberOfThreads);
+    return numberOfProcessedSccs;
+}
+
+template uint64_t processSccsConcurrently(storm::storage::SparseMatrix<double> const& matrix,
+                                          storm::storage::Decomposition<storm::storage::StronglyConnectedComponent> const& sccs,
+                                          std::function<void(uint64_t)> const& processScc, uint64_t numberOfThreads);
+
+#ifdef STORM_HAVE_CARL
+template uint64_t processSccsConcurrently(storm::storage::SparseMatrix<storm::RationalNumber> const& matrix,
+                                          storm::storage::Decomposition<storm::storage::StronglyConnectedComponent> const& sccs,
+                                          std::function<void(uint64_t)> const& processScc, uint64_t numberOfThreads);
+template uint64_t processSccsConcurrently(storm::storage::SparseMatrix<storm::RationalFunction> const& matrix,
+                                          storm::storage::Decomposition<storm::storage::StronglyConnectedComponent> const& sccs,
+                                          std::function<void(uint64_t)> const& processScc, uint64_t numberOfThreads);
+#endif
+
+}  // namespace storm::solver::helper
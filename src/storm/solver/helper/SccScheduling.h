@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+#include "storm/storage/Decomposition.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponent.h"
+
+namespace storm::solver::helper {
+
+/*!
+ * Processes the SCCs of the given decomposition concurrently. An SCC is handed to a thread as soon as all SCCs that it reaches with a single
+ * transition are processed, i.e., each SCC keeps track of the number of SCCs it still waits for. As every SCC is processed only after the SCCs
+ * it depends on, the results coincide with the ones obtained by processing the SCCs one after another in topological order.
+ *
+ * @param matrix The matrix whose row groups correspond to the states of the decomposition.
+ * @param sccs The SCC decomposition. Every row group has to belong to some SCC.
+ * @param processScc Called with the index of each SCC. Calls for SCCs that do not depend on each other may happen concurrently.
+ * @param numberOfThreads The maximal number of threads that process SCCs.
+ * @return The number of processed SCCs. This is less than the number of SCCs iff the computation was aborted.
+ */
+template<typename ValueType>
+uint64_t processSccsConcurrently(storm::storage::SparseMatrix<ValueType> const& matrix,
+                                 storm::storage::Decomposition<storm::storage::StronglyConnectedComponent> const& sccs,
+                                 std::function<void(uint64_t)> const& processScc, uint64_t numberOfThreads);
+
+}  // namespace storm::solver::helper
@@ -34,9 +34,9 @@ class SVIBackend {
     static const SVIStage CurrentStage = Stage;
     using RowValueStorageType = std::vector<std::pair<ValueType, ValueType>>;
 
-    SVIBackend(RowValueStorageType& rowValueStorage, std::optional<ValueType> const& a, std::optional<ValueType> const& b,
+    SVIBackend(RowValueStorageType rowValueStorage, std::optional<ValueType> const& a, std::optional<ValueType> const& b,
                std::optional<ValueType> const& d = {})
-        : currRowValues(rowValueStorage) {
+        : currRowValues(std::move(rowValueStorage)) {
         if (a.has_value()) {
             aValue &= *a;
         }
@@ -158,6 +158,13 @@ class SVIBackend {
         return false;
     }
 
+    void merge(SVIBackend const& other) {
+        allYLessOne &= other.allYLessOne;
+        curr_a &= other.curr_a;
+        curr_b &= other.curr_b;
+        dValue &= other.dValue;
+    }
+
     std::optional<ValueType> a() const {
         return aValue.getOptionalValue();
     }
@@ -211,7 +218,7 @@ class SVIBackend {
 
     std::pair<ValueType, ValueType> best;
     ExtremumDir bestValue;
-    RowValueStorageType& currRowValues;
+    RowValueStorageType currRowValues;
     uint64_t currRowValuesIndex{0};
 };
 
@@ -329,9 +336,19 @@ typename SoundValueIterationHelper<ValueType, TrivialRowGrouping>::SVIData Sound
         getNextConvergenceCheckState = [&convergenceCheckState]() { ++convergenceCheckState; };
     }
 
+    // Row groups can only be processed in parallel if the results are written to separate vectors.
+    std::pair<std::vector<ValueType>, std::vector<ValueType>> xyAux;
+    if (viOperator->isParallel()) {
+        xyAux = xy;
+    }
     while (true) {
         ++numIterations;
-        viOperator->template applyInPlace(xy, offsets, backend);
+        if (viOperator->isParallel()) {
+            viOperator->template apply(xy, xyAux, offsets, backend);
+            std::swap(xy, xyAux);
+        } else {
+            viOperator->template applyInPlace(xy, offsets, backend);
+        }
         SVIData data{SolverStatus::InProgress, xy, backend.a(), backend.b()};
         if (data.checkConvergence(convergenceCheckState, getNextConvergenceCheckState, relative, precision)) {
             return SVIData{SolverStatus::Converged, xy, backend.a(), backend.b()};
@@ -344,6 +361,7 @@ typename SoundValueIterationHelper<ValueType, TrivialRowGrouping>::SVIData Sound
                 }
             }
             if (backend.moveToNextStage()) {
+                xyAux = {};
                 switch (backend.getNextStage()) {
                     case SVIStage::y_less_1:
                         return SVI(xy, offsets, numIterations, relative, precision, backend.template createBackendForNextStage<SVIStage::y_less_1>(),
@@ -367,7 +385,8 @@ typename SoundValueIterationHelper<ValueType, TrivialRowGrouping>::SVIData Sound
     std::function<SolverStatus(SVIData const&)> const& iterationCallback, std::optional<storm::storage::BitVector> const& relevantValues) const {
     typename SVIBackend<ValueType, Dir, SVIStage::Initial, TrivialRowGrouping>::RowValueStorageType rowValueStorage;
     rowValueStorage.resize(sizeOfLargestRowGroup - 1);
-    return SVI(xy, offsets, numIterations, relative, precision, SVIBackend<ValueType, Dir, SVIStage::Initial, TrivialRowGrouping>(rowValueStorage, a, b),
+    return SVI(xy, offsets, numIterations, relative, precision,
+               SVIBackend<ValueType, Dir, SVIStage::Initial, TrivialRowGrouping>(std::move(rowValueStorage), a, b),
                iterationCallback, relevantValues);
 }
 
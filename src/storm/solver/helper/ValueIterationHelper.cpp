@@ -48,12 +48,74 @@ class VIOperatorBackend {
         return false;
     }
 
+    void merge(VIOperatorBackend const& other) {
+        isConverged &= other.isConverged;
+    }
+
    private:
     storm::utility::Extremum<Dir, ValueType> best;
     ValueType const precision;
     bool isConverged{true};
 };
 
+template<typename ValueType, uint64_t BatchSize, storm::OptimizationDirection Dir, bool Relative>
+class BatchVIOperatorBackend {
+   public:
+    BatchVIOperatorBackend(ValueType const& precision) : precision{precision} {
+        // intentionally empty
+    }
+
+    void startNewIteration() {
+        isConverged = true;
+    }
+
+    void firstRow(std::array<ValueType, BatchSize>&& values, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
+        for (uint64_t i = 0; i < BatchSize; ++i) {
+            best[i] = std::move(values[i]);
+        }
+    }
+
+    void nextRow(std::array<ValueType, BatchSize>&& values, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
+        for (uint64_t i = 0; i < BatchSize; ++i) {
+            best[i] &= std::move(values[i]);
+        }
+    }
+
+    void applyUpdate(std::array<ValueType, BatchSize>& currValues, [[maybe_unused]] uint64_t rowGroup) {
+        for (uint64_t i = 0; i < BatchSize; ++i) {
+            if (isConverged) {
+                if constexpr (Relative) {
+                    isConverged = storm::utility::abs<ValueType>(currValues[i] - *best[i]) <= storm::utility::abs<ValueType>(precision * currValues[i]);
+                } else {
+                    isConverged = storm::utility::abs<ValueType>(currValues[i] - *best[i]) <= precision;
+                }
+            }
+            currValues[i] = std::move(*best[i]);
+        }
+    }
+
+    void endOfIteration() const {
+        // intentionally left empty.
+    }
+
+    bool converged() const {
+        return isConverged;
+    }
+
+    bool constexpr abort() const {
+        return false;
+    }
+
+    void merge(BatchVIOperatorBackend const& other) {
+        isConverged &= other.isConverged;
+    }
+
+   private:
+    std::array<storm::utility::Extremum<Dir, ValueType>, BatchSize> best;
+    ValueType const precision;
+    bool isConverged{true};
+};
+
 template<typename ValueType, bool TrivialRowGrouping>
 ValueIterationHelper<ValueType, TrivialRowGrouping>::ValueIterationHelper(std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping>> viOperator)
     : viOperator(viOperator) {
@@ -69,6 +131,10 @@ SolverStatus ValueIterationHelper<ValueType, TrivialRowGrouping>::VI(std::vector
     VIOperatorBackend<ValueType, Dir, Relative> backend{precision};
     std::vector<ValueType>* operand1{&operand};
     std::vector<ValueType>* operand2{&operand};
+    if (viOperator->isParallel()) {
+        // Row groups can only be processed in parallel if the results are written to a separate vector.
+        mult = MultiplicationStyle::Regular;
+    }
     if (mult == MultiplicationStyle::Regular) {
         operand2 = &viOperator->allocateAuxiliaryVector(operand.size());
     }
@@ -127,6 +193,126 @@ SolverStatus ValueIterationHelper<ValueType, TrivialRowGrouping>::VI(std::vector
     return VI(operand, offsets, numIterations, relative, precision, dir, iterationCallback, mult);
 }
 
+template<typename ValueType, bool TrivialRowGrouping>
+SolverStatus ValueIterationHelper<ValueType, TrivialRowGrouping>::VI(std::vector<std::vector<ValueType>>& operands,
+                                                                     std::vector<std::vector<ValueType>> const& offsets, uint64_t& numIterations,
+                                                                     bool relative, ValueType const& precision,
+                                                                     std::optional<storm::OptimizationDirection> const& dir,
+                                                                     std::function<SolverStatus(SolverStatus const&)> const& iterationCallback,
+                                                                     MultiplicationStyle mult) const {
+    STORM_LOG_ASSERT(operands.size() == offsets.size(), "Number of operands and offsets does not match.");
+    SolverStatus result{SolverStatus::Converged};
+    uint64_t objective = 0;
+    while (objective < operands.size()) {
+        // Handle as many of the remaining objectives as possible with a single batch.
+        uint64_t const remaining = operands.size() - objective;
+        SolverStatus status;
+        uint64_t batchSize;
+        if (remaining >= MaxBatchSize) {
+            batchSize = MaxBatchSize;
+            status = solveBatch<MaxBatchSize>(operands, offsets, objective, numIterations, relative, precision, dir, iterationCallback, mult);
+        } else if (remaining >= 2) {
+            batchSize = 2;
+            status = solveBatch<2>(operands, offsets, objective, numIterations, relative, precision, dir, iterationCallback, mult);
+        } else {
+            batchSize = 1;
+            status = solveBatch<1>(operands, offsets, objective, numIterations, relative, precision, dir, iterationCallback, mult);
+        }
+        if (result == SolverStatus::Converged) {
+            result = status;
+        }
+        objective += batchSize;
+    }
+    return result;
+}
+
+template<typename ValueType, bool TrivialRowGrouping>
+template<uint64_t BatchSize>
+SolverStatus ValueIterationHelper<ValueType, TrivialRowGrouping>::solveBatch(std::vector<std::vector<ValueType>>& operands,
+                                                                             std::vector<std::vector<ValueType>> const& offsets, uint64_t firstObjective,
+                                                                             uint64_t& numIterations, bool relative, ValueType const& precision,
+                                                                             std::optional<storm::OptimizationDirection> const& dir,
+                                                                             std::function<SolverStatus(SolverStatus const&)> const& iterationCallback,
+                                                                             MultiplicationStyle mult) const {
+    STORM_LOG_ASSERT(TrivialRowGrouping || dir.has_value(), "no optimization direction given!");
+    // Store the values of the objectives in this batch contiguously
+    std::vector<std::array<ValueType, BatchSize>> batchOperand(operands[firstObjective].size());
+    std::vector<std::array<ValueType, BatchSize>> batchOffsets(offsets[firstObjective].size());
+    for (uint64_t i = 0; i < BatchSize; ++i) {
+        auto const& operand = operands[firstObjective + i];
+        auto const& offset = offsets[firstObjective + i];
+        STORM_LOG_ASSERT(operand.size() == batchOperand.size() && offset.size() == batchOffsets.size(), "Dimension mismatch.");
+        for (uint64_t rowGroup = 0; rowGroup < operand.size(); ++rowGroup) {
+            batchOperand[rowGroup][i] = operand[rowGroup];
+        }
+        for (uint64_t row = 0; row < offset.size(); ++row) {
+            batchOffsets[row][i] = offset[row];
+        }
+    }
+
+    SolverStatus status;
+    if (!dir.has_value() || maximize(*dir)) {
+        if (relative) {
+            status = batchVI<BatchSize, storm::OptimizationDirection::Maximize, true>(batchOperand, batchOffsets, numIterations, precision, iterationCallback,
+                                                                                      mult);
+        } else {
+            status = batchVI<BatchSize, storm::OptimizationDirection::Maximize, false>(batchOperand, batchOffsets, numIterations, precision, iterationCallback,
+                                                                                       mult);
+        }
+    } else {
+        if (relative) {
+            status = batchVI<BatchSize, storm::OptimizationDirection::Minimize, true>(batchOperand, batchOffsets, numIterations, precision, iterationCallback,
+                                                                                      mult);
+        } else {
+            status = batchVI<BatchSize, storm::OptimizationDirection::Minimize, false>(batchOperand, batchOffsets, numIterations, precision, iterationCallback,
+                                                                                       mult);
+        }
+    }
+
+    for (uint64_t i = 0; i < BatchSize; ++i) {
+        auto& operand = operands[firstObjective + i];
+        for (uint64_t rowGroup = 0; rowGroup < operand.size(); ++rowGroup) {
+            operand[rowGroup] = std::move(batchOperand[rowGroup][i]);
+        }
+    }
+    return status;
+}
+
+template<typename ValueType, bool TrivialRowGrouping>
+template<uint64_t BatchSize, storm::OptimizationDirection Dir, bool Relative>
+SolverStatus ValueIterationHelper<ValueType, TrivialRowGrouping>::batchVI(std::vector<std::array<ValueType, BatchSize>>& operand,
+                                                                          std::vector<std::array<ValueType, BatchSize>> const& offsets, uint64_t& numIterations,
+                                                                          ValueType const& precision,
+                                                                          std::function<SolverStatus(SolverStatus const&)> const& iterationCallback,
+                                                                          MultiplicationStyle mult) const {
+    BatchVIOperatorBackend<ValueType, BatchSize, Dir, Relative> backend{precision};
+    if (viOperator->isParallel()) {
+        // Row groups can only be processed in parallel if the results are written to a separate vector.
+        mult = MultiplicationStyle::Regular;
+    }
+    std::vector<std::array<ValueType, BatchSize>> auxiliaryOperand;
+    if (mult == MultiplicationStyle::Regular) {
+        auxiliaryOperand.resize(operand.size());
+    }
+    SolverStatus status{SolverStatus::InProgress};
+    while (status == SolverStatus::InProgress) {
+        ++numIterations;
+        bool converged;
+        if (mult == MultiplicationStyle::Regular) {
+            converged = viOperator->template apply(operand, auxiliaryOperand, offsets, backend);
+            std::swap(operand, auxiliaryOperand);
+        } else {
+            converged = viOperator->template applyInPlace(operand, offsets, backend);
+        }
+        if (converged) {
+            status = SolverStatus::Converged;
+        } else if (iterationCallback) {
+            status = iterationCallback(status);
+        }
+    }
+    return status;
+}
+
 template class ValueIterationHelper<double, true>;
 template class ValueIterationHelper<double, false>;
 template class ValueIterationHelper<storm::RationalNumber, true>;
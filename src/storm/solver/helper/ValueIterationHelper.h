@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -32,7 +33,39 @@ class ValueIterationHelper {
                     std::optional<storm::OptimizationDirection> const& dir = {}, std::function<SolverStatus(SolverStatus const&)> const& iterationCallback = {},
                     MultiplicationStyle mult = MultiplicationStyle::GaussSeidel) const;
 
+    /*!
+     * Performs value iteration for multiple objectives (i.e., multiple offset vectors) over the same matrix.
+     * Instead of solving the objectives one after another, batches of objectives are handled with a single pass over the matrix per iteration,
+     * where the values of the objectives in a batch are stored contiguously for each row group.
+     * The optimization direction is applied to each objective independently, i.e., different objectives might be optimized by different choices.
+     * @param operands the initial values of each objective (one entry per row group). Will contain the results of each objective afterwards.
+     * @param offsets the row offsets of each objective (one entry per row)
+     * @return Converged iff all objectives converged. Otherwise, the status of the first batch that did not converge.
+     */
+    SolverStatus VI(std::vector<std::vector<ValueType>>& operands, std::vector<std::vector<ValueType>> const& offsets, uint64_t& numIterations, bool relative,
+                    ValueType const& precision, std::optional<storm::OptimizationDirection> const& dir = {},
+                    std::function<SolverStatus(SolverStatus const&)> const& iterationCallback = {},
+                    MultiplicationStyle mult = MultiplicationStyle::GaussSeidel) const;
+
    private:
+    /*!
+     * Solves the batch of BatchSize objectives starting with the given objective index
+     */
+    template<uint64_t BatchSize>
+    SolverStatus solveBatch(std::vector<std::vector<ValueType>>& operands, std::vector<std::vector<ValueType>> const& offsets, uint64_t firstObjective,
+                            uint64_t& numIterations, bool relative, ValueType const& precision, std::optional<storm::OptimizationDirection> const& dir,
+                            std::function<SolverStatus(SolverStatus const&)> const& iterationCallback, MultiplicationStyle mult) const;
+
+    template<uint64_t BatchSize, storm::OptimizationDirection Dir, bool Relative>
+    SolverStatus batchVI(std::vector<std::array<ValueType, BatchSize>>& operand, std::vector<std::array<ValueType, BatchSize>> const& offsets,
+                         uint64_t& numIterations, ValueType const& precision, std::function<SolverStatus(SolverStatus const&)> const& iterationCallback,
+                         MultiplicationStyle mult) const;
+
+    /*!
+     * The maximal number of objectives that are handled with a single pass over the matrix
+     */
+    static constexpr uint64_t MaxBatchSize = 4;
+
     std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping>> viOperator;
 };
 
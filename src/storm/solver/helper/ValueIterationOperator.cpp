@@ -1,5 +1,7 @@
 #include "storm/solver/helper/ValueIterationOperator.h"
 
+#include <algorithm>
+#include <memory>
 #include <optional>
 
 #include "storm/adapters/RationalNumberAdapter.h"
@@ -11,6 +13,24 @@ template<typename ValueType, bool TrivialRowGrouping>
 template<bool Backward>
 void ValueIterationOperator<ValueType, TrivialRowGrouping>::setMatrix(storm::storage::SparseMatrix<ValueType> const& matrix,
                                                                       std::vector<IndexType> const* rowGroupIndices) {
+    if (ownedMatrix.get() != &matrix) {
+        ownedMatrix.reset();
+    }
+    initialize<Backward>(matrix, rowGroupIndices);
+}
+
+template<typename ValueType, bool TrivialRowGrouping>
+template<bool Backward>
+void ValueIterationOperator<ValueType, TrivialRowGrouping>::setMatrix(storm::storage::SparseMatrix<ValueType>&& matrix,
+                                                                      std::vector<IndexType> const* rowGroupIndices) {
+    ownedMatrix = std::make_unique<storm::storage::SparseMatrix<ValueType>>(std::move(matrix));
+    initialize<Backward>(*ownedMatrix, rowGroupIndices);
+}
+
+template<typename ValueType, bool TrivialRowGrouping>
+template<bool Backward>
+void ValueIterationOperator<ValueType, TrivialRowGrouping>::initialize(storm::storage::SparseMatrix<ValueType> const& matrix,
+                                                                       std::vector<IndexType> const* rowGroupIndices) {
     if constexpr (TrivialRowGrouping) {
         STORM_LOG_ASSERT(matrix.hasTrivialRowGrouping(), "Expected a matrix with trivial row grouping");
         STORM_LOG_ASSERT(rowGroupIndices == nullptr, "Row groups given, but grouping is supposed to be trivial.");
@@ -21,38 +41,41 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping>::setMatrix(storm::sto
         } else {
             this->rowGroupIndices = &matrix.getRowGroupIndices();
         }
+        STORM_LOG_ASSERT(std::adjacent_find(this->rowGroupIndices->begin(), this->rowGroupIndices->end()) == this->rowGroupIndices->end(),
+                         "There is an empty row group. This is not expected.");
     }
+    this->matrix = &matrix;
+    this->matrixEntries = matrix.getEntryCount() > 0 ? &*matrix.begin() : nullptr;
+    this->rowIndications = &matrix.getRowIndications();
     this->backwards = Backward;
     this->hasSkippedRows = false;
-    auto const numRows = matrix.getRowCount();
-    matrixValues.clear();
-    matrixColumns.clear();
-    matrixValues.reserve(matrix.getNonzeroEntryCount());
-    matrixColumns.reserve(matrix.getNonzeroEntryCount() + numRows + 1);  // matrixColumns also contain indications for when a row(group) starts
-    if constexpr (!TrivialRowGrouping) {
-        matrixColumns.push_back(StartOfRowGroupIndicator);  // indicate start of first row(group)
-        for (auto groupIndex : indexRange<Backward>(0, this->rowGroupIndices->size() - 1)) {
-            STORM_LOG_ASSERT(this->rowGroupIndices->at(groupIndex) != this->rowGroupIndices->at(groupIndex + 1),
-                             "There is an empty row group. This is not expected.");
-            for (auto rowIndex : indexRange<false>((*this->rowGroupIndices)[groupIndex], (*this->rowGroupIndices)[groupIndex + 1])) {
-                for (auto const& entry : matrix.getRow(rowIndex)) {
-                    matrixValues.push_back(entry.getValue());
-                    matrixColumns.push_back(entry.getColumn());
-                }
-                matrixColumns.push_back(StartOfRowIndicator);  // Indicate start of next row
-            }
-            matrixColumns.back() = StartOfRowGroupIndicator;  // This is the start of the next row group
-        }
-    } else {
-        matrixColumns.push_back(StartOfRowIndicator);  // Indicate start of first row
-        for (auto rowIndex : indexRange<Backward>(0, numRows)) {
-            for (auto const& entry : matrix.getRow(rowIndex)) {
-                matrixValues.push_back(entry.getValue());
-                matrixColumns.push_back(entry.getColumn());
-            }
-            matrixColumns.push_back(StartOfRowIndicator);  // Indicate start of next row
+    std::vector<bool>().swap(ignoredRows);
+    computePieces();
+}
+
+template<typename ValueType, bool TrivialRowGrouping>
+void ValueIterationOperator<ValueType, TrivialRowGrouping>::computePieces() {
+    pieceStarts.clear();
+    if (storm::utility::getNumberOfThreads<ValueType>(numberOfThreads) <= 1 || matrix == nullptr) {
+        return;
+    }
+    IndexType const numberOfGroups = TrivialRowGrouping ? matrix->getRowCount() : rowGroupIndices->size() - 1;
+    // Create a few pieces per thread to balance the load but avoid pieces that are too small to be worth the overhead.
+    // The size of a piece is measured as the number of its rows plus the number of its entries.
+    uint64_t const pieceSize = std::max<uint64_t>(1ull << 14, (matrix->getRowCount() + matrix->getEntryCount()) / (numberOfThreads * 8));
+    uint64_t currentPieceSize = 0;
+    pieceStarts.push_back(0);
+    for (IndexType position = 0; position < numberOfGroups; ++position) {
+        if (currentPieceSize >= pieceSize) {
+            pieceStarts.push_back(position);
+            currentPieceSize = 0;
         }
+        IndexType const groupIndex = backwards ? numberOfGroups - 1 - position : position;
+        IndexType const firstRow = TrivialRowGrouping ? groupIndex : (*rowGroupIndices)[groupIndex];
+        IndexType const endRow = TrivialRowGrouping ? groupIndex + 1 : (*rowGroupIndices)[groupIndex + 1];
+        currentPieceSize += endRow - firstRow + (*rowIndications)[endRow] - (*rowIndications)[firstRow];
     }
+    pieceStarts.push_back(numberOfGroups);
 }
 
 template<typename ValueType, bool TrivialRowGrouping>
@@ -61,61 +84,46 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping>::setMatrixForwards(st
     setMatrix<false>(matrix, rowGroupIndices);
 }
 
+template<typename ValueType, bool TrivialRowGrouping>
+void ValueIterationOperator<ValueType, TrivialRowGrouping>::setMatrixForwards(storm::storage::SparseMatrix<ValueType>&& matrix,
+                                                                              std::vector<IndexType> const* rowGroupIndices) {
+    setMatrix<false>(std::move(matrix), rowGroupIndices);
+}
+
 template<typename ValueType, bool TrivialRowGrouping>
 void ValueIterationOperator<ValueType, TrivialRowGrouping>::setMatrixBackwards(storm::storage::SparseMatrix<ValueType> const& matrix,
                                                                                std::vector<IndexType> const* rowGroupIndices) {
     setMatrix<true>(matrix, rowGroupIndices);
 }
 
+template<typename ValueType, bool TrivialRowGrouping>
+void ValueIterationOperator<ValueType, TrivialRowGrouping>::setMatrixBackwards(storm::storage::SparseMatrix<ValueType>&& matrix,
+                                                                               std::vector<IndexType> const* rowGroupIndices) {
+    setMatrix<true>(std::move(matrix), rowGroupIndices);
+}
+
 template<typename ValueType, bool TrivialRowGrouping>
 void ValueIterationOperator<ValueType, TrivialRowGrouping>::unsetIgnoredRows() {
-    for (auto& c : matrixColumns) {
-        if (c >= StartOfRowIndicator) {
-            c &= StartOfRowGroupIndicator;
-        }
-    }
+    std::vector<bool>().swap(ignoredRows);
     hasSkippedRows = false;
 }
 
 template<typename ValueType, bool TrivialRowGrouping>
-template<bool Backward>
 void ValueIterationOperator<ValueType, TrivialRowGrouping>::setIgnoredRows(bool useLocalRowIndices, std::function<bool(IndexType, IndexType)> const& ignore) {
     STORM_LOG_ASSERT(!TrivialRowGrouping, "Tried to ignroe rows but the row grouping is trivial.");
-    auto colIt = matrixColumns.begin();
-    for (auto groupIndex : indexRange<Backward>(0, this->rowGroupIndices->size() - 1)) {
-        STORM_LOG_ASSERT(colIt != matrixColumns.end(), "VI Operator in invalid state.");
-        STORM_LOG_ASSERT(*colIt >= StartOfRowGroupIndicator, "VI Operator in invalid state.");
-        auto const rowIndexRange = useLocalRowIndices ? indexRange<false>(0ull, (*this->rowGroupIndices)[groupIndex + 1] - (*this->rowGroupIndices)[groupIndex])
-                                                      : indexRange<false>((*this->rowGroupIndices)[groupIndex], (*this->rowGroupIndices)[groupIndex + 1]);
-        for (auto const rowIndex : rowIndexRange) {
-            if (!ignore(groupIndex, rowIndex)) {
-                *colIt &= StartOfRowGroupIndicator;  // Clear number of skipped entries
-                moveToEndOfRow(colIt);
-            } else if ((*colIt & SkipNumEntriesMask) == 0) {  // i.e. should ignore but is not already ignored
-                auto currColIt = colIt;
-                moveToEndOfRow(colIt);
-                *currColIt += std::distance(currColIt, colIt);  // set number of skipped entries
-            }
-            STORM_LOG_ASSERT(
-                !std::all_of(rowIndexRange.begin(), rowIndexRange.end(), [&ignore, &groupIndex](IndexType rowIndex) { return ignore(groupIndex, rowIndex); }),
-                "All rows in row group " << groupIndex << " are ignored.");
-            STORM_LOG_ASSERT(colIt != matrixColumns.end(), "VI Operator in invalid state.");
-            STORM_LOG_ASSERT(*colIt >= StartOfRowIndicator, "VI Operator in invalid state.");
+    ignoredRows.assign(matrix->getRowCount(), false);
+    for (IndexType groupIndex = 0; groupIndex + 1 < this->rowGroupIndices->size(); ++groupIndex) {
+        IndexType const firstRow = (*this->rowGroupIndices)[groupIndex];
+        IndexType const endRow = (*this->rowGroupIndices)[groupIndex + 1];
+        for (IndexType rowIndex = firstRow; rowIndex < endRow; ++rowIndex) {
+            ignoredRows[rowIndex] = ignore(groupIndex, useLocalRowIndices ? rowIndex - firstRow : rowIndex);
         }
-        STORM_LOG_ASSERT(*colIt == StartOfRowGroupIndicator, "VI Operator in invalid state.");
+        STORM_LOG_ASSERT(std::find(ignoredRows.begin() + firstRow, ignoredRows.begin() + endRow, false) != ignoredRows.begin() + endRow,
+                         "All rows in row group " << groupIndex << " are ignored.");
     }
     hasSkippedRows = true;
 }
 
-template<typename ValueType, bool TrivialRowGrouping>
-void ValueIterationOperator<ValueType, TrivialRowGrouping>::setIgnoredRows(bool useLocalRowIndices, std::function<bool(IndexType, IndexType)> const& ignore) {
-    if (backwards) {
-        setIgnoredRows<true>(useLocalRowIndices, ignore);
-    } else {
-        setIgnoredRows<false>(useLocalRowIndices, ignore);
-    }
-}
-
 template<typename ValueType, bool TrivialRowGrouping>
 std::vector<typename ValueIterationOperator<ValueType, TrivialRowGrouping>::IndexType> const&
 ValueIterationOperator<ValueType, TrivialRowGrouping>::getRowGroupIndices() const {
@@ -142,34 +150,23 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping>::freeAuxiliaryVector(
 }
 
 template<typename ValueType, bool TrivialRowGrouping>
-void ValueIterationOperator<ValueType, TrivialRowGrouping>::moveToEndOfRow(std::vector<IndexType>::iterator& matrixColumnIt) const {
-    do {
-        ++matrixColumnIt;
-    } while (*matrixColumnIt < StartOfRowIndicator);
+void ValueIterationOperator<ValueType, TrivialRowGrouping>::setNumberOfThreads(uint64_t numberOfThreads) {
+    STORM_LOG_ASSERT(numberOfThreads > 0, "Expected a positive number of threads.");
+    if (this->numberOfThreads == numberOfThreads) {
+        return;
+    }
+    this->numberOfThreads = numberOfThreads;
+    computePieces();
 }
 
 template<typename ValueType, bool TrivialRowGrouping>
-bool ValueIterationOperator<ValueType, TrivialRowGrouping>::skipIgnoredRow(std::vector<IndexType>::const_iterator& matrixColumnIt,
-                                                                           typename std::vector<ValueType>::const_iterator& matrixValueIt) const {
-    if (IndexType entriesToSkip = (*matrixColumnIt & SkipNumEntriesMask)) {
-        matrixColumnIt += entriesToSkip;
-        matrixValueIt += entriesToSkip - 1;
-        return true;
-    }
-    return false;
+bool ValueIterationOperator<ValueType, TrivialRowGrouping>::isParallel() const {
+    return numberOfThreads > 1 && pieceStarts.size() > 2;
 }
 
 template<typename ValueType, bool TrivialRowGrouping>
-uint64_t ValueIterationOperator<ValueType, TrivialRowGrouping>::skipMultipleIgnoredRows(std::vector<IndexType>::const_iterator& matrixColumnIt,
-                                                                                        typename std::vector<ValueType>::const_iterator& matrixValueIt) const {
-    IndexType result{0ull};
-    while (skipIgnoredRow(matrixColumnIt, matrixValueIt)) {
-        ++result;
-        STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "Undexpected state of VI operator");
-        // We (currently) don't use this past the end of a row group, so we may have this additional sanity check:
-        STORM_LOG_ASSERT(*matrixColumnIt < StartOfRowGroupIndicator, "Undexpected state of VI operator");
-    }
-    return result;
+uint64_t ValueIterationOperator<ValueType, TrivialRowGrouping>::getSizeInBytes() const {
+    return ignoredRows.capacity() / 8 + pieceStarts.capacity() * sizeof(IndexType);
 }
 
 template class ValueIterationOperator<double, true>;
@@ -1,24 +1,26 @@
 #pragma once
+#include <array>
 #include <functional>
+#include <iterator>
+#include <memory>
 #include <optional>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include <boost/range/adaptor/reversed.hpp>
 #include <boost/range/irange.hpp>
 
+#include "storm/storage/SparseMatrix.h"
 #include "storm/storage/sparse/StateType.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/simd.h"
 #include "storm/utility/vector.h"  // TODO
 
 namespace storm {
 class Environment;
 
-namespace storage {
-template<typename T>
-class SparseMatrix;
-}
-
 namespace solver::helper {
 
 /*!
@@ -38,27 +40,44 @@ class ValueIterationOperator {
      * @tparam backwards if true, we iterate backwards starting with the largest rowgroup. This often makes in place (Gauss-Seidel) iterations more efficient
      * @param matrix the transition matrix
      * @param rowGroupIndices if given, overwrites the rowGroupIndices of the matrix. Must be nullptr if TrivialRowGrouping is true
-     * @note The reference to the row group indices (either of the matrix or the given pointer) must not be invalidated as long as this operator is used.
+     * @note The operator reads the entries of the given matrix without copying them. Hence, the matrix and the row group indices (either of the matrix or the
+     * given pointer) must not be invalidated as long as this operator is used.
      */
     template<bool Backward = true>
     void setMatrix(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<IndexType> const* rowGroupIndices = nullptr);
 
+    /*!
+     * Same as above, but this operator takes ownership of the given matrix.
+     */
+    template<bool Backward = true>
+    void setMatrix(storm::storage::SparseMatrix<ValueType>&& matrix, std::vector<IndexType> const* rowGroupIndices = nullptr);
+
     /*!
      * Initializes this operator with the given data for forward iterations (starting with the smallest row group
      * @param matrix the transition matrix
      * @param rowGroupIndices if given, overwrites the rowGroupIndices of the matrix. Must be nullptr if TrivialRowGrouping is true
-     * @note The reference to the row group indices (either of the matrix or the given pointer) must not be invalidated as long as this operator is used.
+     * @note The matrix and the row group indices (either of the matrix or the given pointer) must not be invalidated as long as this operator is used.
      */
     void setMatrixForwards(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<IndexType> const* rowGroupIndices = nullptr);
 
+    /*!
+     * Same as above, but this operator takes ownership of the given matrix.
+     */
+    void setMatrixForwards(storm::storage::SparseMatrix<ValueType>&& matrix, std::vector<IndexType> const* rowGroupIndices = nullptr);
+
     /*!
      * Initializes this operator with the given data for backward iterations (starting with the largest row group)
      * @param matrix the transition matrix
      * @param rowGroupIndices if given, overwrites the rowGroupIndices of the matrix. Must be nullptr if TrivialRowGrouping is true
-     * @note The reference to the row group indices (either of the matrix or the given pointer) must not be invalidated as long as this operator is used.
+     * @note The matrix and the row group indices (either of the matrix or the given pointer) must not be invalidated as long as this operator is used.
      */
     void setMatrixBackwards(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<IndexType> const* rowGroupIndices = nullptr);
 
+    /*!
+     * Same as above, but this operator takes ownership of the given matrix.
+     */
+    void setMatrixBackwards(storm::storage::SparseMatrix<ValueType>&& matrix, std::vector<IndexType> const* rowGroupIndices = nullptr);
+
     /*!
      * Applies the operator with the given operands, offsets, and backend.
      * More specifically, for each row group and for each row in a row group,
@@ -77,8 +96,11 @@ class ValueIterationOperator {
      * @tparam OperandType The type of input and output operand. Can be a value vector or a pair of two value vectors with one entry per group.
      *                      In the latter case, the rowResult for backend.firstRow and backend.nextRow is a pair of values and
      *                      applyUpdate gets two operandOutReference's to write the group result to.
+     *                      OperandType can also be a vector of arrays of K values (one array per group), which allows to handle K objectives
+     *                      with a single pass over the matrix. In this case, the rowResult and the operandOutReference are such arrays.
      * @tparam OffsetType The type of row offsets. Can be a single value vector (one entry per row) or a pair of a (pointer to a) value vector and a value.
      *                      The latter case is only valid if OperandType is a pair of two value vectors.
+     *                      If OperandType is a vector of arrays, OffsetType has to be a vector of arrays of the same size (one array per row).
      * @tparam BackendType The type of backend, shall implement the methods above
      * @param operandIn Input operand
      * @param operandOut Output operand
@@ -86,10 +108,35 @@ class ValueIterationOperator {
      * @param backend the backend
      * @return whatever backend.converged() returns
      *
+     * If multiple threads are set (see `setNumberOfThreads`), operandIn and operandOut are different objects, and the backend implements
+     * * backend.merge(otherBackend);
+     * the row groups are processed in parallel (i.e. Jacobi-style). In this case, the row groups are split into consecutive pieces and each piece is
+     * processed with a copy of the backend (created after backend.startNewIteration() was invoked). Before applyUpdate is invoked, operandOut receives
+     * the value of operandIn for the corresponding row group, so that backends observe the same values as for in-place applications. Once all pieces
+     * are processed, the copies are merged into the given backend in the order of the pieces. Hence, all row groups are processed and backend.abort()
+     * is only checked once (after merging). If it returns false, backend.endOfIteration() is invoked.
+     *
      * @note This and other apply methods are intentionally implemented in the header file as there are potentially many different BackendTypes
      */
     template<typename OperandType, typename OffsetType, typename BackendType>
     bool apply(OperandType const& operandIn, OperandType& operandOut, OffsetType const& offsets, BackendType& backend) const {
+        if constexpr (SupportsParallelApplication<BackendType>::value) {
+            if (isParallel() && &operandIn != &operandOut) {
+                if (hasSkippedRows) {
+                    if (backwards) {
+                        return applyParallel<OperandType, OffsetType, BackendType, true, true>(operandOut, operandIn, offsets, backend);
+                    } else {
+                        return applyParallel<OperandType, OffsetType, BackendType, false, true>(operandOut, operandIn, offsets, backend);
+                    }
+                } else {
+                    if (backwards) {
+                        return applyParallel<OperandType, OffsetType, BackendType, true, false>(operandOut, operandIn, offsets, backend);
+                    } else {
+                        return applyParallel<OperandType, OffsetType, BackendType, false, false>(operandOut, operandIn, offsets, backend);
+                    }
+                }
+            }
+        }
         if (hasSkippedRows) {
             if (backwards) {
                 return apply<OperandType, OffsetType, BackendType, true, true>(operandOut, operandIn, offsets, backend);
@@ -145,6 +192,23 @@ class ValueIterationOperator {
      */
     void freeAuxiliaryVector();
 
+    /*!
+     * Sets the (maximal) number of threads used when applying the operator in parallel (see `apply`).
+     * @param numberOfThreads the number of threads. A value of one disables parallel applications.
+     */
+    void setNumberOfThreads(uint64_t numberOfThreads);
+
+    /*!
+     * @return true iff `apply` processes the row groups in parallel, given that the operands differ and the backend supports it.
+     * @note This requires that multiple threads are set and that the matrix is large enough to be split into multiple pieces.
+     */
+    bool isParallel() const;
+
+    /*!
+     * @return the number of bytes occupied by this operator in addition to the matrix (whose entries are not copied).
+     */
+    uint64_t getSizeInBytes() const;
+
    private:
     /*!
      * Internal variant of `apply`
@@ -155,41 +219,86 @@ class ValueIterationOperator {
         STORM_LOG_ASSERT(getSize(operandIn) == getSize(operandOut), "Input and Output Operands have different sizes.");
         auto const operandSize = getSize(operandIn);
         STORM_LOG_ASSERT(TrivialRowGrouping || rowGroupIndices->size() == operandSize + 1, "Dimension mismatch");
+        STORM_LOG_ASSERT(!TrivialRowGrouping || matrix->getRowCount() == operandSize, "Dimension mismatch");
         backend.startNewIteration();
-        auto matrixValueIt = matrixValues.cbegin();
-        auto matrixColumnIt = matrixColumns.cbegin();
         for (auto groupIndex : indexRange<Backward>(0, operandSize)) {
-            STORM_LOG_ASSERT(matrixColumnIt != matrixColumns.end(), "VI Operator in invalid state.");
-            STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "VI Operator in invalid state.");
-            //            STORM_LOG_ASSERT(matrixValueIt != matrixValues.end(), "VI Operator in invalid state.");
-            if constexpr (TrivialRowGrouping) {
-                backend.firstRow(applyRow(matrixColumnIt, matrixValueIt, operandIn, offsets, groupIndex), groupIndex, groupIndex);
-            } else {
-                IndexType rowIndex = (*rowGroupIndices)[groupIndex];
-                if constexpr (SkipIgnoredRows) {
-                    rowIndex += skipMultipleIgnoredRows(matrixColumnIt, matrixValueIt);
+            applyRowGroup<OperandType, OffsetType, BackendType, SkipIgnoredRows, false>(operandOut, operandIn, offsets, backend, groupIndex);
+            if (backend.abort()) {
+                return backend.converged();
+            }
+        }
+        backend.endOfIteration();
+        return backend.converged();
+    }
+
+    /*!
+     * Variant of the internal `apply` that processes pieces of row groups in parallel, each with its own copy of the backend
+     */
+    template<typename OperandType, typename OffsetType, typename BackendType, bool Backward, bool SkipIgnoredRows>
+    bool applyParallel(OperandType& operandOut, OperandType const& operandIn, OffsetType const& offsets, BackendType& backend) const {
+        STORM_LOG_ASSERT(getSize(operandIn) == getSize(operandOut), "Input and Output Operands have different sizes.");
+        auto const operandSize = getSize(operandIn);
+        STORM_LOG_ASSERT(TrivialRowGrouping || rowGroupIndices->size() == operandSize + 1, "Dimension mismatch");
+        STORM_LOG_ASSERT(pieceStarts.back() == operandSize, "Pieces do not match the operand size.");
+        backend.startNewIteration();
+        uint64_t const numberOfPieces = pieceStarts.size() - 1;
+        std::vector<BackendType> pieceBackends(numberOfPieces, backend);
+        storm::utility::ThreadPool::getGlobalPool().parallelFor(
+            0, numberOfPieces,
+            [&](uint64_t piece) {
+                auto& pieceBackend = pieceBackends[piece];
+                for (IndexType position = pieceStarts[piece]; position < pieceStarts[piece + 1]; ++position) {
+                    IndexType const groupIndex = Backward ? operandSize - 1 - position : position;
+                    applyRowGroup<OperandType, OffsetType, BackendType, SkipIgnoredRows, true>(operandOut, operandIn, offsets, pieceBackend, groupIndex);
                 }
-                backend.firstRow(applyRow(matrixColumnIt, matrixValueIt, operandIn, offsets, rowIndex), groupIndex, rowIndex);
-                while (*matrixColumnIt < StartOfRowGroupIndicator) {
+            },
+            numberOfThreads);
+        for (auto const& pieceBackend : pieceBackends) {
+            backend.merge(pieceBackend);
+        }
+        if (backend.abort()) {
+            return backend.converged();
+        }
+        backend.endOfIteration();
+        return backend.converged();
+    }
+
+    /*!
+     * Processes the row group with the given index
+     * @tparam CopyOperand if true, operandOut receives the value of operandIn for this row group before the backend applies the update
+     */
+    template<typename OperandType, typename OffsetType, typename BackendType, bool SkipIgnoredRows, bool CopyOperand>
+    void applyRowGroup(OperandType& operandOut, OperandType const& operandIn, OffsetType const& offsets, BackendType& backend, IndexType groupIndex) const {
+        if constexpr (TrivialRowGrouping) {
+            backend.firstRow(applyRow(groupIndex, operandIn, offsets, groupIndex), groupIndex, groupIndex);
+        } else {
+            IndexType rowIndex = (*rowGroupIndices)[groupIndex];
+            IndexType const rowGroupEnd = (*rowGroupIndices)[groupIndex + 1];
+            if constexpr (SkipIgnoredRows) {
+                while (ignoredRows[rowIndex]) {
                     ++rowIndex;
-                    if (!SkipIgnoredRows || !skipIgnoredRow(matrixColumnIt, matrixValueIt)) {
-                        backend.nextRow(applyRow(matrixColumnIt, matrixValueIt, operandIn, offsets, rowIndex), groupIndex, rowIndex);
-                    }
+                    STORM_LOG_ASSERT(rowIndex < rowGroupEnd, "All rows in row group " << groupIndex << " are ignored.");
                 }
             }
-            if constexpr (isPair<OperandType>::value) {
-                backend.applyUpdate(operandOut.first[groupIndex], operandOut.second[groupIndex], groupIndex);
-            } else {
-                backend.applyUpdate(operandOut[groupIndex], groupIndex);
+            backend.firstRow(applyRow(rowIndex, operandIn, offsets, rowIndex), groupIndex, rowIndex);
+            for (++rowIndex; rowIndex < rowGroupEnd; ++rowIndex) {
+                if (!SkipIgnoredRows || !ignoredRows[rowIndex]) {
+                    backend.nextRow(applyRow(rowIndex, operandIn, offsets, rowIndex), groupIndex, rowIndex);
+                }
             }
-            if (backend.abort()) {
-                return backend.converged();
+        }
+        if constexpr (isPair<OperandType>::value) {
+            if constexpr (CopyOperand) {
+                operandOut.first[groupIndex] = operandIn.first[groupIndex];
+                operandOut.second[groupIndex] = operandIn.second[groupIndex];
+            }
+            backend.applyUpdate(operandOut.first[groupIndex], operandOut.second[groupIndex], groupIndex);
+        } else {
+            if constexpr (CopyOperand) {
+                operandOut[groupIndex] = operandIn[groupIndex];
             }
+            backend.applyUpdate(operandOut[groupIndex], groupIndex);
         }
-        STORM_LOG_ASSERT(matrixColumnIt + 1 == matrixColumns.cend(), "Unexpected position of matrix column iterator.");
-        STORM_LOG_ASSERT(matrixValueIt == matrixValues.cend(), "Unexpected position of matrix column iterator.");
-        backend.endOfIteration();
-        return backend.converged();
     }
 
     // Auxiliary methods to deal with various OperandTypes and OffsetTypes
@@ -212,19 +321,32 @@ class ValueIterationOperator {
     }
 
     /*!
-     * Computes the result for a single row and advances the given iterators to the end of the row
+     * Computes the result for the given row of the matrix
      */
     template<typename OperandType, typename OffsetType>
-    auto applyRow(std::vector<IndexType>::const_iterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt,
-                  OperandType const& operand, OffsetType const& offsets, uint64_t offsetIndex) const {
-        STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "VI Operator in invalid state.");
+    auto applyRow(IndexType rowIndex, OperandType const& operand, OffsetType const& offsets, uint64_t offsetIndex) const {
         auto result{initializeRowRes(operand, offsets, offsetIndex)};
-        for (++matrixColumnIt; *matrixColumnIt < StartOfRowIndicator; ++matrixColumnIt, ++matrixValueIt) {
+        auto entryIt = matrixEntries + (*rowIndications)[rowIndex];
+        auto const entryEnd = matrixEntries + (*rowIndications)[rowIndex + 1];
+        if constexpr (std::is_same_v<ValueType, double> && std::is_same_v<OperandType, std::vector<double>>) {
+            // Long rows are processed with vector instructions (if supported by the CPU).
+            uint64_t const numberOfEntries = entryEnd - entryIt;
+            if (numberOfEntries >= storm::utility::simd::MinimalNumberOfVectorizedEntries) {
+                result += storm::utility::simd::gatherDotProduct(entryIt, numberOfEntries, operand.data());
+                return result;
+            }
+        }
+        for (; entryIt != entryEnd; ++entryIt) {
             if constexpr (isPair<OperandType>::value) {
-                result.first += operand.first[*matrixColumnIt] * (*matrixValueIt);
-                result.second += operand.second[*matrixColumnIt] * (*matrixValueIt);
+                result.first += operand.first[entryIt->getColumn()] * entryIt->getValue();
+                result.second += operand.second[entryIt->getColumn()] * entryIt->getValue();
+            } else if constexpr (isArray<typename OperandType::value_type>::value) {
+                auto const& operandValues = operand[entryIt->getColumn()];
+                for (uint64_t i = 0; i < operandValues.size(); ++i) {
+                    result[i] += operandValues[i] * entryIt->getValue();
+                }
             } else {
-                result += operand[*matrixColumnIt] * (*matrixValueIt);
+                result += operand[entryIt->getColumn()] * entryIt->getValue();
             }
         }
         return result;
@@ -256,38 +378,54 @@ class ValueIterationOperator {
     template<typename T1, typename T2>
     struct isPair<std::pair<T1, T2>> : std::true_type {};
 
+    template<typename>
+    struct isArray : std::false_type {};
+
+    template<typename T, std::size_t K>
+    struct isArray<std::array<T, K>> : std::true_type {};
+
+    template<typename BackendType, typename = void>
+    struct SupportsParallelApplication : std::false_type {};
+
+    template<typename BackendType>
+    struct SupportsParallelApplication<BackendType, std::void_t<decltype(std::declval<BackendType&>().merge(std::declval<BackendType const&>()))>>
+        : std::true_type {};
+
     /*!
-     * Internal variant of setIgnoredRows
+     * Initializes the data that is derived from the matrix (the matrix is not copied)
      */
-    template<bool Backward = true>
-    void setIgnoredRows(bool useLocalRowIndices, std::function<bool(IndexType, IndexType)> const& ignore);
+    template<bool Backward>
+    void initialize(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<IndexType> const* rowGroupIndices);
 
     /*!
-     * Moves the given iterator to the end of the current row
+     * Splits the row groups (in the order in which they are processed) into pieces that can be processed in parallel
      */
-    void moveToEndOfRow(std::vector<IndexType>::iterator& matrixColumnIt) const;
+    void computePieces();
 
     /*!
-     * Skips the current row, if it is ignored. Advances the iterators accordingly
+     * The matrix whose entries are read when applying the operator.
      */
-    bool skipIgnoredRow(std::vector<IndexType>::const_iterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt) const;
+    storm::storage::SparseMatrix<ValueType> const* matrix{nullptr};
 
     /*!
-     * Skips all ignored rows, advancing the iterators to the first successor row that is not ignored
+     * Holds the matrix if this operator took ownership of it.
      */
-    uint64_t skipMultipleIgnoredRows(std::vector<IndexType>::const_iterator& matrixColumnIt,
-                                     typename std::vector<ValueType>::const_iterator& matrixValueIt) const;
+    std::unique_ptr<storm::storage::SparseMatrix<ValueType>> ownedMatrix;
 
     /*!
-     * The non-zero matrix entries.
+     * Points to the first entry of the matrix. The entries of row i are the ones in [rowIndications[i], rowIndications[i + 1]).
      */
-    std::vector<ValueType> matrixValues;
+    storm::storage::MatrixEntry<IndexType, ValueType> const* matrixEntries{nullptr};
 
     /*!
-     * Row indicators and columns of the matrix entries. Has size #non-zero matrix entries + #rows + 1
-     * A row indicator is an index >= 1000...000. Before and after each row there is a row indicator.
+     * The row indications of the matrix.
      */
-    std::vector<IndexType> matrixColumns;
+    std::vector<IndexType> const* rowIndications{nullptr};
+
+    /*!
+     * Is true at the index of each row that is ignored. Only used if hasSkippedRows is true.
+     */
+    std::vector<bool> ignoredRows;
 
     /*!
      * Row group indices as in the sparse matrix (even if the matrix is set in backwards order, this vector will not be reversed)
@@ -315,19 +453,15 @@ class ValueIterationOperator {
     bool auxiliaryVectorUsedExternally{false};
 
     /*!
-     * Bitmask that indicates the start of a row in the 'matrixColumns' vector
-     */
-    IndexType const StartOfRowIndicator = 1ull << 63;  // 10000..0
-
-    /*!
-     * Bitmask that indicates the start of a row group in the 'matrixColumns' vector
+     * The position (w.r.t. the processing order) of the first row group of each piece of row groups that can be processed in parallel,
+     * followed by an entry that marks the end of the last piece
      */
-    IndexType const StartOfRowGroupIndicator = StartOfRowIndicator + (1ull << 62);  // 11000..0
+    std::vector<IndexType> pieceStarts;
 
     /*!
-     * Ignored rows are encoded by adding the number of skipped entries to the row indicator. This Bitmask helps to get the number of skipped entries
+     * The number of threads used for parallel applications
      */
-    IndexType const SkipNumEntriesMask = ~StartOfRowGroupIndicator;  // 00111..1
+    uint64_t numberOfThreads{1};
 };
 
 }  // namespace solver::helper
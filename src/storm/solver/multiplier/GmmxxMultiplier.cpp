@@ -1,13 +1,12 @@
 #include "GmmxxMultiplier.h"
 
-#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
-#include "storm/settings/SettingsManager.h"
-#include "storm/settings/modules/CoreSettings.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/storage/SparseMatrix.h"
 
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/constants.h"
 
 #include "storm/utility/macros.h"
@@ -35,11 +34,7 @@ void GmmxxMultiplier<ValueType>::clearCache() const {
 
 template<typename ValueType>
 bool GmmxxMultiplier<ValueType>::parallelize(Environment const& env) const {
-#ifdef STORM_HAVE_INTELTBB
-    return storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
-#else
-    return false;
-#endif
+    return storm::utility::getNumberOfThreads<ValueType>(env.solver().getNumberOfThreads()) > 1;
 }
 
 template<typename ValueType>
@@ -56,7 +51,7 @@ void GmmxxMultiplier<ValueType>::multiply(Environment const& env, std::vector<Va
         target = this->cachedVector.get();
     }
     if (parallelize(env)) {
-        multAddParallel(x, b, *target);
+        multAddParallel(x, b, *target, env.solver().getNumberOfThreads());
     } else {
         multAdd(x, b, *target);
     }
@@ -99,7 +94,7 @@ void GmmxxMultiplier<ValueType>::multiplyAndReduce(Environment const& env, Optim
         target = this->cachedVector.get();
     }
     if (parallelize(env)) {
-        multAddReduceParallel(dir, rowGroupIndices, x, b, *target, choices);
+        multAddReduceParallel(dir, rowGroupIndices, x, b, *target, choices, env.solver().getNumberOfThreads());
     } else {
         multAddReduceHelper(dir, rowGroupIndices, x, b, *target, choices, false);
     }
@@ -269,39 +264,37 @@ void GmmxxMultiplier<storm::RationalFunction>::multAddReduceHelper(std::vector<u
 }
 
 template<typename ValueType>
-void GmmxxMultiplier<ValueType>::multAddParallel(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
-#ifdef STORM_HAVE_INTELTBB
-    if (b) {
-        if (b == &result) {
-            gmm::mult_add_parallel(gmmMatrix, x, result);
-        } else {
-            gmm::mult_add_parallel(gmmMatrix, x, *b, result);
-        }
-    } else {
-        gmm::mult_parallel(gmmMatrix, x, result);
-    }
-#else
-    STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
-    multAdd(x, b, result);
-#endif
+void GmmxxMultiplier<ValueType>::multAddParallel(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                                  uint64_t numberOfThreads) const {
+    typedef gmm::csr_matrix<ValueType> MatrixType;
+    storm::utility::ThreadPool::getGlobalPool().parallelForBlocks(
+        0, gmm::mat_nrows(gmmMatrix), 1024,
+        [&](uint64_t startRow, uint64_t endRow) {
+            auto itr = mat_row_const_begin(gmmMatrix) + startRow;
+            for (uint64_t row = startRow; row < endRow; ++row, ++itr) {
+                ValueType newValue = b ? (*b)[row] : storm::utility::zero<ValueType>();
+                newValue += vect_sp(gmm::linalg_traits<MatrixType>::row(itr), x);
+                result[row] = newValue;
+            }
+        },
+        numberOfThreads);
 }
 
-#ifdef STORM_HAVE_INTELTBB
 template<typename ValueType, typename Compare>
-class TbbMultAddReduceFunctor {
+class ParallelMultAddReduceFunctor {
    public:
-    TbbMultAddReduceFunctor(std::vector<uint64_t> const& rowGroupIndices, gmm::csr_matrix<ValueType> const& matrix, std::vector<ValueType> const& x,
-                            std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices)
+    ParallelMultAddReduceFunctor(std::vector<uint64_t> const& rowGroupIndices, gmm::csr_matrix<ValueType> const& matrix, std::vector<ValueType> const& x,
+                                 std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices)
         : rowGroupIndices(rowGroupIndices), matrix(matrix), x(x), b(b), result(result), choices(choices) {
         // Intentionally left empty.
     }
 
-    void operator()(tbb::blocked_range<unsigned long> const& range) const {
+    void operator()(uint64_t startGroup, uint64_t endGroup) const {
         typedef std::vector<ValueType> VectorType;
         typedef gmm::csr_matrix<ValueType> MatrixType;
 
-        auto groupIt = rowGroupIndices.begin() + range.begin();
-        auto groupIte = rowGroupIndices.begin() + range.end();
+        auto groupIt = rowGroupIndices.begin() + startGroup;
+        auto groupIte = rowGroupIndices.begin() + endGroup;
 
         auto itr = mat_row_const_begin(matrix) + *groupIt;
         typename std::vector<ValueType>::const_iterator bIt;
@@ -310,10 +303,10 @@ class TbbMultAddReduceFunctor {
         }
         typename std::vector<uint64_t>::iterator choiceIt;
         if (choices) {
-            choiceIt = choices->begin() + range.begin();
+            choiceIt = choices->begin() + startGroup;
         }
 
-        auto resultIt = result.begin() + range.begin();
+        auto resultIt = result.begin() + startGroup;
 
         // Variables for correctly tracking choices (only update if new choice is strictly better).
         ValueType oldSelectedChoiceValue;
@@ -372,25 +365,22 @@ class TbbMultAddReduceFunctor {
     std::vector<ValueType>& result;
     std::vector<uint64_t>* choices;
 };
-#endif
 
 template<typename ValueType>
 void GmmxxMultiplier<ValueType>::multAddReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
                                                        std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
-                                                       std::vector<uint64_t>* choices) const {
-#ifdef STORM_HAVE_INTELTBB
+                                                       std::vector<uint64_t>* choices, uint64_t numberOfThreads) const {
     if (dir == storm::OptimizationDirection::Minimize) {
-        tbb::parallel_for(tbb::blocked_range<unsigned long>(0, rowGroupIndices.size() - 1, 100),
-                          TbbMultAddReduceFunctor<ValueType, storm::utility::ElementLess<ValueType>>(rowGroupIndices, this->gmmMatrix, x, b, result, choices));
+        storm::utility::ThreadPool::getGlobalPool().parallelForBlocks(
+            0, rowGroupIndices.size() - 1, 1024,
+            ParallelMultAddReduceFunctor<ValueType, storm::utility::ElementLess<ValueType>>(rowGroupIndices, this->gmmMatrix, x, b, result, choices),
+            numberOfThreads);
     } else {
-        tbb::parallel_for(
-            tbb::blocked_range<unsigned long>(0, rowGroupIndices.size() - 1, 100),
-            TbbMultAddReduceFunctor<ValueType, storm::utility::ElementGreater<ValueType>>(rowGroupIndices, this->gmmMatrix, x, b, result, choices));
+        storm::utility::ThreadPool::getGlobalPool().parallelForBlocks(
+            0, rowGroupIndices.size() - 1, 1024,
+            ParallelMultAddReduceFunctor<ValueType, storm::utility::ElementGreater<ValueType>>(rowGroupIndices, this->gmmMatrix, x, b, result, choices),
+            numberOfThreads);
     }
-#else
-    STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
-    multAddReduceHelper(dir, rowGroupIndices, x, b, result, choices);
-#endif
 }
 
 template<>
@@ -398,7 +388,8 @@ void GmmxxMultiplier<storm::RationalFunction>::multAddReduceParallel(storm::solv
                                                                      std::vector<uint64_t> const& rowGroupIndices,
                                                                      std::vector<storm::RationalFunction> const& x,
                                                                      std::vector<storm::RationalFunction> const* b,
-                                                                     std::vector<storm::RationalFunction>& result, std::vector<uint64_t>* choices) const {
+                                                                     std::vector<storm::RationalFunction>& result, std::vector<uint64_t>* choices,
+                                                                     uint64_t numberOfThreads) const {
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
 }
 
@@ -3,15 +3,14 @@
 #include "storm-config.h"
 
 #include "storm/environment/solver/MultiplierEnvironment.h"
-#include "storm/settings/SettingsManager.h"
-#include "storm/settings/modules/CoreSettings.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/storage/SparseMatrix.h"
 
-#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -24,11 +23,7 @@ NativeMultiplier<ValueType>::NativeMultiplier(storm::storage::SparseMatrix<Value
 
 template<typename ValueType>
 bool NativeMultiplier<ValueType>::parallelize(Environment const& env) const {
-#ifdef STORM_HAVE_INTELTBB
-    return storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
-#else
-    return false;
-#endif
+    return storm::utility::getNumberOfThreads<ValueType>(env.solver().getNumberOfThreads()) > 1;
 }
 
 template<typename ValueType>
@@ -44,7 +39,7 @@ void NativeMultiplier<ValueType>::multiply(Environment const& env, std::vector<V
         target = this->cachedVector.get();
     }
     if (parallelize(env)) {
-        multAddParallel(x, b, *target);
+        multAddParallel(x, b, *target, env.solver().getNumberOfThreads());
     } else {
         multAdd(x, b, *target);
     }
@@ -77,7 +72,7 @@ void NativeMultiplier<ValueType>::multiplyAndReduce(Environment const& env, Opti
         target = this->cachedVector.get();
     }
     if (parallelize(env)) {
-        multAddReduceParallel(dir, rowGroupIndices, x, b, *target, choices);
+        multAddReduceParallel(dir, rowGroupIndices, x, b, *target, choices, env.solver().getNumberOfThreads());
     } else {
         multAddReduce(dir, rowGroupIndices, x, b, *target, choices);
     }
@@ -126,25 +121,16 @@ void NativeMultiplier<ValueType>::multAddReduce(storm::solver::OptimizationDirec
 }
 
 template<typename ValueType>
-void NativeMultiplier<ValueType>::multAddParallel(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
-#ifdef STORM_HAVE_INTELTBB
-    this->matrix.multiplyWithVectorParallel(x, result, b);
-#else
-    STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
-    multAdd(x, b, result);
-#endif
+void NativeMultiplier<ValueType>::multAddParallel(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                                   uint64_t numberOfThreads) const {
+    this->matrix.multiplyWithVectorParallel(x, result, b, numberOfThreads);
 }
 
 template<typename ValueType>
 void NativeMultiplier<ValueType>::multAddReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
                                                         std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
-                                                        std::vector<uint64_t>* choices) const {
-#ifdef STORM_HAVE_INTELTBB
-    this->matrix.multiplyAndReduceParallel(dir, rowGroupIndices, x, b, result, choices);
-#else
-    STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
-    multAddReduce(dir, rowGroupIndices, x, b, result, choices);
-#endif
+                                                        std::vector<uint64_t>* choices, uint64_t numberOfThreads) const {
+    this->matrix.multiplyAndReduceParallel(dir, rowGroupIndices, x, b, result, choices, numberOfThreads);
 }
 
 template class NativeMultiplier<double>;
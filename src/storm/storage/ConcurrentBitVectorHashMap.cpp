@@ -0,0 +1,435 @@
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "storm/exceptions/InternalException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+// The number of buckets whose keys are moved to a successor table at once.
+static const uint64_t chunkSize = 1024;
+
+template<class ValueType, class Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::ConcurrentBitVectorHashMapIterator(ConcurrentBitVectorHashMap const& map,
+                                                                                                                    uint64_t bucket)
+    : map(map), bucket(bucket) {
+    skipUnoccupiedBuckets();
+}
+
+template<class ValueType, class Hash>
+bool ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator==(ConcurrentBitVectorHashMapIterator const& other) {
+    return &map == &other.map && bucket == other.bucket;
+}
+
+template<class ValueType, class Hash>
+bool ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator!=(ConcurrentBitVectorHashMapIterator const& other) {
+    return !(*this == other);
+}
+
+template<class ValueType, class Hash>
+typename ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator&
+ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator++(int) {
+    ++bucket;
+    skipUnoccupiedBuckets();
+    return *this;
+}
+
+template<class ValueType, class Hash>
+typename ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator&
+ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator++() {
+    ++bucket;
+    skipUnoccupiedBuckets();
+    return *this;
+}
+
+template<class ValueType, class Hash>
+std::pair<storm::storage::BitVector, ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator*() const {
+    return map.getBucketAndValue(bucket);
+}
+
+template<class ValueType, class Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::skipUnoccupiedBuckets() {
+    Table const& table = map.getConsolidatedTable();
+    uint64_t numberOfBuckets = table.getNumberOfBuckets();
+    while (bucket < numberOfBuckets && table.bucketStates[bucket].load(std::memory_order_relaxed) != Occupied) {
+        ++bucket;
+    }
+}
+
+template<class ValueType, class Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::Table::Table(uint64_t bucketSize, uint64_t sizeExponent)
+    : sizeExponent(sizeExponent),
+      bucketStates(new std::atomic<uint8_t>[1ull << sizeExponent]),
+      buckets(bucketSize * (1ull << sizeExponent)),
+      values(1ull << sizeExponent),
+      numberOfOccupiedBuckets(0),
+      successor(nullptr),
+      nextChunkToMove(0),
+      numberOfMovedChunks(0) {
+    for (uint64_t bucket = 0; bucket < getNumberOfBuckets(); ++bucket) {
+        bucketStates[bucket].store(Empty, std::memory_order_relaxed);
+    }
+}
+
+template<class ValueType, class Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::Table::getNumberOfBuckets() const {
+    return 1ull << sizeExponent;
+}
+
+template<class ValueType, class Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, double loadFactor)
+    : loadFactor(loadFactor),
+      bucketSize(bucketSize),
+      currentTable(nullptr),
+      firstTable(nullptr),
+      numberOfActiveOperations(0),
+      numberOfElements(0) {
+    STORM_LOG_ASSERT(bucketSize % 64 == 0, "Bucket size must be a multiple of 64.");
+
+    uint64_t sizeExponent = 1;
+    while (initialSize > 0) {
+        ++sizeExponent;
+        initialSize >>= 1;
+    }
+
+    firstTable = new Table(bucketSize, sizeExponent);
+    currentTable.store(firstTable);
+}
+
+template<class ValueType, class Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::~ConcurrentBitVectorHashMap() {
+    Table* table = firstTable;
+    while (table != nullptr) {
+        Table* successor = table->successor.load();
+        delete table;
+        table = successor;
+    }
+}
+
+template<class ValueType, class Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::size() const {
+    return numberOfElements.load();
+}
+
+template<class ValueType, class Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::capacity() const {
+    beginOperation();
+    Table const* table = currentTable.load();
+    Table const* successor = table->successor.load();
+    while (successor != nullptr) {
+        table = successor;
+        successor = table->successor.load();
+    }
+    uint64_t result = table->getNumberOfBuckets();
+    endOperation();
+    return result;
+}
+
+template<class ValueType, class Hash>
+ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAdd(storm::storage::BitVector const& key, ValueType const& value) {
+    return findOrAddAndGetBucket(key, value).first;
+}
+
+template<class ValueType, class Hash>
+std::pair<ValueType, uint64_t> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAddAndGetBucket(storm::storage::BitVector const& key,
+                                                                                                   ValueType const& value) {
+    STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
+    beginOperation();
+    helpMovingEntries();
+    auto result = findOrInsert(currentTable.load(), key, hasher(key), [&value]() { return value; });
+    endOperation();
+    if (std::get<2>(result)) {
+        ++numberOfElements;
+    }
+    return std::make_pair(std::get<0>(result), std::get<1>(result));
+}
+
+template<class ValueType, class Hash>
+std::pair<ValueType, bool> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAddWithGenerator(storm::storage::BitVector const& key,
+                                                                                                std::function<ValueType()> const& valueGenerator) {
+    STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
+    beginOperation();
+    helpMovingEntries();
+    auto result = findOrInsert(currentTable.load(), key, hasher(key), valueGenerator);
+    endOperation();
+    if (std::get<2>(result)) {
+        ++numberOfElements;
+    }
+    return std::make_pair(std::get<0>(result), std::get<2>(result));
+}
+
+template<class ValueType, class Hash>
+std::tuple<ValueType, uint64_t, bool> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrInsert(Table* table, storm::storage::BitVector const& key,
+                                                                                               HashValueType hash,
+                                                                                               std::function<ValueType()> const& valueGenerator) {
+    while (true) {
+        // Keys must not be added to a table that is being replaced, so we need to know whether there is a successor.
+        Table* successor = table->successor.load(std::memory_order_acquire);
+        uint64_t numberOfBuckets = table->getNumberOfBuckets();
+        uint64_t bucket = getInitialBucket(*table, hash);
+        bool continueInSuccessor = false;
+
+        for (uint64_t probes = 0; probes < numberOfBuckets && !continueInSuccessor; ++probes) {
+            uint8_t state = table->bucketStates[bucket].load(std::memory_order_acquire);
+            bool checkNextBucket = false;
+            while (!checkNextBucket && !continueInSuccessor) {
+                if (state == Empty) {
+                    if (successor != nullptr) {
+                        // Seal the bucket, such that no thread adds the key to this table later on.
+                        if (table->bucketStates[bucket].compare_exchange_weak(state, Sealed, std::memory_order_acq_rel)) {
+                            continueInSuccessor = true;
+                        }
+                    } else if (table->bucketStates[bucket].compare_exchange_weak(state, Busy, std::memory_order_acq_rel)) {
+                        // We claimed the bucket, so we can safely write the key and its value.
+                        table->buckets.set(bucket * bucketSize, key);
+                        ValueType value = valueGenerator();
+                        table->values[bucket] = value;
+                        table->bucketStates[bucket].store(Occupied, std::memory_order_release);
+                        if (table->numberOfOccupiedBuckets.fetch_add(1) + 1 >= loadFactor * numberOfBuckets) {
+                            getOrCreateSuccessor(table);
+                        }
+                        return std::make_tuple(value, bucket, true);
+                    }
+                    // Otherwise, the state of the bucket has changed in the meantime and we need to check it again.
+                } else if (state == Busy) {
+                    // Another thread is writing to the bucket, so we need to wait until the key becomes available.
+                    std::this_thread::yield();
+                    state = table->bucketStates[bucket].load(std::memory_order_acquire);
+                } else if (state == Sealed) {
+                    continueInSuccessor = true;
+                } else {
+                    if (table->buckets.matches(bucket * bucketSize, key)) {
+                        return std::make_tuple(table->values[bucket], bucket, false);
+                    }
+                    checkNextBucket = true;
+                }
+            }
+
+            ++bucket;
+            if (bucket == numberOfBuckets) {
+                bucket = 0;
+            }
+        }
+
+        // Either the key cannot be inserted in this table or all buckets are taken. In both cases, we proceed with the successor.
+        table = getOrCreateSuccessor(table);
+    }
+}
+
+template<class ValueType, class Hash>
+std::pair<bool, ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::find(Table const* table, storm::storage::BitVector const& key,
+                                                                             HashValueType hash) const {
+    while (table != nullptr) {
+        uint64_t numberOfBuckets = table->getNumberOfBuckets();
+        uint64_t bucket = getInitialBucket(*table, hash);
+
+        for (uint64_t probes = 0; probes < numberOfBuckets; ++probes) {
+            uint8_t state = table->bucketStates[bucket].load(std::memory_order_acquire);
+            while (state == Busy) {
+                std::this_thread::yield();
+                state = table->bucketStates[bucket].load(std::memory_order_acquire);
+            }
+            if (state == Empty || state == Sealed) {
+                break;
+            }
+            if (table->buckets.matches(bucket * bucketSize, key)) {
+                return std::make_pair(true, table->values[bucket]);
+            }
+            ++bucket;
+            if (bucket == numberOfBuckets) {
+                bucket = 0;
+            }
+        }
+
+        // The key might still be contained in a successor table.
+        table = table->successor.load(std::memory_order_acquire);
+    }
+    return std::make_pair(false, ValueType());
+}
+
+template<class ValueType, class Hash>
+typename ConcurrentBitVectorHashMap<ValueType, Hash>::Table* ConcurrentBitVectorHashMap<ValueType, Hash>::getOrCreateSuccessor(Table* table) {
+    Table* successor = table->successor.load(std::memory_order_acquire);
+    if (successor == nullptr) {
+        STORM_LOG_TRACE("Increasing size of concurrent hash map from " << table->getNumberOfBuckets() << " to " << 2 * table->getNumberOfBuckets() << ".");
+        Table* newTable = new Table(bucketSize, table->sizeExponent + 1);
+        if (table->successor.compare_exchange_strong(successor, newTable, std::memory_order_acq_rel)) {
+            successor = newTable;
+        } else {
+            // Another thread was faster.
+            delete newTable;
+        }
+    }
+    return successor;
+}
+
+template<class ValueType, class Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::getNumberOfChunks(Table const& table) const {
+    return (table.getNumberOfBuckets() + chunkSize - 1) / chunkSize;
+}
+
+template<class ValueType, class Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::helpMovingEntries() {
+    Table* table = currentTable.load(std::memory_order_acquire);
+    if (table->successor.load(std::memory_order_acquire) == nullptr) {
+        return;
+    }
+
+    uint64_t numberOfChunks = getNumberOfChunks(*table);
+    uint64_t chunk = table->nextChunkToMove.fetch_add(1);
+    if (chunk < numberOfChunks) {
+        moveChunk(table, chunk);
+        if (table->numberOfMovedChunks.fetch_add(1) + 1 == numberOfChunks) {
+            // All keys have been moved, so subsequent operations can start with the successor.
+            Table* expected = table;
+            currentTable.compare_exchange_strong(expected, table->successor.load(), std::memory_order_acq_rel);
+        }
+    }
+}
+
+template<class ValueType, class Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::moveChunk(Table* table, uint64_t chunk) {
+    Table* successor = table->successor.load(std::memory_order_acquire);
+    uint64_t lastBucket = std::min((chunk + 1) * chunkSize, table->getNumberOfBuckets());
+    for (uint64_t bucket = chunk * chunkSize; bucket < lastBucket; ++bucket) {
+        uint8_t state = table->bucketStates[bucket].load(std::memory_order_acquire);
+        while (state == Empty || state == Busy) {
+            if (state == Empty) {
+                // Make sure that no key is added to this bucket anymore.
+                if (table->bucketStates[bucket].compare_exchange_weak(state, Sealed, std::memory_order_acq_rel)) {
+                    state = Sealed;
+                }
+            } else {
+                std::this_thread::yield();
+                state = table->bucketStates[bucket].load(std::memory_order_acquire);
+            }
+        }
+        if (state == Occupied) {
+            storm::storage::BitVector key = table->buckets.get(bucket * bucketSize, bucketSize);
+            ValueType value = table->values[bucket];
+            findOrInsert(successor, key, hasher(key), [&value]() { return value; });
+            table->bucketStates[bucket].store(Moved, std::memory_order_release);
+        }
+    }
+}
+
+template<class ValueType, class Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::beginOperation() const {
+    numberOfActiveOperations.fetch_add(1);
+}
+
+template<class ValueType, class Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::endOperation() const {
+    // The current table has to be determined while this operation is still registered: operations that start after the
+    // deregistration begin at this table (or a later one), so all tables before it are no longer accessed once the
+    // number of active operations drops to zero.
+    uint64_t currentSizeExponent = currentTable.load()->sizeExponent;
+    if (numberOfActiveOperations.fetch_sub(1) != 1) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(releaseMutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        // Another thread is already releasing tables.
+        return;
+    }
+    // The size of the tables grows along the chain, which identifies the tables before the current one even if another
+    // thread has released some of them in the meantime.
+    while (firstTable->sizeExponent < currentSizeExponent) {
+        Table* successor = firstTable->successor.load();
+        delete firstTable;
+        firstTable = successor;
+    }
+}
+
+template<class ValueType, class Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::finishMoving() const {
+    auto& map = const_cast<ConcurrentBitVectorHashMap<ValueType, Hash>&>(*this);
+    Table* table = currentTable.load();
+    while (table->successor.load() != nullptr) {
+        uint64_t numberOfChunks = getNumberOfChunks(*table);
+        for (uint64_t chunk = table->nextChunkToMove.fetch_add(1); chunk < numberOfChunks; chunk = table->nextChunkToMove.fetch_add(1)) {
+            map.moveChunk(table, chunk);
+        }
+        table = table->successor.load();
+    }
+    currentTable.store(table);
+
+    // As there are no concurrent operations, we can release the tables that have been replaced.
+    while (firstTable != table) {
+        Table* successor = firstTable->successor.load();
+        delete firstTable;
+        firstTable = successor;
+    }
+}
+
+template<class ValueType, class Hash>
+typename ConcurrentBitVectorHashMap<ValueType, Hash>::Table const& ConcurrentBitVectorHashMap<ValueType, Hash>::getConsolidatedTable() const {
+    Table const* table = currentTable.load();
+    if (table != firstTable || table->successor.load() != nullptr) {
+        finishMoving();
+        table = currentTable.load();
+    }
+    return *table;
+}
+
+template<class ValueType, class Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::getInitialBucket(Table const& table, HashValueType hash) const {
+    return static_cast<uint64_t>(hash) >> (sizeof(HashValueType) * 8 - table.sizeExponent);
+}
+
+template<class ValueType, class Hash>
+ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::getValue(storm::storage::BitVector const& key) const {
+    beginOperation();
+    std::pair<bool, ValueType> flagValuePair = find(currentTable.load(), key, hasher(key));
+    endOperation();
+    STORM_LOG_ASSERT(flagValuePair.first, "Unknown key.");
+    return flagValuePair.second;
+}
+
+template<class ValueType, class Hash>
+ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::getValue(uint64_t bucket) const {
+    return getConsolidatedTable().values[bucket];
+}
+
+template<class ValueType, class Hash>
+bool ConcurrentBitVectorHashMap<ValueType, Hash>::contains(storm::storage::BitVector const& key) const {
+    beginOperation();
+    bool result = find(currentTable.load(), key, hasher(key)).first;
+    endOperation();
+    return result;
+}
+
+template<class ValueType, class Hash>
+typename ConcurrentBitVectorHashMap<ValueType, Hash>::const_iterator ConcurrentBitVectorHashMap<ValueType, Hash>::begin() const {
+    return const_iterator(*this, 0);
+}
+
+template<class ValueType, class Hash>
+typename ConcurrentBitVectorHashMap<ValueType, Hash>::const_iterator ConcurrentBitVectorHashMap<ValueType, Hash>::end() const {
+    return const_iterator(*this, getConsolidatedTable().getNumberOfBuckets());
+}
+
+template<class ValueType, class Hash>
+std::pair<storm::storage::BitVector, ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::getBucketAndValue(uint64_t bucket) const {
+    Table const& table = getConsolidatedTable();
+    return std::make_pair(table.buckets.get(bucket * bucketSize, bucketSize), table.values[bucket]);
+}
+
+template<class ValueType, class Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::remap(std::function<ValueType(ValueType const&)> const& remapping) {
+    Table& table = const_cast<Table&>(getConsolidatedTable());
+    for (uint64_t bucket = 0; bucket < table.getNumberOfBuckets(); ++bucket) {
+        if (table.bucketStates[bucket].load(std::memory_order_relaxed) == Occupied) {
+            table.values[bucket] = remapping(table.values[bucket]);
+        }
+    }
+}
+
+template class ConcurrentBitVectorHashMap<uint64_t>;
+template class ConcurrentBitVectorHashMap<uint32_t>;
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,325 @@
+#ifndef STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_
+#define STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * This class represents a hash-map whose keys are bit vectors and that can be queried and extended by multiple
+ * threads concurrently. As for BitVectorHashMap, only queries and insertions are supported and the keys must be bit
+ * vectors with a length that is a multiple of 64.
+ *
+ * Insertions and queries do not use locks: buckets are claimed via compare-and-swap operations. If the load of the
+ * map becomes too high, a larger table is allocated and the entries are moved to it incrementally, i.e. every
+ * subsequent insertion moves a small chunk of entries. Until all entries are moved, queries consult the old table
+ * first. Hence, there is no point at which all threads need to wait for the whole map being rehashed. Tables whose
+ * entries have all been moved are released as soon as no concurrent operation is in progress anymore.
+ *
+ * The methods that refer to buckets, iterate over the map or modify the stored values (getBucketAndValue,
+ * getValue(bucket), begin, end, remap) must not be called while other threads modify the map. Bucket indices are
+ * invalidated whenever the map grows.
+ */
+template<typename ValueType, typename Hash = Murmur3BitVectorHash<ValueType>>
+class ConcurrentBitVectorHashMap {
+   public:
+    class ConcurrentBitVectorHashMapIterator {
+       public:
+        /*! Creates an iterator that points to the bucket with the given index in the given map.
+         *
+         * @param map The map of the iterator.
+         * @param bucket The index of the bucket the iterator points to.
+         */
+        ConcurrentBitVectorHashMapIterator(ConcurrentBitVectorHashMap const& map, uint64_t bucket);
+
+        // Methods to compare two iterators.
+        bool operator==(ConcurrentBitVectorHashMapIterator const& other);
+        bool operator!=(ConcurrentBitVectorHashMapIterator const& other);
+
+        // Methods to move iterator forward.
+        ConcurrentBitVectorHashMapIterator& operator++(int);
+        ConcurrentBitVectorHashMapIterator& operator++();
+
+        // Method to retrieve the currently pointed-to bit vector and its mapped-to value.
+        std::pair<storm::storage::BitVector, ValueType> operator*() const;
+
+       private:
+        // Moves the iterator to the next occupied bucket (starting with the current one).
+        void skipUnoccupiedBuckets();
+
+        // The map this iterator refers to.
+        ConcurrentBitVectorHashMap const& map;
+
+        // The bucket this iterator points to.
+        uint64_t bucket;
+    };
+
+    typedef ConcurrentBitVectorHashMapIterator const_iterator;
+
+    /*!
+     * Creates a new hash map with the given bucket size and initial size.
+     *
+     * @param bucketSize The size of the buckets that this map can hold. This value must be a multiple of 64.
+     * @param initialSize The number of buckets that is initially available.
+     * @param loadFactor The load factor that determines at which point the size of the underlying storage is
+     * increased.
+     */
+    ConcurrentBitVectorHashMap(uint64_t bucketSize = 64, uint64_t initialSize = 1000, double loadFactor = 0.75);
+
+    ~ConcurrentBitVectorHashMap();
+
+    ConcurrentBitVectorHashMap(ConcurrentBitVectorHashMap const&) = delete;
+    ConcurrentBitVectorHashMap& operator=(ConcurrentBitVectorHashMap const&) = delete;
+
+    /*!
+     * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+     * key is inserted with the given value. This method may be called concurrently.
+     *
+     * @param key The key to search or insert.
+     * @param value The value that is inserted if the key is not already found in the map.
+     * @return The found value if the key is already contained in the map and the provided new value otherwise.
+     */
+    ValueType findOrAdd(storm::storage::BitVector const& key, ValueType const& value);
+
+    /*!
+     * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+     * key is inserted with the given value. This method may be called concurrently.
+     *
+     * @param key The key to search or insert.
+     * @param value The value that is inserted if the key is not already found in the map.
+     * @return A pair whose first component is the found value if the key is already contained in the map and
+     * the provided new value otherwise and whose second component is the index of the bucket into which the key
+     * was inserted.
+     */
+    std::pair<ValueType, uint64_t> findOrAddAndGetBucket(storm::storage::BitVector const& key, ValueType const& value);
+
+    /*!
+     * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+     * key is inserted with the value obtained from the given generator. The generator is called at most once and
+     * only if the key is inserted, which makes it possible to hand out consecutive values (e.g. state indices)
+     * to the keys in the order in which they are inserted. This method may be called concurrently.
+     *
+     * @param key The key to search or insert.
+     * @param valueGenerator A function producing the value of the key if it is inserted.
+     * @return A pair whose first component is the value of the key and whose second component indicates whether
+     * the key has been inserted by this call.
+     */
+    std::pair<ValueType, bool> findOrAddWithGenerator(storm::storage::BitVector const& key, std::function<ValueType()> const& valueGenerator);
+
+    /*!
+     * Retrieves the key stored in the given bucket (if any) and the value it is mapped to.
+     *
+     * @param bucket The index of the bucket.
+     * @return The content and value of the named bucket.
+     */
+    std::pair<storm::storage::BitVector, ValueType> getBucketAndValue(uint64_t bucket) const;
+
+    /*!
+     * Retrieves the value associated with the given key (if any). If the key does not exist, the behaviour is
+     * undefined. This method may be called concurrently.
+     *
+     * @return The value associated with the given key (if any).
+     */
+    ValueType getValue(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Retrieves the value associated with the given bucket.
+     *
+     * @return The value associated with the given bucket (if any).
+     */
+    ValueType getValue(uint64_t bucket) const;
+
+    /*!
+     * Checks if the given key is already contained in the map. This method may be called concurrently.
+     *
+     * @param key The key to search
+     * @return True if the key is already contained in the map
+     */
+    bool contains(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Retrieves an iterator to the elements of the map.
+     *
+     * @return The iterator.
+     */
+    const_iterator begin() const;
+
+    /*!
+     * Retrieves an iterator that points one past the elements of the map.
+     *
+     * @return The iterator.
+     */
+    const_iterator end() const;
+
+    /*!
+     * Retrieves the size of the map in terms of the number of key-value pairs it stores.
+     *
+     * @return The size of the map.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Retrieves the capacity of the underlying container.
+     *
+     * @return The capacity of the underlying container.
+     */
+    uint64_t capacity() const;
+
+    /*!
+     * Performs a remapping of all values stored by applying the given remapping.
+     *
+     * @param remapping The remapping to apply.
+     */
+    void remap(std::function<ValueType(ValueType const&)> const& remapping);
+
+   private:
+    // The possible states of a bucket.
+    enum BucketState : uint8_t {
+        // The bucket has never been used.
+        Empty = 0,
+        // A thread is currently writing a key to the bucket.
+        Busy = 1,
+        // The bucket holds a key.
+        Occupied = 2,
+        // The bucket holds a key that has been copied to the successor table.
+        Moved = 3,
+        // The bucket is empty, but must not be used anymore, because the table is being replaced.
+        Sealed = 4
+    };
+
+    // A table holding the buckets. The map consists of a chain of tables, where only the last one is not in the
+    // process of being replaced by its successor.
+    struct Table {
+        Table(uint64_t bucketSize, uint64_t sizeExponent);
+
+        uint64_t getNumberOfBuckets() const;
+
+        // The number of buckets is 2^sizeExponent.
+        uint64_t sizeExponent;
+
+        // The state of each bucket.
+        std::unique_ptr<std::atomic<uint8_t>[]> bucketStates;
+
+        // The keys stored in the buckets.
+        storm::storage::BitVector buckets;
+
+        // The values stored in the buckets.
+        std::vector<ValueType> values;
+
+        // The number of buckets that hold a key.
+        std::atomic<uint64_t> numberOfOccupiedBuckets;
+
+        // The table that replaces this one (if any).
+        std::atomic<Table*> successor;
+
+        // The next chunk of buckets whose keys are to be moved to the successor.
+        std::atomic<uint64_t> nextChunkToMove;
+
+        // The number of chunks whose keys have been moved to the successor.
+        std::atomic<uint64_t> numberOfMovedChunks;
+    };
+
+    typedef decltype(std::declval<Hash>()(std::declval<storm::storage::BitVector>())) HashValueType;
+
+    /*!
+     * Searches the given key in the given table and its successors. If it is not found, it is inserted into the
+     * last table with the value retrieved from the given generator.
+     *
+     * @return The value of the key, the bucket in which it is stored and whether the key was inserted.
+     */
+    std::tuple<ValueType, uint64_t, bool> findOrInsert(Table* table, storm::storage::BitVector const& key, HashValueType hash,
+                                                       std::function<ValueType()> const& valueGenerator);
+
+    /*!
+     * Searches the given key in the given table and its successors.
+     *
+     * @return A pair indicating whether the key was found and, if so, its value.
+     */
+    std::pair<bool, ValueType> find(Table const* table, storm::storage::BitVector const& key, HashValueType hash) const;
+
+    /*!
+     * Retrieves the successor of the given table. If there is none yet, a table with twice the size is created.
+     */
+    Table* getOrCreateSuccessor(Table* table);
+
+    /*!
+     * If the current table is being replaced, this moves the keys of one chunk of its buckets to the successor.
+     */
+    void helpMovingEntries();
+
+    /*!
+     * Moves the keys of all buckets in the given chunk of the given table to the successor of the table.
+     */
+    void moveChunk(Table* table, uint64_t chunk);
+
+    /*!
+     * Registers an operation that may access the tables concurrently. While it is registered, no table is released.
+     */
+    void beginOperation() const;
+
+    /*!
+     * Deregisters an operation. If no other operation is in progress, the tables that have been replaced before
+     * the operation ended are released.
+     */
+    void endOperation() const;
+
+    /*!
+     * Moves all remaining keys to the last table and releases all other tables. This must not be called
+     * concurrently with other operations.
+     */
+    void finishMoving() const;
+
+    /*!
+     * Retrieves the table that holds all keys. This must not be called concurrently with other operations.
+     */
+    Table const& getConsolidatedTable() const;
+
+    /*!
+     * Determines the bucket at which the search for a key with the given hash value starts.
+     */
+    uint64_t getInitialBucket(Table const& table, HashValueType hash) const;
+
+    /*!
+     * Retrieves the number of chunks of buckets in the given table.
+     */
+    uint64_t getNumberOfChunks(Table const& table) const;
+
+    // The load factor determining when the size of the map is increased.
+    double loadFactor;
+
+    // The size of one bucket.
+    uint64_t bucketSize;
+
+    // The first table of the chain that holds keys that have not been moved to a successor.
+    mutable std::atomic<Table*> currentTable;
+
+    // The first table of the chain that has not been released.
+    mutable Table* firstTable;
+
+    // The number of operations that currently access the tables.
+    mutable std::atomic<uint64_t> numberOfActiveOperations;
+
+    // Ensures that only one thread releases tables at a time.
+    mutable std::mutex releaseMutex;
+
+    // The number of elements in this map.
+    std::atomic<uint64_t> numberOfElements;
+
+    // Functor object that are used to perform the actual hashing.
+    Hash hasher;
+};
+
+}  // namespace storage
+}  // namespace storm
+
+#endif /* STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_ */
@@ -7,10 +7,14 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/ThreadPool.h"
 
 namespace storm {
 namespace storage {
 
+// The minimal number of states of an MEC candidate for which the SCC decomposition is done in parallel (if multiple threads are requested).
+uint64_t const minimalCandidateSizeForParallelSccDecomposition = 10000;
+
 template<typename ValueType>
 MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition() : Decomposition() {
     // Intentionally left empty.
@@ -25,15 +29,16 @@ MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(
 
 template<typename ValueType>
 MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                                                              storm::storage::SparseMatrix<ValueType> const& backwardTransitions) {
-    performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions);
+                                                                              storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                              uint64_t numberOfThreads) {
+    performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, nullptr, nullptr, nullptr, numberOfThreads);
 }
 
 template<typename ValueType>
 MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                               storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
-                                                                              storm::storage::BitVector const& states) {
-    performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, &states);
+                                                                              storm::storage::BitVector const& states, uint64_t numberOfThreads) {
+    performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, &states, nullptr, nullptr, numberOfThreads);
 }
 
 template<typename ValueType>
@@ -44,6 +49,14 @@ MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(st
     performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, &states, &choices);
 }
 
+template<typename ValueType>
+MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                              storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                              storm::storage::BitVector const& states,
+                                                                              MaximalEndComponentDecomposition const& baseDecomposition) {
+    performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, &states, nullptr, &baseDecomposition);
+}
+
 template<typename ValueType>
 MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::models::sparse::NondeterministicModel<ValueType> const& model,
                                                                               storm::storage::BitVector const& states) {
@@ -74,16 +87,31 @@ MaximalEndComponentDecomposition<ValueType>& MaximalEndComponentDecomposition<Va
 
 template<typename ValueType>
 void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                                                                          storm::storage::SparseMatrix<ValueType> backwardTransitions,
+                                                                                          storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                           storm::storage::BitVector const* states,
-                                                                                          storm::storage::BitVector const* choices) {
+                                                                                          storm::storage::BitVector const* choices,
+                                                                                          MaximalEndComponentDecomposition const* baseDecomposition,
+                                                                                          uint64_t numberOfThreads) {
     // Get some data for convenient access.
     uint_fast64_t numberOfStates = transitionMatrix.getRowGroupCount();
     std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
 
     // Initialize the maximal end component list to be the full state space.
     std::list<StateBlock> endComponentStateSets;
-    if (states) {
+    if (baseDecomposition) {
+        // Every MEC of the subsystem is contained in an MEC of the base decomposition, so we start with the latter (restricted to the subsystem).
+        for (auto const& baseMec : *baseDecomposition) {
+            std::vector<storm::storage::sparse::state_type> candidateStates;
+            for (auto const& stateChoicesPair : baseMec) {
+                if (!states || states->get(stateChoicesPair.first)) {
+                    candidateStates.push_back(stateChoicesPair.first);
+                }
+            }
+            if (!candidateStates.empty()) {
+                endComponentStateSets.emplace_back(candidateStates.begin(), candidateStates.end());
+            }
+        }
+    } else if (states) {
         endComponentStateSets.emplace_back(states->begin(), states->end(), true);
     } else {
         std::vector<storm::storage::sparse::state_type> allStates;
@@ -93,7 +121,24 @@ void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDeco
     }
     storm::storage::BitVector statesToCheck(numberOfStates);
     storm::storage::BitVector includedChoices;
-    if (choices) {
+    if (baseDecomposition) {
+        // Only choices that stay inside an MEC of the base decomposition can stay inside an MEC of the subsystem.
+        includedChoices = storm::storage::BitVector(transitionMatrix.getRowCount(), false);
+        for (auto const& baseMec : *baseDecomposition) {
+            for (auto const& stateChoicesPair : baseMec) {
+                for (auto choice : stateChoicesPair.second) {
+                    includedChoices.set(choice);
+                }
+            }
+        }
+        if (choices) {
+            includedChoices &= *choices;
+        }
+        if (states) {
+            // Exclude choices that originate from or lead to states that are not considered.
+            includedChoices &= transitionMatrix.getRowFilter(*states, *states);
+        }
+    } else if (choices) {
         includedChoices = *choices;
         if (states) {
             // Exclude choices that originate from or lead to states that are not considered.
@@ -115,9 +160,14 @@ void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDeco
         bool mecChanged = false;
 
         // Get an SCC decomposition of the current MEC candidate.
-
-        StronglyConnectedComponentDecomposition<ValueType> sccs(
-            transitionMatrix, StronglyConnectedComponentDecompositionOptions().subsystem(&currMecAsBitVector).choices(&includedChoices).dropNaiveSccs());
+        // Small candidates are not worth the overhead of the parallel algorithm.
+        uint64_t const numberOfSccThreads =
+            mec.size() >= minimalCandidateSizeForParallelSccDecomposition ? storm::utility::getNumberOfThreads<ValueType>(numberOfThreads) : 1;
+        StronglyConnectedComponentDecomposition<ValueType> sccs(transitionMatrix, StronglyConnectedComponentDecompositionOptions()
+                                                                                      .subsystem(&currMecAsBitVector)
+                                                                                      .choices(&includedChoices)
+                                                                                      .dropNaiveSccs()
+                                                                                      .useThreads(numberOfSccThreads));
 
         // We need to do another iteration in case we have either more than once SCC or the SCC is smaller than
         // the MEC canditate itself.
@@ -32,9 +32,10 @@ class MaximalEndComponentDecomposition : public Decomposition<MaximalEndComponen
      *
      * @param transitionMatrix The transition relation of model to decompose into MECs.
      * @param backwardTransition The reversed transition relation.
+     * @param numberOfThreads The number of threads used for the SCC decompositions of large MEC candidates (only for floating point values).
      */
     MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                     storm::storage::SparseMatrix<ValueType> const& backwardTransitions);
+                                     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, uint64_t numberOfThreads = 1);
 
     /*
      * Creates an MEC decomposition of the given subsystem of given model (represented by a row-grouped matrix).
@@ -42,9 +43,11 @@ class MaximalEndComponentDecomposition : public Decomposition<MaximalEndComponen
      * @param transitionMatrix The transition relation of model to decompose into MECs.
      * @param backwardTransition The reversed transition relation.
      * @param states The states of the subsystem to decompose.
+     * @param numberOfThreads The number of threads used for the SCC decompositions of large MEC candidates (only for floating point values).
      */
     MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states);
+                                     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states,
+                                     uint64_t numberOfThreads = 1);
 
     /*
      * Creates an MEC decomposition of the given subsystem of given model (represented by a row-grouped matrix).
@@ -58,6 +61,20 @@ class MaximalEndComponentDecomposition : public Decomposition<MaximalEndComponen
                                      storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states,
                                      storm::storage::BitVector const& choices);
 
+    /*
+     * Creates an MEC decomposition of the given subsystem of given model (represented by a row-grouped matrix) by refining the MEC
+     * decomposition of a larger subsystem. As every MEC of the given subsystem is contained in an MEC of the larger subsystem,
+     * only the states and choices of the MECs of the given decomposition need to be considered.
+     *
+     * @param transitionMatrix The transition relation of model to decompose into MECs.
+     * @param backwardTransition The reversed transition relation.
+     * @param states The states of the subsystem to decompose.
+     * @param baseDecomposition An MEC decomposition of a subsystem that includes the given subsystem (e.g. of the whole model).
+     */
+    MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states,
+                                     MaximalEndComponentDecomposition const& baseDecomposition);
+
     /*!
      * Creates an MEC decomposition of the given subsystem in the given model.
      *
@@ -103,10 +120,13 @@ class MaximalEndComponentDecomposition : public Decomposition<MaximalEndComponen
      * @param backwardTransitions The reversed transition relation.
      * @param states The states of the subsystem to decompose.
      * @param choices The choices of the subsystem to decompose.
+     * @param baseDecomposition If given, an MEC decomposition of a larger subsystem whose MECs are refined.
+     * @param numberOfThreads The number of threads used for the SCC decompositions of large MEC candidates.
      */
     void performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                                 storm::storage::SparseMatrix<ValueType> backwardTransitions, storm::storage::BitVector const* states = nullptr,
-                                                 storm::storage::BitVector const* choices = nullptr);
+                                                 storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                 storm::storage::BitVector const* states = nullptr, storm::storage::BitVector const* choices = nullptr,
+                                                 MaximalEndComponentDecomposition const* baseDecomposition = nullptr, uint64_t numberOfThreads = 1);
 };
 }  // namespace storage
 }  // namespace storm
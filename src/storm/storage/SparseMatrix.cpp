@@ -6,7 +6,9 @@
 
 #include "storm/storage/BitVector.h"
 #include "storm/utility/ConstantsComparator.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/simd.h"
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
@@ -32,21 +34,11 @@ MatrixEntry<IndexType, ValueType>::MatrixEntry(std::pair<IndexType, ValueType>&&
     // Intentionally left empty.
 }
 
-template<typename IndexType, typename ValueType>
-IndexType const& MatrixEntry<IndexType, ValueType>::getColumn() const {
-    return this->entry.first;
-}
-
 template<typename IndexType, typename ValueType>
 void MatrixEntry<IndexType, ValueType>::setColumn(IndexType const& column) {
     this->entry.first = column;
 }
 
-template<typename IndexType, typename ValueType>
-ValueType const& MatrixEntry<IndexType, ValueType>::getValue() const {
-    return this->entry.second;
-}
-
 template<typename IndexType, typename ValueType>
 void MatrixEntry<IndexType, ValueType>::setValue(ValueType const& value) {
     this->entry.second = value;
@@ -762,6 +754,11 @@ typename SparseMatrix<ValueType>::index_type SparseMatrix<ValueType>::getNumRows
     return numRows;
 }
 
+template<typename ValueType>
+std::vector<typename SparseMatrix<ValueType>::index_type> const& SparseMatrix<ValueType>::getRowIndications() const {
+    return rowIndications;
+}
+
 template<typename ValueType>
 std::vector<typename SparseMatrix<ValueType>::index_type> const& SparseMatrix<ValueType>::getRowGroupIndices() const {
     // If there is no current row grouping, we need to create it.
@@ -1676,6 +1673,43 @@ std::vector<ResultValueType> SparseMatrix<ValueType>::getPointwiseProductRowSumV
     return result;
 }
 
+/*!
+ * Adds the products of the matrix entries in [it, ite) with the corresponding entries of the given vector to the given value and moves it to ite.
+ * For double values, long rows are processed with vector instructions (if supported by the CPU).
+ */
+template<typename ValueType, typename IteratorType>
+void addRowTimesVector(IteratorType& it, IteratorType const& ite, std::vector<ValueType> const& vector, ValueType& value) {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        uint64_t const numberOfEntries = std::distance(it, ite);
+        if (numberOfEntries >= storm::utility::simd::MinimalNumberOfVectorizedEntries) {
+            value += storm::utility::simd::gatherDotProduct(&*it, numberOfEntries, vector.data());
+            it = ite;
+            return;
+        }
+    }
+    for (; it != ite; ++it) {
+        value += it->getValue() * vector[it->getColumn()];
+    }
+}
+
+/*!
+ * Same as addRowTimesVector but for the matrix entries in (ite, it], which are traversed backwards.
+ */
+template<typename ValueType, typename IteratorType>
+void addRowTimesVectorBackward(IteratorType& it, IteratorType const& ite, std::vector<ValueType> const& vector, ValueType& value) {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        uint64_t const numberOfEntries = std::distance(ite, it);
+        if (numberOfEntries >= storm::utility::simd::MinimalNumberOfVectorizedEntries) {
+            value += storm::utility::simd::gatherDotProduct(&*std::next(ite), numberOfEntries, vector.data());
+            it = ite;
+            return;
+        }
+    }
+    for (; it != ite; --it) {
+        value += it->getValue() * vector[it->getColumn()];
+    }
+}
+
 template<typename ValueType>
 void SparseMatrix<ValueType>::multiplyWithVector(std::vector<ValueType> const& vector, std::vector<ValueType>& result,
                                                  std::vector<value_type> const* summand) const {
@@ -1718,9 +1752,8 @@ void SparseMatrix<ValueType>::multiplyWithVectorForward(std::vector<ValueType> c
             newValue = storm::utility::zero<ValueType>();
         }
 
-        for (ite = this->begin() + *(rowIterator + 1); it != ite; ++it) {
-            newValue += it->getValue() * vector[it->getColumn()];
-        }
+        ite = this->begin() + *(rowIterator + 1);
+        addRowTimesVector(it, ite, vector, newValue);
 
         *resultIterator = newValue;
     }
@@ -1747,31 +1780,27 @@ void SparseMatrix<ValueType>::multiplyWithVectorBackward(std::vector<ValueType>
             newValue = storm::utility::zero<ValueType>();
         }
 
-        for (ite = this->begin() + *rowIterator - 1; it != ite; --it) {
-            newValue += (it->getValue() * vector[it->getColumn()]);
-        }
+        ite = this->begin() + *rowIterator - 1;
+        addRowTimesVectorBackward(it, ite, vector, newValue);
 
         *resultIterator = newValue;
     }
 }
 
-#ifdef STORM_HAVE_INTELTBB
 template<typename ValueType>
-class TbbMultAddFunctor {
+class ParallelMultAddFunctor {
    public:
     typedef typename storm::storage::SparseMatrix<ValueType>::index_type index_type;
     typedef typename storm::storage::SparseMatrix<ValueType>::value_type value_type;
     typedef typename storm::storage::SparseMatrix<ValueType>::const_iterator const_iterator;
 
-    TbbMultAddFunctor(std::vector<MatrixEntry<index_type, value_type>> const& columnsAndEntries, std::vector<uint64_t> const& rowIndications,
-                      std::vector<ValueType> const& x, std::vector<ValueType>& result, std::vector<value_type> const* summand)
+    ParallelMultAddFunctor(std::vector<MatrixEntry<index_type, value_type>> const& columnsAndEntries, std::vector<uint64_t> const& rowIndications,
+                           std::vector<ValueType> const& x, std::vector<ValueType>& result, std::vector<value_type> const* summand)
         : columnsAndEntries(columnsAndEntries), rowIndications(rowIndications), x(x), result(result), summand(summand) {
         // Intentionally left empty.
     }
 
-    void operator()(tbb::blocked_range<index_type> const& range) const {
-        index_type startRow = range.begin();
-        index_type endRow = range.end();
+    void operator()(uint64_t startRow, uint64_t endRow) const {
         typename std::vector<index_type>::const_iterator rowIterator = rowIndications.begin() + startRow;
         const_iterator it = columnsAndEntries.begin() + *rowIterator;
         const_iterator ite;
@@ -1785,9 +1814,8 @@ class TbbMultAddFunctor {
         for (; resultIterator != resultIteratorEnd; ++rowIterator, ++resultIterator, ++summandIterator) {
             ValueType newValue = summand ? *summandIterator : storm::utility::zero<ValueType>();
 
-            for (ite = columnsAndEntries.begin() + *(rowIterator + 1); it != ite; ++it) {
-                newValue += it->getValue() * x[it->getColumn()];
-            }
+            ite = columnsAndEntries.begin() + *(rowIterator + 1);
+            addRowTimesVector(it, ite, x, newValue);
 
             *resultIterator = newValue;
         }
@@ -1803,19 +1831,18 @@ class TbbMultAddFunctor {
 
 template<typename ValueType>
 void SparseMatrix<ValueType>::multiplyWithVectorParallel(std::vector<ValueType> const& vector, std::vector<ValueType>& result,
-                                                         std::vector<value_type> const* summand) const {
+                                                         std::vector<value_type> const* summand, uint64_t numberOfThreads) const {
     if (&vector == &result) {
         STORM_LOG_WARN(
             "Matrix-vector-multiplication invoked but the target vector uses the same memory as the input vector. This requires to allocate auxiliary memory.");
         std::vector<ValueType> tmpVector(this->getRowCount());
-        multiplyWithVectorParallel(vector, tmpVector);
+        multiplyWithVectorParallel(vector, tmpVector, summand, numberOfThreads);
         result = std::move(tmpVector);
     } else {
-        tbb::parallel_for(tbb::blocked_range<index_type>(0, result.size(), 100),
-                          TbbMultAddFunctor<ValueType>(columnsAndValues, rowIndications, vector, result, summand));
+        storm::utility::ThreadPool::getGlobalPool().parallelForBlocks(
+            0, result.size(), 1024, ParallelMultAddFunctor<ValueType>(columnsAndValues, rowIndications, vector, result, summand), numberOfThreads);
     }
 }
-#endif
 
 template<typename ValueType>
 ValueType SparseMatrix<ValueType>::multiplyRowWithVector(index_type row, std::vector<ValueType> const& vector) const {
@@ -1941,9 +1968,7 @@ void SparseMatrix<ValueType>::multiplyAndReduceForward(std::vector<uint64_t> con
                 ++summandIt;
             }
 
-            for (auto elementIte = this->begin() + *(rowIt + 1); elementIt != elementIte; ++elementIt) {
-                currentValue += elementIt->getValue() * vector[elementIt->getColumn()];
-            }
+            addRowTimesVector(elementIt, this->begin() + *(rowIt + 1), vector, currentValue);
 
             if (choices) {
                 selectedChoice = 0;
@@ -1957,9 +1982,7 @@ void SparseMatrix<ValueType>::multiplyAndReduceForward(std::vector<uint64_t> con
 
             for (; currentRow < *(rowGroupIt + 1); ++rowIt, ++currentRow) {
                 ValueType newValue = summand ? *summandIt : storm::utility::zero<ValueType>();
-                for (auto elementIte = this->begin() + *(rowIt + 1); elementIt != elementIte; ++elementIt) {
-                    newValue += elementIt->getValue() * vector[elementIt->getColumn()];
-                }
+                addRowTimesVector(elementIt, this->begin() + *(rowIt + 1), vector, newValue);
 
                 if (choices && currentRow == *choiceIt + *rowGroupIt) {
                     oldSelectedChoiceValue = newValue;
@@ -2039,9 +2062,7 @@ void SparseMatrix<ValueType>::multiplyAndReduceBackward(std::vector<uint64_t> co
                 --summandIt;
             }
 
-            for (auto elementIte = this->begin() + *rowIt - 1; elementIt != elementIte; --elementIt) {
-                currentValue += elementIt->getValue() * vector[elementIt->getColumn()];
-            }
+            addRowTimesVectorBackward(elementIt, this->begin() + *rowIt - 1, vector, currentValue);
             if (choices) {
                 selectedChoice = currentRow - *rowGroupIt;
                 if (*choiceIt == selectedChoice) {
@@ -2053,9 +2074,7 @@ void SparseMatrix<ValueType>::multiplyAndReduceBackward(std::vector<uint64_t> co
 
             for (uint64_t i = *rowGroupIt + 1, end = *(rowGroupIt + 1); i < end; --rowIt, --currentRow, ++i, --summandIt) {
                 ValueType newValue = summand ? *summandIt : storm::utility::zero<ValueType>();
-                for (auto elementIte = this->begin() + *rowIt - 1; elementIt != elementIte; --elementIt) {
-                    newValue += elementIt->getValue() * vector[elementIt->getColumn()];
-                }
+                addRowTimesVectorBackward(elementIt, this->begin() + *rowIt - 1, vector, newValue);
 
                 if (choices && currentRow == *choiceIt + *rowGroupIt) {
                     oldSelectedChoiceValue = newValue;
@@ -2088,17 +2107,16 @@ void SparseMatrix<storm::RationalFunction>::multiplyAndReduceBackward(Optimizati
 }
 #endif
 
-#ifdef STORM_HAVE_INTELTBB
 template<typename ValueType, typename Compare>
-class TbbMultAddReduceFunctor {
+class ParallelMultAddReduceFunctor {
    public:
     typedef typename storm::storage::SparseMatrix<ValueType>::index_type index_type;
     typedef typename storm::storage::SparseMatrix<ValueType>::value_type value_type;
     typedef typename storm::storage::SparseMatrix<ValueType>::const_iterator const_iterator;
 
-    TbbMultAddReduceFunctor(std::vector<uint64_t> const& rowGroupIndices, std::vector<MatrixEntry<index_type, value_type>> const& columnsAndEntries,
-                            std::vector<uint64_t> const& rowIndications, std::vector<ValueType> const& x, std::vector<ValueType>& result,
-                            std::vector<value_type> const* summand, std::vector<uint64_t>* choices)
+    ParallelMultAddReduceFunctor(std::vector<uint64_t> const& rowGroupIndices, std::vector<MatrixEntry<index_type, value_type>> const& columnsAndEntries,
+                                 std::vector<uint64_t> const& rowIndications, std::vector<ValueType> const& x, std::vector<ValueType>& result,
+                                 std::vector<value_type> const* summand, std::vector<uint64_t>* choices)
         : rowGroupIndices(rowGroupIndices),
           columnsAndEntries(columnsAndEntries),
           rowIndications(rowIndications),
@@ -2109,9 +2127,9 @@ class TbbMultAddReduceFunctor {
         // Intentionally left empty.
     }
 
-    void operator()(tbb::blocked_range<index_type> const& range) const {
-        auto groupIt = rowGroupIndices.begin() + range.begin();
-        auto groupIte = rowGroupIndices.begin() + range.end();
+    void operator()(uint64_t startGroup, uint64_t endGroup) const {
+        auto groupIt = rowGroupIndices.begin() + startGroup;
+        auto groupIte = rowGroupIndices.begin() + endGroup;
 
         auto rowIt = rowIndications.begin() + *groupIt;
         auto elementIt = columnsAndEntries.begin() + *rowIt;
@@ -2121,10 +2139,10 @@ class TbbMultAddReduceFunctor {
         }
         typename std::vector<uint64_t>::iterator choiceIt;
         if (choices) {
-            choiceIt = choices->begin() + range.begin();
+            choiceIt = choices->begin() + startGroup;
         }
 
-        auto resultIt = result.begin() + range.begin();
+        auto resultIt = result.begin() + startGroup;
 
         // Variables for correctly tracking choices (only update if new choice is strictly better).
         ValueType oldSelectedChoiceValue;
@@ -2141,9 +2159,7 @@ class TbbMultAddReduceFunctor {
                     ++summandIt;
                 }
 
-                for (auto elementIte = columnsAndEntries.begin() + *(rowIt + 1); elementIt != elementIte; ++elementIt) {
-                    currentValue += elementIt->getValue() * x[elementIt->getColumn()];
-                }
+                addRowTimesVector(elementIt, columnsAndEntries.begin() + *(rowIt + 1), x, currentValue);
 
                 if (choices) {
                     selectedChoice = 0;
@@ -2157,9 +2173,7 @@ class TbbMultAddReduceFunctor {
 
                 for (; currentRow < *(groupIt + 1); ++rowIt, ++currentRow, ++summandIt) {
                     ValueType newValue = summand ? *summandIt : storm::utility::zero<ValueType>();
-                    for (auto elementIte = columnsAndEntries.begin() + *(rowIt + 1); elementIt != elementIte; ++elementIt) {
-                        newValue += elementIt->getValue() * x[elementIt->getColumn()];
-                    }
+                    addRowTimesVector(elementIt, columnsAndEntries.begin() + *(rowIt + 1), x, newValue);
 
                     if (choices && currentRow == *choiceIt + *groupIt) {
                         oldSelectedChoiceValue = newValue;
@@ -2196,15 +2210,19 @@ class TbbMultAddReduceFunctor {
 template<typename ValueType>
 void SparseMatrix<ValueType>::multiplyAndReduceParallel(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
                                                         std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
-                                                        std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
+                                                        std::vector<ValueType>& result, std::vector<uint64_t>* choices, uint64_t numberOfThreads) const {
     if (dir == storm::OptimizationDirection::Minimize) {
-        tbb::parallel_for(tbb::blocked_range<index_type>(0, rowGroupIndices.size() - 1, 100),
-                          TbbMultAddReduceFunctor<ValueType, storm::utility::ElementLess<ValueType>>(rowGroupIndices, columnsAndValues, rowIndications, vector,
-                                                                                                     result, summand, choices));
+        storm::utility::ThreadPool::getGlobalPool().parallelForBlocks(
+            0, rowGroupIndices.size() - 1, 1024,
+            ParallelMultAddReduceFunctor<ValueType, storm::utility::ElementLess<ValueType>>(rowGroupIndices, columnsAndValues, rowIndications, vector, result,
+                                                                                            summand, choices),
+            numberOfThreads);
     } else {
-        tbb::parallel_for(tbb::blocked_range<index_type>(0, rowGroupIndices.size() - 1, 100),
-                          TbbMultAddReduceFunctor<ValueType, storm::utility::ElementGreater<ValueType>>(rowGroupIndices, columnsAndValues, rowIndications,
-                                                                                                        vector, result, summand, choices));
+        storm::utility::ThreadPool::getGlobalPool().parallelForBlocks(
+            0, rowGroupIndices.size() - 1, 1024,
+            ParallelMultAddReduceFunctor<ValueType, storm::utility::ElementGreater<ValueType>>(rowGroupIndices, columnsAndValues, rowIndications, vector,
+                                                                                               result, summand, choices),
+            numberOfThreads);
     }
 }
 
@@ -2213,11 +2231,11 @@ template<>
 void SparseMatrix<storm::RationalFunction>::multiplyAndReduceParallel(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
                                                                       std::vector<storm::RationalFunction> const& vector,
                                                                       std::vector<storm::RationalFunction> const* summand,
-                                                                      std::vector<storm::RationalFunction>& result, std::vector<uint64_t>* choices) const {
+                                                                      std::vector<storm::RationalFunction>& result, std::vector<uint64_t>* choices,
+                                                                      uint64_t numberOfThreads) const {
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
 }
 #endif
-#endif
 
 template<typename ValueType>
 void SparseMatrix<ValueType>::multiplyAndReduce(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
@@ -14,7 +14,7 @@
 #include "storm/storage/BitVector.h"
 #include "storm/storage/sparse/StateType.h"
 
-#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm-config.h"
 #include "storm/utility/OsDetection.h"
 #include "storm/utility/constants.h"
 
@@ -123,6 +123,17 @@ class MatrixEntry {
     std::pair<index_type, value_type> entry;
 };
 
+// The accessors are defined here so that they can be inlined in tight loops over the entries (e.g. when applying a value iteration operator).
+template<typename IndexType, typename ValueType>
+inline IndexType const& MatrixEntry<IndexType, ValueType>::getColumn() const {
+    return this->entry.first;
+}
+
+template<typename IndexType, typename ValueType>
+inline ValueType const& MatrixEntry<IndexType, ValueType>::getValue() const {
+    return this->entry.second;
+}
+
 /*!
  * Computes the hash value of a matrix entry.
  */
@@ -591,6 +602,13 @@ class SparseMatrix {
      */
     index_type getNumRowsInRowGroups(storm::storage::BitVector const& groupConstraint) const;
 
+    /*!
+     * Returns the row indications of this matrix, i.e., the entries of row i are the entries with index in [rowIndications[i], rowIndications[i + 1]).
+     *
+     * @return The row indications of this matrix.
+     */
+    std::vector<index_type> const& getRowIndications() const;
+
     /*!
      * Returns the grouping of rows of this matrix.
      *
@@ -909,10 +927,15 @@ class SparseMatrix {
                                    std::vector<value_type> const* summand = nullptr) const;
     void multiplyWithVectorBackward(std::vector<value_type> const& vector, std::vector<value_type>& result,
                                     std::vector<value_type> const* summand = nullptr) const;
-#ifdef STORM_HAVE_INTELTBB
-    void multiplyWithVectorParallel(std::vector<value_type> const& vector, std::vector<value_type>& result,
-                                    std::vector<value_type> const* summand = nullptr) const;
-#endif
+
+    /*!
+     * Multiplies the matrix with the given vector as multiplyWithVector, but distributes the rows among the given
+     * number of threads.
+     *
+     * @param numberOfThreads The maximal number of threads to use. If zero, all threads of the global thread pool are used.
+     */
+    void multiplyWithVectorParallel(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr,
+                                    uint64_t numberOfThreads = 0) const;
 
     /*!
      * Multiplies the matrix with the given vector, reduces it according to the given direction and and writes
@@ -944,14 +967,16 @@ class SparseMatrix {
     template<typename Compare>
     void multiplyAndReduceBackward(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* b,
                                    std::vector<ValueType>& result, std::vector<uint64_t>* choices) const;
-#ifdef STORM_HAVE_INTELTBB
+
+    /*!
+     * Multiplies the matrix with the given vector and reduces the result as multiplyAndReduce, but distributes the
+     * row groups among the given number of threads.
+     *
+     * @param numberOfThreads The maximal number of threads to use. If zero, all threads of the global thread pool are used.
+     */
     void multiplyAndReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
                                    std::vector<ValueType> const& vector, std::vector<ValueType> const* b, std::vector<ValueType>& result,
-                                   std::vector<uint64_t>* choices) const;
-    template<typename Compare>
-    void multiplyAndReduceParallel(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* b,
-                                   std::vector<ValueType>& result, std::vector<uint64_t>* choices) const;
-#endif
+                                   std::vector<uint64_t>* choices, uint64_t numberOfThreads = 0) const;
 
     /*!
      * Multiplies a single row of the matrix with the given vector and returns the result
@@ -1,9 +1,16 @@
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 #include <storm/utility/vector.h>
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <numeric>
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/models/sparse/Model.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/macros.h"
 
 #include "storm/exceptions/UnexpectedException.h"
@@ -166,6 +173,511 @@ void performSccDecompositionGCM(storm::storage::SparseMatrix<ValueType> const& t
     }
 }
 
+namespace {
+uint64_t const noColor = std::numeric_limits<uint64_t>::max();
+uint64_t const noPreorderNumber = std::numeric_limits<uint64_t>::max();
+
+// Subproblems with fewer states are not split further but decomposed by the sequential algorithm.
+uint64_t const minimalForwardBackwardSize = 1024;
+
+// The number of states (or SCCs) that are processed by one thread at once.
+uint64_t const blockSize = 1024;
+
+/*!
+ * Computes the SCCs of a (sub)system using several threads.
+ *
+ * The states are partitioned into subproblems such that every SCC is contained in one subproblem. Initially, all states
+ * form one subproblem. After removing states without incoming or outgoing transitions within the subproblem (which
+ * form trivial SCCs), a subproblem is split by a forward-backward step: The states that are forward and backward
+ * reachable from a pivot state form an SCC, and the states that are only forward reachable, only backward reachable and
+ * neither form three new subproblems. Different subproblems are processed in parallel. Subproblems that are small or
+ * that stem from an unbalanced split are decomposed with the path-based algorithm instead, which bounds the overall
+ * effort on graphs where forward-backward steps only split off small SCCs (e.g. long chains).
+ *
+ * States of different subproblems are distinguished by their color. All transitions between different colors are ignored.
+ */
+template<typename ValueType>
+class ParallelSccDecomposer {
+   public:
+    ParallelSccDecomposer(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const* subsystem,
+                          storm::storage::BitVector const* choices, uint64_t numberOfThreads)
+        : transitionMatrix(transitionMatrix),
+          subsystem(subsystem),
+          choices(choices),
+          numberOfThreads(numberOfThreads),
+          numberOfStates(transitionMatrix.getRowGroupCount()),
+          colors(numberOfStates),
+          sccOf(numberOfStates),
+          nonTrivial(numberOfStates, 0),
+          forwardMark(numberOfStates, 0),
+          backwardMark(numberOfStates, 0),
+          inDegree(numberOfStates),
+          outDegree(numberOfStates),
+          preorderNumbers(numberOfStates, noPreorderNumber) {
+        // Intentionally left empty.
+    }
+
+    /*!
+     * Computes the SCCs. They are numbered in the same way as by the path-based algorithm, i.e., every SCC has a larger
+     * index than the SCCs reachable from it. Among SCCs of equal depth, the SCC with the smaller minimal state comes first.
+     */
+    void decompose(storm::storage::BitVector& nonTrivialStates, std::vector<uint_fast64_t>& stateToSccMapping, uint_fast64_t& sccCount,
+                   std::vector<uint_fast64_t>* sccDepths) {
+        auto& threadPool = storm::utility::ThreadPool::getGlobalPool();
+        buildGraph();
+
+        Subproblem initialSubproblem;
+        initialSubproblem.color = nextColor++;
+        initialSubproblem.splitWithForwardBackward = true;
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            if (isInSubsystem(state)) {
+                initialSubproblem.states.push_back(state);
+                colors[state].store(initialSubproblem.color, std::memory_order_relaxed);
+            } else {
+                colors[state].store(noColor, std::memory_order_relaxed);
+            }
+        }
+        std::vector<Subproblem> subproblems;
+        if (!initialSubproblem.states.empty()) {
+            subproblems.push_back(std::move(initialSubproblem));
+        }
+        while (!subproblems.empty()) {
+            std::vector<std::vector<Subproblem>> newSubproblems(subproblems.size());
+            threadPool.parallelFor(
+                0, subproblems.size(), [&](uint64_t index) { processSubproblem(subproblems[index], newSubproblems[index]); }, numberOfThreads);
+            subproblems.clear();
+            for (auto& subproblemsOfIndex : newSubproblems) {
+                std::move(subproblemsOfIndex.begin(), subproblemsOfIndex.end(), std::back_inserter(subproblems));
+            }
+        }
+
+        // Number the SCCs by their depth.
+        uint64_t numberOfSccs = nextScc;
+        std::vector<uint64_t> depths = computeSccDepths(numberOfSccs);
+        std::vector<uint64_t> order(numberOfSccs);
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&](uint64_t const& first, uint64_t const& second) {
+            return depths[first] < depths[second] || (depths[first] == depths[second] && sccStates[sccStarts[first]] < sccStates[sccStarts[second]]);
+        });
+        std::vector<uint64_t> sccToIndex(numberOfSccs);
+        for (uint64_t index = 0; index < numberOfSccs; ++index) {
+            sccToIndex[order[index]] = index;
+        }
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            if (isInSubsystem(state)) {
+                stateToSccMapping[state] = sccToIndex[sccOf[state]];
+                if (nonTrivial[state]) {
+                    nonTrivialStates.set(state, true);
+                }
+            }
+        }
+        if (sccDepths) {
+            sccDepths->resize(numberOfSccs);
+            for (uint64_t scc = 0; scc < numberOfSccs; ++scc) {
+                (*sccDepths)[sccToIndex[scc]] = depths[scc];
+            }
+        }
+        sccCount = numberOfSccs;
+    }
+
+   private:
+    struct Subproblem {
+        std::vector<uint64_t> states;
+        uint64_t color;
+        bool splitWithForwardBackward;
+    };
+
+    bool isInSubsystem(uint64_t state) const {
+        return !subsystem || subsystem->get(state);
+    }
+
+    bool hasColor(uint64_t state, uint64_t color) const {
+        return colors[state].load(std::memory_order_relaxed) == color;
+    }
+
+    template<typename Function>
+    void forEachSuccessor(uint64_t state, Function const& function) const {
+        for (uint64_t row = transitionMatrix.getRowGroupIndices()[state], rowEnd = transitionMatrix.getRowGroupIndices()[state + 1]; row != rowEnd; ++row) {
+            if (choices && !choices->get(row)) {
+                continue;
+            }
+            for (auto const& successor : transitionMatrix.getRow(row)) {
+                if (isInSubsystem(successor.getColumn()) && !storm::utility::isZero(successor.getValue())) {
+                    function(successor.getColumn());
+                }
+            }
+        }
+    }
+
+    /*!
+     * Builds the forward and backward graph of the subsystem.
+     */
+    void buildGraph() {
+        auto& threadPool = storm::utility::ThreadPool::getGlobalPool();
+        forwardStarts.assign(numberOfStates + 1, 0);
+        threadPool.parallelForBlocks(
+            0, numberOfStates, blockSize,
+            [&](uint64_t begin, uint64_t end) {
+                for (uint64_t state = begin; state < end; ++state) {
+                    if (isInSubsystem(state)) {
+                        forEachSuccessor(state, [&](uint64_t successor) {
+                            ++forwardStarts[state + 1];
+                            if (successor == state) {
+                                nonTrivial[state] = 1;
+                            }
+                        });
+                    }
+                }
+            },
+            numberOfThreads);
+        std::partial_sum(forwardStarts.begin(), forwardStarts.end(), forwardStarts.begin());
+
+        std::vector<std::atomic<uint64_t>> backwardPositions(numberOfStates + 1);
+        for (auto& position : backwardPositions) {
+            position.store(0, std::memory_order_relaxed);
+        }
+        forwardTargets.resize(forwardStarts.back());
+        threadPool.parallelForBlocks(
+            0, numberOfStates, blockSize,
+            [&](uint64_t begin, uint64_t end) {
+                for (uint64_t state = begin; state < end; ++state) {
+                    if (isInSubsystem(state)) {
+                        uint64_t position = forwardStarts[state];
+                        forEachSuccessor(state, [&](uint64_t successor) {
+                            forwardTargets[position++] = successor;
+                            backwardPositions[successor + 1].fetch_add(1, std::memory_order_relaxed);
+                        });
+                    }
+                }
+            },
+            numberOfThreads);
+
+        backwardStarts.resize(numberOfStates + 1);
+        for (uint64_t state = 0; state <= numberOfStates; ++state) {
+            backwardStarts[state] = backwardPositions[state].load(std::memory_order_relaxed);
+        }
+        std::partial_sum(backwardStarts.begin(), backwardStarts.end(), backwardStarts.begin());
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            backwardPositions[state].store(backwardStarts[state], std::memory_order_relaxed);
+        }
+        backwardTargets.resize(backwardStarts.back());
+        threadPool.parallelForBlocks(
+            0, numberOfStates, blockSize,
+            [&](uint64_t begin, uint64_t end) {
+                for (uint64_t state = begin; state < end; ++state) {
+                    for (uint64_t index = forwardStarts[state]; index < forwardStarts[state + 1]; ++index) {
+                        backwardTargets[backwardPositions[forwardTargets[index]].fetch_add(1, std::memory_order_relaxed)] = state;
+                    }
+                }
+            },
+            numberOfThreads);
+    }
+
+    /*!
+     * Computes the SCCs within the given subproblem or splits it into new subproblems.
+     */
+    void processSubproblem(Subproblem& subproblem, std::vector<Subproblem>& newSubproblems) {
+        if (subproblem.splitWithForwardBackward) {
+            trim(subproblem);
+        }
+        if (!subproblem.splitWithForwardBackward || subproblem.states.size() < minimalForwardBackwardSize) {
+            decomposePathBased(subproblem);
+            return;
+        }
+
+        uint64_t const color = subproblem.color;
+        uint64_t const pivot = subproblem.states.front();
+        std::vector<uint64_t> forwardReached;
+        std::vector<uint64_t> backwardReached;
+        reach(pivot, color, forwardStarts, forwardTargets, forwardMark, forwardReached);
+        reach(pivot, color, backwardStarts, backwardTargets, backwardMark, backwardReached);
+
+        // The states that are forward and backward reachable from the pivot form its SCC.
+        uint64_t const scc = nextScc++;
+        bool const nonSingletonScc =
+            std::count_if(backwardReached.begin(), backwardReached.end(), [&](uint64_t const& state) { return forwardMark[state] != 0; }) > 1;
+        Subproblem forwardSubproblem, backwardSubproblem, remainingSubproblem;
+        for (auto state : subproblem.states) {
+            if (forwardMark[state] && backwardMark[state]) {
+                sccOf[state] = scc;
+                colors[state].store(noColor, std::memory_order_relaxed);
+                if (nonSingletonScc) {
+                    nonTrivial[state] = 1;
+                }
+            } else if (forwardMark[state]) {
+                forwardSubproblem.states.push_back(state);
+            } else if (backwardMark[state]) {
+                backwardSubproblem.states.push_back(state);
+            } else {
+                remainingSubproblem.states.push_back(state);
+            }
+        }
+        for (auto state : forwardReached) {
+            forwardMark[state] = 0;
+        }
+        for (auto state : backwardReached) {
+            backwardMark[state] = 0;
+        }
+
+        for (auto newSubproblem : {&forwardSubproblem, &backwardSubproblem, &remainingSubproblem}) {
+            if (!newSubproblem->states.empty()) {
+                newSubproblem->color = nextColor++;
+                // Only continue with forward-backward steps if the split was balanced.
+                newSubproblem->splitWithForwardBackward = 4 * newSubproblem->states.size() <= 3 * subproblem.states.size();
+                for (auto state : newSubproblem->states) {
+                    colors[state].store(newSubproblem->color, std::memory_order_relaxed);
+                }
+                newSubproblems.push_back(std::move(*newSubproblem));
+            }
+        }
+    }
+
+    /*!
+     * Removes all states from the subproblem that (transitively) have no incoming or no outgoing transitions within the
+     * subproblem. Each of these states forms a trivial SCC.
+     */
+    void trim(Subproblem& subproblem) {
+        uint64_t const color = subproblem.color;
+        for (auto state : subproblem.states) {
+            inDegree[state] = 0;
+            outDegree[state] = 0;
+            for (uint64_t index = backwardStarts[state]; index < backwardStarts[state + 1]; ++index) {
+                if (hasColor(backwardTargets[index], color)) {
+                    ++inDegree[state];
+                }
+            }
+            for (uint64_t index = forwardStarts[state]; index < forwardStarts[state + 1]; ++index) {
+                if (hasColor(forwardTargets[index], color)) {
+                    ++outDegree[state];
+                }
+            }
+        }
+        std::vector<uint64_t> trimmedStates;
+        for (auto state : subproblem.states) {
+            if (inDegree[state] == 0 || outDegree[state] == 0) {
+                colors[state].store(noColor, std::memory_order_relaxed);
+                trimmedStates.push_back(state);
+            }
+        }
+        for (uint64_t index = 0; index < trimmedStates.size(); ++index) {
+            uint64_t state = trimmedStates[index];
+            sccOf[state] = nextScc++;
+            for (uint64_t successorIndex = forwardStarts[state]; successorIndex < forwardStarts[state + 1]; ++successorIndex) {
+                uint64_t successor = forwardTargets[successorIndex];
+                if (hasColor(successor, color) && --inDegree[successor] == 0) {
+                    colors[successor].store(noColor, std::memory_order_relaxed);
+                    trimmedStates.push_back(successor);
+                }
+            }
+            for (uint64_t predecessorIndex = backwardStarts[state]; predecessorIndex < backwardStarts[state + 1]; ++predecessorIndex) {
+                uint64_t predecessor = backwardTargets[predecessorIndex];
+                if (hasColor(predecessor, color) && --outDegree[predecessor] == 0) {
+                    colors[predecessor].store(noColor, std::memory_order_relaxed);
+                    trimmedStates.push_back(predecessor);
+                }
+            }
+        }
+        if (!trimmedStates.empty()) {
+            subproblem.states.erase(
+                std::remove_if(subproblem.states.begin(), subproblem.states.end(), [&](uint64_t const& state) { return !hasColor(state, color); }),
+                subproblem.states.end());
+        }
+    }
+
+    /*!
+     * Collects all states of the given color that are reachable from the pivot (via the given graph).
+     */
+    void reach(uint64_t pivot, uint64_t color, std::vector<uint64_t> const& starts, std::vector<uint64_t> const& targets, std::vector<uint8_t>& mark,
+               std::vector<uint64_t>& reached) const {
+        mark[pivot] = 1;
+        reached.push_back(pivot);
+        for (uint64_t reachedIndex = 0; reachedIndex < reached.size(); ++reachedIndex) {
+            uint64_t state = reached[reachedIndex];
+            for (uint64_t index = starts[state]; index < starts[state + 1]; ++index) {
+                uint64_t target = targets[index];
+                if (!mark[target] && hasColor(target, color)) {
+                    mark[target] = 1;
+                    reached.push_back(target);
+                }
+            }
+        }
+    }
+
+    /*!
+     * Decomposes the subproblem with the path-based algorithm (see performSccDecompositionGCM).
+     */
+    void decomposePathBased(Subproblem const& subproblem) {
+        uint64_t const color = subproblem.color;
+        std::vector<uint64_t> s;
+        std::vector<uint64_t> p;
+        std::vector<uint64_t> recursionStateStack;
+        uint64_t currentIndex = 0;
+        for (auto startState : subproblem.states) {
+            if (!hasColor(startState, color) || preorderNumbers[startState] != noPreorderNumber) {
+                continue;
+            }
+            recursionStateStack.push_back(startState);
+            while (!recursionStateStack.empty()) {
+                uint64_t currentState = recursionStateStack.back();
+                if (preorderNumbers[currentState] == noPreorderNumber) {
+                    preorderNumbers[currentState] = currentIndex++;
+                    s.push_back(currentState);
+                    p.push_back(currentState);
+                    for (uint64_t index = forwardStarts[currentState]; index < forwardStarts[currentState + 1]; ++index) {
+                        uint64_t successor = forwardTargets[index];
+                        if (!hasColor(successor, color)) {
+                            // The successor is in another subproblem or already has an SCC.
+                            continue;
+                        }
+                        if (preorderNumbers[successor] == noPreorderNumber) {
+                            recursionStateStack.push_back(successor);
+                        } else {
+                            while (preorderNumbers[p.back()] > preorderNumbers[successor]) {
+                                p.pop_back();
+                            }
+                        }
+                    }
+                } else {
+                    if (currentState == p.back()) {
+                        p.pop_back();
+                        uint64_t const scc = nextScc++;
+                        bool nonSingletonScc = s.back() != currentState;
+                        uint64_t poppedState = 0;
+                        do {
+                            poppedState = s.back();
+                            s.pop_back();
+                            sccOf[poppedState] = scc;
+                            colors[poppedState].store(noColor, std::memory_order_relaxed);
+                            if (nonSingletonScc) {
+                                nonTrivial[poppedState] = 1;
+                            }
+                        } while (poppedState != currentState);
+                    }
+                    recursionStateStack.pop_back();
+                }
+            }
+        }
+    }
+
+    /*!
+     * Computes the depth of each SCC, i.e., the length of the longest path to a bottom SCC in the graph of SCCs. The SCCs
+     * are processed level by level, starting with the bottom SCCs.
+     */
+    std::vector<uint64_t> computeSccDepths(uint64_t numberOfSccs) {
+        auto& threadPool = storm::utility::ThreadPool::getGlobalPool();
+
+        // Collect the states of each SCC (in ascending order).
+        sccStarts.assign(numberOfSccs + 1, 0);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            if (isInSubsystem(state)) {
+                ++sccStarts[sccOf[state] + 1];
+            }
+        }
+        std::partial_sum(sccStarts.begin(), sccStarts.end(), sccStarts.begin());
+        sccStates.resize(sccStarts.back());
+        {
+            std::vector<uint64_t> positions(sccStarts.begin(), sccStarts.end() - 1);
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                if (isInSubsystem(state)) {
+                    sccStates[positions[sccOf[state]]++] = state;
+                }
+            }
+        }
+
+        // Count the transitions leaving each SCC.
+        std::vector<std::atomic<uint64_t>> remainingTransitions(numberOfSccs);
+        std::vector<uint64_t> frontier;
+        std::mutex frontierMutex;
+        threadPool.parallelForBlocks(
+            0, numberOfSccs, blockSize,
+            [&](uint64_t begin, uint64_t end) {
+                std::vector<uint64_t> bottomSccs;
+                for (uint64_t scc = begin; scc < end; ++scc) {
+                    uint64_t numberOfLeavingTransitions = 0;
+                    for (uint64_t stateIndex = sccStarts[scc]; stateIndex < sccStarts[scc + 1]; ++stateIndex) {
+                        uint64_t state = sccStates[stateIndex];
+                        for (uint64_t index = forwardStarts[state]; index < forwardStarts[state + 1]; ++index) {
+                            if (sccOf[forwardTargets[index]] != scc) {
+                                ++numberOfLeavingTransitions;
+                            }
+                        }
+                    }
+                    remainingTransitions[scc].store(numberOfLeavingTransitions, std::memory_order_relaxed);
+                    if (numberOfLeavingTransitions == 0) {
+                        bottomSccs.push_back(scc);
+                    }
+                }
+                std::lock_guard<std::mutex> lock(frontierMutex);
+                frontier.insert(frontier.end(), bottomSccs.begin(), bottomSccs.end());
+            },
+            numberOfThreads);
+
+        // An SCC is reached in the level given by its depth once all its leaving transitions have been processed.
+        std::vector<uint64_t> depths(numberOfSccs);
+        for (uint64_t depth = 0; !frontier.empty(); ++depth) {
+            std::vector<uint64_t> nextFrontier;
+            auto processFrontier = [&](uint64_t begin, uint64_t end) {
+                std::vector<uint64_t> reachedSccs;
+                for (uint64_t frontierIndex = begin; frontierIndex < end; ++frontierIndex) {
+                    uint64_t scc = frontier[frontierIndex];
+                    depths[scc] = depth;
+                    for (uint64_t stateIndex = sccStarts[scc]; stateIndex < sccStarts[scc + 1]; ++stateIndex) {
+                        uint64_t state = sccStates[stateIndex];
+                        for (uint64_t index = backwardStarts[state]; index < backwardStarts[state + 1]; ++index) {
+                            uint64_t predecessorScc = sccOf[backwardTargets[index]];
+                            if (predecessorScc != scc && remainingTransitions[predecessorScc].fetch_sub(1, std::memory_order_relaxed) == 1) {
+                                reachedSccs.push_back(predecessorScc);
+                            }
+                        }
+                    }
+                }
+                std::lock_guard<std::mutex> lock(frontierMutex);
+                nextFrontier.insert(nextFrontier.end(), reachedSccs.begin(), reachedSccs.end());
+            };
+            if (frontier.size() > blockSize) {
+                threadPool.parallelForBlocks(0, frontier.size(), blockSize, processFrontier, numberOfThreads);
+            } else {
+                processFrontier(0, frontier.size());
+            }
+            frontier = std::move(nextFrontier);
+        }
+        return depths;
+    }
+
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix;
+    storm::storage::BitVector const* subsystem;
+    storm::storage::BitVector const* choices;
+    uint64_t numberOfThreads;
+    uint64_t numberOfStates;
+
+    // The graph of the subsystem (in compressed row storage).
+    std::vector<uint64_t> forwardStarts;
+    std::vector<uint64_t> forwardTargets;
+    std::vector<uint64_t> backwardStarts;
+    std::vector<uint64_t> backwardTargets;
+
+    // The color of each state, i.e., the subproblem to which it belongs (or noColor if its SCC has been found).
+    std::vector<std::atomic<uint64_t>> colors;
+    std::atomic<uint64_t> nextColor{0};
+
+    // The (preliminary) SCC index of each state.
+    std::vector<uint64_t> sccOf;
+    std::atomic<uint64_t> nextScc{0};
+    std::vector<uint8_t> nonTrivial;
+
+    // The states of each SCC (in compressed row storage).
+    std::vector<uint64_t> sccStarts;
+    std::vector<uint64_t> sccStates;
+
+    // Auxiliary data of the algorithms. Each entry is only accessed by the thread that processes the subproblem of the state.
+    std::vector<uint8_t> forwardMark;
+    std::vector<uint8_t> backwardMark;
+    std::vector<uint64_t> inDegree;
+    std::vector<uint64_t> outDegree;
+    std::vector<uint64_t> preorderNumbers;
+};
+}  // namespace
+
 template<typename ValueType>
 void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                  StronglyConnectedComponentDecompositionOptions const& options) {
@@ -177,9 +689,20 @@ void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition
     // We need to keep of trivial states (singleton SCCs without selfloop).
     storm::storage::BitVector nonTrivialStates(numberOfStates, false);
 
+    // Store scc depths if requested
+    std::vector<uint_fast64_t>* sccDepthsPtr = nullptr;
+    sccDepths = boost::none;
+    if (options.isComputeSccDepthsSet || options.areOnlyBottomSccsConsidered) {
+        sccDepths = std::vector<uint_fast64_t>();
+        sccDepthsPtr = &sccDepths.get();
+    }
+
     // Obtain a mapping from states to the SCC it belongs to
     std::vector<uint_fast64_t> stateToSccMapping(numberOfStates);
-    {
+    if (options.numberOfThreads > 1) {
+        ParallelSccDecomposer<ValueType>(transitionMatrix, options.subsystemPtr, options.choicesPtr, options.numberOfThreads)
+            .decompose(nonTrivialStates, stateToSccMapping, sccCount, sccDepthsPtr);
+    } else {
         // Set up the environment of the algorithm.
         // Start with the two stacks it maintains.
         // This is to reduce memory (re-)allocations
@@ -195,14 +718,6 @@ void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition
         storm::storage::BitVector hasPreorderNumber(numberOfStates);
         storm::storage::BitVector stateHasScc(numberOfStates);
 
-        // Store scc depths if requested
-        std::vector<uint_fast64_t>* sccDepthsPtr = nullptr;
-        sccDepths = boost::none;
-        if (options.isComputeSccDepthsSet || options.areOnlyBottomSccsConsidered) {
-            sccDepths = std::vector<uint_fast64_t>();
-            sccDepthsPtr = &sccDepths.get();
-        }
-
         // Start the search for SCCs from every state in the block.
         uint_fast64_t currentIndex = 0;
         if (options.subsystemPtr) {
@@ -49,6 +49,11 @@ struct StronglyConnectedComponentDecompositionOptions {
         isComputeSccDepthsSet = value;
         return *this;
     }
+    /// Sets the number of threads used for the decomposition. If this is larger than one, a parallel forward-backward algorithm is used.
+    StronglyConnectedComponentDecompositionOptions& useThreads(uint64_t value) {
+        numberOfThreads = value;
+        return *this;
+    }
 
     storm::storage::BitVector const* subsystemPtr = nullptr;
     storm::storage::BitVector const* choicesPtr = nullptr;
@@ -56,6 +61,7 @@ struct StronglyConnectedComponentDecompositionOptions {
     bool areOnlyBottomSccsConsidered = false;
     bool isTopologicalSortForced = false;
     bool isComputeSccDepthsSet = false;
+    uint64_t numberOfThreads = 1;
 };
 
 /*!
@@ -647,7 +647,8 @@ storm::storage::SparseMatrix<ValueType> Add<LibraryType, ValueType>::toMatrix()
 }
 
 template<DdType LibraryType, typename ValueType>
-storm::storage::SparseMatrix<ValueType> Add<LibraryType, ValueType>::toMatrix(storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd) const {
+storm::storage::SparseMatrix<ValueType> Add<LibraryType, ValueType>::toMatrix(storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd,
+                                                                              uint64_t numberOfThreads) const {
     std::set<storm::expressions::Variable> rowMetaVariables;
     std::set<storm::expressions::Variable> columnMetaVariables;
 
@@ -659,13 +660,14 @@ storm::storage::SparseMatrix<ValueType> Add<LibraryType, ValueType>::toMatrix(st
         }
     }
 
-    return toMatrix(rowMetaVariables, columnMetaVariables, rowOdd, columnOdd);
+    return toMatrix(rowMetaVariables, columnMetaVariables, rowOdd, columnOdd, numberOfThreads);
 }
 
 template<DdType LibraryType, typename ValueType>
 storm::storage::SparseMatrix<ValueType> Add<LibraryType, ValueType>::toMatrix(std::set<storm::expressions::Variable> const& rowMetaVariables,
                                                                               std::set<storm::expressions::Variable> const& columnMetaVariables,
-                                                                              storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd) const {
+                                                                              storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd,
+                                                                              uint64_t numberOfThreads) const {
     std::vector<uint_fast64_t> ddRowVariableIndices;
     std::vector<uint_fast64_t> ddColumnVariableIndices;
 
@@ -713,7 +715,7 @@ storm::storage::SparseMatrix<ValueType> Add<LibraryType, ValueType>::toMatrix(st
 
     // Now actually fill the entry vector.
     internalAdd.toMatrixComponents(trivialRowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, ddRowVariableIndices, ddColumnVariableIndices,
-                                   true);
+                                   true, numberOfThreads);
 
     // Since the last call to toMatrixRec modified the rowIndications, we need to restore the correct values.
     for (uint_fast64_t i = rowIndications.size() - 1; i > 0; --i) {
@@ -727,7 +729,8 @@ storm::storage::SparseMatrix<ValueType> Add<LibraryType, ValueType>::toMatrix(st
 
 template<DdType LibraryType, typename ValueType>
 storm::storage::SparseMatrix<ValueType> Add<LibraryType, ValueType>::toMatrix(std::set<storm::expressions::Variable> const& groupMetaVariables,
-                                                                              storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd) const {
+                                                                              storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd,
+                                                                              uint64_t numberOfThreads) const {
     std::set<storm::expressions::Variable> rowMetaVariables;
     std::set<storm::expressions::Variable> columnMetaVariables;
 
@@ -745,14 +748,14 @@ storm::storage::SparseMatrix<ValueType> Add<LibraryType, ValueType>::toMatrix(st
     }
 
     // Create the canonical row group sizes and build the matrix.
-    return toLabeledMatrix(rowMetaVariables, columnMetaVariables, groupMetaVariables, rowOdd, columnOdd).matrix;
+    return toLabeledMatrix(rowMetaVariables, columnMetaVariables, groupMetaVariables, rowOdd, columnOdd, {}, numberOfThreads).matrix;
 }
 
 template<DdType LibraryType, typename ValueType>
 typename Add<LibraryType, ValueType>::MatrixAndLabeling Add<LibraryType, ValueType>::toLabeledMatrix(
     std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables,
     std::set<storm::expressions::Variable> const& groupMetaVariables, storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd,
-    std::vector<std::set<storm::expressions::Variable>> const& labelMetaVariables) const {
+    std::vector<std::set<storm::expressions::Variable>> const& labelMetaVariables, uint64_t numberOfThreads) const {
     std::vector<uint_fast64_t> ddRowVariableIndices;
     std::vector<uint_fast64_t> ddColumnVariableIndices;
     std::vector<uint_fast64_t> ddGroupVariableIndices;
@@ -892,7 +895,7 @@ typename Add<LibraryType, ValueType>::MatrixAndLabeling Add<LibraryType, ValueTy
         auto const& group = groups[i];
 
         group.internalAdd.toMatrixComponents(rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, ddRowVariableIndices,
-                                             ddColumnVariableIndices, true);
+                                             ddColumnVariableIndices, true, numberOfThreads);
 
         statesWithGroupEnabled[i].composeWithExplicitVector(rowOdd, ddRowVariableIndices, rowGroupIndices, std::plus<uint_fast64_t>());
     }
@@ -915,7 +918,7 @@ typename Add<LibraryType, ValueType>::MatrixAndLabeling Add<LibraryType, ValueTy
 template<DdType LibraryType, typename ValueType>
 std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> Add<LibraryType, ValueType>::toMatrixVector(
     storm::dd::Add<LibraryType, ValueType> const& vector, std::set<storm::expressions::Variable> const& groupMetaVariables, storm::dd::Odd const& rowOdd,
-    storm::dd::Odd const& columnOdd) const {
+    storm::dd::Odd const& columnOdd, uint64_t numberOfThreads) const {
     std::set<storm::expressions::Variable> rowMetaVariables;
     std::set<storm::expressions::Variable> columnMetaVariables;
 
@@ -933,35 +936,37 @@ std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> Add<L
     }
 
     // Create the canonical row group sizes and build the matrix.
-    return toMatrixVector(vector, rowMetaVariables, columnMetaVariables, groupMetaVariables, rowOdd, columnOdd);
+    return toMatrixVector(vector, rowMetaVariables, columnMetaVariables, groupMetaVariables, rowOdd, columnOdd, numberOfThreads);
 }
 
 template<DdType LibraryType, typename ValueType>
 std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> Add<LibraryType, ValueType>::toMatrixVector(
     storm::dd::Add<LibraryType, ValueType> const& vector, std::set<storm::expressions::Variable> const& rowMetaVariables,
     std::set<storm::expressions::Variable> const& columnMetaVariables, std::set<storm::expressions::Variable> const& groupMetaVariables,
-    storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd) const {
+    storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd, uint64_t numberOfThreads) const {
     // Count how many choices each row group has.
     std::vector<uint_fast64_t> rowGroupIndices = (this->notZero().existsAbstract(columnMetaVariables) || vector.notZero())
                                                      .template toAdd<uint_fast64_t>()
                                                      .sumAbstract(groupMetaVariables)
                                                      .toVector(rowOdd);
-    return toMatrixVector(std::move(rowGroupIndices), vector, rowMetaVariables, columnMetaVariables, groupMetaVariables, rowOdd, columnOdd);
+    return toMatrixVector(std::move(rowGroupIndices), vector, rowMetaVariables, columnMetaVariables, groupMetaVariables, rowOdd, columnOdd, numberOfThreads);
 }
 
 template<DdType LibraryType, typename ValueType>
 std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> Add<LibraryType, ValueType>::toMatrixVector(
     std::vector<uint_fast64_t>&& rowGroupIndices, storm::dd::Add<LibraryType, ValueType> const& vector,
     std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables,
-    std::set<storm::expressions::Variable> const& groupMetaVariables, storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd) const {
-    auto resultAsVector = toMatrixVectors(std::move(rowGroupIndices), {vector}, rowMetaVariables, columnMetaVariables, groupMetaVariables, rowOdd, columnOdd);
+    std::set<storm::expressions::Variable> const& groupMetaVariables, storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd,
+    uint64_t numberOfThreads) const {
+    auto resultAsVector =
+        toMatrixVectors(std::move(rowGroupIndices), {vector}, rowMetaVariables, columnMetaVariables, groupMetaVariables, rowOdd, columnOdd, numberOfThreads);
     return std::make_pair(resultAsVector.first, resultAsVector.second.front());
 }
 
 template<DdType LibraryType, typename ValueType>
 std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<std::vector<ValueType>>> Add<LibraryType, ValueType>::toMatrixVectors(
     std::vector<storm::dd::Add<LibraryType, ValueType>> const& vectors, std::set<storm::expressions::Variable> const& groupMetaVariables,
-    storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd) const {
+    storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd, uint64_t numberOfThreads) const {
     std::set<storm::expressions::Variable> rowMetaVariables;
     std::set<storm::expressions::Variable> columnMetaVariables;
 
@@ -986,14 +991,15 @@ std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<std::vector<Value
                                                      .template toAdd<uint_fast64_t>()
                                                      .sumAbstract(groupMetaVariables)
                                                      .toVector(rowOdd);
-    return toMatrixVectors(std::move(rowGroupIndices), vectors, rowMetaVariables, columnMetaVariables, groupMetaVariables, rowOdd, columnOdd);
+    return toMatrixVectors(std::move(rowGroupIndices), vectors, rowMetaVariables, columnMetaVariables, groupMetaVariables, rowOdd, columnOdd, numberOfThreads);
 }
 
 template<DdType LibraryType, typename ValueType>
 std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<std::vector<ValueType>>> Add<LibraryType, ValueType>::toMatrixVectors(
     std::vector<uint_fast64_t>&& rowGroupIndices, std::vector<storm::dd::Add<LibraryType, ValueType>> const& vectors,
     std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables,
-    std::set<storm::expressions::Variable> const& groupMetaVariables, storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd) const {
+    std::set<storm::expressions::Variable> const& groupMetaVariables, storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd,
+    uint64_t numberOfThreads) const {
     std::vector<uint_fast64_t> ddRowVariableIndices;
     std::vector<uint_fast64_t> ddColumnVariableIndices;
     std::vector<uint_fast64_t> ddGroupVariableIndices;
@@ -1117,7 +1123,7 @@ std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<std::vector<Value
         auto const& dd = groups[i].back();
 
         dd.internalAdd.toMatrixComponents(rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, ddRowVariableIndices, ddColumnVariableIndices,
-                                          true);
+                                          true, numberOfThreads);
         statesWithGroupEnabled[i].composeWithExplicitVector(rowOdd, ddRowVariableIndices, rowGroupIndices, std::plus<uint_fast64_t>());
     }
 
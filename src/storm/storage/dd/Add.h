@@ -623,9 +623,10 @@ class Add : public Dd<LibraryType> {
      *
      * @param rowOdd The ODD used for determining the correct row.
      * @param columnOdd The ODD used for determining the correct column.
+     * @param numberOfThreads The maximal number of threads used to fill the matrix. Only supported by Sylvan for double values.
      * @return The matrix that is represented by this ADD.
      */
-    storm::storage::SparseMatrix<ValueType> toMatrix(storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd) const;
+    storm::storage::SparseMatrix<ValueType> toMatrix(storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd, uint64_t numberOfThreads = 1) const;
 
     /*!
      * Converts the ADD to a (sparse) matrix. The given offset-labeled DDs are used to determine the
@@ -635,11 +636,12 @@ class Add : public Dd<LibraryType> {
      * @param columnMetaVariables The meta variables that encode the columns of the matrix.
      * @param rowOdd The ODD used for determining the correct row.
      * @param columnOdd The ODD used for determining the correct column.
+     * @param numberOfThreads The maximal number of threads used to fill the matrix. Only supported by Sylvan for double values.
      * @return The matrix that is represented by this ADD.
      */
     storm::storage::SparseMatrix<ValueType> toMatrix(std::set<storm::expressions::Variable> const& rowMetaVariables,
                                                      std::set<storm::expressions::Variable> const& columnMetaVariables, storm::dd::Odd const& rowOdd,
-                                                     storm::dd::Odd const& columnOdd) const;
+                                                     storm::dd::Odd const& columnOdd, uint64_t numberOfThreads = 1) const;
 
     /*!
      * Converts the ADD to a row-grouped (sparse) matrix. The given offset-labeled DDs are used to
@@ -650,10 +652,11 @@ class Add : public Dd<LibraryType> {
      * @param groupMetaVariables The meta variables that are used to distinguish different row groups.
      * @param rowOdd The ODD used for determining the correct row.
      * @param columnOdd The ODD used for determining the correct column.
+     * @param numberOfThreads The maximal number of threads used to fill the matrix. Only supported by Sylvan for double values.
      * @return The matrix that is represented by this ADD.
      */
     storm::storage::SparseMatrix<ValueType> toMatrix(std::set<storm::expressions::Variable> const& groupMetaVariables, storm::dd::Odd const& rowOdd,
-                                                     storm::dd::Odd const& columnOdd) const;
+                                                     storm::dd::Odd const& columnOdd, uint64_t numberOfThreads = 1) const;
 
     /*!
      * Converts the ADD to a row-grouped (sparse) matrix. The given offset-labeled DDs are used to determine the
@@ -668,6 +671,7 @@ class Add : public Dd<LibraryType> {
      * @param rowOdd The ODD used for determining the correct row.
      * @param columnOdd The ODD used for determining the correct column.
      * @param buildLabeling If false, no labeling vector is built.
+     * @param numberOfThreads The maximal number of threads used to fill the matrix. Only supported by Sylvan for double values.
      * @return The matrix that is represented by this ADD and a vector corresponding to row labeling
      * (if requested).
      */
@@ -689,7 +693,8 @@ class Add : public Dd<LibraryType> {
     MatrixAndLabeling toLabeledMatrix(
         std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables,
         std::set<storm::expressions::Variable> const& groupMetaVariables, storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd,
-        std::vector<std::set<storm::expressions::Variable>> const& labelMetaVariables = std::vector<std::set<storm::expressions::Variable>>()) const;
+        std::vector<std::set<storm::expressions::Variable>> const& labelMetaVariables = std::vector<std::set<storm::expressions::Variable>>(),
+        uint64_t numberOfThreads = 1) const;
 
     /*!
      * Converts the ADD to a row-grouped (sparse) matrix and the given vector to a row-grouped vector.
@@ -702,16 +707,18 @@ class Add : public Dd<LibraryType> {
      * @param groupMetaVariables The meta variables that are used to distinguish different row groups.
      * @param rowOdd The ODD used for determining the correct row.
      * @param columnOdd The ODD used for determining the correct column.
+     * @param numberOfThreads The maximal number of threads used to fill the matrix. Only supported by Sylvan for double values.
      * @return The matrix that is represented by this ADD.
      */
     std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> toMatrixVector(storm::dd::Add<LibraryType, ValueType> const& vector,
                                                                                               std::set<storm::expressions::Variable> const& groupMetaVariables,
-                                                                                              storm::dd::Odd const& rowOdd,
-                                                                                              storm::dd::Odd const& columnOdd) const;
+                                                                                              storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd,
+                                                                                              uint64_t numberOfThreads = 1) const;
     std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> toMatrixVector(
         std::vector<uint_fast64_t>&& rowGroupSizes, storm::dd::Add<LibraryType, ValueType> const& vector,
         std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables,
-        std::set<storm::expressions::Variable> const& groupMetaVariables, storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd) const;
+        std::set<storm::expressions::Variable> const& groupMetaVariables, storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd,
+        uint64_t numberOfThreads = 1) const;
 
     /*!
      * Converts the ADD to a row-grouped (sparse) matrix and the given vectors to row-grouped vectors.
@@ -724,15 +731,17 @@ class Add : public Dd<LibraryType> {
      * @param groupMetaVariables The meta variables that are used to distinguish different row groups.
      * @param rowOdd The ODD used for determining the correct row.
      * @param columnOdd The ODD used for determining the correct column.
+     * @param numberOfThreads The maximal number of threads used to fill the matrix. Only supported by Sylvan for double values.
      * @return The matrix that is represented by this ADD.
      */
     std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<std::vector<ValueType>>> toMatrixVectors(
         std::vector<storm::dd::Add<LibraryType, ValueType>> const& vectors, std::set<storm::expressions::Variable> const& groupMetaVariables,
-        storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd) const;
+        storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd, uint64_t numberOfThreads = 1) const;
     std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<std::vector<ValueType>>> toMatrixVectors(
         std::vector<uint_fast64_t>&& rowGroupSizes, std::vector<storm::dd::Add<LibraryType, ValueType>> const& vectors,
         std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables,
-        std::set<storm::expressions::Variable> const& groupMetaVariables, storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd) const;
+        std::set<storm::expressions::Variable> const& groupMetaVariables, storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd,
+        uint64_t numberOfThreads = 1) const;
 
     /*!
      * Exports the DD to the given file in the dot format.
@@ -815,6 +824,7 @@ class Add : public Dd<LibraryType> {
      * @param groupMetaVariables The meta variables that are used to distinguish different row groups.
      * @param rowOdd The ODD used for determining the correct row.
      * @param columnOdd The ODD used for determining the correct column.
+     * @param numberOfThreads The maximal number of threads used to fill the matrix. Only supported by Sylvan for double values.
      * @return The matrix that is represented by this ADD and and a vector corresponding to the symbolic vector
      * (if it was given).
      */
@@ -822,8 +832,8 @@ class Add : public Dd<LibraryType> {
                                                                                               std::set<storm::expressions::Variable> const& rowMetaVariables,
                                                                                               std::set<storm::expressions::Variable> const& columnMetaVariables,
                                                                                               std::set<storm::expressions::Variable> const& groupMetaVariables,
-                                                                                              storm::dd::Odd const& rowOdd,
-                                                                                              storm::dd::Odd const& columnOdd) const;
+                                                                                              storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd,
+                                                                                              uint64_t numberOfThreads = 1) const;
 
     // The internal ADD that depends on the chosen library.
     InternalAdd<LibraryType, ValueType> internalAdd;
@@ -728,7 +728,8 @@ template<typename ValueType>
 void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponents(std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<uint_fast64_t>& rowIndications,
                                                               std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues,
                                                               Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices,
-                                                              std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
+                                                              std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues,
+                                                              uint64_t) const {
     return toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0,
                                  ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0, ddRowVariableIndices, ddColumnVariableIndices,
                                  writeValues);
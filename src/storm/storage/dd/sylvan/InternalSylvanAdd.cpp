@@ -10,6 +10,7 @@
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
@@ -1230,10 +1231,109 @@ template<typename ValueType>
 void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponents(std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<uint_fast64_t>& rowIndications,
                                                                 std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues,
                                                                 Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices,
-                                                                std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
-    return toMatrixComponentsRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), rowGroupIndices,
-                                 rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0,
-                                 ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+                                                                std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues,
+                                                                uint64_t numberOfThreads) const {
+    uint_fast64_t maxLevel = ddRowVariableIndices.size() + ddColumnVariableIndices.size();
+    MTBDD rootDd = this->getSylvanMtbdd().GetMTBDD();
+
+    // Only floating point values can be copied concurrently, as exact and parametric numbers are not thread-safe. Moreover, small matrices
+    // are not worth the overhead.
+    if (!std::is_same<ValueType, double>::value || numberOfThreads <= 1 || rowOdd.getTotalOffset() < 4096) {
+        toMatrixComponentsRec(mtbdd_regular(rootDd), mtbdd_hascomp(rootDd), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0,
+                              maxLevel, 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+        return;
+    }
+
+    // A part of the DD that still needs to be traversed for the rows of a task.
+    struct ColumnItem {
+        MTBDD dd;
+        bool negated;
+        Odd const* columnOdd;
+        uint_fast64_t columnOffset;
+    };
+
+    // The rows below a node of the row ODD together with all parts of the DD that contribute to them (ordered by their columns).
+    struct RowTask {
+        Odd const* rowOdd;
+        uint_fast64_t rowOffset;
+        std::vector<ColumnItem> items;
+    };
+
+    // Split the rows into tasks by unfolding the top levels of the row ODD. As the rows of different tasks are disjoint, the tasks
+    // can be processed concurrently. Within a task, the items are processed in order such that the entries of a row are sorted.
+    std::vector<RowTask> tasks;
+    tasks.push_back(RowTask{&rowOdd, 0, {ColumnItem{mtbdd_regular(rootDd), static_cast<bool>(mtbdd_hascomp(rootDd)), &columnOdd, 0}}});
+    uint_fast64_t currentLevel = 0;
+    uint_fast64_t const desiredNumberOfTasks = 16 * numberOfThreads;
+    while (tasks.size() < desiredNumberOfTasks && 2 * (currentLevel + 1) < maxLevel) {
+        std::vector<RowTask> newTasks;
+        for (auto const& task : tasks) {
+            RowTask elseTask{&task.rowOdd->getElseSuccessor(), task.rowOffset, {}};
+            RowTask thenTask{&task.rowOdd->getThenSuccessor(), task.rowOffset + task.rowOdd->getElseOffset(), {}};
+            for (auto const& item : task.items) {
+                MTBDD dd = item.dd;
+                MTBDD elseElse;
+                MTBDD elseThen;
+                MTBDD thenElse;
+                MTBDD thenThen;
+                if (mtbdd_isleaf(dd) || ddColumnVariableIndices[currentLevel] < mtbdd_getvar(dd)) {
+                    elseElse = elseThen = thenElse = thenThen = dd;
+                } else if (ddRowVariableIndices[currentLevel] < mtbdd_getvar(dd)) {
+                    elseElse = thenElse = mtbdd_getlow(dd);
+                    elseThen = thenThen = mtbdd_gethigh(dd);
+                } else {
+                    MTBDD elseNode = mtbdd_getlow(dd);
+                    if (mtbdd_isleaf(elseNode) || ddColumnVariableIndices[currentLevel] < mtbdd_getvar(elseNode)) {
+                        elseElse = elseThen = elseNode;
+                    } else {
+                        elseElse = mtbdd_getlow(elseNode);
+                        elseThen = mtbdd_gethigh(elseNode);
+                    }
+                    MTBDD thenNode = mtbdd_gethigh(dd);
+                    if (mtbdd_isleaf(thenNode) || ddColumnVariableIndices[currentLevel] < mtbdd_getvar(thenNode)) {
+                        thenElse = thenThen = thenNode;
+                    } else {
+                        thenElse = mtbdd_getlow(thenNode);
+                        thenThen = mtbdd_gethigh(thenNode);
+                    }
+                }
+
+                Odd const& columnElse = item.columnOdd->getElseSuccessor();
+                Odd const& columnThen = item.columnOdd->getThenSuccessor();
+                uint_fast64_t columnThenOffset = item.columnOffset + item.columnOdd->getElseOffset();
+                auto addItem = [&item](RowTask& target, MTBDD successor, Odd const& successorColumnOdd, uint_fast64_t successorColumnOffset) {
+                    MTBDD regularSuccessor = mtbdd_regular(successor);
+                    if (!(mtbdd_isleaf(regularSuccessor) && mtbdd_iszero(regularSuccessor))) {
+                        bool negated = static_cast<bool>(mtbdd_hascomp(successor)) != item.negated;
+                        target.items.push_back(ColumnItem{regularSuccessor, negated, &successorColumnOdd, successorColumnOffset});
+                    }
+                };
+                addItem(elseTask, elseElse, columnElse, item.columnOffset);
+                addItem(elseTask, elseThen, columnThen, columnThenOffset);
+                addItem(thenTask, thenElse, columnElse, item.columnOffset);
+                addItem(thenTask, thenThen, columnThen, columnThenOffset);
+            }
+            if (!elseTask.items.empty()) {
+                newTasks.push_back(std::move(elseTask));
+            }
+            if (!thenTask.items.empty()) {
+                newTasks.push_back(std::move(thenTask));
+            }
+        }
+        tasks = std::move(newTasks);
+        ++currentLevel;
+    }
+
+    storm::utility::ThreadPool::getGlobalPool().parallelFor(
+        0, tasks.size(),
+        [&](uint64_t taskIndex) {
+            auto const& task = tasks[taskIndex];
+            for (auto const& item : task.items) {
+                toMatrixComponentsRec(item.dd, item.negated, rowGroupIndices, rowIndications, columnsAndValues, *task.rowOdd, *item.columnOdd, currentLevel,
+                                      currentLevel, maxLevel, task.rowOffset, item.columnOffset, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+            }
+        },
+        numberOfThreads);
 }
 
 template<typename ValueType>
@@ -636,11 +636,12 @@ class InternalAdd<DdType::Sylvan, ValueType> {
      * @param ddColumnVariableIndices The variable indices of the column variables.
      * @param writeValues A flag that indicates whether or not to write to the entry vector. If this is not set,
      * only the row indications are modified.
+     * @param numberOfThreads The maximal number of threads used to fill the components. Only double values are filled concurrently.
      */
     void toMatrixComponents(std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<uint_fast64_t>& rowIndications,
                             std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd,
                             std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices,
-                            bool writeValues) const;
+                            bool writeValues, uint64_t numberOfThreads = 1) const;
 
     /*!
      * Creates an ADD from the given explicit vector.
@@ -0,0 +1,189 @@
+#include "storm/utility/ThreadPool.h"
+
+#include <algorithm>
+
+namespace storm {
+namespace utility {
+
+// Indicates whether the current thread executes (a part of) a parallel loop.
+static thread_local bool insideParallelLoop = false;
+
+ThreadPool::ThreadPool(uint64_t numberOfThreads) {
+    numberOfThreads = storm::utility::getNumberOfThreads(numberOfThreads);
+    taskRanges = std::make_unique<TaskRange[]>(numberOfThreads);
+    workers.reserve(numberOfThreads - 1);
+    for (uint64_t workerIndex = 1; workerIndex < numberOfThreads; ++workerIndex) {
+        workers.emplace_back([this, workerIndex]() { runWorker(workerIndex); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        shutdown = true;
+    }
+    loopStarted.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+uint64_t ThreadPool::getNumberOfThreads() const {
+    return workers.size() + 1;
+}
+
+void ThreadPool::parallelFor(uint64_t begin, uint64_t end, std::function<void(uint64_t)> const& body, uint64_t maxNumberOfThreads) {
+    if (begin >= end) {
+        return;
+    }
+    uint64_t numberOfThreads = getNumberOfThreads();
+    if (maxNumberOfThreads != 0) {
+        numberOfThreads = std::min(numberOfThreads, maxNumberOfThreads);
+    }
+    numberOfThreads = std::min(numberOfThreads, end - begin);
+
+    // Nested loops and loops issued while the pool is busy are executed by the calling thread.
+    std::unique_lock<std::mutex> loopLock(loopMutex, std::defer_lock);
+    if (numberOfThreads <= 1 || insideParallelLoop || !loopLock.try_lock()) {
+        for (uint64_t index = begin; index < end; ++index) {
+            body(index);
+        }
+        return;
+    }
+
+    // Initially, each thread gets a contiguous range of (roughly) the same size.
+    uint64_t const size = end - begin;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        std::lock_guard<std::mutex> lock(taskRanges[thread].mutex);
+        taskRanges[thread].begin = begin + (size * thread) / numberOfThreads;
+        taskRanges[thread].end = begin + (size * (thread + 1)) / numberOfThreads;
+    }
+    currentBody = &body;
+    currentLoopFailed.store(false);
+    currentException = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        currentNumberOfThreads = numberOfThreads;
+        numberOfBusyWorkers = numberOfThreads - 1;
+        ++loopCounter;
+    }
+    loopStarted.notify_all();
+
+    insideParallelLoop = true;
+    work(0);
+    insideParallelLoop = false;
+
+    {
+        std::unique_lock<std::mutex> lock(stateMutex);
+        loopFinished.wait(lock, [this]() { return numberOfBusyWorkers == 0; });
+    }
+    currentBody = nullptr;
+    if (currentException) {
+        std::rethrow_exception(currentException);
+    }
+}
+
+void ThreadPool::parallelForBlocks(uint64_t begin, uint64_t end, uint64_t blockSize, std::function<void(uint64_t, uint64_t)> const& body,
+                                   uint64_t maxNumberOfThreads) {
+    if (begin >= end) {
+        return;
+    }
+    blockSize = std::max<uint64_t>(1, blockSize);
+    uint64_t const numberOfBlocks = (end - begin + blockSize - 1) / blockSize;
+    parallelFor(
+        0, numberOfBlocks,
+        [&](uint64_t block) {
+            uint64_t const blockBegin = begin + block * blockSize;
+            body(blockBegin, std::min(end, blockBegin + blockSize));
+        },
+        maxNumberOfThreads);
+}
+
+ThreadPool& ThreadPool::getGlobalPool() {
+    static ThreadPool globalPool(0);
+    return globalPool;
+}
+
+void ThreadPool::runWorker(uint64_t workerIndex) {
+    insideParallelLoop = true;
+    uint64_t lastLoop = 0;
+    while (true) {
+        bool participate;
+        {
+            std::unique_lock<std::mutex> lock(stateMutex);
+            loopStarted.wait(lock, [this, &lastLoop]() { return shutdown || loopCounter != lastLoop; });
+            if (shutdown) {
+                return;
+            }
+            lastLoop = loopCounter;
+            participate = workerIndex < currentNumberOfThreads;
+        }
+        if (participate) {
+            work(workerIndex);
+            bool lastWorker;
+            {
+                std::lock_guard<std::mutex> lock(stateMutex);
+                lastWorker = --numberOfBusyWorkers == 0;
+            }
+            if (lastWorker) {
+                loopFinished.notify_all();
+            }
+        }
+    }
+}
+
+void ThreadPool::work(uint64_t workerIndex) {
+    uint64_t task;
+    do {
+        while (takeTask(workerIndex, task)) {
+            if (currentLoopFailed.load(std::memory_order_relaxed)) {
+                return;
+            }
+            try {
+                (*currentBody)(task);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(stateMutex);
+                if (!currentException) {
+                    currentException = std::current_exception();
+                }
+                currentLoopFailed.store(true);
+            }
+        }
+    } while (stealTasks(workerIndex));
+}
+
+bool ThreadPool::takeTask(uint64_t workerIndex, uint64_t& task) {
+    TaskRange& range = taskRanges[workerIndex];
+    std::lock_guard<std::mutex> lock(range.mutex);
+    if (range.begin < range.end) {
+        task = range.begin++;
+        return true;
+    }
+    return false;
+}
+
+bool ThreadPool::stealTasks(uint64_t workerIndex) {
+    for (uint64_t offset = 1; offset < currentNumberOfThreads; ++offset) {
+        TaskRange& victim = taskRanges[(workerIndex + offset) % currentNumberOfThreads];
+        uint64_t stolenBegin, stolenEnd;
+        {
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (victim.begin >= victim.end) {
+                continue;
+            }
+            // Take the upper half of the remaining range (rounded up).
+            stolenEnd = victim.end;
+            stolenBegin = victim.end - (victim.end - victim.begin + 1) / 2;
+            victim.end = stolenBegin;
+        }
+        TaskRange& range = taskRanges[workerIndex];
+        std::lock_guard<std::mutex> lock(range.mutex);
+        range.begin = stolenBegin;
+        range.end = stolenEnd;
+        return true;
+    }
+    return false;
+}
+
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,152 @@
+#ifndef STORM_UTILITY_THREADPOOL_H_
+#define STORM_UTILITY_THREADPOOL_H_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace storm {
+namespace utility {
+
+/*!
+ * Resolves the number of threads given by a thread option for computations on the given value type.
+ * An option value of zero refers to the number of hardware threads. Computations on exact or parametric values always
+ * get a single thread as the number types of the underlying libraries (GMP, CLN, CArL) may not be shared among threads.
+ *
+ * @param optionValue The number of threads as given by the user.
+ * @return The number of threads (at least one).
+ */
+template<typename ValueType = double>
+uint64_t getNumberOfThreads(uint64_t optionValue) {
+    if (!std::is_same<ValueType, double>::value) {
+        return 1;
+    }
+    return optionValue == 0 ? std::max<uint64_t>(1, std::thread::hardware_concurrency()) : optionValue;
+}
+
+/*!
+ * A small pool of worker threads that executes parallel loops. The iterations of a loop are distributed among the
+ * participating threads in contiguous ranges. A thread that has processed its range steals half of the remaining
+ * range of another thread, which balances the load if iterations have different costs.
+ *
+ * Parallel loops issued from within a parallel loop (or while another thread uses the pool) are executed
+ * sequentially by the calling thread.
+ */
+class ThreadPool {
+   public:
+    /*!
+     * Creates a pool such that loops can be executed by the given number of threads (including the thread issuing the loop).
+     *
+     * @param numberOfThreads The number of threads. If zero, the number of hardware threads is used.
+     */
+    explicit ThreadPool(uint64_t numberOfThreads);
+
+    ~ThreadPool();
+
+    ThreadPool(ThreadPool const&) = delete;
+    ThreadPool& operator=(ThreadPool const&) = delete;
+
+    /*!
+     * Retrieves the maximal number of threads that execute a loop (including the thread issuing the loop).
+     */
+    uint64_t getNumberOfThreads() const;
+
+    /*!
+     * Calls the given function for all indices in the range [begin, end). The order of the calls is unspecified and the
+     * function is called concurrently from different threads. If a call throws an exception, the remaining indices
+     * might not be processed and the (first) exception is rethrown once all threads are finished.
+     *
+     * @param begin The first index.
+     * @param end The index one past the last index.
+     * @param body The function to call for each index.
+     * @param maxNumberOfThreads If given (i.e. nonzero), at most this many threads participate in the loop.
+     */
+    void parallelFor(uint64_t begin, uint64_t end, std::function<void(uint64_t)> const& body, uint64_t maxNumberOfThreads = 0);
+
+    /*!
+     * Splits the range [begin, end) into consecutive blocks of the given size (except for the last block, which may be
+     * smaller) and calls the given function for each block. The blocks are processed as by parallelFor. This avoids
+     * the overhead of one function call per index for loops whose iterations are cheap.
+     *
+     * @param begin The first index.
+     * @param end The index one past the last index.
+     * @param blockSize The (maximal) number of indices per block.
+     * @param body The function to call for each block. It is given the first index and the index one past the last index of the block.
+     * @param maxNumberOfThreads If given (i.e. nonzero), at most this many threads participate in the loop.
+     */
+    void parallelForBlocks(uint64_t begin, uint64_t end, uint64_t blockSize, std::function<void(uint64_t, uint64_t)> const& body,
+                           uint64_t maxNumberOfThreads = 0);
+
+    /*!
+     * Retrieves a pool that is shared among all components of storm. The pool is created on the first call.
+     */
+    static ThreadPool& getGlobalPool();
+
+   private:
+    // The range of indices that still need to be processed by one thread.
+    struct alignas(64) TaskRange {
+        std::mutex mutex;
+        uint64_t begin{0};
+        uint64_t end{0};
+    };
+
+    /*!
+     * The loop executed by the worker with the given index.
+     */
+    void runWorker(uint64_t workerIndex);
+
+    /*!
+     * Processes indices of the current loop (own and stolen ones) until no more indices are available.
+     */
+    void work(uint64_t workerIndex);
+
+    /*!
+     * Takes the next index from the range of the given worker.
+     *
+     * @return True iff an index was available.
+     */
+    bool takeTask(uint64_t workerIndex, uint64_t& task);
+
+    /*!
+     * Moves half of the remaining indices of some other participating worker to the range of the given worker.
+     *
+     * @return True iff indices could be stolen.
+     */
+    bool stealTasks(uint64_t workerIndex);
+
+    // The worker threads. The thread issuing a loop participates as worker 0.
+    std::vector<std::thread> workers;
+
+    // The remaining indices of each participating thread.
+    std::unique_ptr<TaskRange[]> taskRanges;
+
+    // Ensures that only one loop is executed by the pool at a time.
+    std::mutex loopMutex;
+
+    // Protects the members below that synchronize the workers with the thread issuing a loop.
+    std::mutex stateMutex;
+    std::condition_variable loopStarted;
+    std::condition_variable loopFinished;
+    uint64_t loopCounter{0};
+    uint64_t numberOfBusyWorkers{0};
+    bool shutdown{false};
+
+    // Information on the current loop.
+    std::function<void(uint64_t)> const* currentBody{nullptr};
+    uint64_t currentNumberOfThreads{0};
+    std::atomic<bool> currentLoopFailed{false};
+    std::exception_ptr currentException;
+};
+
+}  // namespace utility
+}  // namespace storm
+
+#endif /* STORM_UTILITY_THREADPOOL_H_ */
@@ -3,13 +3,12 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 
-#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/vector.h"
 
-#include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/macros.h"
 
@@ -17,29 +16,23 @@ namespace storm {
 namespace utility {
 
 template<typename ValueType>
-VectorHelper<ValueType>::VectorHelper() : doParallelize(storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
-#ifndef STORM_HAVE_INTELTBB
-    STORM_LOG_THROW(!doParallelize, storm::exceptions::InvalidSettingsException, "Cannot parallelize without TBB.");
-#endif
+VectorHelper<ValueType>::VectorHelper() : numberOfThreads(storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads()) {
+    // Intentionally left empty.
 }
 
 template<typename ValueType>
 bool VectorHelper<ValueType>::parallelize() const {
-    return doParallelize;
+    return storm::utility::getNumberOfThreads<ValueType>(numberOfThreads) > 1;
 }
 
 template<typename ValueType>
 void VectorHelper<ValueType>::reduceVector(storm::solver::OptimizationDirection dir, std::vector<ValueType> const& source, std::vector<ValueType>& target,
                                            std::vector<uint_fast64_t> const& rowGrouping, std::vector<uint_fast64_t>* choices) const {
-#ifdef STORM_HAVE_INTELTBB
     if (this->parallelize()) {
-        storm::utility::vector::reduceVectorMinOrMaxParallel(dir, source, target, rowGrouping, choices);
+        storm::utility::vector::reduceVectorMinOrMaxParallel(dir, source, target, rowGrouping, choices, numberOfThreads);
     } else {
         storm::utility::vector::reduceVectorMinOrMax(dir, source, target, rowGrouping, choices);
     }
-#else
-    storm::utility::vector::reduceVectorMinOrMax(dir, source, target, rowGrouping, choices);
-#endif
 }
 
 template<>
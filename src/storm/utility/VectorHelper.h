@@ -19,8 +19,8 @@ class VectorHelper {
     bool parallelize() const;
 
    private:
-    // A flag that stores whether the parallelization to be used.
-    bool doParallelize;
+    // The number of threads to use. If it is larger than one, operations are parallelized.
+    uint64_t numberOfThreads;
 };
 }  // namespace utility
 }  // namespace storm
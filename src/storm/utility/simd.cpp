@@ -0,0 +1,113 @@
+#include "storm/utility/simd.h"
+
+#include "storm/storage/SparseMatrix.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define STORM_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace storm {
+namespace utility {
+namespace simd {
+
+namespace {
+
+typedef storm::storage::MatrixEntry<uint64_t, double> Entry;
+
+// The vectorized kernels load a matrix entry as a column index followed by a value.
+static_assert(sizeof(Entry) == 2 * sizeof(uint64_t), "Unexpected layout of matrix entries.");
+
+enum class InstructionSet { Scalar, Avx2, Avx512 };
+
+InstructionSet detectInstructionSet() {
+#ifdef STORM_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return InstructionSet::Avx512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return InstructionSet::Avx2;
+    }
+#endif
+    return InstructionSet::Scalar;
+}
+
+InstructionSet getInstructionSet() {
+    static InstructionSet const instructionSet = detectInstructionSet();
+    return instructionSet;
+}
+
+double scalarDotProduct(Entry const* entries, uint64_t numberOfEntries, double const* x) {
+    double result = 0.0;
+    for (uint64_t i = 0; i < numberOfEntries; ++i) {
+        result += entries[i].getValue() * x[entries[i].getColumn()];
+    }
+    return result;
+}
+
+#ifdef STORM_SIMD_X86
+__attribute__((target("avx2,fma"))) double horizontalSum(__m256d sum) {
+    __m128d result = _mm_add_pd(_mm256_castpd256_pd128(sum), _mm256_extractf128_pd(sum, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(result, _mm_unpackhi_pd(result, result)));
+}
+
+__attribute__((target("avx2,fma"))) double avx2DotProduct(Entry const* entries, uint64_t numberOfEntries, double const* x) {
+    __m256d sum = _mm256_setzero_pd();
+    uint64_t i = 0;
+    for (; i + 4 <= numberOfEntries; i += 4) {
+        // Each load yields two entries. Unpacking separates the column indices from the values (in the order 0, 2, 1, 3).
+        __m256i first = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(entries + i));
+        __m256i second = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(entries + i + 2));
+        __m256i indices = _mm256_unpacklo_epi64(first, second);
+        __m256d values = _mm256_castsi256_pd(_mm256_unpackhi_epi64(first, second));
+        sum = _mm256_fmadd_pd(values, _mm256_i64gather_pd(x, indices, sizeof(double)), sum);
+    }
+    return horizontalSum(sum) + scalarDotProduct(entries + i, numberOfEntries - i, x);
+}
+
+__attribute__((target("avx512f"))) double avx512DotProduct(Entry const* entries, uint64_t numberOfEntries, double const* x) {
+    __m512d sum = _mm512_setzero_pd();
+    uint64_t i = 0;
+    for (; i + 8 <= numberOfEntries; i += 8) {
+        // Each load yields four entries. Unpacking separates the column indices from the values (in the order 0, 4, 1, 5, 2, 6, 3, 7).
+        __m512i first = _mm512_loadu_si512(entries + i);
+        __m512i second = _mm512_loadu_si512(entries + i + 4);
+        __m512i indices = _mm512_unpacklo_epi64(first, second);
+        __m512d values = _mm512_castsi512_pd(_mm512_unpackhi_epi64(first, second));
+        sum = _mm512_fmadd_pd(values, _mm512_i64gather_pd(indices, x, sizeof(double)), sum);
+    }
+    return _mm512_reduce_add_pd(sum) + scalarDotProduct(entries + i, numberOfEntries - i, x);
+}
+#endif
+
+}  // namespace
+
+std::string getInstructionSetName() {
+    switch (getInstructionSet()) {
+        case InstructionSet::Avx512:
+            return "AVX-512";
+        case InstructionSet::Avx2:
+            return "AVX2";
+        default:
+            return "scalar";
+    }
+}
+
+double gatherDotProduct(storm::storage::MatrixEntry<uint64_t, double> const* entries, uint64_t numberOfEntries, double const* x) {
+#ifdef STORM_SIMD_X86
+    switch (getInstructionSet()) {
+        case InstructionSet::Avx512:
+            return avx512DotProduct(entries, numberOfEntries, x);
+        case InstructionSet::Avx2:
+            return avx2DotProduct(entries, numberOfEntries, x);
+        default:
+            break;
+    }
+#endif
+    return scalarDotProduct(entries, numberOfEntries, x);
+}
+
+}  // namespace simd
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace storm {
+namespace storage {
+template<typename IndexType, typename ValueType>
+class MatrixEntry;
+}
+
+namespace utility {
+namespace simd {
+
+/*!
+ * Rows with fewer entries are processed with scalar instructions by the callers of the functions below, as the overhead
+ * of vectorization does not pay off for such rows.
+ */
+uint64_t constexpr MinimalNumberOfVectorizedEntries = 8;
+
+/*!
+ * @return the name of the instruction set that is used by the functions below. This depends on the CPU the program runs on.
+ */
+std::string getInstructionSetName();
+
+/*!
+ * Computes the sum of entries[i].getValue() * x[entries[i].getColumn()] for i = 0, ..., numberOfEntries - 1.
+ * If supported by the CPU, this uses vector instructions (AVX-512 or AVX2) that gather the entries of x.
+ * @note The order in which the products are summed up differs from a sequential loop, which might lead to different rounding errors.
+ */
+double gatherDotProduct(storm::storage::MatrixEntry<uint64_t, double> const* entries, uint64_t numberOfEntries, double const* x);
+
+}  // namespace simd
+}  // namespace utility
+}  // namespace storm
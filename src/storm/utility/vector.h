@@ -5,13 +5,14 @@
 #include <functional>
 #include <iosfwd>
 #include <numeric>
-#include "storm/adapters/IntelTbbAdapter.h"
+#include <type_traits>
 #include "storm/adapters/RationalNumberAdapter.h"
 
 #include <boost/optional.hpp>
 
 #include "storm/solver/OptimizationDirection.h"
 #include "storm/storage/BitVector.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
@@ -346,24 +347,36 @@ void applyPointwiseTernary(std::vector<InValueType1> const& firstOperand, std::v
     }
 }
 
-#ifdef STORM_HAVE_INTELTBB
+/*!
+ * Applies the given operation pointwise on the three given vectors as applyPointwiseTernary, but distributes the
+ * elements among the given number of threads.
+ *
+ * @param numberOfThreads The maximal number of threads to use. If zero, all threads of the global thread pool are used.
+ * Values that are not doubles are processed sequentially, as exact and parametric arithmetic is not thread-safe.
+ */
 template<class InValueType1, class InValueType2, class OutValueType, class Operation>
 void applyPointwiseTernaryParallel(std::vector<InValueType1> const& firstOperand, std::vector<InValueType2> const& secondOperand,
-                                   std::vector<OutValueType>& target, Operation f = Operation()) {
-    tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, target.size()), [&](tbb::blocked_range<uint_fast64_t> const& range) {
-        auto firstIt = firstOperand.begin() + range.begin();
-        auto firstIte = firstOperand.begin() + range.end();
-        auto secondIt = secondOperand.begin() + range.begin();
-        auto targetIt = target.begin() + range.begin();
-        while (firstIt != firstIte) {
-            *targetIt = f(*firstIt, *secondIt, *targetIt);
-            ++targetIt;
-            ++firstIt;
-            ++secondIt;
-        }
-    });
+                                   std::vector<OutValueType>& target, Operation f = Operation(), uint64_t numberOfThreads = 0) {
+    if (!std::is_same<OutValueType, double>::value) {
+        applyPointwiseTernary(firstOperand, secondOperand, target, f);
+        return;
+    }
+    storm::utility::ThreadPool::getGlobalPool().parallelForBlocks(
+        0, target.size(), 1024,
+        [&](uint64_t begin, uint64_t end) {
+            auto firstIt = firstOperand.begin() + begin;
+            auto firstIte = firstOperand.begin() + end;
+            auto secondIt = secondOperand.begin() + begin;
+            auto targetIt = target.begin() + begin;
+            while (firstIt != firstIte) {
+                *targetIt = f(*firstIt, *secondIt, *targetIt);
+                ++targetIt;
+                ++firstIt;
+                ++secondIt;
+            }
+        },
+        numberOfThreads);
 }
-#endif
 
 /*!
  * Applies the given operation pointwise on the two given vectors and writes the result to the third vector.
@@ -379,16 +392,26 @@ void applyPointwise(std::vector<InValueType1> const& firstOperand, std::vector<I
     std::transform(firstOperand.begin(), firstOperand.end(), secondOperand.begin(), target.begin(), f);
 }
 
-#ifdef STORM_HAVE_INTELTBB
+/*!
+ * Applies the given operation pointwise on the two given vectors as applyPointwise, but distributes the elements
+ * among the given number of threads.
+ *
+ * @param numberOfThreads The maximal number of threads to use. If zero, all threads of the global thread pool are used.
+ */
 template<class InValueType1, class InValueType2, class OutValueType, class Operation>
 void applyPointwiseParallel(std::vector<InValueType1> const& firstOperand, std::vector<InValueType2> const& secondOperand, std::vector<OutValueType>& target,
-                            Operation f = Operation()) {
-    tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, target.size()), [&](tbb::blocked_range<uint_fast64_t> const& range) {
-        std::transform(firstOperand.begin() + range.begin(), firstOperand.begin() + range.end(), secondOperand.begin() + range.begin(),
-                       target.begin() + range.begin(), f);
-    });
+                            Operation f = Operation(), uint64_t numberOfThreads = 0) {
+    if (!std::is_same<OutValueType, double>::value) {
+        applyPointwise(firstOperand, secondOperand, target, f);
+        return;
+    }
+    storm::utility::ThreadPool::getGlobalPool().parallelForBlocks(
+        0, target.size(), 1024,
+        [&](uint64_t begin, uint64_t end) {
+            std::transform(firstOperand.begin() + begin, firstOperand.begin() + end, secondOperand.begin() + begin, target.begin() + begin, f);
+        },
+        numberOfThreads);
 }
-#endif
 
 /*!
  * Applies the given function pointwise on the given vector.
@@ -402,14 +425,23 @@ void applyPointwise(std::vector<InValueType> const& operand, std::vector<OutValu
     std::transform(operand.begin(), operand.end(), target.begin(), f);
 }
 
-#ifdef STORM_HAVE_INTELTBB
+/*!
+ * Applies the given function pointwise on the given vector as applyPointwise, but distributes the elements among the
+ * given number of threads.
+ *
+ * @param numberOfThreads The maximal number of threads to use. If zero, all threads of the global thread pool are used.
+ */
 template<class InValueType, class OutValueType, class Operation>
-void applyPointwiseParallel(std::vector<InValueType> const& operand, std::vector<OutValueType>& target, Operation f = Operation()) {
-    tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, target.size()), [&](tbb::blocked_range<uint_fast64_t> const& range) {
-        std::transform(operand.begin() + range.begin(), operand.begin() + range.end(), target.begin() + range.begin(), f);
-    });
+void applyPointwiseParallel(std::vector<InValueType> const& operand, std::vector<OutValueType>& target, Operation f = Operation(),
+                            uint64_t numberOfThreads = 0) {
+    if (!std::is_same<OutValueType, double>::value) {
+        applyPointwise(operand, target, f);
+        return;
+    }
+    storm::utility::ThreadPool::getGlobalPool().parallelForBlocks(
+        0, target.size(), 1024,
+        [&](uint64_t begin, uint64_t end) { std::transform(operand.begin() + begin, operand.begin() + end, target.begin() + begin, f); }, numberOfThreads);
 }
-#endif
 
 /*!
  * Adds the two given vectors and writes the result to the target vector.
@@ -627,20 +659,16 @@ VT min_if(std::vector<VT> const& values, storm::storage::BitVector const& filter
     return current;
 }
 
-#ifdef STORM_HAVE_INTELTBB
 template<class T, class Filter>
-class TbbReduceVectorFunctor {
+class ParallelReduceVectorFunctor {
    public:
-    TbbReduceVectorFunctor(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping,
-                           std::vector<uint_fast64_t>* choices, Filter const& f)
+    ParallelReduceVectorFunctor(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping,
+                                std::vector<uint_fast64_t>* choices, Filter const& f)
         : source(source), target(target), rowGrouping(rowGrouping), choices(choices), f(f) {
         // Intentionally left empty.
     }
 
-    void operator()(tbb::blocked_range<uint64_t> const& range) const {
-        uint_fast64_t startRow = range.begin();
-        uint_fast64_t endRow = range.end();
-
+    void operator()(uint64_t startRow, uint64_t endRow) const {
         typename std::vector<T>::iterator targetIt = target.begin() + startRow;
         typename std::vector<T>::iterator targetIte = target.begin() + endRow;
         typename std::vector<uint_fast64_t>::const_iterator rowGroupingIt = rowGrouping.begin() + startRow;
@@ -655,7 +683,7 @@ class TbbReduceVectorFunctor {
         T oldSelectedChoiceValue;
         uint64_t selectedChoice;
 
-        uint64_t currentRow = 0;
+        uint64_t currentRow = *rowGroupingIt;
         for (; targetIt != targetIte; ++targetIt, ++rowGroupingIt, ++choiceIt) {
             // Only traverse elements if the row group is non-empty.
             if (*rowGroupingIt != *(rowGroupingIt + 1)) {
@@ -687,6 +715,11 @@ class TbbReduceVectorFunctor {
                 if (choices && f(*targetIt, oldSelectedChoiceValue)) {
                     *choiceIt = selectedChoice;
                 }
+            } else {
+                if (choices) {
+                    *choiceIt = 0;
+                }
+                *targetIt = storm::utility::zero<T>();
             }
         }
     }
@@ -696,9 +729,8 @@ class TbbReduceVectorFunctor {
     std::vector<T>& target;
     std::vector<uint_fast64_t> const& rowGrouping;
     std::vector<uint_fast64_t>* choices;
-    Filter const& f;
+    Filter f;
 };
-#endif
 
 /*!
  * Reduces the given source vector by selecting an element according to the given filter out of each row group.
@@ -766,13 +798,21 @@ void reduceVector(std::vector<T> const& source, std::vector<T>& target, std::vec
     }
 }
 
-#ifdef STORM_HAVE_INTELTBB
+/*!
+ * Reduces the given source vector as reduceVector, but distributes the row groups among the given number of threads.
+ *
+ * @param numberOfThreads The maximal number of threads to use. If zero, all threads of the global thread pool are used.
+ */
 template<class T, class Filter>
 void reduceVectorParallel(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping,
-                          std::vector<uint_fast64_t>* choices) {
-    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, target.size()), TbbReduceVectorFunctor<T, Filter>(source, target, rowGrouping, choices, Filter()));
+                          std::vector<uint_fast64_t>* choices, uint64_t numberOfThreads = 0) {
+    if (!std::is_same<T, double>::value) {
+        reduceVector<T, Filter>(source, target, rowGrouping, choices);
+        return;
+    }
+    storm::utility::ThreadPool::getGlobalPool().parallelForBlocks(
+        0, target.size(), 1024, ParallelReduceVectorFunctor<T, Filter>(source, target, rowGrouping, choices, Filter()), numberOfThreads);
 }
-#endif
 
 /*!
  * Reduces the given source vector by selecting the smallest element out of each row group.
@@ -788,13 +828,11 @@ void reduceVectorMin(std::vector<T> const& source, std::vector<T>& target, std::
     reduceVector<T, storm::utility::ElementLess<T>>(source, target, rowGrouping, choices);
 }
 
-#ifdef STORM_HAVE_INTELTBB
 template<class T>
 void reduceVectorMinParallel(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping,
-                             std::vector<uint_fast64_t>* choices = nullptr) {
-    reduceVector<T, storm::utility::ElementLess<T>>(source, target, rowGrouping, choices);
+                             std::vector<uint_fast64_t>* choices = nullptr, uint64_t numberOfThreads = 0) {
+    reduceVectorParallel<T, storm::utility::ElementLess<T>>(source, target, rowGrouping, choices, numberOfThreads);
 }
-#endif
 
 /*!
  * Reduces the given source vector by selecting the largest element out of each row group.
@@ -810,13 +848,11 @@ void reduceVectorMax(std::vector<T> const& source, std::vector<T>& target, std::
     reduceVector<T, storm::utility::ElementGreater<T>>(source, target, rowGrouping, choices);
 }
 
-#ifdef STORM_HAVE_INTELTBB
 template<class T>
 void reduceVectorMaxParallel(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping,
-                             std::vector<uint_fast64_t>* choices = nullptr) {
-    reduceVector<T, storm::utility::ElementGreater<T>>(source, target, rowGrouping, choices);
+                             std::vector<uint_fast64_t>* choices = nullptr, uint64_t numberOfThreads = 0) {
+    reduceVectorParallel<T, storm::utility::ElementGreater<T>>(source, target, rowGrouping, choices, numberOfThreads);
 }
-#endif
 
 /*!
  * Reduces the given source vector by selecting either the smallest or the largest out of each row group.
@@ -837,17 +873,15 @@ void reduceVectorMinOrMax(storm::solver::OptimizationDirection dir, std::vector<
     }
 }
 
-#ifdef STORM_HAVE_INTELTBB
 template<class T>
 void reduceVectorMinOrMaxParallel(storm::solver::OptimizationDirection dir, std::vector<T> const& source, std::vector<T>& target,
-                                  std::vector<uint_fast64_t> const& rowGrouping, std::vector<uint_fast64_t>* choices = nullptr) {
+                                  std::vector<uint_fast64_t> const& rowGrouping, std::vector<uint_fast64_t>* choices = nullptr, uint64_t numberOfThreads = 0) {
     if (dir == storm::solver::OptimizationDirection::Minimize) {
-        reduceVectorMinParallel(source, target, rowGrouping, choices);
+        reduceVectorMinParallel(source, target, rowGrouping, choices, numberOfThreads);
     } else {
-        reduceVectorMaxParallel(source, target, rowGrouping, choices);
+        reduceVectorMaxParallel(source, target, rowGrouping, choices, numberOfThreads);
     }
 }
-#endif
 
 /*!
  * Compares the given elements and determines whether they are equal modulo the given precision. The provided flag
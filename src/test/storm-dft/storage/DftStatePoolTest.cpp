@@ -0,0 +1,40 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-dft/storage/DFTStatePool.h"
+
+namespace {
+
+TEST(DftStatePoolTest, AddGetRelease) {
+    storm::dft::storage::DFTStatePool pool(128);
+    std::vector<storm::storage::BitVector> states;
+    std::vector<storm::dft::storage::DFTStatePool::Handle> handles;
+    for (uint64_t i = 0; i < 10; ++i) {
+        storm::storage::BitVector status(128);
+        status.set(i);
+        status.set(127 - i);
+        states.push_back(status);
+        handles.push_back(pool.add(status));
+    }
+    EXPECT_EQ(pool.size(), 10ul);
+    for (uint64_t i = 0; i < 10; ++i) {
+        EXPECT_EQ(pool.get(handles[i]), states[i]);
+    }
+
+    // Released slots are reused
+    pool.release(handles[3]);
+    pool.release(handles[7]);
+    EXPECT_EQ(pool.size(), 8ul);
+    storm::storage::BitVector status(128, true);
+    auto handle = pool.add(status);
+    EXPECT_TRUE(handle == handles[3] || handle == handles[7]);
+    EXPECT_EQ(pool.size(), 9ul);
+    EXPECT_EQ(pool.get(handle), status);
+    for (uint64_t i = 0; i < 10; ++i) {
+        if (handles[i] != handle && i != 3 && i != 7) {
+            EXPECT_EQ(pool.get(handles[i]), states[i]);
+        }
+    }
+}
+
+}  // namespace
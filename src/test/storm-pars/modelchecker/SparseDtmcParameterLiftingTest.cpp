@@ -99,6 +99,40 @@ namespace {
         EXPECT_EQ(storm::modelchecker::RegionResult::AllViolated, regionChecker->analyzeRegion(this->env(), allVioRegion, storm::modelchecker::RegionResultHypothesis::Unknown,storm::modelchecker::RegionResult::Unknown, true));
     }
 
+    TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_ParallelRefinement) {
+        typedef typename TestFixture::ValueType ValueType;
+
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+        std::string formulaAsString = "P<=0.84 [F s=5 ]";
+
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+        auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+        auto task = storm::api::createTask<storm::RationalFunction>(formulas[0], true);
+        auto region = storm::api::parseRegion<storm::RationalFunction>("0.1<=pL<=0.9,0.1<=pK<=0.9", modelParameters);
+        auto coverageThreshold = storm::utility::convertNumber<storm::RationalFunction>(0.1);
+
+        auto sequentialResult = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task)->performRegionRefinement(this->env(), region, coverageThreshold);
+
+        std::vector<std::shared_ptr<storm::modelchecker::RegionModelChecker<storm::RationalFunction>>> checkers;
+        for (uint64_t i = 0; i < 4; ++i) {
+            checkers.push_back(storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task));
+        }
+        // Exact parameter lifting is performed sequentially as the arithmetic on rational numbers is not thread-safe.
+        EXPECT_EQ((std::is_same<ValueType, double>::value), checkers.front()->isConcurrentRegionAnalysisSupported());
+        auto parallelResult = storm::modelchecker::RegionModelChecker<storm::RationalFunction>::performParallelRegionRefinement(this->env(), checkers, region, coverageThreshold);
+
+        // The subregions and their results do not depend on the number of threads.
+        auto const& sequentialRegions = sequentialResult->getRegionResults();
+        auto const& parallelRegions = parallelResult->getRegionResults();
+        ASSERT_EQ(sequentialRegions.size(), parallelRegions.size());
+        for (uint64_t i = 0; i < sequentialRegions.size(); ++i) {
+            EXPECT_EQ(sequentialRegions[i].first.toString(true), parallelRegions[i].first.toString(true));
+            EXPECT_EQ(sequentialRegions[i].second, parallelRegions[i].second);
+        }
+    }
+
     TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_no_simplification) {
         typedef typename TestFixture::ValueType ValueType;
 
@@ -12,6 +12,8 @@
 #include "storm/settings/modules/GeneralSettings.h"
 
 #include "storm-pars/utility/ModelInstantiator.h"
+#include "storm-pars/api/instantiation.h"
+#include "storm/environment/Environment.h"
 #include "storm/api/storm.h"
 #include "storm-parsers/api/storm-parsers.h"
 #include "storm/models/sparse/Model.h"
@@ -57,7 +59,7 @@ TEST(ModelInstantiatorTest, BrpProb) {
                 for(auto const& paramEntry : dtmc->getTransitionMatrix().getRow(row)){
                     EXPECT_EQ(paramEntry.getColumn(), instantiatedEntry->getColumn());
                     double evaluatedValue = carl::toDouble(paramEntry.getValue().evaluate(valuation));
-                    EXPECT_EQ(evaluatedValue, instantiatedEntry->getValue());
+                    EXPECT_NEAR(evaluatedValue, instantiatedEntry->getValue(), 1e-12);
                     ++instantiatedEntry;
                 }
                 EXPECT_EQ(instantiated.getTransitionMatrix().getRow(row).end(),instantiatedEntry);
@@ -90,7 +92,7 @@ TEST(ModelInstantiatorTest, BrpProb) {
                 for(auto const& paramEntry : dtmc->getTransitionMatrix().getRow(row)){
                     EXPECT_EQ(paramEntry.getColumn(), instantiatedEntry->getColumn());
                     double evaluatedValue = carl::toDouble(paramEntry.getValue().evaluate(valuation));
-                    EXPECT_EQ(evaluatedValue, instantiatedEntry->getValue());
+                    EXPECT_NEAR(evaluatedValue, instantiatedEntry->getValue(), 1e-12);
                     ++instantiatedEntry;
                 }
                 EXPECT_EQ(instantiated.getTransitionMatrix().getRow(row).end(),instantiatedEntry);
@@ -123,7 +125,7 @@ TEST(ModelInstantiatorTest, BrpProb) {
                 for(auto const& paramEntry : dtmc->getTransitionMatrix().getRow(row)){
                     EXPECT_EQ(paramEntry.getColumn(), instantiatedEntry->getColumn());
                     double evaluatedValue = carl::toDouble(paramEntry.getValue().evaluate(valuation));
-                    EXPECT_EQ(evaluatedValue, instantiatedEntry->getValue());
+                    EXPECT_NEAR(evaluatedValue, instantiatedEntry->getValue(), 1e-12);
                     ++instantiatedEntry;
                 }
                 EXPECT_EQ(instantiated.getTransitionMatrix().getRow(row).end(),instantiatedEntry);
@@ -180,7 +182,7 @@ TEST(ModelInstantiatorTest, Brp_Rew) {
                 for(auto const& paramEntry : dtmc->getTransitionMatrix().getRow(row)){
                     EXPECT_EQ(paramEntry.getColumn(), instantiatedEntry->getColumn());
                     double evaluatedValue = carl::toDouble(paramEntry.getValue().evaluate(valuation));
-                    EXPECT_EQ(evaluatedValue, instantiatedEntry->getValue());
+                    EXPECT_NEAR(evaluatedValue, instantiatedEntry->getValue(), 1e-12);
                     ++instantiatedEntry;
                 }
                 EXPECT_EQ(instantiated.getTransitionMatrix().getRow(row).end(),instantiatedEntry);
@@ -195,7 +197,7 @@ TEST(ModelInstantiatorTest, Brp_Rew) {
         ASSERT_EQ(stateActionEntries, instantiated.getUniqueRewardModel().getStateActionRewardVector().size());
         for(std::size_t i =0; i<stateActionEntries; ++i){
             double evaluatedValue = carl::toDouble(dtmc->getUniqueRewardModel().getStateActionRewardVector()[i].evaluate(valuation));
-            EXPECT_EQ(evaluatedValue, instantiated.getUniqueRewardModel().getStateActionRewardVector()[i]);
+            EXPECT_NEAR(evaluatedValue, instantiated.getUniqueRewardModel().getStateActionRewardVector()[i], 1e-12);
         }
         EXPECT_EQ(dtmc->getStateLabeling(), instantiated.getStateLabeling());
         EXPECT_EQ(dtmc->getOptionalChoiceLabeling(), instantiated.getOptionalChoiceLabeling());
@@ -242,7 +244,7 @@ TEST(ModelInstantiatorTest, Consensus) {
             for(auto const& paramEntry : mdp->getTransitionMatrix().getRow(row)){
                 EXPECT_EQ(paramEntry.getColumn(), instantiatedEntry->getColumn());
                 double evaluatedValue = carl::toDouble(paramEntry.getValue().evaluate(valuation));
-                EXPECT_EQ(evaluatedValue, instantiatedEntry->getValue());
+                EXPECT_NEAR(evaluatedValue, instantiatedEntry->getValue(), 1e-12);
                 ++instantiatedEntry;
             }
             EXPECT_EQ(instantiated.getTransitionMatrix().getRow(row).end(),instantiatedEntry);
@@ -257,4 +259,112 @@ TEST(ModelInstantiatorTest, Consensus) {
     EXPECT_NEAR(0.3526577219, quantitativeChkResult[*instantiated.getInitialStates().begin()], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
 }
 
+TEST(ModelInstantiatorTest, BrpProbBatch) {
+    carl::VariablePool::getInstance().clear();
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P=? [F s=5 ]";
+
+    // Program and formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program.checkValidity();
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    ASSERT_TRUE(formulas.size()==1);
+    // Parametric model
+    storm::generator::NextStateGeneratorOptions options(*formulas.front());
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc = storm::builder::ExplicitModelBuilder<storm::RationalFunction>(program, options).build()->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+    storm::utility::ModelInstantiator<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::models::sparse::Dtmc<double>> modelInstantiator(*dtmc);
+
+    storm::RationalFunctionVariable const& pL = carl::VariablePool::getInstance().findVariableWithName("pL");
+    ASSERT_NE(pL, carl::Variable::NO_VARIABLE);
+    storm::RationalFunctionVariable const& pK = carl::VariablePool::getInstance().findVariableWithName("pK");
+    ASSERT_NE(pK, carl::Variable::NO_VARIABLE);
+    std::vector<std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient>> valuations;
+    for (uint64_t i = 0; i <= 10; ++i) {
+        for (uint64_t j = 0; j <= 10; ++j) {
+            std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> valuation;
+            valuation.insert(std::make_pair(pL, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(i) / storm::utility::convertNumber<storm::RationalFunctionCoefficient>(10)));
+            valuation.insert(std::make_pair(pK, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(j) / storm::utility::convertNumber<storm::RationalFunctionCoefficient>(10)));
+            valuations.push_back(std::move(valuation));
+        }
+    }
+
+    uint64_t numberOfInstantiations = 0;
+    modelInstantiator.instantiate(valuations, [&](uint64_t index, storm::models::sparse::Dtmc<double> const& instantiated) {
+        EXPECT_EQ(numberOfInstantiations, index);
+        ++numberOfInstantiations;
+        for(std::size_t row = 0; row < dtmc->getTransitionMatrix().getRowCount(); ++row){
+            auto instantiatedEntry = instantiated.getTransitionMatrix().getRow(row).begin();
+            for(auto const& paramEntry : dtmc->getTransitionMatrix().getRow(row)){
+                EXPECT_EQ(paramEntry.getColumn(), instantiatedEntry->getColumn());
+                double evaluatedValue = carl::toDouble(paramEntry.getValue().evaluate(valuations[index]));
+                EXPECT_NEAR(evaluatedValue, instantiatedEntry->getValue(), 1e-12);
+                ++instantiatedEntry;
+            }
+        }
+    });
+    EXPECT_EQ(valuations.size(), numberOfInstantiations);
+}
+
+TEST(ModelInstantiatorTest, BrpProbSampling) {
+    carl::VariablePool::getInstance().clear();
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P=? [F s=5 ]";
+
+    // Program and formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program.checkValidity();
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    ASSERT_TRUE(formulas.size()==1);
+    // Parametric model
+    storm::generator::NextStateGeneratorOptions options(*formulas.front());
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc = storm::builder::ExplicitModelBuilder<storm::RationalFunction>(program, options).build()->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    storm::modelchecker::CheckTask<storm::logic::Formula, storm::RationalFunction> checkTask(*formulas.front(), true);
+
+    storm::RationalFunctionVariable const& pL = carl::VariablePool::getInstance().findVariableWithName("pL");
+    ASSERT_NE(pL, carl::Variable::NO_VARIABLE);
+    storm::RationalFunctionVariable const& pK = carl::VariablePool::getInstance().findVariableWithName("pK");
+    ASSERT_NE(pK, carl::Variable::NO_VARIABLE);
+    std::vector<std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient>> valuations;
+    for (uint64_t i = 1; i < 10; ++i) {
+        for (uint64_t j = 1; j < 10; ++j) {
+            std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> valuation;
+            valuation.insert(std::make_pair(pL, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(i) / storm::utility::convertNumber<storm::RationalFunctionCoefficient>(10)));
+            valuation.insert(std::make_pair(pK, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(j) / storm::utility::convertNumber<storm::RationalFunctionCoefficient>(10)));
+            valuations.push_back(std::move(valuation));
+        }
+    }
+
+    storm::Environment env;
+    std::vector<storm::utility::Stopwatch> valuationWatches;
+    std::vector<uint64_t> reportedIndices;
+    auto results = storm::api::checkAtValuations<storm::modelchecker::SparseDtmcInstantiationModelChecker, storm::models::sparse::Dtmc<storm::RationalFunction>, double>(
+        env, *dtmc, checkTask, valuations, true, 2, &valuationWatches,
+        [&reportedIndices](uint64_t index, std::unique_ptr<storm::modelchecker::CheckResult> const& result, storm::utility::Stopwatch const&) {
+            EXPECT_TRUE(result != nullptr);
+            reportedIndices.push_back(index);
+        });
+    ASSERT_EQ(valuations.size(), results.size());
+    EXPECT_EQ(valuations.size(), valuationWatches.size());
+    // All results are reported exactly once and in the order of the valuations.
+    ASSERT_EQ(valuations.size(), reportedIndices.size());
+    for (uint64_t i = 0; i < reportedIndices.size(); ++i) {
+        EXPECT_EQ(i, reportedIndices[i]);
+    }
+
+    // Compare with checking each valuation on its own.
+    storm::utility::ModelInstantiator<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::models::sparse::Dtmc<double>> modelInstantiator(*dtmc);
+    uint64_t initialState = *dtmc->getInitialStates().begin();
+    for (uint64_t i = 0; i < valuations.size(); ++i) {
+        storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>> modelchecker(modelInstantiator.instantiate(valuations[i]));
+        std::unique_ptr<storm::modelchecker::CheckResult> expected = modelchecker.check(*formulas[0]);
+        ASSERT_TRUE(results[i] != nullptr);
+        // Only the result for the initial state is kept.
+        EXPECT_FALSE(results[i]->asExplicitQuantitativeCheckResult<double>().isResultForAllStates());
+        EXPECT_NEAR(expected->asExplicitQuantitativeCheckResult<double>()[initialState], results[i]->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-4);
+    }
+}
+
 #endif
@@ -0,0 +1,146 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <random>
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/generator/CompiledStateExpression.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/ExpressionEvaluator.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/prism/Program.h"
+
+namespace {
+
+// Evaluates all guards, likelihoods and assignments of the given program in randomly chosen states, both with the compiled
+// expressions and with an evaluator, and checks that the results coincide. Returns the number of compiled expressions.
+uint64_t checkCompiledExpressions(std::string const& filename) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(filename, true).substituteConstantsFormulas();
+    storm::generator::VariableInformation variableInformation(program, 32, false);
+    storm::expressions::ExpressionEvaluator<double> evaluator(program.getManager());
+
+    std::vector<std::pair<storm::expressions::Expression, storm::generator::CompiledStateExpression>> expressions;
+    auto addExpression = [&](storm::expressions::Expression const& expression) {
+        auto compiledExpression = storm::generator::CompiledStateExpression::compile(expression, variableInformation);
+        if (compiledExpression) {
+            expressions.emplace_back(expression, std::move(compiledExpression.get()));
+        }
+    };
+    for (auto const& module : program.getModules()) {
+        for (auto const& command : module.getCommands()) {
+            addExpression(command.getGuardExpression());
+            for (auto const& update : command.getUpdates()) {
+                addExpression(update.getLikelihoodExpression());
+                for (auto const& assignment : update.getAssignments()) {
+                    addExpression(assignment.getExpression());
+                }
+            }
+        }
+    }
+
+    std::mt19937 generator(42);
+    for (uint64_t sample = 0; sample < 100; ++sample) {
+        storm::generator::CompressedState state(variableInformation.getTotalBitOffset(true));
+        for (auto const& booleanVariable : variableInformation.booleanVariables) {
+            state.set(booleanVariable.bitOffset, generator() % 2 == 0);
+        }
+        for (auto const& integerVariable : variableInformation.integerVariables) {
+            std::uniform_int_distribution<int64_t> distribution(integerVariable.lowerBound, integerVariable.upperBound);
+            state.setFromInt(integerVariable.bitOffset, integerVariable.bitWidth, distribution(generator) - integerVariable.lowerBound);
+        }
+        storm::generator::unpackStateIntoEvaluator(state, variableInformation, evaluator);
+
+        for (auto const& expression : expressions) {
+            if (expression.first.hasBooleanType()) {
+                EXPECT_EQ(evaluator.asBool(expression.first), expression.second.evaluateAsBool(state)) << "for expression " << expression.first;
+            } else if (expression.first.hasIntegerType()) {
+                EXPECT_EQ(evaluator.asInt(expression.first), expression.second.evaluateAsInt(state)) << "for expression " << expression.first;
+            } else {
+                EXPECT_NEAR(evaluator.asRational(expression.first), expression.second.evaluateAsDouble(state), 1e-12) << "for expression " << expression.first;
+            }
+        }
+    }
+    return expressions.size();
+}
+
+}  // namespace
+
+TEST(CompiledStateExpressionTest, Expressions) {
+    std::string programText = R"(
+dtmc
+module test
+    x : [-3..5] init 0;
+    y : [0..10] init 0;
+    b : bool init false;
+    [] x < 0 & !b -> 0.5 : (x' = x + 1) + 0.5 : (y' = max(0, min(10, y * 2 - x)));
+    [] x >= 0 => (b | y = 3) -> (x + y) / 20 : (b' = ((x = 1) = b)) + 1 - (x + y) / 20 : (y' = (b ? floor(y / 3) : ceil(y / 4)));
+    [] pow(x, 2) > y -> (x' = mod(y, 7) - 3) & (b' = !(b != (x != y)));
+endmodule
+)";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(programText, "").substituteConstantsFormulas();
+    storm::generator::VariableInformation variableInformation(program, 32, false);
+    storm::expressions::ExpressionEvaluator<double> evaluator(program.getManager());
+
+    for (int64_t x = -3; x <= 5; ++x) {
+        for (int64_t y = 0; y <= 10; ++y) {
+            for (bool b : {false, true}) {
+                storm::generator::CompressedState state(variableInformation.getTotalBitOffset(true));
+                for (auto const& integerVariable : variableInformation.integerVariables) {
+                    int64_t value = integerVariable.getName() == "x" ? x : y;
+                    state.setFromInt(integerVariable.bitOffset, integerVariable.bitWidth, value - integerVariable.lowerBound);
+                }
+                state.set(variableInformation.booleanVariables.front().bitOffset, b);
+                storm::generator::unpackStateIntoEvaluator(state, variableInformation, evaluator);
+
+                for (auto const& command : program.getModule(0).getCommands()) {
+                    auto guard = storm::generator::CompiledStateExpression::compile(command.getGuardExpression(), variableInformation);
+                    ASSERT_TRUE(guard.is_initialized());
+                    EXPECT_EQ(evaluator.asBool(command.getGuardExpression()), guard->evaluateAsBool(state));
+                    for (auto const& update : command.getUpdates()) {
+                        auto likelihood = storm::generator::CompiledStateExpression::compile(update.getLikelihoodExpression(), variableInformation);
+                        ASSERT_TRUE(likelihood.is_initialized());
+                        EXPECT_NEAR(evaluator.asRational(update.getLikelihoodExpression()), likelihood->evaluateAsDouble(state), 1e-12);
+                        for (auto const& assignment : update.getAssignments()) {
+                            auto value = storm::generator::CompiledStateExpression::compile(assignment.getExpression(), variableInformation);
+                            ASSERT_TRUE(value.is_initialized());
+                            if (assignment.getExpression().hasBooleanType()) {
+                                EXPECT_EQ(evaluator.asBool(assignment.getExpression()), value->evaluateAsBool(state));
+                            } else {
+                                EXPECT_EQ(evaluator.asInt(assignment.getExpression()), value->evaluateAsInt(state));
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(CompiledStateExpressionTest, UnsupportedExpressions) {
+    std::string programText = R"(
+dtmc
+const double p;
+module test
+    x : [0..5] init 0;
+    [] x < 5 -> p : (x' = x + 1) + 1 - p : (x' = 0);
+endmodule
+)";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(programText, "").substituteConstantsFormulas();
+    storm::generator::VariableInformation variableInformation(program, 32, false);
+    storm::prism::Command const& command = program.getModule(0).getCommand(0);
+
+    storm::prism::Update const& update = command.getUpdate(0);
+
+    // The undefined constant is not part of the state.
+    EXPECT_TRUE(storm::generator::CompiledStateExpression::compile(command.getGuardExpression(), variableInformation).is_initialized());
+    EXPECT_FALSE(storm::generator::CompiledStateExpression::compile(update.getLikelihoodExpression(), variableInformation).is_initialized());
+    EXPECT_TRUE(storm::generator::CompiledStateExpression::compile(update.getAssignments().front().getExpression(), variableInformation).is_initialized());
+}
+
+TEST(CompiledStateExpressionTest, Programs) {
+    EXPECT_LT(0ul, checkCompiledExpressions(STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm"));
+    EXPECT_LT(0ul, checkCompiledExpressions(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm"));
+    EXPECT_LT(0ul, checkCompiledExpressions(STORM_TEST_RESOURCES_DIR "/dtmc/nand-5-2.pm"));
+    EXPECT_LT(0ul, checkCompiledExpressions(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm"));
+    EXPECT_LT(0ul, checkCompiledExpressions(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm"));
+}
@@ -147,6 +147,37 @@ TEST(ExplicitJaniModelBuilderTest, Mdp) {
     EXPECT_EQ(59ul, model->getNumberOfTransitions());
 }
 
+TEST(ExplicitJaniModelBuilderTest, ParallelExploration) {
+    std::vector<storm::jani::Model> janiModels;
+    for (std::string const& file : {"/dtmc/crowds-5-5.pm", "/mdp/firewire3-0.5.nm", "/mdp/csma2-2.nm"}) {
+        janiModels.push_back(storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file).toJani().substituteConstantsFunctions());
+    }
+    // The generators of this model need to keep the data of the eliminated arrays.
+    janiModels.push_back(storm::api::parseJaniModel(STORM_TEST_RESOURCES_DIR "/dtmc/die_array_nested.jani").first);
+
+    for (auto const& janiModel : janiModels) {
+        storm::generator::NextStateGeneratorOptions generatorOptions(true, true);
+        auto sequentialModel = storm::builder::ExplicitModelBuilder<double>(janiModel, generatorOptions).build();
+
+        generatorOptions.setNumberOfExplorationThreads(4);
+        auto parallelModel = storm::builder::ExplicitModelBuilder<double>(janiModel, generatorOptions).build();
+
+        EXPECT_EQ(sequentialModel->getNumberOfStates(), parallelModel->getNumberOfStates()) << janiModel.getName();
+        EXPECT_TRUE(sequentialModel->getTransitionMatrix() == parallelModel->getTransitionMatrix()) << janiModel.getName();
+        EXPECT_TRUE(sequentialModel->getStateLabeling() == parallelModel->getStateLabeling()) << janiModel.getName();
+        EXPECT_EQ(sequentialModel->getRewardModels().size(), parallelModel->getRewardModels().size()) << janiModel.getName();
+        for (auto const& rewardModel : sequentialModel->getRewardModels()) {
+            auto const& parallelRewardModel = parallelModel->getRewardModel(rewardModel.first);
+            if (rewardModel.second.hasStateRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateRewardVector(), parallelRewardModel.getStateRewardVector()) << janiModel.getName();
+            }
+            if (rewardModel.second.hasStateActionRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), parallelRewardModel.getStateActionRewardVector()) << janiModel.getName();
+            }
+        }
+    }
+}
+
 TEST(ExplicitJaniModelBuilderTest, Ma) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ma/simple.ma");
     storm::jani::Model janiModel = program.toJani().substituteConstantsFunctions();
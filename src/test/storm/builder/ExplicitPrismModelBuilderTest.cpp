@@ -107,6 +107,32 @@ TEST(ExplicitPrismModelBuilderTest, Mdp) {
     EXPECT_EQ(36ul, model->getInitialStates().getNumberOfSetBits());
 }
 
+TEST(ExplicitPrismModelBuilderTest, ParallelExploration) {
+    for (std::string const& file : {"/dtmc/crowds-5-5.pm", "/mdp/firewire3-0.5.nm", "/mdp/csma2-2.nm"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file);
+        storm::generator::NextStateGeneratorOptions generatorOptions(true, true);
+        generatorOptions.setBuildChoiceLabels();
+        auto sequentialModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+
+        generatorOptions.setNumberOfExplorationThreads(4);
+        auto parallelModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+
+        EXPECT_EQ(sequentialModel->getNumberOfStates(), parallelModel->getNumberOfStates()) << file;
+        EXPECT_TRUE(sequentialModel->getTransitionMatrix() == parallelModel->getTransitionMatrix()) << file;
+        EXPECT_TRUE(sequentialModel->getStateLabeling() == parallelModel->getStateLabeling()) << file;
+        EXPECT_EQ(sequentialModel->getRewardModels().size(), parallelModel->getRewardModels().size()) << file;
+        for (auto const& rewardModel : sequentialModel->getRewardModels()) {
+            auto const& parallelRewardModel = parallelModel->getRewardModel(rewardModel.first);
+            if (rewardModel.second.hasStateRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateRewardVector(), parallelRewardModel.getStateRewardVector()) << file;
+            }
+            if (rewardModel.second.hasStateActionRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), parallelRewardModel.getStateActionRewardVector()) << file;
+            }
+        }
+    }
+}
+
 TEST(ExplicitPrismModelBuilderTest, Ma) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ma/simple.ma");
 
@@ -0,0 +1,98 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <algorithm>
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/generator/GuardIndex.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/ExpressionEvaluator.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/prism/Program.h"
+
+namespace {
+
+std::vector<storm::expressions::Expression> getGuards(storm::prism::Module const& module) {
+    std::vector<storm::expressions::Expression> guards;
+    for (auto const& command : module.getCommands()) {
+        guards.push_back(command.getGuardExpression());
+    }
+    return guards;
+}
+
+}  // namespace
+
+TEST(GuardIndexTest, Bucketing) {
+    std::string programText = R"(
+mdp
+module test
+    s : [0..4] init 0;
+    x : [0..3] init 0;
+    b : bool init false;
+    [] s = 0 & x < 3 -> (x' = x + 1);
+    [] s = 0 & x = 3 -> (s' = 1);
+    [] s = 1 & !b -> (b' = true);
+    [] 2 = s & b -> (s' = 3);
+    [] s = 3 & x = 0 & s = 4 -> (s' = 0);
+    [] s = 7 -> (s' = 0);
+    [] x = 2 | b -> (x' = 0);
+    [] s = 4 -> (s' = 0);
+endmodule
+)";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(programText, "").substituteConstantsFormulas();
+    storm::generator::VariableInformation variableInformation(program, 32, false);
+    storm::expressions::ExpressionEvaluator<double> evaluator(program.getManager());
+    std::vector<storm::expressions::Expression> guards = getGuards(program.getModule(0));
+
+    storm::generator::GuardIndex guardIndex(guards, variableInformation);
+    ASSERT_TRUE(guardIndex.hasIndexVariable());
+    EXPECT_EQ("s", guardIndex.getIndexVariable().getName());
+
+    uint64_t numberOfCandidates = 0;
+    uint64_t numberOfStates = 0;
+    for (int64_t s = 0; s <= 4; ++s) {
+        for (int64_t x = 0; x <= 3; ++x) {
+            for (bool b : {false, true}) {
+                storm::generator::CompressedState state(variableInformation.getTotalBitOffset(true));
+                for (auto const& integerVariable : variableInformation.integerVariables) {
+                    int64_t value = integerVariable.getName() == "s" ? s : x;
+                    state.setFromInt(integerVariable.bitOffset, integerVariable.bitWidth, value - integerVariable.lowerBound);
+                }
+                state.set(variableInformation.booleanVariables.front().bitOffset, b);
+                storm::generator::unpackStateIntoEvaluator(state, variableInformation, evaluator);
+
+                std::vector<uint64_t> const& candidates = guardIndex.getPotentiallySatisfiedGuards(state);
+                EXPECT_TRUE(std::is_sorted(candidates.begin(), candidates.end()));
+                for (uint64_t guard = 0; guard < guards.size(); ++guard) {
+                    if (evaluator.asBool(guards[guard])) {
+                        EXPECT_TRUE(std::binary_search(candidates.begin(), candidates.end(), guard)) << "for guard " << guards[guard];
+                    }
+                }
+                numberOfCandidates += candidates.size();
+                ++numberOfStates;
+            }
+        }
+    }
+    // Each state has the one guard that does not fix s and at most two guards that fix s to the current value.
+    EXPECT_LE(numberOfCandidates, 3 * numberOfStates);
+}
+
+TEST(GuardIndexTest, NoBucketing) {
+    std::string programText = R"(
+dtmc
+module test
+    x : [0..3] init 0;
+    [] x < 3 -> (x' = x + 1);
+    [] x = 3 -> (x' = 0);
+endmodule
+)";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(programText, "").substituteConstantsFormulas();
+    storm::generator::VariableInformation variableInformation(program, 32, false);
+    std::vector<storm::expressions::Expression> guards = getGuards(program.getModule(0));
+
+    // Only one guard fixes the value of x, so bucketing does not pay off.
+    storm::generator::GuardIndex guardIndex(guards, variableInformation);
+    EXPECT_FALSE(guardIndex.hasIndexVariable());
+    storm::generator::CompressedState state(variableInformation.getTotalBitOffset(true));
+    EXPECT_EQ(std::vector<uint64_t>({0, 1}), guardIndex.getPotentiallySatisfiedGuards(state));
+}
@@ -0,0 +1,91 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-cli-utilities/model-server.h"
+
+namespace {
+
+class ModelServerTest : public ::testing::Test {
+   protected:
+    bool handle(std::string const& request) {
+        answers.clear();
+        return storm::cli::handleServerRequest(models, request, [this](storm::json<double> const& answer) { answers.push_back(answer); });
+    }
+
+    std::map<std::string, storm::cli::ServerModel> models;
+    std::vector<storm::json<double>> answers;
+};
+
+TEST_F(ModelServerTest, LoadCheckUnload) {
+    EXPECT_TRUE(handle("{\"command\": \"load\", \"id\": 1, \"model\": \"die\", \"prism\": \"" STORM_TEST_RESOURCES_DIR "/dtmc/die.pm\"}"));
+    ASSERT_EQ(1ul, answers.size());
+    EXPECT_FALSE(answers[0].contains("error"));
+    EXPECT_EQ(1, answers[0].at("id").get<int>());
+    EXPECT_TRUE(answers[0].at("done").get<bool>());
+    EXPECT_EQ(1ul, models.size());
+
+    // One answer per property, followed by the final answer.
+    EXPECT_TRUE(handle("{\"command\": \"check\", \"id\": 2, \"model\": \"die\", \"properties\": \"P=? [F \\\"one\\\"]; P=? [F \\\"done\\\"]\"}"));
+    ASSERT_EQ(3ul, answers.size());
+    for (auto const& answer : answers) {
+        EXPECT_FALSE(answer.contains("error"));
+        EXPECT_EQ(2, answer.at("id").get<int>());
+    }
+    EXPECT_NEAR(1.0 / 6.0, answers[0].at("result").at(0).at("v").get<double>(), 1e-6);
+    EXPECT_NEAR(1.0, answers[1].at("result").at(0).at("v").get<double>(), 1e-6);
+    EXPECT_FALSE(answers[0].contains("done"));
+    EXPECT_TRUE(answers[2].at("done").get<bool>());
+
+    EXPECT_TRUE(handle("{\"command\": \"list\"}"));
+    ASSERT_EQ(1ul, answers.size());
+    ASSERT_EQ(1ul, answers[0].at("models").size());
+    EXPECT_EQ("die", answers[0].at("models").at(0).at("model").get<std::string>());
+    EXPECT_EQ(13ul, answers[0].at("models").at(0).at("states").get<uint64_t>());
+
+    EXPECT_TRUE(handle("{\"command\": \"unload\", \"model\": \"die\"}"));
+    ASSERT_EQ(1ul, answers.size());
+    EXPECT_FALSE(answers[0].contains("error"));
+    EXPECT_TRUE(models.empty());
+
+    EXPECT_FALSE(handle("{\"command\": \"shutdown\"}"));
+    ASSERT_EQ(1ul, answers.size());
+    EXPECT_TRUE(answers[0].at("done").get<bool>());
+}
+
+TEST_F(ModelServerTest, MdpPrecomputationsAreDroppedAfterRequest) {
+    EXPECT_TRUE(handle("{\"command\": \"load\", \"model\": \"dice\", \"prism\": \"" STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm\"}"));
+    ASSERT_EQ(1ul, answers.size());
+    EXPECT_FALSE(answers[0].contains("error"));
+    ASSERT_TRUE(models.at("dice").mdpModelChecker != nullptr);
+
+    EXPECT_TRUE(handle("{\"command\": \"check\", \"model\": \"dice\", \"properties\": \"Pmin=? [F \\\"two\\\"]; Pmax=? [F \\\"two\\\"]\"}"));
+    ASSERT_EQ(3ul, answers.size());
+    EXPECT_NEAR(1.0 / 36.0, answers[0].at("result").at(0).at("v").get<double>(), 1e-6);
+    EXPECT_NEAR(1.0 / 36.0, answers[1].at("result").at(0).at("v").get<double>(), 1e-6);
+
+    // The shared precomputations only live as long as the request.
+    EXPECT_EQ(nullptr, models.at("dice").mdpModelChecker->getPrecomputationCache());
+}
+
+TEST_F(ModelServerTest, Errors) {
+    // Errors are reported in the final answer and do not stop the server.
+    EXPECT_TRUE(handle("not json"));
+    ASSERT_EQ(1ul, answers.size());
+    EXPECT_TRUE(answers[0].contains("error"));
+    EXPECT_TRUE(answers[0].at("done").get<bool>());
+
+    EXPECT_TRUE(handle("{\"command\": \"check\", \"model\": \"unknown\", \"properties\": \"P=? [F true]\"}"));
+    ASSERT_EQ(1ul, answers.size());
+    EXPECT_TRUE(answers[0].contains("error"));
+
+    EXPECT_TRUE(handle("{\"command\": \"unknown\"}"));
+    ASSERT_EQ(1ul, answers.size());
+    EXPECT_TRUE(answers[0].contains("error"));
+
+    EXPECT_TRUE(handle("{\"command\": \"load\", \"model\": \"die\"}"));
+    ASSERT_EQ(1ul, answers.size());
+    EXPECT_TRUE(answers[0].contains("error"));
+    EXPECT_TRUE(models.empty());
+}
+
+}  // namespace
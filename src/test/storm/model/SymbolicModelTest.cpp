@@ -0,0 +1,67 @@
+#include "storm-config.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/DdPrismModelBuilder.h"
+#include "storm/models/symbolic/Dtmc.h"
+#include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/storage/dd/Add.h"
+#include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/Odd.h"
+#include "test/storm_gtest.h"
+
+TEST(SymbolicModelTest, ExplicitRepresentationCache) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> model =
+        storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program);
+
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> matrix = model->getTransitionMatrix();
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> otherMatrix = matrix * model->getManager().template getConstant<double>(0.5);
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> states = model->getReachableStates();
+    storm::dd::Odd odd = states.createOdd();
+
+    // By default, nothing is cached.
+    auto explicitMatrix = model->toExplicitMatrix(matrix, states, odd);
+    EXPECT_EQ(13ul, explicitMatrix->getRowCount());
+    EXPECT_EQ(20ul, explicitMatrix->getEntryCount());
+    EXPECT_NE(explicitMatrix, model->toExplicitMatrix(matrix, states, odd));
+
+    // Once enabled, the conversion is reused.
+    model->setExplicitRepresentationCacheCapacity(40);
+    explicitMatrix = model->toExplicitMatrix(matrix, states, odd);
+    EXPECT_EQ(explicitMatrix, model->toExplicitMatrix(matrix, states, odd));
+    auto otherExplicitMatrix = model->toExplicitMatrix(otherMatrix, states, odd);
+    EXPECT_NE(explicitMatrix, otherExplicitMatrix);
+    EXPECT_EQ(explicitMatrix, model->toExplicitMatrix(matrix, states, odd));
+    EXPECT_EQ(otherExplicitMatrix, model->toExplicitMatrix(otherMatrix, states, odd));
+
+    // Conversions that exceed the capacity evict the least recently used ones.
+    model->setExplicitRepresentationCacheCapacity(20);
+    EXPECT_EQ(otherExplicitMatrix, model->toExplicitMatrix(otherMatrix, states, odd));
+    EXPECT_NE(explicitMatrix, model->toExplicitMatrix(matrix, states, odd));
+
+    // Disabling the cache drops all conversions.
+    model->setExplicitRepresentationCacheCapacity(0);
+    explicitMatrix = model->toExplicitMatrix(matrix, states, odd);
+    EXPECT_NE(explicitMatrix, model->toExplicitMatrix(matrix, states, odd));
+}
+
+TEST(SymbolicModelTest, ParallelExplicitRepresentation) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> model =
+        storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program);
+
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> states = model->getReachableStates();
+    storm::dd::Odd odd = states.createOdd();
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> vector = model->getInitialStates().template toAdd<double>();
+
+    auto sequential = model->toExplicitMatrixVector(model->getTransitionMatrix(), vector, states, odd, {}, 1);
+    auto parallel = model->toExplicitMatrixVector(model->getTransitionMatrix(), vector, states, odd, {}, 4);
+    EXPECT_EQ(8607ul, parallel.first->getRowCount());
+    EXPECT_EQ(15113ul, parallel.first->getEntryCount());
+    EXPECT_EQ(*sequential.first, *parallel.first);
+    EXPECT_EQ(*sequential.second, *parallel.second);
+}
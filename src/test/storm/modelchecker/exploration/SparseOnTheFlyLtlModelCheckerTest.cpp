@@ -0,0 +1,127 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/parser/FormulaParser.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/automata/DeterministicAutomaton.h"
+#include "storm/automata/LTL2DeterministicAutomaton.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/environment/Environment.h"
+#include "storm/logic/ExtractMaximalStateFormulasVisitor.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/helper/ltl/SparseLTLHelper.h"
+#include "storm/modelchecker/prctl/SparseOnTheFlyLtlModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+TEST(SparseOnTheFlyLtlModelCheckerTest, Die) {
+#ifdef STORM_HAVE_LTL_MODELCHECKING_SUPPORT
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::parser::FormulaParser formulaParser(program);
+    storm::modelchecker::SparseOnTheFlyLtlModelChecker<storm::models::sparse::Dtmc<double>> checker(program);
+    storm::Environment env;
+
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [(X s>0) U (s=7 & d=2)]");
+    ASSERT_TRUE(checker.canHandle(storm::modelchecker::CheckTask<>(*formula, true)));
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_NEAR(1.0 / 6.0, result->asExplicitQuantitativeCheckResult<double>()[0], 1e-6);
+
+    formula = formulaParser.parseSingleFormulaFromString("P=? [ (F (X (s=6 & (XX s=5)))) & (F G (d!=5))]");
+    result = checker.check(env, storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_NEAR(1.0 / 24.0, result->asExplicitQuantitativeCheckResult<double>()[0], 1e-6);
+
+    formula = formulaParser.parseSingleFormulaFromString("P=? [ F (s=3 U (\"three\"))]");
+    result = checker.check(env, storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_NEAR(1.0 / 6.0, result->asExplicitQuantitativeCheckResult<double>()[0], 1e-6);
+
+    // State subformulas that are not propositional can not be expressed over the model variables.
+    formula = formulaParser.parseSingleFormulaFromString("P=? [ F (P>0.5 [X s=1])]");
+    EXPECT_FALSE(checker.canHandle(storm::modelchecker::CheckTask<>(*formula, true)));
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(SparseOnTheFlyLtlModelCheckerTest, Coin) {
+#ifdef STORM_HAVE_LTL_MODELCHECKING_SUPPORT
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm");
+    storm::parser::FormulaParser formulaParser(program);
+    storm::modelchecker::SparseOnTheFlyLtlModelChecker<storm::models::sparse::Mdp<double>> checker(program);
+    storm::Environment env;
+
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("Pmin=? [!(GF \"all_coins_equal_1\")]");
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_NEAR(4.0 / 9.0, result->asExplicitQuantitativeCheckResult<double>()[0], 1e-6);
+
+    formula = formulaParser.parseSingleFormulaFromString("Pmax=? [F \"all_coins_equal_1\" U \"finished\"]");
+    result = checker.check(env, storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_NEAR(5.0 / 9.0, result->asExplicitQuantitativeCheckResult<double>()[0], 1e-6);
+
+    formula = formulaParser.parseSingleFormulaFromString("P>0.4 [!(GF \"all_coins_equal_1\")]");
+    result = checker.check(env, storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_TRUE(result->asExplicitQualitativeCheckResult()[0]);
+
+    formula = formulaParser.parseSingleFormulaFromString("Pmax=?[ (GF \"all_coins_equal_1\") & ((GF \"all_coins_equal_0\") | (FG \"finished\"))]");
+    result = checker.check(env, storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_NEAR(5.0 / 9.0, result->asExplicitQuantitativeCheckResult<double>()[0], 1e-6);
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(SparseOnTheFlyLtlModelCheckerTest, FixedDeadlocks) {
+#ifdef STORM_HAVE_LTL_MODELCHECKING_SUPPORT
+    // The states with s=1 and s=2 are deadlocks that are fixed by self-loops. The automaton has to keep reading their labels.
+    std::string programString =
+        "dtmc\n"
+        "module main\n"
+        "  s : [0..2] init 0;\n"
+        "  [] s=0 -> 0.5 : (s'=1) + 0.5 : (s'=2);\n"
+        "endmodule\n"
+        "label \"a\" = s=1;\n"
+        "label \"b\" = s!=2;\n";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(programString, "deadlocks");
+    storm::parser::FormulaParser formulaParser(program);
+    storm::modelchecker::SparseOnTheFlyLtlModelChecker<storm::models::sparse::Dtmc<double>> checker(program);
+    storm::Environment env;
+
+    // Compare against the product that is built from the explicit model.
+    auto model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true))
+                     .build()
+                     ->as<storm::models::sparse::Dtmc<double>>();
+    ASSERT_EQ(2ull, model->getStates("deadlock").getNumberOfSetBits());
+    auto computeOnBuiltModel = [&model, &env](storm::logic::Formula const& formula) {
+        storm::logic::ExtractMaximalStateFormulasVisitor::ApToFormulaMap extracted;
+        std::shared_ptr<storm::logic::Formula> ltlFormula =
+            storm::logic::ExtractMaximalStateFormulasVisitor::extract(formula.asProbabilityOperatorFormula().getSubformula().asPathFormula(), extracted);
+        std::map<std::string, storm::storage::BitVector> apSatSets;
+        for (auto const& apFormulaPair : extracted) {
+            apSatSets[apFormulaPair.first] = model->getStates(apFormulaPair.second->asAtomicLabelFormula().getLabel());
+        }
+        auto da = storm::automata::LTL2DeterministicAutomaton::ltl2daSpot(*ltlFormula, false);
+        storm::modelchecker::helper::SparseLTLHelper<double, false> helper(model->getTransitionMatrix());
+        helper.setRelevantStates(model->getInitialStates());
+        return helper.computeDAProductProbabilities(env, *da, apSatSets)[*model->getInitialStates().begin()];
+    };
+
+    for (std::string const& formulaString : {"P=? [X X \"a\"]", "P=? [F (\"a\" & X \"a\")]", "P=? [F G \"b\"]", "P=? [(X \"b\") U (\"a\" & X X \"a\")]"}) {
+        std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString(formulaString);
+        std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, storm::modelchecker::CheckTask<>(*formula, true));
+        EXPECT_NEAR(0.5, result->asExplicitQuantitativeCheckResult<double>()[0], 1e-6) << formulaString;
+        EXPECT_NEAR(computeOnBuiltModel(*formula), result->asExplicitQuantitativeCheckResult<double>()[0], 1e-6) << formulaString;
+    }
+
+    // An initial deadlock state is read twice when checking the next state.
+    program = storm::parser::PrismParser::parseFromString("dtmc\nmodule main\n  s : [0..1] init 0;\n  [] s=1 -> (s'=0);\nendmodule\nlabel \"a\" = s=0;\n",
+                                                          "initialdeadlock");
+    storm::modelchecker::SparseOnTheFlyLtlModelChecker<storm::models::sparse::Dtmc<double>> initialDeadlockChecker(program);
+    std::shared_ptr<storm::logic::Formula const> formula = storm::parser::FormulaParser(program).parseSingleFormulaFromString("P=? [X \"a\"]");
+    std::unique_ptr<storm::modelchecker::CheckResult> result = initialDeadlockChecker.check(env, storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_NEAR(1.0, result->asExplicitQuantitativeCheckResult<double>()[0], 1e-6);
+#else
+    GTEST_SKIP();
+#endif
+}
@@ -5,6 +5,8 @@
 #include "storm/api/storm.h"
 #include "storm/environment/Environment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/modelchecker/multiobjective/multiObjectiveModelChecking.h"
 #include "storm/modelchecker/results/ExplicitParetoCurveCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
@@ -285,6 +287,36 @@ TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, single_obj_lower_bounds) {
     EXPECT_EQ(expectedResult, result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
 }
 
+TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, single_obj_concurrent_epochs) {
+    storm::Environment env;
+    storm::Environment concurrentEnv;
+    concurrentEnv.solver().setNumberOfThreads(4);
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/mdp/one_dim_walk.nm";
+    std::string constantsDef = "N=10";
+    std::string formulasAsString = "Pmax=? [ F{\"r\"}<=5,{\"l\"}<=10 x=N ] ";
+    formulasAsString += "; \n Pmin=? [ F{\"r\"}>=2,{\"l\"}<=4 x=N ] ";
+
+    // programm, model,  formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, constantsDef);
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Mdp<double>>();
+    uint_fast64_t const initState = *mdp->getInitialStates().begin();
+
+    // Analyzing independent epochs concurrently should not change the result.
+    for (auto const& formula : formulas) {
+        std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine(env, mdp, storm::api::createTask<double>(formula, true));
+        ASSERT_TRUE(result->isExplicitQuantitativeCheckResult());
+        std::unique_ptr<storm::modelchecker::CheckResult> concurrentResult =
+            storm::api::verifyWithSparseEngine(concurrentEnv, mdp, storm::api::createTask<double>(formula, true));
+        ASSERT_TRUE(concurrentResult->isExplicitQuantitativeCheckResult());
+        EXPECT_NEAR(result->asExplicitQuantitativeCheckResult<double>()[initState], concurrentResult->asExplicitQuantitativeCheckResult<double>()[initState],
+                    1e-6);
+    }
+}
+
 #if defined STORM_HAVE_HYPRO || defined STORM_HAVE_Z3_OPTIMIZE
 
 TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, one_dim_walk_small) {
@@ -545,6 +577,35 @@ TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, csma) {
     EXPECT_TRUE(result->asExplicitParetoCurveCheckResult<storm::RationalNumber>().getOverApproximation()->contains(expectedAchievableValues));
 }
 
+TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, csma_objectives_solved_together) {
+    storm::Environment env;
+    env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Gmmxx);
+    storm::Environment powerEnv;
+    powerEnv.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+    powerEnv.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Power);
+    powerEnv.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/mdp/csma2_2.nm";
+    std::string formulasAsString = "multi(P>=0.5 [ F{\"time\"}<=70 \"all_delivered\" ], Pmax=? [ !\"collision_max_backoff\" U \"all_delivered\"] )";
+
+    // programm, model,  formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Mdp<double>>();
+    uint_fast64_t const initState = *mdp->getInitialStates().begin();
+
+    // With the native power method, the linear equation systems of the objectives are solved together. This should not change the result.
+    std::unique_ptr<storm::modelchecker::CheckResult> result =
+        storm::modelchecker::multiobjective::performMultiObjectiveModelChecking(env, *mdp, formulas[0]->asMultiObjectiveFormula());
+    ASSERT_TRUE(result->isExplicitQuantitativeCheckResult());
+    std::unique_ptr<storm::modelchecker::CheckResult> powerResult =
+        storm::modelchecker::multiobjective::performMultiObjectiveModelChecking(powerEnv, *mdp, formulas[0]->asMultiObjectiveFormula());
+    ASSERT_TRUE(powerResult->isExplicitQuantitativeCheckResult());
+    EXPECT_NEAR(0.875, result->asExplicitQuantitativeCheckResult<double>()[initState], 1e-4);
+    EXPECT_NEAR(result->asExplicitQuantitativeCheckResult<double>()[initState], powerResult->asExplicitQuantitativeCheckResult<double>()[initState], 1e-4);
+}
+
 TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, lower_bounds) {
     storm::Environment env;
 
@@ -2,8 +2,10 @@
 #include "test/storm_gtest.h"
 
 #include "storm-parsers/parser/FormulaParser.h"
+#include "storm/api/verification.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/solver/StandardMinMaxLinearEquationSolver.h"
@@ -202,3 +204,72 @@ TEST(ExplicitMdpPrctlModelCheckerTest, AsynchronousLeader) {
 
     EXPECT_NEAR(30.0 / 7.0, quantitativeResult6[0], precision);
 }
+
+TEST(ExplicitMdpPrctlModelCheckerTest, BatchChecking) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(
+        STORM_TEST_RESOURCES_DIR "/tra/leader4.tra", STORM_TEST_RESOURCES_DIR "/lab/leader4.lab", "", STORM_TEST_RESOURCES_DIR "/rew/leader4.trans.rew");
+    ASSERT_EQ(abstractModel->getType(), storm::models::ModelType::Mdp);
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = abstractModel->as<storm::models::sparse::Mdp<double>>();
+    storm::Environment env;
+
+    // Several properties share the target states and the optimization direction.
+    storm::parser::FormulaParser formulaParser;
+    std::vector<std::string> formulaStrings = {"Pmin=? [F \"elected\"]", "Pmax=? [F \"elected\"]",   "Pmax=? [F<=25 \"elected\"]",
+                                               "Rmin=? [F \"elected\"]", "P>=0.5 [F \"elected\"]", "Rmax=? [F \"elected\"]",
+                                               "Pmin=? [F \"elected\"]", "Rmin=? [F \"elected\"]"};
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+    std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, double>> tasks;
+    for (auto const& formulaString : formulaStrings) {
+        formulas.push_back(formulaParser.parseSingleFormulaFromString(formulaString));
+        tasks.push_back(storm::api::createTask<double>(formulas.back(), false));
+    }
+
+    auto batchResults = storm::api::verifyWithSparseEngine(env, mdp, tasks);
+    ASSERT_EQ(tasks.size(), batchResults.size());
+    for (uint64_t i = 0; i < tasks.size(); ++i) {
+        // Check each property with a fresh model checker.
+        auto result = storm::api::verifyWithSparseEngine(env, mdp, tasks[i]);
+        ASSERT_TRUE(result != nullptr);
+        ASSERT_TRUE(batchResults[i] != nullptr);
+        if (result->isExplicitQuantitativeCheckResult()) {
+            ASSERT_TRUE(batchResults[i]->isExplicitQuantitativeCheckResult());
+            EXPECT_EQ(result->asExplicitQuantitativeCheckResult<double>().getValueVector(),
+                      batchResults[i]->asExplicitQuantitativeCheckResult<double>().getValueVector())
+                << "for formula " << formulaStrings[i];
+        } else {
+            ASSERT_TRUE(batchResults[i]->isExplicitQualitativeCheckResult());
+            EXPECT_EQ(result->asExplicitQualitativeCheckResult().getTruthValuesVector(),
+                      batchResults[i]->asExplicitQualitativeCheckResult().getTruthValuesVector())
+                << "for formula " << formulaStrings[i];
+        }
+    }
+
+    // The precomputations are only shared if this is enabled. Repeated properties then reuse them.
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+    EXPECT_EQ(nullptr, checker.getPrecomputationCache());
+    checker.enablePrecomputationCache();
+    ASSERT_NE(nullptr, checker.getPrecomputationCache());
+    for (uint64_t i = 0; i < 4; ++i) {
+        checker.check(env, tasks[i]);
+    }
+    uint64_t hits = checker.getPrecomputationCache()->getNumberOfHits();
+    checker.check(env, tasks[6]);
+    checker.check(env, tasks[7]);
+    EXPECT_GE(checker.getPrecomputationCache()->getNumberOfHits(), hits + 2);
+
+    // If the cache is full, the oldest entries are dropped.
+    storm::modelchecker::helper::SparseMdpPrecomputationCache<double> cache(mdp->getTransitionMatrix(), 2);
+    storm::storage::BitVector allStates(mdp->getNumberOfStates(), true);
+    storm::storage::BitVector const& electedStates = mdp->getStates("elected");
+    auto prob01Min = cache.getProb01(storm::OptimizationDirection::Minimize, allStates, electedStates);
+    auto prob01Max = cache.getProb01(storm::OptimizationDirection::Maximize, allStates, electedStates);
+    auto prob1Min = cache.getProb1(storm::OptimizationDirection::Minimize, electedStates);
+    EXPECT_EQ(2ull, cache.getNumberOfEntries());
+    EXPECT_EQ(0ull, cache.getNumberOfHits());
+    EXPECT_EQ(prob01Max, cache.getProb01(storm::OptimizationDirection::Maximize, allStates, electedStates));
+    EXPECT_EQ(prob1Min, cache.getProb1(storm::OptimizationDirection::Minimize, electedStates));
+    EXPECT_EQ(2ull, cache.getNumberOfHits());
+    EXPECT_EQ(prob01Min, cache.getProb01(storm::OptimizationDirection::Minimize, allStates, electedStates));
+    EXPECT_EQ(2ull, cache.getNumberOfHits());
+    EXPECT_EQ(2ull, cache.getNumberOfEntries());
+}
@@ -39,6 +39,20 @@ class SparseValueTypeValueIterationEnvironment {
     }
 };
 
+class SparseValueTypeValueIterationConcurrentEnvironment {
+   public:
+    static const bool isExact = false;
+    typedef double ValueType;
+    typedef storm::models::sparse::Mdp<ValueType> ModelType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().lra().setNondetLraMethod(storm::solver::LraMethod::ValueIteration);
+        env.solver().lra().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+        env.solver().lra().setNumberOfThreads(4);
+        return env;
+    }
+};
+
 class SparseValueTypeLinearProgrammingEnvironment {
    public:
     static const bool isExact = false;
@@ -119,7 +133,8 @@ class LraMdpPrctlModelCheckerTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<SparseValueTypeValueIterationEnvironment, SparseValueTypeLinearProgrammingEnvironment, SparseSoundEnvironment
+typedef ::testing::Types<SparseValueTypeValueIterationEnvironment, SparseValueTypeValueIterationConcurrentEnvironment, SparseValueTypeLinearProgrammingEnvironment,
+                         SparseSoundEnvironment
 #ifdef STORM_HAVE_Z3_OPTIMIZE
                          ,
                          SparseRationalLinearProgrammingEnvironment
@@ -0,0 +1,50 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <unistd.h>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+
+#include "storm-parsers/parser/BinaryModelParser.h"
+#include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/io/BinaryModelExporter.h"
+#include "test/storm/parser/SparseModelComparison.h"
+
+namespace {
+
+// Exports the given model in binary format, loads it again and checks that all components coincide.
+void checkRoundTrip(std::shared_ptr<storm::models::sparse::Model<double>> const& model) {
+    // Use a fresh file such that concurrently running tests do not interfere.
+    std::string filename = (std::filesystem::temp_directory_path() / "storm-binary-model-parser-test-XXXXXX").string();
+    int fileDescriptor = mkstemp(filename.data());
+    ASSERT_NE(-1, fileDescriptor);
+    close(fileDescriptor);
+    {
+        std::ofstream stream(filename, std::ios::out | std::ios::binary);
+        storm::exporter::exportSparseModelAsBinary(stream, *model);
+    }
+    std::shared_ptr<storm::models::sparse::Model<double>> loadedModel = storm::parser::BinaryModelParser::parseModel(filename);
+    std::remove(filename.c_str());
+
+    storm::test::expectEqualSparseModels(*model, *loadedModel);
+}
+
+}  // namespace
+
+TEST(BinaryModelParserTest, RoundTrip) {
+    storm::parser::DirectEncodingParserOptions options;
+    options.buildChoiceLabeling = true;
+    checkRoundTrip(storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn"));
+    checkRoundTrip(storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn"));
+    checkRoundTrip(storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.drn"));
+    checkRoundTrip(storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ma/jobscheduler.drn", options));
+}
+
+TEST(BinaryModelParserTest, WrongFormat) {
+    // A model in DRN format is rejected.
+    STORM_SILENT_EXPECT_THROW(storm::parser::BinaryModelParser::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn"),
+                              storm::exceptions::WrongFormatException);
+}
@@ -5,6 +5,23 @@
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "test/storm/parser/SparseModelComparison.h"
+
+namespace {
+
+// Parses the given file sequentially and in parallel (with chunks of the given minimal size) and checks that the resulting models coincide.
+void checkParallelParsing(std::string const& filename, bool buildChoiceLabeling, uint64_t minimalChunkSize = 1ull << 16) {
+    storm::parser::DirectEncodingParserOptions options;
+    options.buildChoiceLabeling = buildChoiceLabeling;
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(filename, options);
+    options.numberOfThreads = 4;
+    options.minimalChunkSize = minimalChunkSize;
+    auto parallelModel = storm::parser::DirectEncodingParser<double>::parseModel(filename, options);
+
+    storm::test::expectEqualSparseModels(*model, *parallelModel);
+}
+
+}  // namespace
 
 TEST(DirectEncodingParserTest, DtmcParsing) {
     std::shared_ptr<storm::models::sparse::Model<double>> modelPtr =
@@ -87,3 +104,17 @@ TEST(DirectEncodingParserTest, MarkovAutomatonParsing) {
     ASSERT_TRUE(modelPtr->hasLabel("one_job_finished"));
     ASSERT_EQ(6ul, modelPtr->getStates("one_job_finished").getNumberOfSetBits());
 }
+
+TEST(DirectEncodingParserTest, ParallelParsing) {
+    checkParallelParsing(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn", true);
+    checkParallelParsing(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn", false);
+    checkParallelParsing(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.drn", false);
+    checkParallelParsing(STORM_TEST_RESOURCES_DIR "/ma/jobscheduler.drn", true);
+}
+
+TEST(DirectEncodingParserTest, ParallelParsingSmallChunks) {
+    // Even the small models are split into as many chunks as the threads allow, so that many chunk boundaries are hit.
+    checkParallelParsing(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn", false, 16);
+    checkParallelParsing(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.drn", false, 16);
+    checkParallelParsing(STORM_TEST_RESOURCES_DIR "/ma/jobscheduler.drn", true, 16);
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "test/storm_gtest.h"
+
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace storm {
+namespace test {
+
+/*!
+ * Checks that the two given models coincide in all their components.
+ */
+inline void expectEqualSparseModels(storm::models::sparse::Model<double> const& model, storm::models::sparse::Model<double> const& otherModel) {
+    ASSERT_EQ(model.getType(), otherModel.getType());
+    EXPECT_EQ(model.getTransitionMatrix(), otherModel.getTransitionMatrix());
+    EXPECT_EQ(model.getStateLabeling(), otherModel.getStateLabeling());
+    ASSERT_EQ(model.hasChoiceLabeling(), otherModel.hasChoiceLabeling());
+    if (model.hasChoiceLabeling()) {
+        EXPECT_EQ(model.getChoiceLabeling(), otherModel.getChoiceLabeling());
+    }
+    ASSERT_EQ(model.getNumberOfRewardModels(), otherModel.getNumberOfRewardModels());
+    for (auto const& rewardModel : model.getRewardModels()) {
+        ASSERT_TRUE(otherModel.hasRewardModel(rewardModel.first));
+        auto const& otherRewardModel = otherModel.getRewardModel(rewardModel.first);
+        ASSERT_EQ(rewardModel.second.hasStateRewards(), otherRewardModel.hasStateRewards());
+        ASSERT_EQ(rewardModel.second.hasStateActionRewards(), otherRewardModel.hasStateActionRewards());
+        ASSERT_EQ(rewardModel.second.hasTransitionRewards(), otherRewardModel.hasTransitionRewards());
+        if (rewardModel.second.hasStateRewards()) {
+            EXPECT_EQ(rewardModel.second.getStateRewardVector(), otherRewardModel.getStateRewardVector());
+        }
+        if (rewardModel.second.hasStateActionRewards()) {
+            EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), otherRewardModel.getStateActionRewardVector());
+        }
+    }
+    if (model.isOfType(storm::models::ModelType::Ctmc)) {
+        EXPECT_EQ(model.as<storm::models::sparse::Ctmc<double>>()->getExitRateVector(),
+                  otherModel.as<storm::models::sparse::Ctmc<double>>()->getExitRateVector());
+    } else if (model.isOfType(storm::models::ModelType::MarkovAutomaton)) {
+        auto ma = model.as<storm::models::sparse::MarkovAutomaton<double>>();
+        auto otherMa = otherModel.as<storm::models::sparse::MarkovAutomaton<double>>();
+        EXPECT_EQ(ma->getExitRates(), otherMa->getExitRates());
+        EXPECT_EQ(ma->getMarkovianStates(), otherMa->getMarkovianStates());
+    }
+}
+
+}  // namespace test
+}  // namespace storm
@@ -8,6 +8,8 @@
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
 #include "storm/solver/SolverSelectionOptions.h"
+#include "storm/solver/helper/ValueIterationHelper.h"
+#include "storm/solver/helper/ValueIterationOperator.h"
 #include "storm/storage/SparseMatrix.h"
 
 namespace {
@@ -188,4 +190,97 @@ TYPED_TEST(MinMaxLinearEquationSolverTest, SolveEquations) {
     ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Maximize, x, b));
     EXPECT_NEAR(x[0], this->parseNumber("0.99"), this->precision());
 }
+
+TEST(MinMaxLinearEquationSolverTest, TopologicalConcurrentSccs) {
+    // Layers of independent two-state SCCs, where each layer only leads to the next one.
+    uint64_t const numberOfLayers = 20;
+    uint64_t const sccsPerLayer = 50;
+    uint64_t const numberOfStates = numberOfLayers * sccsPerLayer * 2;
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    std::vector<double> b;
+    uint64_t row = 0;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        uint64_t layer = state / (2 * sccsPerLayer);
+        uint64_t partner = state ^ 1;
+        builder.newRowGroup(row);
+        builder.addNextValue(row, partner, 0.5);
+        if (layer + 1 < numberOfLayers) {
+            builder.addNextValue(row, (state + 2 * sccsPerLayer + 2) % numberOfStates, 0.25);
+        }
+        b.push_back(0.1 * (state % 7));
+        ++row;
+        builder.addNextValue(row, partner, 0.3);
+        if (layer + 1 < numberOfLayers) {
+            builder.addNextValue(row, state + 2 * sccsPerLayer, 0.6);
+        }
+        b.push_back(0.05);
+        ++row;
+    }
+    storm::storage::SparseMatrix<double> A = builder.build();
+
+    auto solve = [&](uint64_t numberOfThreads, storm::OptimizationDirection dir, std::vector<uint64_t>& choices) {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Topological);
+        env.solver().topological().setUnderlyingMinMaxMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().topological().setNumberOfThreads(numberOfThreads);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(0.0, 10.0);
+        solver->setTrackScheduler(true);
+        std::vector<double> x(numberOfStates);
+        EXPECT_TRUE(solver->solveEquations(env, dir, x, b));
+        choices = solver->getSchedulerChoices();
+        return x;
+    };
+
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<uint64_t> sequentialChoices, concurrentChoices;
+        std::vector<double> sequentialResult = solve(1, dir, sequentialChoices);
+        std::vector<double> concurrentResult = solve(4, dir, concurrentChoices);
+        EXPECT_EQ(sequentialResult, concurrentResult);
+        EXPECT_EQ(sequentialChoices, concurrentChoices);
+    }
+}
+
+TEST(MinMaxLinearEquationSolverTest, MultiObjectiveValueIteration) {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 0, 0.4);
+    builder.addNextValue(0, 1, 0.4);
+    builder.addNextValue(1, 1, 0.5);
+    builder.addNextValue(1, 2, 0.3);
+    builder.newRowGroup(2);
+    builder.addNextValue(2, 0, 0.2);
+    builder.addNextValue(2, 2, 0.7);
+    builder.newRowGroup(3);
+    builder.addNextValue(3, 0, 0.6);
+    builder.addNextValue(4, 1, 0.1);
+    builder.addNextValue(4, 2, 0.8);
+    storm::storage::SparseMatrix<double> A = builder.build();
+
+    // Seven objectives such that batches of different sizes are used
+    std::vector<std::vector<double>> offsets;
+    for (uint64_t objective = 0; objective < 7; ++objective) {
+        offsets.push_back({0.1 * objective, 0.5, 1.0 - 0.1 * objective, 0.3 * (objective % 3), 0.2});
+    }
+
+    auto viOperator = std::make_shared<storm::solver::helper::ValueIterationOperator<double, false>>();
+    viOperator->setMatrixBackwards(A);
+    storm::solver::helper::ValueIterationHelper<double, false> viHelper(viOperator);
+    double const precision = 1e-10;
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<std::vector<double>> results(offsets.size(), std::vector<double>(A.getRowGroupCount(), 0.0));
+        uint64_t numIterations = 0;
+        EXPECT_EQ(storm::solver::SolverStatus::Converged, viHelper.VI(results, offsets, numIterations, false, precision, dir));
+        for (uint64_t objective = 0; objective < offsets.size(); ++objective) {
+            std::vector<double> x(A.getRowGroupCount(), 0.0);
+            EXPECT_EQ(storm::solver::SolverStatus::Converged, viHelper.VI(x, offsets[objective], false, precision, dir));
+            for (uint64_t state = 0; state < x.size(); ++state) {
+                EXPECT_NEAR(x[state], results[objective][state], 1e-8);
+            }
+        }
+    }
+}
 }  // namespace
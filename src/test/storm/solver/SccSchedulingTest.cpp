@@ -0,0 +1,50 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <mutex>
+#include <vector>
+
+#include "storm/solver/helper/SccScheduling.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+
+TEST(SccSchedulingTest, DependenciesAreProcessedFirst) {
+    // A binary tree in which every state leads to its parent. Hence, each state is a trivial SCC that depends on the SCC of its parent.
+    // In addition, every fourth state leads to its left sibling, such that SCCs of the same depth depend on each other.
+    uint64_t const numberOfStates = 2000;
+    storm::storage::SparseMatrixBuilder<double> builder(numberOfStates, numberOfStates);
+    builder.addNextValue(0, 0, 1.0);
+    for (uint64_t state = 1; state < numberOfStates; ++state) {
+        uint64_t const parent = (state - 1) / 2;
+        if (state % 4 == 0) {
+            builder.addNextValue(state, parent, 0.5);
+            builder.addNextValue(state, state - 1, 0.5);
+        } else {
+            builder.addNextValue(state, parent, 1.0);
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix = builder.build();
+    storm::storage::StronglyConnectedComponentDecomposition<double> sccs(matrix);
+    ASSERT_EQ(numberOfStates, sccs.size());
+
+    std::mutex mutex;
+    std::vector<uint64_t> positionOfState(numberOfStates, numberOfStates);
+    uint64_t nextPosition = 0;
+    uint64_t numberOfProcessedSccs = storm::solver::helper::processSccsConcurrently(
+        matrix, sccs,
+        [&](uint64_t sccIndex) {
+            std::lock_guard<std::mutex> lock(mutex);
+            uint64_t const state = *sccs[sccIndex].begin();
+            EXPECT_EQ(numberOfStates, positionOfState[state]);
+            positionOfState[state] = nextPosition++;
+        },
+        4);
+    EXPECT_EQ(numberOfStates, numberOfProcessedSccs);
+
+    for (uint64_t state = 1; state < numberOfStates; ++state) {
+        EXPECT_LT(positionOfState[(state - 1) / 2], positionOfState[state]);
+        if (state % 4 == 0) {
+            EXPECT_LT(positionOfState[state - 1], positionOfState[state]);
+        }
+    }
+}
@@ -0,0 +1,157 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <algorithm>
+
+#include "storm/solver/helper/ValueIterationOperator.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+
+// Records the result of each row and maximizes over the rows of a group.
+class RowResultBackend {
+   public:
+    RowResultBackend(uint64_t numberOfRows) : rowResults(numberOfRows, -1.0) {}
+
+    void startNewIteration() {
+        std::fill(rowResults.begin(), rowResults.end(), -1.0);
+    }
+
+    void firstRow(double&& value, uint64_t, uint64_t row) {
+        rowResults[row] = value;
+        best = value;
+    }
+
+    void nextRow(double&& value, uint64_t, uint64_t row) {
+        rowResults[row] = value;
+        best = std::max(best, value);
+    }
+
+    void applyUpdate(double& currValue, uint64_t) {
+        currValue = best;
+    }
+
+    void endOfIteration() const {
+        // intentionally left empty.
+    }
+
+    bool converged() const {
+        return true;
+    }
+
+    bool constexpr abort() const {
+        return false;
+    }
+
+    std::vector<double> rowResults;
+
+   private:
+    double best{0.0};
+};
+
+TEST(ValueIterationOperatorTest, ReadsMatrixWithoutCopy) {
+    // A chain in which each state moves to the next state or back to the first one.
+    uint64_t const numberOfStates = 100;
+    storm::storage::SparseMatrixBuilder<double> builder(numberOfStates, numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        builder.addNextValue(state, 0, 0.5);
+        if (state + 1 < numberOfStates) {
+            builder.addNextValue(state, state + 1, 0.5);
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix = builder.build();
+    std::vector<double> x(numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        x[state] = 0.01 * state;
+    }
+    std::vector<double> offsets(numberOfStates, 0.25);
+    std::vector<double> expected(numberOfStates);
+    matrix.multiplyWithVector(x, expected, &offsets);
+
+    // The operator only refers to the entries of the matrix, so it does not occupy memory for them.
+    storm::solver::helper::ValueIterationOperator<double, true> viOperator;
+    viOperator.setMatrixBackwards(matrix);
+    EXPECT_GT(matrix.getEntryCount() * sizeof(double), viOperator.getSizeInBytes());
+    std::vector<double> result(numberOfStates);
+    RowResultBackend backend(numberOfStates);
+    viOperator.apply(x, result, offsets, backend);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        EXPECT_NEAR(expected[state], result[state], 1e-12);
+    }
+
+    // The operator can also take ownership of the matrix.
+    storm::solver::helper::ValueIterationOperator<double, true> owningViOperator;
+    owningViOperator.setMatrixForwards(storm::storage::SparseMatrix<double>(matrix));
+    std::vector<double> owningResult(numberOfStates);
+    owningViOperator.apply(x, owningResult, offsets, backend);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        EXPECT_NEAR(expected[state], owningResult[state], 1e-12);
+    }
+}
+
+TEST(ValueIterationOperatorTest, LongRows) {
+    // Rows of different lengths such that both the scalar and the vectorized code paths are used.
+    uint64_t const numberOfGroups = 40;
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    uint64_t row = 0;
+    for (uint64_t group = 0; group < numberOfGroups; ++group) {
+        builder.newRowGroup(row);
+        for (uint64_t choice = 0; choice < 3; ++choice, ++row) {
+            uint64_t const rowLength = (group * 3 + choice) % numberOfGroups + 1;
+            for (uint64_t column = 0; column < numberOfGroups; column += numberOfGroups / rowLength) {
+                builder.addNextValue(row, column, 0.01 * ((row + column) % 7 + 1));
+            }
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix = builder.build();
+    std::vector<double> x(numberOfGroups);
+    for (uint64_t group = 0; group < numberOfGroups; ++group) {
+        x[group] = 0.1 * (group % 11);
+    }
+    std::vector<double> offsets(matrix.getRowCount(), 0.5);
+
+    std::vector<double> expected(matrix.getRowCount());
+    for (row = 0; row < matrix.getRowCount(); ++row) {
+        expected[row] = offsets[row];
+        for (auto const& entry : matrix.getRow(row)) {
+            expected[row] += entry.getValue() * x[entry.getColumn()];
+        }
+    }
+
+    for (bool backwards : {true, false}) {
+        storm::solver::helper::ValueIterationOperator<double, false> viOperator;
+        if (backwards) {
+            viOperator.setMatrixBackwards(matrix);
+        } else {
+            viOperator.setMatrixForwards(matrix);
+        }
+        std::vector<double> result(numberOfGroups);
+        RowResultBackend backend(matrix.getRowCount());
+        viOperator.apply(x, result, offsets, backend);
+        for (row = 0; row < matrix.getRowCount(); ++row) {
+            EXPECT_NEAR(expected[row], backend.rowResults[row], 1e-12);
+        }
+
+        // Ignored rows are skipped without being processed.
+        viOperator.setIgnoredRows(true, [](uint64_t, uint64_t localRow) { return localRow == 1; });
+        viOperator.apply(x, result, offsets, backend);
+        for (row = 0; row < matrix.getRowCount(); ++row) {
+            if (row % 3 == 1) {
+                EXPECT_EQ(-1.0, backend.rowResults[row]);
+            } else {
+                EXPECT_NEAR(expected[row], backend.rowResults[row], 1e-12);
+            }
+        }
+        for (uint64_t group = 0; group < numberOfGroups; ++group) {
+            EXPECT_NEAR(std::max(expected[3 * group], expected[3 * group + 2]), result[group], 1e-12);
+        }
+
+        viOperator.unsetIgnoredRows();
+        viOperator.apply(x, result, offsets, backend);
+        for (row = 0; row < matrix.getRowCount(); ++row) {
+            EXPECT_NEAR(expected[row], backend.rowResults[row], 1e-12);
+        }
+    }
+}
+
+}  // namespace
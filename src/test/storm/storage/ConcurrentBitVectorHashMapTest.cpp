@@ -0,0 +1,109 @@
+#include "test/storm_gtest.h"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+TEST(ConcurrentBitVectorHashMapTest, FindOrAdd) {
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(64, 3);
+
+    storm::storage::BitVector first(64);
+    first.set(4);
+    first.set(47);
+    ASSERT_NO_THROW(map.findOrAdd(first, 1));
+
+    storm::storage::BitVector second(64);
+    second.set(8);
+    second.set(18);
+    ASSERT_NO_THROW(map.findOrAdd(second, 2));
+
+    EXPECT_EQ(1ul, map.findOrAdd(first, 3));
+    EXPECT_EQ(2ul, map.findOrAdd(second, 3));
+
+    storm::storage::BitVector third(64);
+    third.set(10);
+    third.set(63);
+    ASSERT_NO_THROW(map.findOrAdd(third, 3));
+
+    storm::storage::BitVector fourth(64);
+    fourth.set(12);
+    fourth.set(14);
+    ASSERT_NO_THROW(map.findOrAdd(fourth, 4));
+
+    storm::storage::BitVector fifth(64);
+    fifth.set(44);
+    fifth.set(55);
+    ASSERT_NO_THROW(map.findOrAdd(fifth, 5));
+
+    storm::storage::BitVector sixth(64);
+    sixth.set(45);
+    sixth.set(55);
+    ASSERT_NO_THROW(map.findOrAdd(sixth, 6));
+
+    EXPECT_EQ(1ul, map.findOrAdd(first, 0));
+    EXPECT_EQ(2ul, map.findOrAdd(second, 0));
+    EXPECT_EQ(3ul, map.findOrAdd(third, 0));
+    EXPECT_EQ(4ul, map.findOrAdd(fourth, 0));
+    EXPECT_EQ(5ul, map.findOrAdd(fifth, 0));
+    EXPECT_EQ(6ul, map.findOrAdd(sixth, 0));
+    EXPECT_EQ(6ul, map.size());
+
+    uint64_t numberOfEntries = 0;
+    for (auto const& entry : map) {
+        EXPECT_EQ(entry.second, map.getValue(entry.first));
+        ++numberOfEntries;
+    }
+    EXPECT_EQ(6ul, numberOfEntries);
+}
+
+TEST(ConcurrentBitVectorHashMapTest, ConcurrentFindOrAdd) {
+    uint64_t const numberOfThreads = 4;
+    uint64_t const numberOfKeys = 20000;
+
+    // Start with a small map to force several resizing steps while the threads insert keys.
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(128, 4);
+    std::atomic<uint64_t> nextValue(0);
+    std::vector<std::vector<uint64_t>> valuesPerThread(numberOfThreads, std::vector<uint64_t>(numberOfKeys));
+
+    std::vector<std::thread> threads;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        threads.emplace_back([&, thread]() {
+            // All threads insert the same keys, but in a different order.
+            for (uint64_t i = 0; i < numberOfKeys; ++i) {
+                uint64_t key = (thread % 2 == 0) ? i : numberOfKeys - 1 - i;
+                storm::storage::BitVector bitVector(128);
+                bitVector.setFromInt(0, 64, key);
+                bitVector.set(64 + key % 64);
+                valuesPerThread[thread][key] = map.findOrAddWithGenerator(bitVector, [&nextValue]() { return nextValue++; }).first;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Every key must have been inserted exactly once and all threads must agree on its value.
+    EXPECT_EQ(numberOfKeys, map.size());
+    EXPECT_EQ(numberOfKeys, nextValue.load());
+    storm::storage::BitVector seenValues(numberOfKeys);
+    for (uint64_t key = 0; key < numberOfKeys; ++key) {
+        for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+            EXPECT_EQ(valuesPerThread[0][key], valuesPerThread[thread][key]);
+        }
+        ASSERT_LT(valuesPerThread[0][key], numberOfKeys);
+        EXPECT_FALSE(seenValues.get(valuesPerThread[0][key]));
+        seenValues.set(valuesPerThread[0][key]);
+    }
+
+    uint64_t numberOfEntries = 0;
+    for (auto const& entry : map) {
+        uint64_t key = entry.first.getAsInt(0, 64);
+        EXPECT_EQ(valuesPerThread[0][key], entry.second);
+        ++numberOfEntries;
+    }
+    EXPECT_EQ(numberOfKeys, numberOfEntries);
+}
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "storm-config.h"
 #include "storm-parsers/parser/AutoParser.h"
 #include "storm-parsers/parser/PrismParser.h"
@@ -141,6 +143,35 @@ TEST(MaximalEndComponentDecomposition, Subsystem) {
     }
 }
 
+TEST(MaximalEndComponentDecomposition, RefineSubsystem) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/tiny1.tra", STORM_TEST_RESOURCES_DIR "/lab/tiny1.lab", "", "");
+
+    std::shared_ptr<storm::models::sparse::MarkovAutomaton<double>> markovAutomaton = abstractModel->as<storm::models::sparse::MarkovAutomaton<double>>();
+    auto const& transitionMatrix = markovAutomaton->getTransitionMatrix();
+    auto const& backwardTransitions = markovAutomaton->getBackwardTransitions();
+
+    storm::storage::MaximalEndComponentDecomposition<double> fullDecomposition(*markovAutomaton);
+    ASSERT_EQ(2ul, fullDecomposition.size());
+
+    storm::storage::BitVector subsystem(markovAutomaton->getNumberOfStates(), true);
+    subsystem.set(7, false);
+
+    storm::storage::MaximalEndComponentDecomposition<double> mecDecomposition;
+    ASSERT_NO_THROW(mecDecomposition =
+                        storm::storage::MaximalEndComponentDecomposition<double>(transitionMatrix, backwardTransitions, subsystem, fullDecomposition));
+
+    // The refinement has to coincide with the decomposition of the subsystem.
+    storm::storage::MaximalEndComponentDecomposition<double> expectedDecomposition(transitionMatrix, backwardTransitions, subsystem);
+    ASSERT_EQ(expectedDecomposition.size(), mecDecomposition.size());
+    ASSERT_EQ(1ul, mecDecomposition.size());
+    EXPECT_TRUE(mecDecomposition[0].getStateSet() == expectedDecomposition[0].getStateSet());
+    EXPECT_TRUE(mecDecomposition[0].containsState(3));
+    for (auto const& stateChoicesPair : mecDecomposition[0]) {
+        EXPECT_TRUE(stateChoicesPair.second == expectedDecomposition[0].getChoicesForState(stateChoicesPair.first));
+    }
+}
+
 TEST(MaximalEndComponentDecomposition, Example1) {
     std::string prismModelPath = STORM_TEST_RESOURCES_DIR "/mdp/prism-mec-example1.nm";
     storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(prismModelPath);
@@ -179,3 +210,45 @@ TEST(MaximalEndComponentDecomposition, Example2) {
     EXPECT_TRUE((mecDecomposition[1].getChoicesForState(0) == storm::storage::MaximalEndComponent::set_type{0, 1}));
     EXPECT_TRUE((mecDecomposition[1].getChoicesForState(1) == storm::storage::MaximalEndComponent::set_type{3}));
 }
+
+TEST(MaximalEndComponentDecomposition, MultipleThreads) {
+    // Each block of states forms a cycle via the first choice.
+    // The second choice may leave the block towards the next one (or the sink).
+    uint64_t const blockSize = 100;
+    uint64_t const numberOfBlocks = 150;
+    uint64_t const sink = blockSize * numberOfBlocks;
+    storm::storage::SparseMatrixBuilder<double> builder(2 * sink + 1, sink + 1, 0, true, true, sink + 1);
+    for (uint64_t state = 0; state < sink; ++state) {
+        uint64_t const blockStart = state - state % blockSize;
+        builder.newRowGroup(2 * state);
+        builder.addNextValue(2 * state, blockStart + (state + 1) % blockSize, 1.0);
+        builder.addNextValue(2 * state + 1, state, 0.5);
+        builder.addNextValue(2 * state + 1, blockStart + blockSize, 0.5);
+    }
+    builder.newRowGroup(2 * sink);
+    builder.addNextValue(2 * sink, sink, 1.0);
+    storm::storage::SparseMatrix<double> transitionMatrix = builder.build();
+    storm::storage::SparseMatrix<double> backwardTransitions = transitionMatrix.transpose(true);
+
+    storm::storage::MaximalEndComponentDecomposition<double> sequentialDecomposition(transitionMatrix, backwardTransitions);
+    storm::storage::MaximalEndComponentDecomposition<double> parallelDecomposition(transitionMatrix, backwardTransitions, 4);
+    ASSERT_EQ(numberOfBlocks + 1, sequentialDecomposition.size());
+    ASSERT_EQ(sequentialDecomposition.size(), parallelDecomposition.size());
+
+    auto getMecs = [](storm::storage::MaximalEndComponentDecomposition<double> const& decomposition) {
+        std::vector<std::vector<std::pair<uint64_t, storm::storage::MaximalEndComponent::set_type>>> result;
+        for (auto const& mec : decomposition) {
+            result.emplace_back(mec.begin(), mec.end());
+            std::sort(result.back().begin(), result.back().end());
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    };
+    auto mecs = getMecs(sequentialDecomposition);
+    EXPECT_EQ(mecs, getMecs(parallelDecomposition));
+    for (auto const& mec : mecs) {
+        for (auto const& stateChoices : mec) {
+            EXPECT_EQ(storm::storage::MaximalEndComponent::set_type{2 * stateChoices.first}, stateChoices.second);
+        }
+    }
+}
@@ -933,4 +933,63 @@ TEST(SparseMatrix, DropZeroEntries) {
 
     ASSERT_TRUE(matrixX == matrix4);
     ASSERT_FALSE(matrixX.getEntryCount() == matrix4.getEntryCount());
-}
\ No newline at end of file
+}
+
+TEST(SparseMatrix, MultiplicationWithLongRows) {
+    // Rows of different lengths such that both the scalar and the vectorized code paths are used.
+    uint64_t const numberOfColumns = 50;
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, 0, 0, false, true);
+    uint64_t row = 0;
+    for (uint64_t group = 0; group < 10; ++group) {
+        matrixBuilder.newRowGroup(row);
+        for (uint64_t choice = 0; choice < 3; ++choice, ++row) {
+            uint64_t const rowLength = (group * 3 + choice) % numberOfColumns + 1;
+            for (uint64_t column = 0; column < numberOfColumns; column += numberOfColumns / rowLength) {
+                matrixBuilder.addNextValue(row, column, 0.01 * ((row + column) % 7 + 1));
+            }
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+    std::vector<double> x(numberOfColumns);
+    for (uint64_t column = 0; column < numberOfColumns; ++column) {
+        x[column] = 0.1 * (column % 11);
+    }
+    std::vector<double> summand(matrix.getRowCount(), 0.5);
+
+    std::vector<double> expected(matrix.getRowCount());
+    for (row = 0; row < matrix.getRowCount(); ++row) {
+        expected[row] = summand[row];
+        for (auto const& entry : matrix.getRow(row)) {
+            expected[row] += entry.getValue() * x[entry.getColumn()];
+        }
+    }
+
+    std::vector<double> result(matrix.getRowCount());
+    matrix.multiplyWithVectorForward(x, result, &summand);
+    for (row = 0; row < matrix.getRowCount(); ++row) {
+        EXPECT_NEAR(expected[row], result[row], 1e-12);
+    }
+    matrix.multiplyWithVectorBackward(x, result, &summand);
+    for (row = 0; row < matrix.getRowCount(); ++row) {
+        EXPECT_NEAR(expected[row], result[row], 1e-12);
+    }
+
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<double> expectedReduced(matrix.getRowGroupCount());
+        for (uint64_t group = 0; group < matrix.getRowGroupCount(); ++group) {
+            auto first = expected.begin() + matrix.getRowGroupIndices()[group];
+            auto last = expected.begin() + matrix.getRowGroupIndices()[group + 1];
+            expectedReduced[group] = storm::solver::minimize(dir) ? *std::min_element(first, last) : *std::max_element(first, last);
+        }
+        std::vector<double> reducedResult(matrix.getRowGroupCount());
+        matrix.multiplyAndReduceForward(dir, matrix.getRowGroupIndices(), x, &summand, reducedResult, nullptr);
+        for (uint64_t group = 0; group < matrix.getRowGroupCount(); ++group) {
+            EXPECT_NEAR(expectedReduced[group], reducedResult[group], 1e-12);
+        }
+        matrix.multiplyAndReduceBackward(dir, matrix.getRowGroupIndices(), x, &summand, reducedResult, nullptr);
+        for (uint64_t group = 0; group < matrix.getRowGroupCount(); ++group) {
+            EXPECT_NEAR(expectedReduced[group], reducedResult[group], 1e-12);
+        }
+    }
+}
@@ -6,6 +6,9 @@
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 #include "test/storm_gtest.h"
 
+#include <algorithm>
+#include <map>
+
 TEST(StronglyConnectedComponentDecomposition, SmallSystemFromMatrix) {
     storm::storage::SparseMatrixBuilder<double> matrixBuilder(6, 6);
     ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 0, 0.3));
@@ -90,3 +93,79 @@ TEST(StronglyConnectedComponentDecomposition, FullSystem2) {
 
     markovAutomaton = nullptr;
 }
+
+TEST(StronglyConnectedComponentDecomposition, ParallelDecomposition) {
+    // Build a system with many SCCs of different sizes that are connected by a few transitions.
+    uint64_t const numberOfStates = 20000;
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, numberOfStates, 0, false, true, numberOfStates);
+    uint64_t random = 42;
+    auto nextRandom = [&random](uint64_t bound) {
+        random = random * 6364136223846793005ull + 1442695040888963407ull;
+        return (random >> 33) % bound;
+    };
+    uint64_t row = 0;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        matrixBuilder.newRowGroup(row);
+        for (uint64_t choice = 0; choice < 2; ++choice, ++row) {
+            uint64_t blockBegin = state - state % 50;
+            std::vector<uint64_t> successors = {blockBegin + nextRandom(50), std::min(numberOfStates - 1, state + nextRandom(3))};
+            if (nextRandom(20) == 0) {
+                successors.push_back(nextRandom(numberOfStates));
+            }
+            std::sort(successors.begin(), successors.end());
+            successors.erase(std::unique(successors.begin(), successors.end()), successors.end());
+            for (auto const& successor : successors) {
+                matrixBuilder.addNextValue(row, successor, 1.0 / successors.size());
+            }
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+    storm::storage::BitVector subsystem(numberOfStates, true);
+    for (uint64_t state = 0; state < numberOfStates; state += 7) {
+        subsystem.set(state, false);
+    }
+
+    for (bool useSubsystem : {false, true}) {
+        storm::storage::StronglyConnectedComponentDecompositionOptions options;
+        options.computeSccDepths();
+        if (useSubsystem) {
+            options.subsystem(&subsystem);
+        }
+        storm::storage::StronglyConnectedComponentDecomposition<double> sequentialDecomposition(matrix, options);
+        options.useThreads(4);
+        storm::storage::StronglyConnectedComponentDecomposition<double> parallelDecomposition(matrix, options);
+
+        // The SCCs and their depths coincide, but the SCCs might be ordered differently.
+        ASSERT_EQ(sequentialDecomposition.size(), parallelDecomposition.size());
+        std::map<storm::storage::StronglyConnectedComponent::container_type, std::pair<uint64_t, bool>> sequentialSccs;
+        for (uint64_t sccIndex = 0; sccIndex < sequentialDecomposition.size(); ++sccIndex) {
+            auto const& scc = sequentialDecomposition[sccIndex];
+            sequentialSccs.emplace(scc.getStates(), std::make_pair(sequentialDecomposition.getSccDepth(sccIndex), scc.isTrivial()));
+        }
+        for (uint64_t sccIndex = 0; sccIndex < parallelDecomposition.size(); ++sccIndex) {
+            auto const& scc = parallelDecomposition[sccIndex];
+            auto sequentialSccIt = sequentialSccs.find(scc.getStates());
+            ASSERT_TRUE(sequentialSccIt != sequentialSccs.end());
+            EXPECT_EQ(sequentialSccIt->second.first, parallelDecomposition.getSccDepth(sccIndex));
+            EXPECT_EQ(sequentialSccIt->second.second, scc.isTrivial());
+        }
+
+        // SCCs are sorted such that successor SCCs come first.
+        std::vector<uint64_t> stateToScc(numberOfStates);
+        for (uint64_t sccIndex = 0; sccIndex < parallelDecomposition.size(); ++sccIndex) {
+            for (auto const& state : parallelDecomposition[sccIndex]) {
+                stateToScc[state] = sccIndex;
+            }
+        }
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            if (useSubsystem && !subsystem.get(state)) {
+                continue;
+            }
+            for (auto const& entry : matrix.getRowGroup(state)) {
+                if (!useSubsystem || subsystem.get(entry.getColumn())) {
+                    EXPECT_LE(stateToScc[entry.getColumn()], stateToScc[state]);
+                }
+            }
+        }
+    }
+}
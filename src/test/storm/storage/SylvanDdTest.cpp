@@ -830,6 +830,35 @@ TEST(SylvanDd, AddOddTest) {
     EXPECT_EQ(106ul, matrix.getNonzeroEntryCount());
 }
 
+TEST(SylvanDd, AddParallelToMatrixTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> a = manager->addMetaVariable("a");
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 10000);
+
+    // Create a matrix with enough rows to be converted concurrently: a diagonal plus a column of ones.
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> dd =
+        manager->template getIdentity<double>(x.first).equals(manager->template getIdentity<double>(x.second)).template toAdd<double>() *
+        manager->template getIdentity<double>(x.first);
+    dd += manager->getEncoding(x.second, 1).template toAdd<double>() * manager->getRange(x.first).template toAdd<double>();
+
+    storm::dd::Odd rowOdd = manager->getRange(x.first).createOdd();
+    storm::dd::Odd columnOdd = manager->getRange(x.second).createOdd();
+
+    storm::storage::SparseMatrix<double> sequentialMatrix = dd.toMatrix({x.first}, {x.second}, rowOdd, columnOdd, 1);
+    storm::storage::SparseMatrix<double> parallelMatrix = dd.toMatrix({x.first}, {x.second}, rowOdd, columnOdd, 4);
+    EXPECT_EQ(10000ul, parallelMatrix.getRowCount());
+    EXPECT_EQ(19999ul, parallelMatrix.getEntryCount());
+    EXPECT_EQ(sequentialMatrix, parallelMatrix);
+
+    // Also check a matrix with row groups.
+    dd = manager->getEncoding(a.first, 0).ite(dd, dd * manager->template getConstant<double>(2));
+    sequentialMatrix = dd.toMatrix({a.first}, rowOdd, columnOdd, 1);
+    parallelMatrix = dd.toMatrix({a.first}, rowOdd, columnOdd, 4);
+    EXPECT_EQ(20000ul, parallelMatrix.getRowCount());
+    EXPECT_EQ(10000ul, parallelMatrix.getRowGroupCount());
+    EXPECT_EQ(sequentialMatrix, parallelMatrix);
+}
+
 TEST(SylvanDd, AddSharpenTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);